@@ -9,12 +9,14 @@
 #include "EnvironmentAndFrames.hpp"
 #include "Observer.hpp"
 #include "xdyn/exceptions/NumericalErrorException.hpp"
+#include <boost/algorithm/string/case_conv.hpp>
 
 Body::Body(const size_t i, const BlockedDOF& blocked_states_, const YamlFilteredStates& filtered_states)
     : states(filtered_states)
     , idx(i)
     , blocked_states(blocked_states_)
     , states_filter(filtered_states)
+    , addresses()
 {
 }
 
@@ -23,6 +25,7 @@ Body::Body(const BodyStates& s, const size_t i, const BlockedDOF& blocked_states
     , idx(i)
     , blocked_states(blocked_states_)
     , states_filter(filtered_states)
+    , addresses()
 {
 }
 
@@ -31,6 +34,7 @@ Body::Body(const size_t i, const BlockedDOF& blocked_states_, const StatesFilter
     , idx(i)
     , blocked_states(blocked_states_)
     , states_filter(states_filter_)
+    , addresses()
 {}
 
 Body::Body(const BodyStates& states_, const size_t i, const BlockedDOF& blocked_states_, const StatesFilter& states_filter_)
@@ -38,6 +42,7 @@ Body::Body(const BodyStates& states_, const size_t i, const BlockedDOF& blocked_
     , idx(i)
     , blocked_states(blocked_states_)
     , states_filter(states_filter_)
+    , addresses()
 {}
 
 
@@ -45,7 +50,7 @@ Body::~Body()
 {
 }
 
-BodyStates Body::get_states() const
+const BodyStates& Body::get_states() const
 {
     return states;
 }
@@ -112,21 +117,46 @@ void Body::update_body_states(StateType x, const double t)
     states.qk.record(t, *_QK(x,idx));
 }
 
+void Body::set_stage_states(StateType x, const double t)
+{
+    blocked_states.force_states(x,t);
+    states.x.record_tentatively(t, *_X(x,idx));
+    states.y.record_tentatively(t, *_Y(x,idx));
+    states.z.record_tentatively(t, *_Z(x,idx));
+    states.u.record_tentatively(t, *_U(x,idx));
+    states.v.record_tentatively(t, *_V(x,idx));
+    states.w.record_tentatively(t, *_W(x,idx));
+    states.p.record_tentatively(t, *_P(x,idx));
+    states.q.record_tentatively(t, *_Q(x,idx));
+    states.r.record_tentatively(t, *_R(x,idx));
+    states.qr.record_tentatively(t, *_QR(x,idx));
+    states.qi.record_tentatively(t, *_QI(x,idx));
+    states.qj.record_tentatively(t, *_QJ(x,idx));
+    states.qk.record_tentatively(t, *_QK(x,idx));
+}
+
 void Body::force_states(StateType& x, const double t) const
 {
     blocked_states.force_states(x,t);
 }
 
 void Body::update_projection_of_z_in_mesh_frame(const double g,
-                                                const ssc::kinematics::KinematicsPtr& k)
+                                                const EnvironmentAndFrames& env)
+{
+    const ssc::kinematics::RotationMatrix ned2mesh = env.frames->is_up_to_date(states.ned_to_mesh)
+                                                   ? env.frames->get(states.ned_to_mesh).get_rot()
+                                                   : env.k->get("NED", std::string("mesh(") + states.name + ")").get_rot();
+    states.g_in_mesh_frame = ned2mesh*Eigen::Vector3d(0, 0, g);
+}
+
+void Body::register_frames(FrameGraph& frames)
 {
-    const ssc::kinematics::Point g_in_NED("NED", 0, 0, g);
-    const ssc::kinematics::RotationMatrix ned2mesh = k->get("NED", std::string("mesh(") + states.name + ")").get_rot();
-    states.g_in_mesh_frame = ned2mesh*g_in_NED.v;
+    states.ned_to_body = frames.get_handle("NED", states.name);
+    states.ned_to_mesh = frames.get_handle("NED", std::string("mesh(") + states.name + ")");
 }
 
 #define CHECK(x,y,t) if (std::isnan(x)) {THROW(__PRETTY_FUNCTION__,NumericalErrorException,"NaN detected in state " << y << ", at t = " << t);}
-void Body::update(const EnvironmentAndFrames& env, const StateType& x, const double t)
+void Body::check_states_and_update_kinematics(const StateType& x, const ssc::kinematics::KinematicsPtr& k, const double t)
 {
     CHECK(*_X(x,idx),"X",t);
     CHECK(*_Y(x,idx),"Y",t);
@@ -141,10 +171,21 @@ void Body::update(const EnvironmentAndFrames& env, const StateType& x, const dou
     CHECK(*_QI(x,idx),"QI",t);
     CHECK(*_QJ(x,idx),"QJ",t);
     CHECK(*_QK(x,idx),"QK",t);
-    update_kinematics(x,env.k);
-    update_body_states(x, t);
+    update_kinematics(x,k);
+}
+
+void Body::update_states_and_intersection(const EnvironmentAndFrames& env, const StateType& x, const double t, const bool states_were_accepted)
+{
+    if (states_were_accepted) update_body_states(x, t);
+    else                      set_stage_states(x, t);
     update_intersection_with_free_surface(env, t);
-    update_projection_of_z_in_mesh_frame(env.g, env.k);
+    update_projection_of_z_in_mesh_frame(env.g, env);
+}
+
+void Body::update(const EnvironmentAndFrames& env, const StateType& x, const double t)
+{
+    check_states_and_update_kinematics(x, env.k, t);
+    update_states_and_intersection(env, x, t, true);
 }
 
 void Body::set_history(const EnvironmentAndFrames& env, const State& states)
@@ -155,7 +196,33 @@ void Body::set_history(const EnvironmentAndFrames& env, const State& states)
         update_kinematics(states.get_StateType(states.x.size()-1), env.k);
         update_intersection_with_free_surface(env, states.x.get_current_time());
     }
-    update_projection_of_z_in_mesh_frame(env.g, env.k);
+    update_projection_of_z_in_mesh_frame(env.g, env);
+}
+
+void Body::append_to_history(const EnvironmentAndFrames& env, const State& new_states)
+{
+    if (new_states.x.is_empty()) return;
+    if (not(states.x.can_record(new_states.x[0].first)))
+    {
+        set_history(env, new_states);
+        return;
+    }
+    const std::vector<std::pair<History*, const History*> > histories = {{&states.x, &new_states.x}, {&states.y, &new_states.y}, {&states.z, &new_states.z},
+                                                                        {&states.u, &new_states.u}, {&states.v, &new_states.v}, {&states.w, &new_states.w},
+                                                                        {&states.p, &new_states.p}, {&states.q, &new_states.q}, {&states.r, &new_states.r},
+                                                                        {&states.qr, &new_states.qr}, {&states.qi, &new_states.qi},
+                                                                        {&states.qj, &new_states.qj}, {&states.qk, &new_states.qk}};
+    for (const auto& h:histories)
+    {
+        for (int i = 0 ; i < (int)h.second->size() ; ++i)
+        {
+            const std::pair<double,double> t_val = (*h.second)[i];
+            h.first->record(t_val.first, t_val.second);
+        }
+    }
+    update_kinematics(new_states.get_StateType(new_states.x.size()-1), env.k);
+    update_intersection_with_free_surface(env, new_states.x.get_current_time());
+    update_projection_of_z_in_mesh_frame(env.g, env);
 }
 
 void Body::calculate_state_derivatives(const ssc::kinematics::Wrench& sum_of_forces,
@@ -170,7 +237,9 @@ void Body::calculate_state_derivatives(const ssc::kinematics::Wrench& sum_of_for
     dXdt = states.inverse_of_the_total_inertia * (sum_of_forces.to_vector());
 
     // dx/dt, dy/dt, dz/dt
-    const ssc::kinematics::RotationMatrix& R = env.k->get("NED", states.name).get_rot();
+    const ssc::kinematics::RotationMatrix R = env.frames->is_up_to_date(states.ned_to_body)
+                                            ? env.frames->get(states.ned_to_body).get_rot()
+                                            : env.k->get("NED", states.name).get_rot();
     const Eigen::Map<const Eigen::Vector3d> uvw(_U(x,idx));
     const Eigen::Vector3d XpYpZp(R*uvw);
     
@@ -211,39 +280,46 @@ BlockedDOF::Vector Body::get_delta_F(const StateType& dx_dt, const ssc::kinemati
     return blocked_states.get_delta_F(dx_dt,states.total_inertia,sum_of_other_forces);
 }
 
+std::vector<DataAddressing> addresses_of_states(const std::string& body_name);
+std::vector<DataAddressing> addresses_of_states(const std::string& body_name)
+{
+    std::vector<DataAddressing> ret;
+    for (const std::string state:{"X", "Y", "Z", "U", "V", "W", "P", "Q", "R"})
+    {
+        ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,state},boost::algorithm::to_lower_copy(state)+"("+body_name+")"));
+    }
+    for (const std::string state:{"Qr", "Qi", "Qj", "Qk"})
+    {
+        ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Quat",state},boost::algorithm::to_lower_copy(state)+"("+body_name+")"));
+    }
+    for (const std::string state:{"PHI", "THETA", "PSI"})
+    {
+        ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,state},boost::algorithm::to_lower_copy(state)+"("+body_name+")"));
+    }
+    for (const std::string state:{"X", "Y", "Z", "U", "V", "W", "P", "Q", "R", "PHI", "THETA", "PSI"})
+    {
+        ret.push_back(DataAddressing(std::vector<std::string>{"filtered_states",body_name,state},boost::algorithm::to_lower_copy(state)+"_filtered("+body_name+")"));
+    }
+    return ret;
+}
+
 void Body::feed(const StateType& x, Observer& observer, const YamlRotation& c) const
 {
-    observer.write_after_solver_step(*_X(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"X"},std::string("x(")+states.name+")"));
-    observer.write_after_solver_step(*_Y(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Y"},std::string("y(")+states.name+")"));
-    observer.write_after_solver_step(*_Z(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Z"},std::string("z(")+states.name+")"));
-    observer.write_after_solver_step(*_U(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"U"},std::string("u(")+states.name+")"));
-    observer.write_after_solver_step(*_V(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"V"},std::string("v(")+states.name+")"));
-    observer.write_after_solver_step(*_W(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"W"},std::string("w(")+states.name+")"));
-    observer.write_after_solver_step(*_P(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"P"},std::string("p(")+states.name+")"));
-    observer.write_after_solver_step(*_Q(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Q"},std::string("q(")+states.name+")"));
-    observer.write_after_solver_step(*_R(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"R"},std::string("r(")+states.name+")"));
-    observer.write_after_solver_step(*_QR(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qr"},std::string("qr(")+states.name+")"));
-    observer.write_after_solver_step(*_QI(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qi"},std::string("qi(")+states.name+")"));
-    observer.write_after_solver_step(*_QJ(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qj"},std::string("qj(")+states.name+")"));
-    observer.write_after_solver_step(*_QK(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qk"},std::string("qk(")+states.name+")"));
+    if (addresses.empty())
+    {
+        addresses = addresses_of_states(states.name);
+    }
     const auto angles = get_angles(x, c);
-    observer.write_after_solver_step(angles.phi, DataAddressing(std::vector<std::string>{"states",states.name,"PHI"},std::string("phi(")+states.name+")"));
-    observer.write_after_solver_step(angles.theta, DataAddressing(std::vector<std::string>{"states",states.name,"THETA"},std::string("theta(")+states.name+")"));
-    observer.write_after_solver_step(angles.psi, DataAddressing(std::vector<std::string>{"states",states.name,"PSI"},std::string("psi(")+states.name+")"));
-
     const auto filtered_states = get_filtered_states(states, x);
-    observer.write_after_solver_step(filtered_states.x, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"X"},std::string("x_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.y, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"Y"},std::string("y_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.z, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"Z"},std::string("z_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.u, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"U"},std::string("u_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.v, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"V"},std::string("v_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.w, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"W"},std::string("w_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.p, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"P"},std::string("p_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.q, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"Q"},std::string("q_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.r, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"R"},std::string("r_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.phi, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"PHI"},std::string("phi_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.theta, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"THETA"},std::string("theta_filtered(")+states.name+")"));
-    observer.write_after_solver_step(filtered_states.psi, DataAddressing(std::vector<std::string>{"filtered_states",states.name,"PSI"},std::string("psi_filtered(")+states.name+")"));
+    const double values[28] = {*_X(x,idx), *_Y(x,idx), *_Z(x,idx), *_U(x,idx), *_V(x,idx), *_W(x,idx), *_P(x,idx), *_Q(x,idx), *_R(x,idx),
+                               *_QR(x,idx), *_QI(x,idx), *_QJ(x,idx), *_QK(x,idx),
+                               angles.phi, angles.theta, angles.psi,
+                               filtered_states.x, filtered_states.y, filtered_states.z, filtered_states.u, filtered_states.v, filtered_states.w,
+                               filtered_states.p, filtered_states.q, filtered_states.r, filtered_states.phi, filtered_states.theta, filtered_states.psi};
+    for (size_t i = 0 ; i < 28 ; ++i)
+    {
+        observer.write_after_solver_step(values[i], addresses[i]);
+    }
 }
 
 std::string Body::get_name() const
@@ -10,6 +10,8 @@
 
 #include "BlockedDOF.hpp"
 #include "BodyStates.hpp"
+#include "FrameGraph.hpp"
+#include "Observer.hpp"
 #include "StatesFilter.hpp"
 #include "StateMacros.hpp"
 #include "State.hpp"
@@ -22,8 +24,6 @@ struct YamlBody;
 struct YamlRotation;
 struct EnvironmentAndFrames;
 
-class Observer;
-
 class Body
 {
     public:
@@ -33,7 +33,7 @@ class Body
         Body(const size_t idx, const BlockedDOF& blocked_states, const StatesFilter& states_filter);
         Body(const BodyStates& states, const size_t idx, const BlockedDOF& blocked_states, const StatesFilter& states_filter);
 
-        BodyStates get_states() const;
+        const BodyStates& get_states() const;
 
         /** \brief Use SurfaceElevation to compute wave height & update accordingly
          */
@@ -51,9 +51,36 @@ class Body
         /**  \brief Update Body structure taking the new coordinates & wave heights into account
          */
         void update(const EnvironmentAndFrames& env, const StateType& x, const double t);
+
+        /**  \brief First part of 'update': checks the states & updates the body's transforms in Kinematics
+          *  \details Kinematics is shared by all bodies: this must not be called concurrently for several bodies.
+          */
+        void check_states_and_update_kinematics(const StateType& x, const ssc::kinematics::KinematicsPtr& k, const double t);
+
+        /**  \brief Second part of 'update': sets the states & computes the intersection with the free surface
+          *  \details Only modifies this body, so can be called concurrently for several bodies
+          *           once all their transforms have been updated in Kinematics.
+          */
+        void update_states_and_intersection(const EnvironmentAndFrames& env,
+                                            const StateType& x,
+                                            const double t,
+                                            const bool states_were_accepted //!< If false, the states are not recorded in history (cf. set_stage_states)
+                                            );
         void set_history(const EnvironmentAndFrames& env, const State& states);
+
+        /**  \brief Adds states after the newest point in history (whereas 'set_history' replaces the whole history)
+          *  \details A point at the same instant as the newest point in history replaces it. If 'new_states'
+          *           starts before the newest point in history, it replaces the whole history (like 'set_history').
+          */
+        void append_to_history(const EnvironmentAndFrames& env, const State& new_states);
         void update_kinematics(const StateType& x, const ssc::kinematics::KinematicsPtr& k) const;
         void update_body_states(StateType x, const double t);
+
+        /**  \brief Sets the states at an intermediate stage of a solver step, without recording them in history
+          *  \details The force models see these states (eg. the radiation damping sees them as the newest point
+          *           of the velocity history) until the next call to 'update_body_states' or 'set_stage_states'.
+          */
+        void set_stage_states(StateType x, const double t);
         void force_states(StateType& x, const double t) const;
         StateType block_states_if_necessary(StateType x, const double t) const;
 
@@ -61,7 +88,11 @@ class Body
          */
         void update_projection_of_z_in_mesh_frame(
             const double g,
-            const ssc::kinematics::KinematicsPtr& k);
+            const EnvironmentAndFrames& env);
+
+        /**  \brief Gets the handles of the transforms used at each evaluation of the state derivatives (cf. FrameGraph)
+         */
+        void register_frames(FrameGraph& frames);
 
         void calculate_state_derivatives(
             const ssc::kinematics::Wrench& sum_of_forces,
@@ -92,6 +123,7 @@ class Body
         size_t idx; //!< Index of the first state
         BlockedDOF blocked_states;
         StatesFilter states_filter;
+        mutable std::vector<DataAddressing> addresses; //!< Of the outputs of 'feed', built at the first call (not at each time step)
 };
 
 typedef TR1(shared_ptr)<Body> BodyPtr;
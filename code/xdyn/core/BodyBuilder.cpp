@@ -13,8 +13,7 @@
 #include "xdyn/exceptions/InternalErrorException.hpp"
 #include "xdyn/external_data_structures/YamlBody.hpp"
 #include "xdyn/external_data_structures/YamlRotation.hpp"
-#include "xdyn/hdb_interpolators/HDBParser.hpp"
-#include "xdyn/hdb_interpolators/PrecalParser.hpp"
+#include "xdyn/hdb_interpolators/HydroDBParser.hpp"
 #include "xdyn/mesh/MeshBuilder.hpp"
 
 #include <ssc/kinematics.hpp>
@@ -113,12 +112,12 @@ Eigen::Matrix<double,6,6> build_added_matrix(const std::string& states_name, con
             }
             else
             {
-                Ma = PrecalParser::from_file(added_mass.precal_filename).get_added_mass();
+                Ma = parser_factory("", added_mass.precal_filename)->get_added_mass();
             }
         }
         else
         {
-            Ma = HDBParser::from_file(added_mass.hdb_filename).get_added_mass();
+            Ma = parser_factory(added_mass.hdb_filename, "")->get_added_mass();
         }
     }
     else
@@ -27,6 +27,8 @@ M(),
 intersector(),
 g_in_mesh_frame(),
 hydrodynamic_forces_calculation_point(),
+ned_to_body(),
+ned_to_mesh(),
 convention(),
 states_filter(YamlFilteredStates())
 {
@@ -47,6 +49,8 @@ M(),
 intersector(),
 g_in_mesh_frame(),
 hydrodynamic_forces_calculation_point(),
+ned_to_body(),
+ned_to_mesh(),
 convention(),
 states_filter(filtered_states)
 {
@@ -67,6 +71,8 @@ M(),
 intersector(),
 g_in_mesh_frame(),
 hydrodynamic_forces_calculation_point(),
+ned_to_body(),
+ned_to_mesh(),
 convention(),
 states_filter(states_filter_)
 {
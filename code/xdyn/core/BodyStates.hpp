@@ -8,6 +8,7 @@
 #ifndef BODYSTATES_HPP_
 #define BODYSTATES_HPP_
 
+#include "FrameGraph.hpp"
 #include "StatesFilter.hpp"
 #include "StateMacros.hpp"
 #include "xdyn/external_data_structures/GeometricTypes3d.hpp"
@@ -54,6 +55,8 @@ struct BodyStates : AbstractStates<History>
     MeshIntersectorPtr intersector;                                //!< Allows us to iterate on all emerged or immersed facets
     EPoint g_in_mesh_frame;                                        //!< Unit vertical vector, expressed in the body's mesh frame
     ssc::kinematics::Point hydrodynamic_forces_calculation_point;  //!< Point of expression of hydrodynamic forces (except Froude-Krylov & hydrostatic)
+    FrameHandle ned_to_body;                                       //!< k->get("NED", name), set by Body::register_frames
+    FrameHandle ned_to_mesh;                                       //!< k->get("NED", "mesh(name)"), set by Body::register_frames
 
     ssc::kinematics::EulerAngles get_angles() const;
     ssc::kinematics::EulerAngles get_angles(const YamlRotation& c) const;
@@ -7,6 +7,7 @@
 #include "BodyWithSurfaceForces.hpp"
 #include "EnvironmentAndFrames.hpp"
 #include <ssc/exception_handling.hpp>
+#include <cmath> // std::isfinite
 
 BodyWithSurfaceForces::BodyWithSurfaceForces(const size_t i, const BlockedDOF& blocked_states_, const YamlFilteredStates& filtered_states) : Body(i, blocked_states_, filtered_states)
 {
@@ -26,21 +27,72 @@ BodyWithSurfaceForces::BodyWithSurfaceForces(const BodyStates& s, const size_t i
 }
 
 
+/* Altitude (z in the NED frame) of a point P of the mesh is z_of_origin + z_axis_of_NED_frame.dot(P):
+ * computed by transforming the origin & the axes of the mesh frame (the same way SurfaceElevationInterface transforms the mesh)
+ */
+void get_altitude_in_NED_frame(const ssc::kinematics::Transform& ned_to_mesh, const std::string& mesh_frame, double& z_of_origin, EPoint& z_axis_of_NED_frame);
+void get_altitude_in_NED_frame(const ssc::kinematics::Transform& ned_to_mesh, const std::string& mesh_frame, double& z_of_origin, EPoint& z_axis_of_NED_frame)
+{
+    ssc::kinematics::Matrix3Xd origin_and_axes = ssc::kinematics::Matrix3Xd::Zero(3, 4);
+    origin_and_axes.rightCols(3) = Eigen::Matrix3d::Identity();
+    ssc::kinematics::Transform T = ned_to_mesh;
+    T.swap();
+    const ssc::kinematics::PointMatrix OP = T*ssc::kinematics::PointMatrix(origin_and_axes, mesh_frame);
+    z_of_origin = OP.m(2,0);
+    for (int i = 0 ; i < 3 ; ++i) z_axis_of_NED_frame(i) = OP.m(2,i+1) - z_of_origin;
+}
+
 void BodyWithSurfaceForces::update_intersection_with_free_surface(const EnvironmentAndFrames& env,
                                     const double t)
 {
     if (env.w.use_count())
     {
+        // The wave heights are not stored in env.w because several bodies may be updated concurrently (cf. Sim::dx_dt)
+        std::vector<double> relative_wave_height;
+        std::vector<double> surface_elevation;
+        // If the wave model can bound its elevation, the wave heights are only computed for the vertices
+        // which are not above the highest wave crest (cf. MeshIntersector::select_vertices_to_evaluate)
+        const double highest_crest = env.w->get_elevation_bounds().first;
+        const bool skip_vertices_above_crest = std::isfinite(highest_crest) and (states.M->get_frame() != "NED")
+                                           and ((size_t)states.M->m.cols() == states.intersector->mesh->nb_of_static_nodes);
         try
         {
-            env.w->update_surface_elevation(states.M, env.k,t);
+            if (skip_vertices_above_crest)
+            {
+                double z_of_origin = 0;
+                EPoint z_axis_of_NED_frame;
+                if (env.frames->is_up_to_date(states.ned_to_body) and (states.M->get_frame() == states.name))
+                {
+                    get_altitude_in_NED_frame(env.frames->get(states.ned_to_body), states.M->get_frame(), z_of_origin, z_axis_of_NED_frame);
+                }
+                else
+                {
+                    get_altitude_in_NED_frame(env.k->get("NED", states.M->get_frame()), states.M->get_frame(), z_of_origin, z_axis_of_NED_frame);
+                }
+                const std::vector<size_t>& vertices = states.intersector->select_vertices_to_evaluate(z_of_origin, z_axis_of_NED_frame, highest_crest);
+                const ssc::kinematics::PointMatrixPtr P(new ssc::kinematics::PointMatrix(states.M->get_frame(), vertices.size()));
+                for (size_t i = 0 ; i < vertices.size() ; ++i)
+                {
+                    P->m.col((Eigen::Index)i) = states.M->m.col((Eigen::Index)vertices[i]);
+                }
+                env.w->compute_surface_elevation(P, env.k, t, relative_wave_height, surface_elevation);
+            }
+            else
+            {
+                env.w->compute_surface_elevation(states.M, env.k, t, relative_wave_height, surface_elevation);
+            }
         }
         catch (const ssc::exception_handling::Exception& e)
         {
             THROW(__PRETTY_FUNCTION__, ssc::exception_handling::Exception, "This simulation uses surface force models (eg. Froude-Krylov) which are integrated on the hull. This requires computing the intersection between the hull and the free surface and hence calculating the wave heights. While calculating these wave heights, " << e.get_message());
         }
-        const std::vector<double> dz = env.w->get_relative_wave_height();
-        states.intersector->update_intersection_with_free_surface(env.w->get_relative_wave_height(),
-                                                                  env.w->get_surface_elevation());
+        if (skip_vertices_above_crest)
+        {
+            states.intersector->update_intersection_with_selected_vertices(relative_wave_height, surface_elevation);
+        }
+        else
+        {
+            states.intersector->update_intersection_with_free_surface(relative_wave_height, surface_elevation);
+        }
     }
 }
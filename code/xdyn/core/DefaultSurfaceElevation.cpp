@@ -50,6 +50,11 @@ std::vector<double> DefaultSurfaceElevation::dynamic_pressure(
     return std::vector<double>(x.size(), 0);
 }
 
+std::pair<double,double> DefaultSurfaceElevation::get_elevation_bounds() const
+{
+    return std::make_pair(zwave, zwave);
+}
+
 std::vector<FlatDiscreteDirectionalWaveSpectrum> DefaultSurfaceElevation::get_flat_directional_spectra(const double, const double, const double) const
 {
     return std::vector<FlatDiscreteDirectionalWaveSpectrum>();
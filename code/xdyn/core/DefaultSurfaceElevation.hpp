@@ -32,6 +32,8 @@ class DefaultSurfaceElevation : public SurfaceElevationInterface
           const ssc::kinematics::PointMatrixPtr& output_mesh,
           const std::pair<std::size_t,std::size_t> output_mesh_size = std::make_pair((std::size_t)0,(std::size_t)0));
 
+        std::pair<double,double> get_elevation_bounds() const;
+
     private:
         DefaultSurfaceElevation(); // Disabled
 
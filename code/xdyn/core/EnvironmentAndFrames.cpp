@@ -17,6 +17,7 @@ EnvironmentAndFrames::EnvironmentAndFrames() : w(),
                                                wind(),
                                                UWCurrent(),
                                                k(KinematicsPtr(new Kinematics())),
+                                               frames(FrameGraphPtr(new FrameGraph())),
                                                rho(0),
                                                nu(0),
                                                g(0),
@@ -11,6 +11,7 @@
 #define ENVIRONMENTANDFRAMES_HPP_
 
 #include "xdyn/core/Body.hpp"
+#include "xdyn/core/FrameGraph.hpp"
 #include "xdyn/core/StateMacros.hpp"
 #include "xdyn/core/SurfaceElevationInterface.hpp"
 #include "xdyn/environment_models/WindModel.hpp"
@@ -31,6 +32,7 @@ struct EnvironmentAndFrames
     WindModelPtr wind;
     UWCurrentModelPtr UWCurrent;
     ssc::kinematics::KinematicsPtr k;
+    FrameGraphPtr frames; //!< Transforms needed by the bodies & force models, computed from 'k' once per state update
     double rho;
     double nu;
     double g;
@@ -44,14 +44,26 @@ bool Memoization::is_cached(const double t, const std::vector<double>& states, c
             && equal(current_command_values, commands_used_for_last_evaluation);
 }
 
-Wrench Memoization::run_if_not_cached(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands)
+std::vector<double> values_of(const std::map<std::string,double>& commands);
+std::vector<double> values_of(const std::map<std::string,double>& commands)
 {
-    std::vector<double> current_command_values;
+    std::vector<double> ret;
+    ret.reserve(commands.size());
     for (const auto& kv:commands)
     {
-        current_command_values.push_back(kv.second);
+        ret.push_back(kv.second);
     }
-    if (not(is_cached(t, states.get_current_state_values(0), current_command_values)))
+    return ret;
+}
+
+bool Memoization::is_cached(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const
+{
+    return is_cached(t, states.get_current_state_values(0), values_of(commands));
+}
+
+Wrench Memoization::run_if_not_cached(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands)
+{
+    if (not(is_cached(states, t, commands)))
     {
         cached_force = callback(states, t, env, commands);
     }
@@ -65,8 +77,14 @@ ForceModel::ForceModel(const std::string& name_, const std::vector<std::string>&
     body_name(body_name_),
     has_internal_frame(true),
     known_reference_frame(internal_frame.frame),
+    internal_frame_to_body_frame(env.frames->get_handle(name_, body_name_)),
+    body_frame_to_internal_frame(env.frames->get_handle(body_name_, name_)),
     latest_force_in_body_frame(ssc::kinematics::Point(body_name)),
-    memo(std::bind(&ForceModel::get_force, this, _1, _2, _3, _4))
+    memo(std::bind(&ForceModel::get_force, this, _1, _2, _3, _4)),
+    addresses_in_internal_frame(wrench_addresses(name, body_name, name)),
+    addresses_in_body_frame(wrench_addresses(name, body_name, body_name)),
+    addresses_in_NED_frame(wrench_addresses(name, body_name, "NED")),
+    addresses_of_commands()
 {
     env.k->add(make_transform(internal_frame, name, env.rot));
 }
@@ -77,8 +95,14 @@ ForceModel::ForceModel(const std::string& name_, const std::vector<std::string>&
     body_name(body_name_),
     has_internal_frame(false),
     known_reference_frame(),
+    internal_frame_to_body_frame(),
+    body_frame_to_internal_frame(),
     latest_force_in_body_frame(ssc::kinematics::Point(body_name)),
-    memo(std::bind(&ForceModel::get_force, this, _1, _2, _3, _4))
+    memo(std::bind(&ForceModel::get_force, this, _1, _2, _3, _4)),
+    addresses_in_internal_frame(),
+    addresses_in_body_frame(wrench_addresses(name, body_name, body_name)),
+    addresses_in_NED_frame(wrench_addresses(name, body_name, "NED")),
+    addresses_of_commands()
 {
 }
 
@@ -101,10 +125,22 @@ std::map<std::string,double> ForceModel::get_commands(ssc::data_source::DataSour
 
 ssc::kinematics::Wrench ForceModel::operator()(const BodyStates& states, const double t, const EnvironmentAndFrames& env, ssc::data_source::DataSource& command_listener)
 {
-    const auto com = get_commands(command_listener,t);
-    auto F = memo.run_if_not_cached(states, t, env, com);
-    can_find_internal_frame(env.k);
-    F.change_point_and_frame(states.G, body_name, env.k);
+    return operator()(states, t, env, get_commands(command_listener,t));
+}
+
+ssc::kinematics::Wrench ForceModel::operator()(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands)
+{
+    auto F = memo.run_if_not_cached(states, t, env, commands);
+    if (env.frames->is_up_to_date(internal_frame_to_body_frame) and env.frames->is_up_to_date(body_frame_to_internal_frame) and F.is_expressed_in(name))
+    {
+        // The internal frame exists (FrameGraph::update found it), no need to look it up in Kinematics
+        F.change_point_and_frame(states.G, body_name, env.frames->get(internal_frame_to_body_frame), env.frames->get(body_frame_to_internal_frame));
+    }
+    else
+    {
+        can_find_internal_frame(env.k);
+        F.change_point_and_frame(states.G, body_name, env.k);
+    }
     latest_force_in_body_frame = ssc::kinematics::Wrench(states.G, F.to_vector());
     return latest_force_in_body_frame;
 }
@@ -191,31 +227,30 @@ void ForceModel::feed(Observer& observer, ssc::kinematics::KinematicsPtr& k, ssc
     {
         can_find_internal_frame(k);
         const Wrench tau_in_internal_frame_at_P = tau_in_body_frame_at_G.change_point_and_frame(ssc::kinematics::Point(name,0,0,0), name, k);
-        observer.write_before_solver_step(tau_in_internal_frame_at_P.X(),DataAddressing({"efforts",body_name,name,name,"Fx"},std::string("Fx(")+name+","+body_name+","+name+")"));
-        observer.write_before_solver_step(tau_in_internal_frame_at_P.Y(),DataAddressing({"efforts",body_name,name,name,"Fy"},std::string("Fy(")+name+","+body_name+","+name+")"));
-        observer.write_before_solver_step(tau_in_internal_frame_at_P.Z(),DataAddressing({"efforts",body_name,name,name,"Fz"},std::string("Fz(")+name+","+body_name+","+name+")"));
-        observer.write_before_solver_step(tau_in_internal_frame_at_P.K(),DataAddressing({"efforts",body_name,name,name,"Mx"},std::string("Mx(")+name+","+body_name+","+name+")"));
-        observer.write_before_solver_step(tau_in_internal_frame_at_P.M(),DataAddressing({"efforts",body_name,name,name,"My"},std::string("My(")+name+","+body_name+","+name+")"));
-        observer.write_before_solver_step(tau_in_internal_frame_at_P.N(),DataAddressing({"efforts",body_name,name,name,"Mz"},std::string("Mz(")+name+","+body_name+","+name+")"));
+        const double F[6] = {tau_in_internal_frame_at_P.X(), tau_in_internal_frame_at_P.Y(), tau_in_internal_frame_at_P.Z(),
+                             tau_in_internal_frame_at_P.K(), tau_in_internal_frame_at_P.M(), tau_in_internal_frame_at_P.N()};
+        for (size_t i = 0 ; i < 6 ; ++i) observer.write_before_solver_step(F[i], addresses_in_internal_frame[i]);
     }
 
-    observer.write_before_solver_step(tau_in_body_frame_at_Ob.X(),DataAddressing({"efforts",body_name,name,body_name,"Fx"},std::string("Fx(")+name+","+body_name+","+body_name+")"));
-    observer.write_before_solver_step(tau_in_body_frame_at_Ob.Y(),DataAddressing({"efforts",body_name,name,body_name,"Fy"},std::string("Fy(")+name+","+body_name+","+body_name+")"));
-    observer.write_before_solver_step(tau_in_body_frame_at_Ob.Z(),DataAddressing({"efforts",body_name,name,body_name,"Fz"},std::string("Fz(")+name+","+body_name+","+body_name+")"));
-    observer.write_before_solver_step(tau_in_body_frame_at_Ob.K(),DataAddressing({"efforts",body_name,name,body_name,"Mx"},std::string("Mx(")+name+","+body_name+","+body_name+")"));
-    observer.write_before_solver_step(tau_in_body_frame_at_Ob.M(),DataAddressing({"efforts",body_name,name,body_name,"My"},std::string("My(")+name+","+body_name+","+body_name+")"));
-    observer.write_before_solver_step(tau_in_body_frame_at_Ob.N(),DataAddressing({"efforts",body_name,name,body_name,"Mz"},std::string("Mz(")+name+","+body_name+","+body_name+")"));
-    observer.write_before_solver_step(tau_in_ned_frame_at_G.X(),DataAddressing({"efforts",body_name,name,"NED","Fx"},std::string("Fx(")+name+","+body_name+",NED)"));
-    observer.write_before_solver_step(tau_in_ned_frame_at_G.Y(),DataAddressing({"efforts",body_name,name,"NED","Fy"},std::string("Fy(")+name+","+body_name+",NED)"));
-    observer.write_before_solver_step(tau_in_ned_frame_at_G.Z(),DataAddressing({"efforts",body_name,name,"NED","Fz"},std::string("Fz(")+name+","+body_name+",NED)"));
-    observer.write_before_solver_step(tau_in_ned_frame_at_G.K(),DataAddressing({"efforts",body_name,name,"NED","Mx"},std::string("Mx(")+name+","+body_name+",NED)"));
-    observer.write_before_solver_step(tau_in_ned_frame_at_G.M(),DataAddressing({"efforts",body_name,name,"NED","My"},std::string("My(")+name+","+body_name+",NED)"));
-    observer.write_before_solver_step(tau_in_ned_frame_at_G.N(),DataAddressing({"efforts",body_name,name,"NED","Mz"},std::string("Mz(")+name+","+body_name+",NED)"));
-
-    for (const auto& command_name:commands)
+    const double F_Ob[6] = {tau_in_body_frame_at_Ob.X(), tau_in_body_frame_at_Ob.Y(), tau_in_body_frame_at_Ob.Z(),
+                            tau_in_body_frame_at_Ob.K(), tau_in_body_frame_at_Ob.M(), tau_in_body_frame_at_Ob.N()};
+    for (size_t i = 0 ; i < 6 ; ++i) observer.write_before_solver_step(F_Ob[i], addresses_in_body_frame[i]);
+    const double F_NED[6] = {tau_in_ned_frame_at_G.X(), tau_in_ned_frame_at_G.Y(), tau_in_ned_frame_at_G.Z(),
+                             tau_in_ned_frame_at_G.K(), tau_in_ned_frame_at_G.M(), tau_in_ned_frame_at_G.N()};
+    for (size_t i = 0 ; i < 6 ; ++i) observer.write_before_solver_step(F_NED[i], addresses_in_NED_frame[i]);
+
+    if (addresses_of_commands.size() != commands.size())
     {
-        const double command_value = get_command(command_name, command_listener, t);
-        observer.write_before_solver_step(command_value,DataAddressing({"efforts",body_name,name,"commands",command_name},std::string(name+"("+command_name+")")));
+        addresses_of_commands.clear();
+        for (const auto& command_name:commands)
+        {
+            addresses_of_commands.push_back(DataAddressing({"efforts",body_name,name,"commands",command_name},std::string(name+"("+command_name+")")));
+        }
+    }
+    for (size_t i = 0 ; i < commands.size() ; ++i)
+    {
+        const double command_value = get_command(commands[i], command_listener, t);
+        observer.write_before_solver_step(command_value, addresses_of_commands[i]);
     }
 
     extra_observations(observer);
@@ -237,6 +272,23 @@ bool ForceModel::is_a_surface_force_model() const
     return false;
 }
 
+bool ForceModel::is_remote() const
+{
+    return false;
+}
+
+void ForceModel::start(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands)
+{
+    if (not(memo.is_cached(states, t, commands)))
+    {
+        send_request(states, t, env, commands);
+    }
+}
+
+void ForceModel::send_request(const BodyStates&, const double, const EnvironmentAndFrames&, const std::map<std::string,double>&)
+{
+}
+
 void ForceModel::extra_observations(Observer&) const
 {
 }
@@ -15,6 +15,7 @@
 #include <ssc/kinematics.hpp>
 
 #include "xdyn/core/EnvironmentAndFrames.hpp"
+#include "xdyn/core/Observer.hpp"
 #include "xdyn/core/Wrench.hpp"
 #include "xdyn/exceptions/InvalidInputException.hpp"
 #include "xdyn/external_data_structures/YamlBody.hpp"
@@ -30,8 +31,6 @@ typedef TR1(shared_ptr)<ForceModel> ForcePtr;
 typedef std::vector<ForcePtr> ListOfForces;
 typedef std::function<boost::optional<ForcePtr>(const YamlModel&, const std::string&, const EnvironmentAndFrames&)> ForceParser;
 
-class Observer;
-
 // SFINAE test for 'parse' method
 template<typename T>
 struct HasParse
@@ -53,6 +52,7 @@ class Memoization
         Memoization() = delete;
         Memoization(const std::function<Wrench(const BodyStates&, const double, const EnvironmentAndFrames&, const std::map<std::string,double>&)>& callback);
         Wrench run_if_not_cached(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>&);
+        bool is_cached(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const;
 
 
     private:
@@ -81,12 +81,26 @@ class ForceModel
         virtual ~ForceModel() = default;
         ssc::kinematics::Wrench operator()(const BodyStates& states, const double t, const EnvironmentAndFrames& env, ssc::data_source::DataSource& command_listener);
         ssc::kinematics::Wrench operator()(const BodyStates& states, const double t, const EnvironmentAndFrames& env);
+        /**  \brief Same as the DataSource version, but with commands retrieved beforehand (using get_commands)
+          *  \details Does not use the DataSource (which is not thread-safe): used by Sim to evaluate several bodies concurrently.
+          */
+        ssc::kinematics::Wrench operator()(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands);
+        std::map<std::string,double> get_commands(ssc::data_source::DataSource& command_listener, const double t) const;
         virtual Wrench get_force(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const = 0;
         std::string get_name() const;
         virtual double get_Tmax() const; // Can be overloaded if model needs access to History (not a problem, just has to say how much history to keep)
         std::string get_body_name() const;
         virtual bool is_a_surface_force_model() const;
         std::vector<std::string> get_command_names() const;
+        /**  \brief Does the force model wait for another process (eg. a gRPC server) to compute its force?
+          *  \details If so, Sim calls 'start' for all such models of a body before evaluating any of its force models.
+          */
+        virtual bool is_remote() const;
+        /**  \brief Sends the request of a remote force model without waiting for the response (unless the force is already cached)
+          *  \details operator() (called with the same arguments) then gets the response: the remote models of a body compute
+          *           their forces concurrently with each other & with the local models, instead of one after the other.
+          */
+        void start(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands);
 
         template<typename ForceType>
         static typename boost::enable_if<HasParse<ForceType>, ForceParser>::type build_parser()
@@ -139,6 +153,7 @@ class ForceModel
         void feed(Observer& observer, ssc::kinematics::KinematicsPtr& k, ssc::data_source::DataSource& command_listener, const double t) const;
         virtual void extra_observations(Observer& observer) const;
     protected:
+        virtual void send_request(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands); //!< Called by 'start': does nothing unless overloaded
         std::vector<std::string> commands;
         std::string name;
         std::string body_name;
@@ -146,13 +161,19 @@ class ForceModel
     private:
         ForceModel(); // Deactivated
         double get_command(const std::string& command_name, ssc::data_source::DataSource& command_listener, const double t) const;
-        std::map<std::string,double> get_commands(ssc::data_source::DataSource& command_listener, const double t) const;
         void can_find_internal_frame(const ssc::kinematics::KinematicsPtr& k) const;
 
         bool has_internal_frame;
         std::string known_reference_frame;
+        FrameHandle internal_frame_to_body_frame; //!< k->get(name, body_name), if the model has an internal frame
+        FrameHandle body_frame_to_internal_frame; //!< k->get(body_name, name), if the model has an internal frame
         ssc::kinematics::Wrench latest_force_in_body_frame;
         Memoization memo;
+        // Built once so 'feed' does not build the names of the observed variables at each time step
+        std::vector<DataAddressing> addresses_in_internal_frame;
+        std::vector<DataAddressing> addresses_in_body_frame;
+        std::vector<DataAddressing> addresses_in_NED_frame;
+        mutable std::vector<DataAddressing> addresses_of_commands; // Built by 'feed' because derived classes can add commands in their constructor
 
 };
 
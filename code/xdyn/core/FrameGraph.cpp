@@ -0,0 +1,79 @@
+/*
+ * FrameGraph.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "FrameGraph.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+FrameHandle::FrameHandle() : graph(nullptr), index(0)
+{
+}
+
+FrameHandle::FrameHandle(const FrameGraph* graph_, const size_t index_) : graph(graph_), index(index_)
+{
+}
+
+FrameGraph::CachedTransform::CachedTransform(const std::string& from_, const std::string& to_) :
+    from(from_),
+    to(to_),
+    T(ssc::kinematics::Point(from_), to_),
+    is_up_to_date(false)
+{
+}
+
+FrameGraph::FrameGraph() : transforms()
+{
+}
+
+FrameHandle FrameGraph::get_handle(const std::string& from, const std::string& to)
+{
+    for (size_t i = 0 ; i < transforms.size() ; ++i)
+    {
+        if ((transforms[i].from == from) and (transforms[i].to == to)) return FrameHandle(this, i);
+    }
+    transforms.push_back(CachedTransform(from, to));
+    return FrameHandle(this, transforms.size() - 1);
+}
+
+void FrameGraph::update(const ssc::kinematics::KinematicsPtr& k)
+{
+    for (auto& transform:transforms)
+    {
+        try
+        {
+            transform.T = k->get(transform.from, transform.to);
+            transform.is_up_to_date = true;
+        }
+        catch (const ssc::kinematics::KinematicsException&)
+        {
+            // The consumers will get the error message from Kinematics
+            transform.is_up_to_date = false;
+        }
+    }
+}
+
+void FrameGraph::invalidate()
+{
+    for (auto& transform:transforms) transform.is_up_to_date = false;
+}
+
+bool FrameGraph::is_up_to_date(const FrameHandle& handle) const
+{
+    return (handle.graph == this) and (handle.index < transforms.size()) and transforms[handle.index].is_up_to_date;
+}
+
+const ssc::kinematics::Transform& FrameGraph::get(const FrameHandle& handle) const
+{
+    if (not(is_up_to_date(handle)))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Transform is not up to date: call FrameGraph::update first (or use Kinematics)");
+    }
+    return transforms[handle.index].T;
+}
+
+size_t FrameGraph::get_nb_of_transforms() const
+{
+    return transforms.size();
+}
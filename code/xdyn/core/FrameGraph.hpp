@@ -0,0 +1,90 @@
+/*
+ * FrameGraph.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef FRAMEGRAPH_HPP_
+#define FRAMEGRAPH_HPP_
+
+#include <ssc/kinematics.hpp>
+#include <ssc/macros.hpp>
+#include TR1INC(memory)
+
+#include <string>
+#include <vector>
+
+class FrameGraph;
+
+/** \brief Index of a transform in a FrameGraph
+ *  \details Obtained once (when building the bodies & the force models) with FrameGraph::get_handle,
+ *           so no frame name is built or looked up when the transform is used.
+ */
+class FrameHandle
+{
+    public:
+        FrameHandle(); //!< Not bound to any FrameGraph: FrameGraph::is_up_to_date always returns false
+
+    private:
+        friend class FrameGraph;
+        FrameHandle(const FrameGraph* graph, const size_t index);
+        const FrameGraph* graph; //!< FrameGraph which created the handle
+        size_t index;            //!< Index of the transform in that FrameGraph
+};
+
+/** \brief Transforms between frames known in Kinematics, needed by the bodies & force models at each evaluation of the state derivatives
+ *  \details Each consumer gets a handle for each transform it needs when it is built. The transforms are
+ *           then computed once for each state update (cf. Sim::dx_dt) instead of being looked up in
+ *           Kinematics by name by each consumer. Outside Sim::dx_dt (or if Kinematics could not compute
+ *           a transform), the transforms are not up to date & the consumers should use Kinematics directly.
+ *           'update' & 'invalidate' are not thread-safe, but the up-to-date transforms can be read concurrently.
+ *  \addtogroup core
+ *  \ingroup core
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/FrameGraphTest.cpp FrameGraphTest example
+ */
+class FrameGraph
+{
+    public:
+        FrameGraph();
+
+        /**  \brief Handle of the transform returned by k->get(from, to)
+          *  \details Several calls with the same frames return the same handle.
+          */
+        FrameHandle get_handle(const std::string& from, const std::string& to);
+
+        /**  \brief Computes all the transforms from Kinematics, after the states were updated
+          *  \details The transforms which Kinematics cannot compute are not up to date.
+          */
+        void update(const ssc::kinematics::KinematicsPtr& k);
+
+        /**  \brief Marks all the transforms as out of date (eg. when Kinematics is about to change)
+          */
+        void invalidate();
+
+        /**  \brief Was 'handle' created by this FrameGraph & was its transform computed since the last call to 'invalidate'?
+          */
+        bool is_up_to_date(const FrameHandle& handle) const;
+
+        /**  \brief Transform computed by the latest call to 'update'
+          *  \details Throws an InternalErrorException if the transform is not up to date.
+          */
+        const ssc::kinematics::Transform& get(const FrameHandle& handle) const;
+
+        size_t get_nb_of_transforms() const;
+
+    private:
+        struct CachedTransform
+        {
+            CachedTransform(const std::string& from, const std::string& to);
+            std::string from;
+            std::string to;
+            ssc::kinematics::Transform T; //!< k->get(from, to), at the latest call to 'update'
+            bool is_up_to_date;
+        };
+        std::vector<CachedTransform> transforms; //!< Indexed by FrameHandle::index
+};
+
+typedef TR1(shared_ptr)<FrameGraph> FrameGraphPtr;
+
+#endif /* FRAMEGRAPH_HPP_ */
@@ -11,12 +11,48 @@
 #include "xdyn/exceptions/InvalidInputException.hpp"
 #include <algorithm>
 
+const DataAddressing& DataAddressing::time()
+{
+    static const DataAddressing address(std::vector<std::string>(1,"t"), "t");
+    return address;
+}
+
+std::vector<DataAddressing> wrench_addresses(const std::string& force_name, const std::string& body_name, const std::string& frame)
+{
+    std::vector<DataAddressing> ret;
+    for (const std::string component:{"Fx", "Fy", "Fz", "Mx", "My", "Mz"})
+    {
+        ret.push_back(DataAddressing({"efforts",body_name,force_name,frame,component}, component+"("+force_name+","+body_name+","+frame+")"));
+    }
+    return ret;
+}
+
+Observer::ObservationPlan::Write::Write(const std::map<std::string, double>::iterator& slot_, const bool after_solver_step_)
+    : slot(slot_)
+    , after_solver_step(after_solver_step_)
+{
+}
+
+Observer::ObservationPlan::ObservationPlan()
+    : writes()
+    , serializers()
+    , nb_of_requested_variables(0)
+    , nb_of_writes(0)
+    , compiled(false)
+    , in_progress(false)
+{
+}
+
 Observer::Observer()
     : requested_serializations()
     , initialized(false)
     , output_everything(true)
     , serializers_called_before_solver_step()
     , serializers_called_after_solver_step()
+    , values_written_before_solver_step()
+    , values_written_after_solver_step()
+    , plan_before_solver_step()
+    , plan_after_solver_step()
     , initialize()
 {
 }
@@ -27,10 +63,38 @@ Observer::Observer(const std::vector<std::string>& data_)
     , output_everything(false)
     , serializers_called_before_solver_step()
     , serializers_called_after_solver_step()
+    , values_written_before_solver_step()
+    , values_written_after_solver_step()
+    , plan_before_solver_step()
+    , plan_after_solver_step()
+    , initialize()
+{
+}
+
+Observer::Observer(const std::vector<std::string>& data_, const bool output_everything_)
+    : requested_serializations(output_everything_ ? std::vector<std::string>() : data_)
+    , initialized(false)
+    , output_everything(output_everything_)
+    , serializers_called_before_solver_step()
+    , serializers_called_after_solver_step()
+    , values_written_before_solver_step()
+    , values_written_after_solver_step()
+    , plan_before_solver_step()
+    , plan_after_solver_step()
     , initialize()
 {
 }
 
+bool Observer::outputs_everything() const
+{
+    return output_everything;
+}
+
+const std::vector<std::string>& Observer::get_requested_serializations() const
+{
+    return requested_serializations;
+}
+
 std::function<void()> Observer::get_serializer(const SurfaceElevationGrid& , const DataAddressing& )
 {
     return [](){};
@@ -52,43 +116,147 @@ std::vector<std::string> Observer::all_variables(std::map<std::string, std::func
     return ret;
 }
 
-void Observer::collect_available_serializations(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+void Observer::write_before_solver_step(const double val, const DataAddressing& address)
 {
-    write_before_solver_step(t, DataAddressing(std::vector<std::string>(1,"t"), "t"));
-    sys.output(sys.state,*this, t, discrete_systems);
+    write_scalar(val, address, false);
 }
 
-void Observer::observe_before_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+void Observer::write_after_solver_step(const double val, const DataAddressing& address)
 {
-    collect_available_serializations(sys, t, discrete_systems);
-    if (output_everything)
+    write_scalar(val, address, true);
+}
+
+Observer::ObservationPlan* Observer::plan_in_progress()
+{
+    if (plan_before_solver_step.in_progress) return &plan_before_solver_step;
+    if (plan_after_solver_step.in_progress)  return &plan_after_solver_step;
+    return NULL;
+}
+
+void Observer::write_scalar(const double val, const DataAddressing& address, const bool after_solver_step)
+{
+    ObservationPlan* plan = plan_in_progress();
+    if (plan && plan->compiled)
     {
-        const auto all_vars = all_variables(initialize);
-        requested_serializations = all_vars;
-        initialize_serialization_of_requested_variables(all_vars);
-        serialize_before_solver_step(all_vars);
+        if (plan->nb_of_writes < plan->writes.size())
+        {
+            const ObservationPlan::Write& planned = plan->writes[plan->nb_of_writes];
+            if ((planned.after_solver_step == after_solver_step) && (planned.slot->first == address.name))
+            {
+                planned.slot->second = val;
+                plan->nb_of_writes++;
+                return;
+            }
+        }
+        // Not the variables seen when the plan was compiled: record it again from this write on
+        plan->compiled = false;
+        plan->writes.erase(plan->writes.begin() + (long)plan->nb_of_writes, plan->writes.end());
+    }
+    auto& values = after_solver_step ? values_written_after_solver_step : values_written_before_solver_step;
+    auto slot = values.find(address.name);
+    if (slot == values.end())
+    {
+        slot = values.insert(std::make_pair(address.name, val)).first;
+        initialize[address.name] = get_initializer(val, address);
+        auto& serializers = after_solver_step ? serializers_called_after_solver_step : serializers_called_before_solver_step;
+        serializers[address.name] = get_serializer(slot->second, address);
     }
     else
     {
-        initialize_serialization_of_requested_variables(requested_serializations);
-        serialize_before_solver_step(requested_serializations);
+        slot->second = val;
+    }
+    if (plan)
+    {
+        plan->writes.push_back(ObservationPlan::Write(slot, after_solver_step));
+        plan->nb_of_writes++;
     }
 }
 
-void Observer::observe_after_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+void Observer::start_observation(ObservationPlan& plan)
 {
-    sys.output(sys.state,*this, t, discrete_systems);
-    if(output_everything)
+    // In case the previous observation was interrupted by an exception
+    plan_before_solver_step.in_progress = false;
+    plan_after_solver_step.in_progress = false;
+    plan.nb_of_writes = 0;
+    if (not(plan.compiled))
     {
-        const auto all_vars = all_variables(initialize);
-        initialize_serialization_of_requested_variables(all_vars);
-        serialize_after_solver_step(all_vars);
+        plan.writes.clear();
     }
-    else
+    plan.in_progress = true;
+}
+
+void Observer::serialize(ObservationPlan& plan, const bool after_solver_step)
+{
+    plan.in_progress = false;
+    if (plan.compiled && (plan.nb_of_writes == plan.writes.size()))
     {
-        initialize_serialization_of_requested_variables(requested_serializations);
-        serialize_after_solver_step(requested_serializations);
+        const size_t n = plan.nb_of_requested_variables;
+        size_t i = 0;
+        before_write();
+        for (const auto serializer:plan.serializers)
+        {
+            (*serializer)();
+            if (i<(n-1)) flush_value_during_write();
+            ++i;
+        }
+        return;
+    }
+    // First observation, or Sim::output wrote fewer variables than planned: serialize by name & compile the plan
+    plan.writes.erase(plan.writes.begin() + (long)plan.nb_of_writes, plan.writes.end());
+    const auto variables = output_everything ? all_variables(initialize) : requested_serializations;
+    if (output_everything && not(after_solver_step))
+    {
+        requested_serializations = variables;
     }
+    initialize_serialization_of_requested_variables(variables);
+    const auto& serializers = after_solver_step ? serializers_called_after_solver_step : serializers_called_before_solver_step;
+    serialize_requested_variables(variables, serializers);
+    plan.serializers.clear();
+    for (const auto& variable_name:variables)
+    {
+        const auto serializer = serializers.find(variable_name);
+        if (serializer != serializers.end())
+        {
+            plan.serializers.push_back(&serializer->second);
+        }
+    }
+    plan.nb_of_requested_variables = variables.size();
+    plan.compiled = true;
+}
+
+void Observer::collect_available_serializations(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+{
+    write_before_solver_step(t, DataAddressing::time());
+    sys.output(sys.state,*this, t, discrete_systems);
+}
+
+void Observer::observe_before_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+{
+    start_observation(plan_before_solver_step);
+    write_before_solver_step(t, DataAddressing::time());
+    sys.output(sys.state,*this, t, discrete_systems);
+    serialize(plan_before_solver_step, false);
+}
+
+void Observer::observe_after_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+{
+    start_observation(plan_after_solver_step);
+    sys.output(sys.state,*this, t, discrete_systems);
+    serialize(plan_after_solver_step, true);
+}
+
+void Observer::observe_values_before_solver_step(const std::function<void()>& write_values)
+{
+    start_observation(plan_before_solver_step);
+    write_values();
+    serialize(plan_before_solver_step, false);
+}
+
+void Observer::observe_values_after_solver_step(const std::function<void()>& write_values)
+{
+    start_observation(plan_after_solver_step);
+    write_values();
+    serialize(plan_after_solver_step, true);
 }
 
 size_t levenshtein_distance(const std::string& s, const std::string& t);
@@ -251,6 +419,8 @@ bool Observer::should_serialize(const std::string& variable) const
 
 void Observer::remove_variable(const std::string& variable_to_remove)
 {
+    plan_before_solver_step.compiled = false;
+    plan_after_solver_step.compiled = false;
     requested_serializations.erase(std::remove_if(requested_serializations.begin(), requested_serializations.end(), [variable_to_remove](const std::string& v){return v == variable_to_remove;}), requested_serializations.end());
 }
 
@@ -33,24 +33,58 @@ struct DataAddressing
             const std::vector<std::string>& address_,
             const std::string& name_):
         name(name_),address(address_){};
+    static const DataAddressing& time(); // Address of the simulation time 't'
 };
 
+/**  \brief Addresses of Fx, Fy, Fz, Mx, My & Mz, eg. 'Fx(gravity,ball,NED)' stored in efforts/ball/gravity/NED/Fx
+  *  \details Built once (& not at each time step) by the objects writing wrenches to the observers.
+  */
+std::vector<DataAddressing> wrench_addresses(const std::string& force_name, const std::string& body_name, const std::string& frame);
+
 class Observer
 {
     public:
         Observer(); // Outputs everything by default
         Observer(const std::vector<std::string>& data);
-        void check_variables_to_serialize_are_available() const;
+        Observer(const std::vector<std::string>& data, const bool output_everything); // 'data' is ignored if output_everything is true
+        bool outputs_everything() const;
+        const std::vector<std::string>& get_requested_serializations() const; // Empty until the first observation if outputs_everything() is true
+        virtual void check_variables_to_serialize_are_available() const;
         virtual void observe_before_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems); // Writes before calling the solver. Cf. solve.hpp Only what was requested by the user in the YAML file
         virtual void observe_after_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems); // Writes after calling the solver. Cf. solve.hpp Only what was requested by the user in the YAML file
         virtual ~Observer();
         void flush();
         // Makes sure the observers know about the variables the system makes available for serialization (so we can run check_variables_to_serialize_are_available solve.hpp)
-        void collect_available_serializations(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems);
+        virtual void collect_available_serializations(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems);
+
+        /**
+         * @brief Same as observe_before_solver_step, but the values are written by 'write_values' instead of Sim::output
+         * @details Used to serialize values recorded elsewhere (eg. by AsyncObserver, in another thread).
+         */
+        void observe_values_before_solver_step(const std::function<void()>& write_values);
+
+        /**
+         * @brief Same as observe_after_solver_step, but the values are written by 'write_values' instead of Sim::output
+         */
+        void observe_values_after_solver_step(const std::function<void()>& write_values);
 
         /**
          * @brief For variables such as forces & discrete states, which should only be observed before a solver step
          */
+        void write_before_solver_step(
+                const double val,
+                const DataAddressing& address);
+
+        /**
+         * @brief For variables such as continuous states, which should only be observed after a solver step
+         */
+        void write_after_solver_step(
+                const double val,
+                const DataAddressing& address);
+
+        /**
+         * @brief For non-scalar variables (eg. SurfaceElevationGrid): the serializer is rebuilt at each call
+         */
         template <typename T> void write_before_solver_step(
                 const T& val,
                 const DataAddressing& address)
@@ -60,7 +94,7 @@ class Observer
         }
 
         /**
-         * @brief For variables such as continuous states, which should only be observed after a solver step
+         * @brief For non-scalar variables (eg. SurfaceElevationGrid): the serializer is rebuilt at each call
          */
         template <typename T> void write_after_solver_step(
                 const T& val,
@@ -80,7 +114,10 @@ class Observer
 
     protected:
 
-        virtual std::function<void()> get_serializer(const double val, const DataAddressing& address) = 0;
+        /**
+         * @brief Called once per variable: 'val' stays valid (& is updated at each step) as long as the observer exists
+         */
+        virtual std::function<void()> get_serializer(const double& val, const DataAddressing& address) = 0;
         virtual std::function<void()> get_initializer(const double val, const DataAddressing& address) = 0;
 
         virtual std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
@@ -104,10 +141,43 @@ class Observer
         std::vector<std::string> all_variables(std::map<std::string, std::function<void()> >& map) const;
 
     private:
+        /**
+         * @brief Sequence of writes of scalars performed by Sim::output during an observation
+         * @details Recorded during the first observation before (resp. after) the solver step. The following
+         *          observations store each value directly in its slot (no lookup by name & no new serializer)
+         *          & call the serializers of the requested variables from a flat list. If Sim::output does
+         *          not write the same variables in the same order, the plan is recorded again.
+         */
+        struct ObservationPlan
+        {
+            struct Write
+            {
+                Write(const std::map<std::string, double>::iterator& slot, const bool after_solver_step);
+                std::map<std::string, double>::iterator slot; // Name of the variable & its value
+                bool after_solver_step;
+            };
+            ObservationPlan();
+            std::vector<Write> writes;
+            std::vector<const std::function<void()>*> serializers; // Of the requested variables, in the requested order
+            size_t nb_of_requested_variables;
+            size_t nb_of_writes; // Since the beginning of the current observation
+            bool compiled;
+            bool in_progress;
+        };
+
+        void write_scalar(const double val, const DataAddressing& address, const bool after_solver_step);
+        ObservationPlan* plan_in_progress();
+        void start_observation(ObservationPlan& plan);
+        void serialize(ObservationPlan& plan, const bool after_solver_step);
+
         bool initialized;
         bool output_everything;
         std::map<std::string, std::function<void()> > serializers_called_before_solver_step;
         std::map<std::string, std::function<void()> > serializers_called_after_solver_step;
+        std::map<std::string, double> values_written_before_solver_step; // Slots of the scalars, to which their serializers are bound
+        std::map<std::string, double> values_written_after_solver_step;
+        ObservationPlan plan_before_solver_step;
+        ObservationPlan plan_after_solver_step;
 
     protected:
         std::map<std::string, std::function<void()> > initialize;
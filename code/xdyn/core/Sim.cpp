@@ -8,10 +8,14 @@
 
 #include "Sim.hpp"
 #include "Observer.hpp"
+#include "SurfaceForceIntegrator.hpp"
+#include "ThreadPool.hpp"
 #include "update_kinematics.hpp"
 #include "xdyn/exceptions/InternalErrorException.hpp"
 
 #include <ssc/kinematics.hpp>
+#include <algorithm> // std::any_of
+#include <functional>
 
 #define SQUARE(x) ((x)*(x))
 
@@ -23,6 +27,49 @@ ssc::kinematics::UnsafeWrench transport_to_origin_of_body_frame(const ssc::kinem
     return ssc::kinematics::UnsafeWrench(F_in_body_frame_at_origin.get_point(), F_in_body_frame_at_origin.get_force(), F_in_body_frame_at_origin.get_torque());
 }
 
+/** \brief Marks the transforms as out of date when it goes out of scope (even if an exception is thrown)
+ */
+class FramesInvalidator
+{
+    public:
+        FramesInvalidator(FrameGraph& frames_) : frames(frames_)
+        {
+        }
+
+        ~FramesInvalidator()
+        {
+            frames.invalidate();
+        }
+
+    private:
+        FramesInvalidator(); // Disabled
+        FramesInvalidator(const FramesInvalidator&); // Disabled
+        FramesInvalidator& operator=(const FramesInvalidator&); // Disabled
+        FrameGraph& frames;
+};
+
+/** \brief Tells the wave model it is called concurrently until it goes out of scope (even if an exception is thrown)
+ */
+class ConcurrentCallsOfWaveModel
+{
+    public:
+        ConcurrentCallsOfWaveModel(const SurfaceElevationPtr& w_, const bool concurrent_calls) : w(concurrent_calls ? w_ : SurfaceElevationPtr())
+        {
+            if (w) w->set_concurrent_calls(true);
+        }
+
+        ~ConcurrentCallsOfWaveModel()
+        {
+            if (w) w->set_concurrent_calls(false);
+        }
+
+    private:
+        ConcurrentCallsOfWaveModel(); // Disabled
+        ConcurrentCallsOfWaveModel(const ConcurrentCallsOfWaveModel&); // Disabled
+        ConcurrentCallsOfWaveModel& operator=(const ConcurrentCallsOfWaveModel&); // Disabled
+        SurfaceElevationPtr w;
+};
+
 class Sim::Impl
 {
     public:
@@ -31,39 +78,68 @@ class Sim::Impl
              const EnvironmentAndFrames& env_,
              const StateType& x,
              const ssc::data_source::DataSource& command_listener_) :
-                 bodies(bodies_), name2bodyptr(), forces(), env(env_),
-                 _dx_dt(StateType(x.size(),0)), command_listener(command_listener_), sum_of_forces_in_body_frame(),
-                 sum_of_forces_in_NED_frame(), fictitious_forces_in_body_frame(), fictitious_forces_in_NED_frame()
+                 bodies(bodies_), forces(), force_models(), first_force_model_of_each_body(1, 0), commands_of_each_force_model(), force_of_each_model(), body_has_remote_force_models(), surface_force_integrators(), env(env_),
+                 _dx_dt(StateType(x.size(),0)), command_listener(command_listener_), sum_of_forces_in_body_frame(bodies_.size()),
+                 sum_of_forces_in_NED_frame(bodies_.size()), fictitious_forces_in_body_frame(bodies_.size()), fictitious_forces_in_NED_frame(bodies_.size()),
+                 thread_pool(new ThreadPool(1)), addresses_of_blocked_states_forces(), addresses_of_sum_of_forces_in_body_frame(),
+                 addresses_of_sum_of_forces_in_NED_frame(), addresses_of_fictitious_forces_in_body_frame(), addresses_of_fictitious_forces_in_NED_frame()
         {
             size_t i = 0;
             for (auto body:bodies)
             {
-                forces[body->get_name()] = forces_.at(i++);
-                name2bodyptr[body->get_name()] = body;
+                const std::string body_name = body->get_name();
+                forces[body_name] = forces_.at(i++);
+                const auto& forces_of_this_body = forces[body_name];
+                force_models.insert(force_models.end(), forces_of_this_body.begin(), forces_of_this_body.end());
+                first_force_model_of_each_body.push_back(force_models.size());
+                body_has_remote_force_models.push_back(std::any_of(forces_of_this_body.begin(), forces_of_this_body.end(), [](const ForcePtr& F){return F->is_remote();}));
+                surface_force_integrators.push_back(SurfaceForceIntegrator(forces_of_this_body));
+                addresses_of_blocked_states_forces.push_back(wrench_addresses("blocked states", body_name, body_name));
+                addresses_of_sum_of_forces_in_body_frame.push_back(wrench_addresses("sum of forces", body_name, body_name));
+                addresses_of_sum_of_forces_in_NED_frame.push_back(wrench_addresses("sum of forces", body_name, "NED"));
+                addresses_of_fictitious_forces_in_body_frame.push_back(wrench_addresses("fictitious forces", body_name, body_name));
+                addresses_of_fictitious_forces_in_NED_frame.push_back(wrench_addresses("fictitious forces", body_name, "NED"));
+            }
+            commands_of_each_force_model.resize(force_models.size());
+            force_of_each_model.assign(force_models.size(), ssc::kinematics::Wrench(ssc::kinematics::Point("")));
+            for (auto body:bodies)
+            {
+                body->register_frames(*env.frames);
             }
         }
 
-        void feed_sum_of_forces(Observer& observer, const std::string& body_name)
+        /**  \brief Retrieves the commands of all force models from the DataSource
+          *  \details The DataSource is not thread-safe, so this is done before the bodies are evaluated
+          */
+        void get_commands(const double t)
         {
-            auto sum_forces_body = transport_to_origin_of_body_frame(sum_of_forces_in_body_frame[body_name], env.k);
-            feed_force(observer, sum_forces_body, "sum of forces", body_name, body_name);
-            feed_force(observer, sum_of_forces_in_NED_frame[body_name], "sum of forces", body_name, "NED");
+            for (size_t i = 0 ; i < force_models.size() ; ++i)
+            {
+                commands_of_each_force_model[i] = force_models[i]->get_commands(command_listener, t);
+            }
         }
-        void feed_fictitious_forces(Observer& observer, const std::string& body_name)
+
+        void feed_sum_of_forces(Observer& observer, const size_t body_index)
+        {
+            auto sum_forces_body = transport_to_origin_of_body_frame(sum_of_forces_in_body_frame[body_index], env.k);
+            feed_force(observer, sum_forces_body, addresses_of_sum_of_forces_in_body_frame[body_index]);
+            feed_force(observer, sum_of_forces_in_NED_frame[body_index], addresses_of_sum_of_forces_in_NED_frame[body_index]);
+        }
+        void feed_fictitious_forces(Observer& observer, const size_t body_index)
         {
-            auto fictitious_forces_body = transport_to_origin_of_body_frame(fictitious_forces_in_body_frame[body_name], env.k);
-            feed_force(observer, fictitious_forces_body, "fictitious forces", body_name, body_name);
-            feed_force(observer, fictitious_forces_in_NED_frame[body_name], "fictitious forces", body_name, "NED");
+            auto fictitious_forces_body = transport_to_origin_of_body_frame(fictitious_forces_in_body_frame[body_index], env.k);
+            feed_force(observer, fictitious_forces_body, addresses_of_fictitious_forces_in_body_frame[body_index]);
+            feed_force(observer, fictitious_forces_in_NED_frame[body_index], addresses_of_fictitious_forces_in_NED_frame[body_index]);
         }
 
-        void feed_force(Observer& observer, ssc::kinematics::UnsafeWrench& W, const std::string& force_name, const std::string& body_name, const std::string& frame)
+        void feed_force(Observer& observer, ssc::kinematics::UnsafeWrench& W, const std::vector<DataAddressing>& addresses)
         {
-            observer.write_before_solver_step(W.X(),DataAddressing({"efforts",body_name,force_name,frame,"Fx"}, "Fx("+force_name+","+body_name+","+frame+")"));
-            observer.write_before_solver_step(W.Y(),DataAddressing({"efforts",body_name,force_name,frame,"Fy"}, "Fy("+force_name+","+body_name+","+frame+")"));
-            observer.write_before_solver_step(W.Z(),DataAddressing({"efforts",body_name,force_name,frame,"Fz"}, "Fz("+force_name+","+body_name+","+frame+")"));
-            observer.write_before_solver_step(W.K(),DataAddressing({"efforts",body_name,force_name,frame,"Mx"}, "Mx("+force_name+","+body_name+","+frame+")"));
-            observer.write_before_solver_step(W.M(),DataAddressing({"efforts",body_name,force_name,frame,"My"}, "My("+force_name+","+body_name+","+frame+")"));
-            observer.write_before_solver_step(W.N(),DataAddressing({"efforts",body_name,force_name,frame,"Mz"}, "Mz("+force_name+","+body_name+","+frame+")"));
+            observer.write_before_solver_step(W.X(),addresses[0]);
+            observer.write_before_solver_step(W.Y(),addresses[1]);
+            observer.write_before_solver_step(W.Z(),addresses[2]);
+            observer.write_before_solver_step(W.K(),addresses[3]);
+            observer.write_before_solver_step(W.M(),addresses[4]);
+            observer.write_before_solver_step(W.N(),addresses[5]);
         }
 
         ssc::data_source::DataSource& get_command_listener()
@@ -72,15 +148,30 @@ class Sim::Impl
         }
 
         std::vector<BodyPtr> bodies;
-        std::map<std::string,BodyPtr> name2bodyptr;
         std::map<std::string,std::vector<ForcePtr> > forces;
+        // Same as 'forces', but resolved to indices at construction so dx_dt does not look up any name:
+        // the force models of bodies[i] are force_models[first_force_model_of_each_body[i]] to force_models[first_force_model_of_each_body[i+1]-1]
+        std::vector<ForcePtr> force_models;
+        std::vector<size_t> first_force_model_of_each_body;
+        std::vector<std::map<std::string,double> > commands_of_each_force_model; // Set by get_commands
+        std::vector<ssc::kinematics::Wrench> force_of_each_model; // Only used by the bodies with remote force models, which are not evaluated in the order of force_models
+        std::vector<bool> body_has_remote_force_models; // Does bodies[i] have at least one force model for which ForceModel::is_remote() is true?
+        std::vector<SurfaceForceIntegrator> surface_force_integrators; // One per body: all its surface force models are integrated in a single pass over the facets
         EnvironmentAndFrames env;
         StateType _dx_dt;
         ssc::data_source::DataSource command_listener;
-        std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_body_frame;
-        std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_NED_frame;
-        std::map<std::string,ssc::kinematics::UnsafeWrench> fictitious_forces_in_body_frame;
-        std::map<std::string,ssc::kinematics::UnsafeWrench> fictitious_forces_in_NED_frame;
+        // One slot per body (in the same order as 'bodies'), so each body only writes its own results
+        std::vector<ssc::kinematics::UnsafeWrench> sum_of_forces_in_body_frame;
+        std::vector<ssc::kinematics::UnsafeWrench> sum_of_forces_in_NED_frame;
+        std::vector<ssc::kinematics::UnsafeWrench> fictitious_forces_in_body_frame;
+        std::vector<ssc::kinematics::UnsafeWrench> fictitious_forces_in_NED_frame;
+        TR1(shared_ptr)<ThreadPool> thread_pool; // Evaluates the bodies (serially if it only has one thread)
+        // Names of the outputs of each body, built once so 'output' does not build them at each time step
+        std::vector<std::vector<DataAddressing> > addresses_of_blocked_states_forces;
+        std::vector<std::vector<DataAddressing> > addresses_of_sum_of_forces_in_body_frame;
+        std::vector<std::vector<DataAddressing> > addresses_of_sum_of_forces_in_NED_frame;
+        std::vector<std::vector<DataAddressing> > addresses_of_fictitious_forces_in_body_frame;
+        std::vector<std::vector<DataAddressing> > addresses_of_fictitious_forces_in_NED_frame;
 };
 
 ssc::data_source::DataSource& Sim::get_command_listener() const
@@ -159,45 +250,121 @@ void Sim::force_states(StateType& x, const double t) const
     }
 }
 
+void Sim::set_number_of_threads(const size_t nb_of_threads)
+{
+    pimpl->thread_pool.reset(new ThreadPool(nb_of_threads));
+}
+
+size_t Sim::get_number_of_threads() const
+{
+    return pimpl->thread_pool->get_nb_of_threads();
+}
+
 void Sim::dx_dt(const StateType& x, StateType& dxdt, const double t)
 {
+    // Kinematics & the DataSource are shared by all bodies: they are only modified here, before the bodies are evaluated.
+    // After that, each body only reads them & writes its own states, force models, result slots & state derivatives,
+    // so the results do not depend on the number of threads or on the order in which the bodies are evaluated.
+    // The states of each stage are only tentative (cf. Body::set_stage_states): the force models see them, but they are
+    // replaced by the next stage. Only the states accepted by the solver are recorded in history (cf. accept_states).
+    pimpl->env.frames->invalidate();
+    // Kinematics can be modified after this function (eg. by the observers), so the transforms are no longer up to date:
+    // they are invalidated on exit, even if a body or a force model throws
+    const FramesInvalidator invalidate_frames_on_exit(*pimpl->env.frames);
     for (auto body: pimpl->bodies)
     {
-        body->update(pimpl->env,x,t);
-        const auto Fext = sum_of_forces(x, body, t);
+        body->check_states_and_update_kinematics(x, pimpl->env.k, t);
+    }
+    // The transforms used by the bodies & force models are computed once here, instead of being looked up by name in Kinematics
+    pimpl->env.frames->update(pimpl->env.k);
+    pimpl->get_commands(t);
+    const std::function<void(const size_t)> evaluate_body = [this, &x, &dxdt, t](const size_t i)
+    {
+        const BodyPtr& body = pimpl->bodies[i];
+        body->update_states_and_intersection(pimpl->env, x, t, false);
+        const auto Fext = sum_of_forces(x, i, t);
         body->calculate_state_derivatives(Fext, x, dxdt, t, pimpl->env);
+    };
+    {
+        const ConcurrentCallsOfWaveModel concurrent_calls(pimpl->env.w, pimpl->thread_pool->runs_concurrently(pimpl->bodies.size()));
+        pimpl->thread_pool->run(pimpl->bodies.size(), evaluate_body);
     }
     state = normalize_quaternions(x);
     pimpl->_dx_dt = dxdt;
 }
 
+void Sim::accept_states(const double t)
+{
+    const StateType accepted_states = normalize_quaternions(state);
+    for (auto body: pimpl->bodies)
+    {
+        body->update_body_states(accepted_states, t);
+    }
+}
+
 ssc::kinematics::Wrench project_into_NED_frame(const ssc::kinematics::Wrench& F, const ssc::kinematics::RotationMatrix& R);
 ssc::kinematics::Wrench project_into_NED_frame(const ssc::kinematics::Wrench& F, const ssc::kinematics::RotationMatrix& R)
 {
     return ssc::kinematics::Wrench(ssc::kinematics::Point("NED"),R*F.force,R*F.torque);
 }
 
-ssc::kinematics::UnsafeWrench Sim::sum_of_forces(const StateType& x, const BodyPtr& body, const double t)
+ssc::kinematics::UnsafeWrench Sim::sum_of_forces(const StateType& x, const size_t body_index, const double t)
 {
+    const BodyPtr& body = pimpl->bodies[body_index];
     const Eigen::Vector3d uvw = body->get_uvw(x);
     const Eigen::Vector3d pqr = body->get_pqr(x);
-    const auto states = body->get_states();
-    pimpl->fictitious_forces_in_body_frame[body->get_name()] = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia,uvw, pqr));
-    pimpl->sum_of_forces_in_body_frame[body->get_name()] = pimpl->fictitious_forces_in_body_frame[body->get_name()];
-    const auto forces = pimpl->forces[body->get_name()];
-    for (auto force:forces)
+    const BodyStates& states = body->get_states();
+    ssc::kinematics::UnsafeWrench& fictitious_forces_in_body_frame = pimpl->fictitious_forces_in_body_frame[body_index];
+    ssc::kinematics::UnsafeWrench& sum_of_forces_in_body_frame = pimpl->sum_of_forces_in_body_frame[body_index];
+    fictitious_forces_in_body_frame = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia,uvw, pqr));
+    sum_of_forces_in_body_frame = fictitious_forces_in_body_frame;
+    SurfaceForceIntegrator& surface_force_integrator = pimpl->surface_force_integrators[body_index];
+    surface_force_integrator.integrate(states, t, pimpl->env);
+    // If a force model throws, the forces which were not used must not be returned by a later call to get_force
+    const SurfaceForceIntegrator::UnusedForcesDiscarder discard_unused_forces_on_exit(surface_force_integrator);
+    const size_t first = pimpl->first_force_model_of_each_body[body_index];
+    const size_t last = pimpl->first_force_model_of_each_body[body_index+1];
+    const std::vector<ForcePtr>& models = pimpl->force_models;
+    const std::vector<std::map<std::string,double> >& commands = pimpl->commands_of_each_force_model;
+    if (pimpl->body_has_remote_force_models[body_index])
     {
-        const ssc::kinematics::Wrench tau = force->operator()(states, t, pimpl->env, pimpl->command_listener);
-        pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau;
+        // The remote models (eg. GRPCForceModel) send their requests first & the local models are evaluated while the
+        // servers compute, so the latency of the body is that of its slowest server, not the sum of their latencies.
+        // The forces are nevertheless summed in the order of the YAML file, so the results do not depend on the servers' response times.
+        std::vector<ssc::kinematics::Wrench>& forces = pimpl->force_of_each_model;
+        for (size_t i = first ; i < last ; ++i)
+        {
+            if (models[i]->is_remote()) models[i]->start(states, t, pimpl->env, commands[i]);
+        }
+        for (size_t i = first ; i < last ; ++i)
+        {
+            if (not(models[i]->is_remote())) forces[i] = models[i]->operator()(states, t, pimpl->env, commands[i]);
+        }
+        for (size_t i = first ; i < last ; ++i)
+        {
+            if (models[i]->is_remote()) forces[i] = models[i]->operator()(states, t, pimpl->env, commands[i]);
+        }
+        for (size_t i = first ; i < last ; ++i)
+        {
+            sum_of_forces_in_body_frame += forces[i];
+        }
     }
-    pimpl->sum_of_forces_in_NED_frame[body->get_name()] = project_into_NED_frame(pimpl->sum_of_forces_in_body_frame[body->get_name()],states.get_rot_from_ned_to_body());
-    pimpl->fictitious_forces_in_NED_frame[body->get_name()] = project_into_NED_frame(pimpl->fictitious_forces_in_body_frame[body->get_name()],states.get_rot_from_ned_to_body());
-    return pimpl->sum_of_forces_in_body_frame[body->get_name()];
+    else
+    {
+        for (size_t i = first ; i < last ; ++i)
+        {
+            sum_of_forces_in_body_frame += models[i]->operator()(states, t, pimpl->env, commands[i]);
+        }
+    }
+    const ssc::kinematics::RotationMatrix ned2body = states.get_rot_from_ned_to_body();
+    pimpl->sum_of_forces_in_NED_frame[body_index] = project_into_NED_frame(sum_of_forces_in_body_frame, ned2body);
+    pimpl->fictitious_forces_in_NED_frame[body_index] = project_into_NED_frame(fictitious_forces_in_body_frame, ned2body);
+    return sum_of_forces_in_body_frame;
 }
 
 void Sim::initialize_system_outputs_before_first_observation()
 {
-    StateType dxdt(13);
+    StateType dxdt(state.size());
     double t = 0;
     if (not(pimpl->bodies.empty()))
     {
@@ -229,40 +396,37 @@ ssc::kinematics::PointMatrix Sim::get_waves(const double t//!< Current instant
 
 void Sim::output(const StateType& x, Observer& obs, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems) const
 {
-    obs.write_before_solver_step(t, DataAddressing(std::vector<std::string>(1,"t"), "t"));
+    obs.write_before_solver_step(t, DataAddressing::time());
     StateType x_with_forced_states;
     for (auto body: pimpl->bodies)
     {
         x_with_forced_states = body->block_states_if_necessary(x,t);
     }
     const auto normalized_x = normalize_quaternions(x_with_forced_states);
-    for (auto forces:pimpl->forces)
+    for (const auto& forces:pimpl->forces)
     {
-        for (auto force:forces.second)
+        for (const auto& force:forces.second)
         {
-            const auto body_name = forces.first;
-            const auto body = pimpl->name2bodyptr[body_name];
-            const auto G = body->get_origin(x);
             force->feed(obs,pimpl->env.k, pimpl->command_listener, t);
             force->extra_observations(obs);
         }
     }
-    for (auto body:pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
+        const BodyPtr& body = pimpl->bodies[i];
         body->feed(normalized_x, obs, pimpl->env.rot);
-        auto dF = body->get_delta_F(pimpl->_dx_dt,pimpl->sum_of_forces_in_body_frame[body->get_name()]);
-        obs.write_before_solver_step(dF(0),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fx"},std::string("Fx(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write_before_solver_step(dF(1),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fy"},std::string("Fy(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write_before_solver_step(dF(2),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fz"},std::string("Fz(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write_before_solver_step(dF(3),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Mx"},std::string("Mx(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write_before_solver_step(dF(4),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"My"},std::string("My(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write_before_solver_step(dF(5),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Mz"},std::string("Mz(blocked states,")+body->get_name()+","+body->get_name()+")"));
+        auto dF = body->get_delta_F(pimpl->_dx_dt,pimpl->sum_of_forces_in_body_frame[i]);
+        const auto& addresses = pimpl->addresses_of_blocked_states_forces[i];
+        for (size_t j = 0 ; j < 6 ; ++j)
+        {
+            obs.write_before_solver_step(dF(j),addresses[j]);
+        }
     }
     pimpl->env.feed(obs, t, pimpl->bodies, normalized_x);
-    for (auto body:pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
-        pimpl->feed_sum_of_forces(obs, body->get_name());
-        pimpl->feed_fictitious_forces(obs, body->get_name());
+        pimpl->feed_sum_of_forces(obs, i);
+        pimpl->feed_fictitious_forces(obs, i);
     }
     for (const auto& discrete_system : discrete_systems)
     {
@@ -284,6 +448,15 @@ void Sim::set_bodystates(const State& states_history)
     }
 }
 
+void Sim::append_bodystates(const State& new_states)
+{
+    pimpl->bodies.at(0)->append_to_history(pimpl->env, new_states);
+    if (not(new_states.x.is_empty()))
+    {
+        state = new_states.get_StateType(new_states.x.size()-1);
+    }
+}
+
 void Sim::set_command_listener(const std::map<std::string, double>& new_commands)
 {
     for(const auto& c : new_commands)
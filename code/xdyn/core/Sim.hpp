@@ -33,7 +33,23 @@ class Sim : public ssc::solver::ContinuousSystem
             const EnvironmentAndFrames& env,
             const StateType& x,
             const ssc::data_source::DataSource& command_listener);
+        /**  \brief Evaluates the state derivatives
+          *  \details The states 'x' are not recorded in the history of the bodies: they are only seen by the
+          *           force models until the next evaluation or the next call to 'accept_states' (cf. Body::set_stage_states).
+          */
         void dx_dt(const StateType& x, StateType& dxdt, const double t);
+
+        /**  \brief Records the current states ('state') in the history of the bodies, at instant t
+          *  \details Called after each step accepted by the solver (cf. AcceptedStatesRecorder & run_solver).
+          */
+        void accept_states(const double t);
+
+        /**  \brief Number of threads used by dx_dt to evaluate the bodies concurrently (1 by default, ie. serial evaluation)
+          *  \details The results do not depend on the number of threads.
+          */
+        void set_number_of_threads(const size_t nb_of_threads);
+        size_t get_number_of_threads() const;
+
         void force_states(StateType& x, const double t) const;
 
         /**  \brief Serialize wave data on mesh for an ASCII observer
@@ -53,6 +69,10 @@ class Sim : public ssc::solver::ContinuousSystem
 
         void set_bodystates(const State& state_history);
 
+        /**  \brief Adds states to the history of the first body, instead of replacing it (cf. set_bodystates & Body::append_to_history)
+          */
+        void append_bodystates(const State& new_states);
+
         std::map<std::string,std::vector<ForcePtr> > get_forces() const;
         std::vector<BodyPtr> get_bodies() const;
         EnvironmentAndFrames get_env() const;
@@ -82,7 +102,7 @@ class Sim : public ssc::solver::ContinuousSystem
         void initialize_system_outputs_before_first_observation();
 
     private:
-        ssc::kinematics::UnsafeWrench sum_of_forces(const StateType& x, const BodyPtr& body, const double t);
+        ssc::kinematics::UnsafeWrench sum_of_forces(const StateType& x, const size_t body_index, const double t);
 
         /**  \brief Make sure quaternions can be converted to Euler angles
           *  \details Normalization takes place at each time step, which is not
@@ -10,8 +10,12 @@
 #include "update_kinematics.hpp"
 #include "xdyn/exceptions/InternalErrorException.hpp"
 #include "xdyn/external_file_formats/stl_reader.hpp"
+#include "xdyn/mesh/MeshSimplifier.hpp"
 
 #include <cstdlib>
+#include <iostream>
+#define _USE_MATH_DEFINES
+#include <cmath>
 #include <ssc/text_file_reader.hpp>
 #include <boost/filesystem.hpp>
 
@@ -202,7 +206,7 @@ Sim SimulatorBuilder::build(const MeshMap& meshes) const
     auto env = build_environment_and_frames();
     auto forces = get_forces(env);
     auto history_length = get_max_history_length(forces);
-    const auto bodies = get_bodies(meshes, are_there_surface_forces_acting_on_body(forces), history_length);
+    const auto bodies = get_bodies(simplify_meshes(meshes, env), are_there_surface_forces_acting_on_body(forces), history_length);
     add_initial_transforms(bodies, env.k);
     return Sim(bodies, forces, env, get_initial_states(), command_listener);
 }
@@ -232,6 +236,60 @@ MeshMap SimulatorBuilder::make_mesh_map() const
     return ret;
 }
 
+MeshMap SimulatorBuilder::make_simplified_mesh_map() const
+{
+    const MeshMap meshes = make_mesh_map();
+    for (const auto& body:input.bodies)
+    {
+        // The environment (eg. a remote wave model) is only built if needed to get the shortest wavelength
+        if (body.mesh_simplification.simplify) return simplify_meshes(meshes, build_environment_and_frames());
+    }
+    return meshes;
+}
+
+double shortest_wavelength(const EnvironmentAndFrames& env, const std::string& body_name);
+double shortest_wavelength(const EnvironmentAndFrames& env, const std::string& body_name)
+{
+    double k_max = 0;
+    if (env.w)
+    {
+        for (const auto spectrum:env.w->get_constant_flat_directional_spectra())
+        {
+            for (const auto k:spectrum->k) k_max = std::max(k_max, k);
+        }
+    }
+    if (k_max <= 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The mesh of body '" << body_name << "' should be simplified (section 'mesh simplification'), "
+              << "but the number of facets is based on the shortest wavelength & the wave model does not have a spectrum known in advance: "
+              << "either remove the 'mesh simplification' section or use a wave model defined in the YAML file.");
+    }
+    return 2*M_PI/k_max;
+}
+
+MeshMap SimulatorBuilder::simplify_meshes(const MeshMap& meshes, const EnvironmentAndFrames& env) const
+{
+    MeshMap ret = meshes;
+    for (const auto& body:input.bodies)
+    {
+        const auto that_mesh = ret.find(body.name);
+        if (not(body.mesh_simplification.simplify) or (that_mesh == ret.end())) continue;
+        const double lambda = shortest_wavelength(env, body.name);
+        const double z = body.mesh_simplification.z_of_waterplane;
+        const size_t budget = MeshSimplifier::get_facet_budget(that_mesh->second, lambda, body.mesh_simplification.edges_per_wavelength);
+        const MeshSimplifier::Properties before = MeshSimplifier::get_properties(that_mesh->second, z);
+        that_mesh->second = MeshSimplifier(that_mesh->second, z).simplify(budget);
+        const MeshSimplifier::Properties after = MeshSimplifier::get_properties(that_mesh->second, z);
+        std::cerr << "Mesh of body '" << body.name << "' simplified from " << before.nb_of_facets << " to " << after.nb_of_facets
+                  << " facets (target: " << budget << " facets, for a shortest wavelength of " << lambda << " m). "
+                  << "Relative volume error: " << std::abs(after.volume - before.volume)/std::abs(before.volume)
+                  << ", centroid error: " << (after.centroid - before.centroid).norm() << " m"
+                  << ", relative waterplane area error: " << (before.waterplane_area > 0 ? std::abs(after.waterplane_area - before.waterplane_area)/before.waterplane_area : 0.)
+                  << std::endl;
+    }
+    return ret;
+}
+
 VectorOfVectorOfPoints SimulatorBuilder::get_mesh(const YamlBody& body) const
 {
     if (not(body.mesh.empty()))
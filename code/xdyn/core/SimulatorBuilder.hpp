@@ -183,6 +183,12 @@ class SimulatorBuilder
         YamlSimulatorInput get_parsed_yaml() const;
         MeshMap make_mesh_map() const;
 
+        /**  \brief Reads the meshes from files & simplifies them if requested (section 'mesh simplification')
+          *  \details Lets several Sim be built from the same meshes (cf. read_meshes): build(const MeshMap&)
+          *           would simplify them again unless the 'mesh simplification' sections are removed.
+          */
+        MeshMap make_simplified_mesh_map() const;
+
         /**  \brief Create a Kinematics object with transforms from NED to each body
           *  \returns KinematicsPtr containing the initial transforms
           */
@@ -199,6 +205,12 @@ class SimulatorBuilder
         void add(const YamlModel& model, ListOfForces& L, const std::string& name, const EnvironmentAndFrames& env) const;
         VectorOfVectorOfPoints get_mesh(const YamlBody& body) const;
 
+        /**  \brief Simplifies the meshes of the bodies which have a 'mesh simplification' section (cf. MeshSimplifier)
+          *  \details The number of facets is based on the shortest wavelength of the wave spectra. The errors
+          *           on the volume, the centroid & the waterplane area are reported on the standard error.
+          */
+        MeshMap simplify_meshes(const MeshMap& meshes, const EnvironmentAndFrames& env) const;
+
         YamlSimulatorInput input;
         TR1(shared_ptr)<BodyBuilder> builder;
         std::vector<ForceParser> force_parsers;
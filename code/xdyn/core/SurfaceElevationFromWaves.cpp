@@ -66,6 +66,35 @@ std::vector<FlatDiscreteDirectionalWaveSpectrum> SurfaceElevationFromWaves::get_
     return ret;
 }
 
+std::vector<const FlatDiscreteDirectionalWaveSpectrum*> SurfaceElevationFromWaves::get_constant_flat_directional_spectra() const
+{
+    std::vector<const FlatDiscreteDirectionalWaveSpectrum*> ret;
+    ret.reserve(directional_spectra.size());
+    for (const auto& spectrum:directional_spectra)
+    {
+        ret.push_back(&spectrum->get_flat_spectrum());
+    }
+    return ret;
+}
+
+std::pair<double,double> SurfaceElevationFromWaves::get_elevation_bounds() const
+{
+    double max_elevation = 0;
+    for (const auto& spectrum:directional_spectra)
+    {
+        max_elevation += spectrum->get_maximum_elevation();
+    }
+    return std::make_pair(-max_elevation, max_elevation);
+}
+
+void SurfaceElevationFromWaves::set_concurrent_calls(const bool concurrent_calls)
+{
+    for (const auto& model:directional_spectra)
+    {
+        model->set_concurrent_calls(concurrent_calls);
+    }
+}
+
 std::vector<double> SurfaceElevationFromWaves::dynamic_pressure(
     const double rho,               //!< water density (in kg/m^3)
     const double g,                 //!< gravity (in m/s^2)
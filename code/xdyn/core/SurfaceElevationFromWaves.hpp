@@ -36,6 +36,9 @@ class SurfaceElevationFromWaves: public SurfaceElevationInterface
             const ssc::kinematics::PointMatrixPtr& output_mesh = ssc::kinematics::PointMatrixPtr(new ssc::kinematics::PointMatrix("NED", 0)));
 
         std::vector<WaveModelPtr> get_models() const {return directional_spectra;};
+        std::vector<const FlatDiscreteDirectionalWaveSpectrum*> get_constant_flat_directional_spectra() const;
+        std::pair<double,double> get_elevation_bounds() const;
+        void set_concurrent_calls(const bool concurrent_calls);
 
         void serialize_wave_spectra_before_simulation(ObserverPtr& observer) const;
     private:
@@ -8,6 +8,7 @@
 #include "SurfaceElevationInterface.hpp"
 #include "xdyn/exceptions/InternalErrorException.hpp"
 #include <ssc/exception_handling.hpp>
+#include <limits>
 #include <string>
 
 /**
@@ -97,8 +98,26 @@ void SurfaceElevationInterface::update_surface_elevation(
 {
     const size_t n = (size_t)P->m.cols();
     if (n<=0) return;
+    compute_surface_elevation(P, k, t, relative_wave_height_for_each_point_in_mesh, surface_elevation_for_each_point_in_mesh);
+}
+
+void SurfaceElevationInterface::compute_surface_elevation(
+    const ssc::kinematics::PointMatrixPtr& P,       //!< Points for which to compute the relative wave height
+    const ssc::kinematics::KinematicsPtr& k,        //!< Object used to compute the transforms to the NED frame
+    const double t,                                 //!< Current instant (in seconds)
+    std::vector<double>& relative_wave_height,      //!< Output: zwave - z for each point in P
+    std::vector<double>& surface_elevation          //!< Output: zwave for each point in P
+    ) const
+{
+    const size_t n = (size_t)P->m.cols();
+    if (n<=0)
+    {
+        relative_wave_height.clear();
+        surface_elevation.clear();
+        return;
+    }
     const ssc::kinematics::PointMatrix OP = compute_position_in_NED_frame(*P, k);
-    relative_wave_height_for_each_point_in_mesh.resize(n);
+    relative_wave_height.resize(n);
 
     std::vector<double> x(n), y(n);
     for (size_t i = 0; i < n; ++i)
@@ -106,10 +125,10 @@ void SurfaceElevationInterface::update_surface_elevation(
         x[i] = OP.m(0, static_cast<Eigen::Index>(i));
         y[i] = OP.m(1, static_cast<Eigen::Index>(i));
     }
-    surface_elevation_for_each_point_in_mesh = get_and_check_wave_height(x, y, t);
+    surface_elevation = get_and_check_wave_height(x, y, t);
     for (size_t i = 0; i < n; ++i)
     {
-        relative_wave_height_for_each_point_in_mesh[i] = OP.m(2, static_cast<Eigen::Index>(i)) - surface_elevation_for_each_point_in_mesh.at(i);
+        relative_wave_height[i] = OP.m(2, static_cast<Eigen::Index>(i)) - surface_elevation.at(i);
     }
 }
 
@@ -258,3 +277,17 @@ SurfaceElevationGrid SurfaceElevationInterface::get_waves_on_mesh_as_a_grid(
 void SurfaceElevationInterface::serialize_wave_spectra_before_simulation(ObserverPtr&) const
 {
 }
+
+std::vector<const FlatDiscreteDirectionalWaveSpectrum*> SurfaceElevationInterface::get_constant_flat_directional_spectra() const
+{
+    return std::vector<const FlatDiscreteDirectionalWaveSpectrum*>();
+}
+
+std::pair<double,double> SurfaceElevationInterface::get_elevation_bounds() const
+{
+    return std::make_pair(-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+}
+
+void SurfaceElevationInterface::set_concurrent_calls(const bool)
+{
+}
@@ -44,6 +44,18 @@ class SurfaceElevationInterface
             const double t                                //!< Current instant (in seconds)
             );
 
+        /**  \brief Computes surface elevation for each point on mesh, without storing it in this object.
+          *  \details Same as update_surface_elevation, but the results are returned to the caller,
+          *           so several bodies can compute their wave heights concurrently.
+          */
+        void compute_surface_elevation(
+            const ssc::kinematics::PointMatrixPtr& M,     //!< Points for which to compute the relative wave height
+            const ssc::kinematics::KinematicsPtr& k,      //!< Object used to compute the transforms to the NED frame
+            const double t,                               //!< Current instant (in seconds)
+            std::vector<double>& relative_wave_height,    //!< Output: zwave - z for each point in M
+            std::vector<double>& surface_elevation        //!< Output: zwave for each point in M
+            ) const;
+
         /**  \brief Returns the relative wave height computed by update_surface_elevation
           *  \returns zwave - z for each point in mesh.
           *  \snippet hydro_model/unit_tests/WaveModelInterfaceTest.cpp WaveModelInterfaceTest get_relative_wave_height_matrix_example
@@ -149,6 +161,26 @@ class SurfaceElevationInterface
         virtual void serialize_wave_spectra_before_simulation(ObserverPtr& observer) const;
 
         virtual std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_directional_spectra(const double x, const double y, const double t) const = 0;
+
+        /**  \brief Spectra which depend neither on the position nor on time, owned by the wave model
+          *  \details Lets the RAO-based force models precompute what only depends on the rays.
+          *  \returns Empty if the spectra are not known in advance (eg. if they are computed by a remote
+          *           wave model): get_flat_directional_spectra should then be called at each time step.
+          */
+        virtual std::vector<const FlatDiscreteDirectionalWaveSpectrum*> get_constant_flat_directional_spectra() const;
+
+        /**  \brief Bounds of the wave elevation (z in the NED frame), valid everywhere & at all instants
+          *  \details Lets the bodies skip the wave elevation computations on the parts of their hulls which are
+          *           above the highest possible wave crest (cf. MeshIntersector::select_vertices_to_evaluate).
+          *  \returns (-infinity, +infinity) if the wave model cannot bound its elevation (eg. a remote wave model)
+          */
+        virtual std::pair<double,double> get_elevation_bounds() const;
+
+        /**  \brief Tells the wave model whether it is about to be called by several threads at the same time (cf. Sim::dx_dt)
+          *  \details The caches whose content depends on the order of the calls (eg. WavePhasorCache) are then bypassed,
+          *           so the results do not depend on the scheduling of the threads. Does nothing by default.
+          */
+        virtual void set_concurrent_calls(const bool concurrent_calls);
         /**  \brief If the wave output mesh is not defined in NED, use Kinematics to update its x-y coordinates
           */
 
@@ -0,0 +1,59 @@
+/*
+ * SurfaceForceIntegrator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "SurfaceForceIntegrator.hpp"
+#include "BodyStates.hpp"
+
+SurfaceForceIntegrator::SurfaceForceIntegrator(const ListOfForces& forces_of_one_body) :
+        models(), raw_models(), facets(), forces()
+{
+    for (const auto& force:forces_of_one_body)
+    {
+        const auto surface_force_model = TR1(dynamic_pointer_cast)<const SurfaceForceModel>(force);
+        if (surface_force_model and surface_force_model->can_share_surface_integration())
+        {
+            models.push_back(surface_force_model);
+            raw_models.push_back(surface_force_model.get());
+        }
+    }
+    if (models.size() < 2)
+    {
+        models.clear();
+        raw_models.clear();
+    }
+}
+
+void SurfaceForceIntegrator::integrate(const BodyStates& states, const double t, const EnvironmentAndFrames& env)
+{
+    if (raw_models.empty()) return;
+    SurfaceForceModel::integrate(raw_models, states, t, env, facets, forces);
+    for (size_t i = 0 ; i < raw_models.size() ; ++i)
+    {
+        raw_models[i]->precomputed_force = forces[i];
+    }
+}
+
+void SurfaceForceIntegrator::discard_unused_forces()
+{
+    for (const auto model:raw_models)
+    {
+        model->precomputed_force.reset();
+    }
+}
+
+SurfaceForceIntegrator::UnusedForcesDiscarder::UnusedForcesDiscarder(SurfaceForceIntegrator& integrator_) : integrator(integrator_)
+{
+}
+
+SurfaceForceIntegrator::UnusedForcesDiscarder::~UnusedForcesDiscarder()
+{
+    integrator.discard_unused_forces();
+}
+
+size_t SurfaceForceIntegrator::get_nb_of_models() const
+{
+    return raw_models.size();
+}
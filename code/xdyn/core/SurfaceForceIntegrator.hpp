@@ -0,0 +1,64 @@
+/*
+ * SurfaceForceIntegrator.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SURFACEFORCEINTEGRATOR_HPP_
+#define SURFACEFORCEINTEGRATOR_HPP_
+
+#include "xdyn/core/SurfaceForceModel.hpp"
+
+/** \brief Integrates all the surface force models of a body in a single pass over the facets
+ *  \details Without it, each surface force model walks the facets (& computes their areas, the
+ *           elevations of their centroids, the average wave elevations...) separately.
+ *           Sim calls 'integrate' once per body & per evaluation of the state derivatives,
+ *           before the force models: the forces are stored in each SurfaceForceModel & returned
+ *           by their next call to get_force (the results are identical to those of separate
+ *           integrations). Models which override get_force (cf. SurfaceForceModel::can_share_surface_integration)
+ *           are not included. Does nothing if the body has fewer than two surface force models.
+ *  \addtogroup model_wrappers
+ *  \ingroup model_wrappers
+ *  \section ex1 Example
+ *  \snippet force_models/unit_tests/SurfaceForceIntegratorTest.cpp SurfaceForceIntegratorTest example
+ */
+class SurfaceForceIntegrator
+{
+    public:
+        SurfaceForceIntegrator(const ListOfForces& forces_of_one_body);
+
+        /**  \brief Computes the forces of all the surface force models & stores them in each model
+          */
+        void integrate(const BodyStates& states, const double t, const EnvironmentAndFrames& env);
+
+        /**  \brief Discards the forces which were not used by get_force (eg. if ForceModel used its cache)
+          */
+        void discard_unused_forces();
+
+        /** \brief Calls 'discard_unused_forces' when it goes out of scope, so no force is left for the next
+         *         call to get_force (eg. if a force model throws before all the forces were used)
+         */
+        class UnusedForcesDiscarder
+        {
+            public:
+                UnusedForcesDiscarder(SurfaceForceIntegrator& integrator_);
+                ~UnusedForcesDiscarder();
+
+            private:
+                UnusedForcesDiscarder(); // Disabled
+                UnusedForcesDiscarder(const UnusedForcesDiscarder&); // Disabled
+                UnusedForcesDiscarder& operator=(const UnusedForcesDiscarder&); // Disabled
+                SurfaceForceIntegrator& integrator;
+        };
+
+        size_t get_nb_of_models() const; //!< Number of models integrated in the same pass (0 if fewer than two)
+
+    private:
+        SurfaceForceIntegrator();
+        std::vector<TR1(shared_ptr)<const SurfaceForceModel> > models;
+        std::vector<const SurfaceForceModel*> raw_models; //!< Same as 'models' (not owned)
+        SurfaceForceModel::FacetData facets;
+        std::vector<Wrench> forces;
+};
+
+#endif /* SURFACEFORCEINTEGRATOR_HPP_ */
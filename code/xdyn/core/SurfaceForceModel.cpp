@@ -8,10 +8,87 @@
 #include "SurfaceForceModel.hpp"
 #include "BodyStates.hpp"
 
+SurfaceForceModel::FacetData::FacetData() : dS(), zG(), eta(), centroids(), nb_of_facets(0)
+{
+}
+
+ZGCalculator get_zg_calculator(const BodyStates& states, const EnvironmentAndFrames& env);
+ZGCalculator get_zg_calculator(const BodyStates& states, const EnvironmentAndFrames& env)
+{
+    ZGCalculator zg;
+    if (env.frames->is_up_to_date(states.ned_to_body))
+    {
+        zg.update_transform(env.frames->get(states.ned_to_body));
+    }
+    else
+    {
+        zg.update_transform(env.k->get("NED", states.name));
+    }
+    return zg;
+}
+
+void add_elementary_force(Wrench& F, const SurfaceForceModel::DF& f, const ssc::kinematics::Point& G);
+void add_elementary_force(Wrench& F, const SurfaceForceModel::DF& f, const ssc::kinematics::Point& G)
+{
+    const double x = (f.C(0)-G.v(0));
+    const double y = (f.C(1)-G.v(1));
+    const double z = (f.C(2)-G.v(2));
+    F.X() += f.dF(0);
+    F.Y() += f.dF(1);
+    F.Z() += f.dF(2);
+    F.K() += (y*f.dF(2)-z*f.dF(1));
+    F.M() += (z*f.dF(0)-x*f.dF(2));
+    F.N() += (x*f.dF(1)-y*f.dF(0));
+}
+
+void SurfaceForceModel::FacetData::update(const FacetIterator& begin_facet, const FacetIterator& end_facet, const BodyStates& states, const ZGCalculator& zg, const bool with_wave_data)
+{
+    nb_of_facets = 0;
+    for (auto that_facet = begin_facet ; that_facet != end_facet ; ++that_facet) ++nb_of_facets;
+    // std::vector::resize keeps the capacity, so this only allocates when the number of facets reaches a new maximum
+    dS.resize(nb_of_facets);
+    zG.resize(nb_of_facets);
+    size_t i = 0;
+    for (auto that_facet = begin_facet ; that_facet != end_facet ; ++that_facet)
+    {
+        dS[i] = that_facet->area*that_facet->unit_normal;
+        zG[i] = zg.get_zG_in_NED(that_facet->centre_of_gravity);
+        ++i;
+    }
+    if (not(with_wave_data)) return;
+    eta.resize(nb_of_facets);
+    const std::string mesh_frame = states.M->get_frame();
+    if (not(centroids) or (centroids->get_frame() != mesh_frame))
+    {
+        centroids.reset(new ssc::kinematics::PointMatrix(mesh_frame, nb_of_facets));
+    }
+    centroids->m.resize(3, (Eigen::Index)nb_of_facets);
+    const std::vector<double>& all_absolute_wave_elevations = states.intersector->all_absolute_wave_elevations;
+    i = 0;
+    for (auto that_facet = begin_facet ; that_facet != end_facet ; ++that_facet)
+    {
+        double eta_facet = 0;
+        for (const auto vertex:that_facet->vertex_index)
+        {
+            eta_facet += all_absolute_wave_elevations.at(vertex);
+        }
+        if (not(that_facet->vertex_index.empty())) eta_facet /= (double)that_facet->vertex_index.size();
+        eta[i] = eta_facet;
+        centroids->m.col((Eigen::Index)i) = that_facet->centre_of_gravity;
+        ++i;
+    }
+}
+
+size_t SurfaceForceModel::FacetData::size() const
+{
+    return nb_of_facets;
+}
+
 SurfaceForceModel::SurfaceForceModel(const std::string& name_, const std::string& body_name, const EnvironmentAndFrames& env) :
         ForceModel(name_, {}, body_name, env),
         g_in_NED(ssc::kinematics::Point("NED", 0, 0, env.g)),
-        zg_calculator(new ZGCalculator())
+        precomputed_force(),
+        facet_buffer()
 {
 }
 
@@ -26,36 +103,98 @@ Wrench SurfaceForceModel::get_force(
     const std::map<std::string,double>&
     ) const
 {
-    zg_calculator->update_transform(env.k->get("NED", states.name));
-    Wrench F(states.G, body_name);
+    if (precomputed_force)
+    {
+        const Wrench F = precomputed_force.get();
+        precomputed_force.reset();
+        return F;
+    }
+    // Nothing to share with other models: integrate directly, reusing this model's buffers
+    Wrench F(states.G, get_body_name());
     const auto b = begin(states.intersector);
     const auto e = end(states.intersector);
-    std::function<SurfaceForceModel::DF(const FacetIterator &,
-                                        const size_t,
-                                        const EnvironmentAndFrames &,
-                                        const BodyStates &,
-                                        const double)> dF_lambda =
-        get_dF(b, e, env, states, t);
-
+    facet_buffer.update(b, e, states, get_zg_calculator(states, env), uses_wave_data_on_facets());
+    const auto dF = get_dF(b, e, env, states, t, facet_buffer);
     size_t facet_index = 0;
-    for (auto that_facet = begin(states.intersector) ; that_facet != e ; ++that_facet)
+    for (auto that_facet = b ; that_facet != e ; ++that_facet)
     {
-        const DF f = dF_lambda(that_facet, facet_index, env, states, t);
-        const double x = (f.C(0)-states.G.v(0));
-        const double y = (f.C(1)-states.G.v(1));
-        const double z = (f.C(2)-states.G.v(2));
-        F.X() += f.dF(0);
-        F.Y() += f.dF(1);
-        F.Z() += f.dF(2);
-        F.K() += (y*f.dF(2)-z*f.dF(1));
-        F.M() += (z*f.dF(0)-x*f.dF(2));
-        F.N() += (x*f.dF(1)-y*f.dF(0));
+        add_elementary_force(F, dF(that_facet, facet_index, env, states, t), states.G);
         ++facet_index;
     }
     calculations_after_surface_integration(states);
     return F;
 }
 
+void SurfaceForceModel::integrate(
+    const std::vector<const SurfaceForceModel*>& models,
+    const BodyStates& states,
+    const double t,
+    const EnvironmentAndFrames& env,
+    FacetData& facets,
+    std::vector<Wrench>& forces)
+{
+    typedef std::function<SurfaceForceModel::DF(const FacetIterator &,
+                                                const size_t,
+                                                const EnvironmentAndFrames &,
+                                                const BodyStates &,
+                                                const double)> ElementaryForce;
+    const ZGCalculator zg = get_zg_calculator(states, env);
+    forces.clear();
+    for (const auto model:models)
+    {
+        forces.push_back(Wrench(states.G, model->get_body_name()));
+    }
+    std::vector<bool> integrated(models.size(), false);
+    std::vector<size_t> models_on_these_facets;
+    std::vector<ElementaryForce> dF;
+    for (size_t i = 0 ; i < models.size() ; ++i)
+    {
+        if (integrated[i]) continue;
+        const auto b = models[i]->begin(states.intersector);
+        const auto e = models[i]->end(states.intersector);
+        models_on_these_facets.clear();
+        bool with_wave_data = false;
+        for (size_t j = i ; j < models.size() ; ++j)
+        {
+            if (not(integrated[j]) and (models[j]->begin(states.intersector) == b) and (models[j]->end(states.intersector) == e))
+            {
+                models_on_these_facets.push_back(j);
+                integrated[j] = true;
+                with_wave_data = with_wave_data or models[j]->uses_wave_data_on_facets();
+            }
+        }
+        facets.update(b, e, states, zg, with_wave_data);
+        dF.clear();
+        for (const auto j:models_on_these_facets)
+        {
+            dF.push_back(models[j]->get_dF(b, e, env, states, t, facets));
+        }
+        size_t facet_index = 0;
+        for (auto that_facet = b ; that_facet != e ; ++that_facet)
+        {
+            for (size_t k = 0 ; k < models_on_these_facets.size() ; ++k)
+            {
+                add_elementary_force(forces[models_on_these_facets[k]], dF[k](that_facet, facet_index, env, states, t), states.G);
+            }
+            ++facet_index;
+        }
+        for (const auto j:models_on_these_facets)
+        {
+            models[j]->calculations_after_surface_integration(states);
+        }
+    }
+}
+
+bool SurfaceForceModel::can_share_surface_integration() const
+{
+    return true;
+}
+
+bool SurfaceForceModel::uses_wave_data_on_facets() const
+{
+    return false;
+}
+
 void SurfaceForceModel::calculations_after_surface_integration(const BodyStates&) const
 {
 }
@@ -58,6 +58,29 @@ class SurfaceForceModel : public ForceModel
             EPoint C; //!< Point of application (used to calculate the torque)
         };
 
+        /**  \brief Quantities which do not depend on the force model, computed once per facet
+          *  \details Shared by all the surface force models of a body integrated over the same facets
+          *           (cf. SurfaceForceIntegrator). Indexed like the facets (in the order of the FacetIterator).
+          *           The buffers are reused from one call to the next.
+          */
+        struct FacetData
+        {
+            FacetData();
+            void update(const FacetIterator& begin_facet,
+                        const FacetIterator& end_facet,
+                        const BodyStates& states,
+                        const ZGCalculator& zg,
+                        const bool with_wave_data //!< Should 'eta' & 'centroids' be computed? (cf. SurfaceForceModel::uses_wave_data_on_facets)
+                        );
+            size_t size() const;
+
+            std::vector<EPoint> dS;                   //!< Area times unit normal (in the mesh frame)
+            std::vector<double> zG;                   //!< z-coordinate of the centroid in the NED frame (in m)
+            std::vector<double> eta;                  //!< Average of the wave elevations at the vertices (in m). Only valid if updated 'with_wave_data'
+            ssc::kinematics::PointMatrixPtr centroids; //!< Centroids (in the mesh frame). Only valid if updated 'with_wave_data'
+            size_t nb_of_facets;
+        };
+
         SurfaceForceModel(const std::string& name, const std::string& body_name_, const EnvironmentAndFrames& env);
         virtual ~SurfaceForceModel();
         Wrench get_force(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const override;
@@ -70,9 +93,20 @@ class SurfaceForceModel : public ForceModel
                                           const FacetIterator &end_facet,
                                           const EnvironmentAndFrames &env,
                                           const BodyStates &states,
-                                          const double t
+                                          const double t,
+                                          const FacetData& facets //!< Only valid while the returned function is used
                                          ) const = 0;
 
+        /**  \brief Can the force be integrated in the same pass over the facets as the other surface force models of the body?
+          *  \details False for the models which do not use SurfaceForceModel::get_force (cf. SurfaceForceIntegrator)
+          */
+        virtual bool can_share_surface_integration() const;
+
+        /**  \brief Does get_dF use FacetData::eta & FacetData::centroids?
+          *  \details False by default: they are then only computed if another model integrated over the same facets uses them.
+          */
+        virtual bool uses_wave_data_on_facets() const;
+
     /**  \brief Compute potential energy of the hydrostatic force model
       */
         double potential_energy(const BodyStates& states, const std::vector<double>& x, const EnvironmentAndFrames& env) const;
@@ -80,7 +114,17 @@ class SurfaceForceModel : public ForceModel
         bool is_a_surface_force_model() const override;
 
     private:
+        friend class SurfaceForceIntegrator;
         SurfaceForceModel();
+        /**  \brief Integrates the forces of several models, in a single pass over the facets of each facet range
+          *  \details Models iterating on the same facets (eg. all the immersed facets) share the same pass.
+          */
+        static void integrate(const std::vector<const SurfaceForceModel*>& models,
+                              const BodyStates& states,
+                              const double t,
+                              const EnvironmentAndFrames& env,
+                              FacetData& facets,
+                              std::vector<Wrench>& forces);
         virtual void calculations_after_surface_integration(const BodyStates&) const;
         virtual FacetIterator begin(const MeshIntersectorPtr& intersector) const = 0;
         virtual FacetIterator end(const MeshIntersectorPtr& intersector) const = 0;
@@ -88,9 +132,8 @@ class SurfaceForceModel : public ForceModel
 
     private:
         ssc::kinematics::Point g_in_NED;
-
-    protected:
-        TR1(shared_ptr)<ZGCalculator> zg_calculator;
+        mutable boost::optional<Wrench> precomputed_force; //!< Set by SurfaceForceIntegrator & used (once) by the next call to get_force
+        mutable FacetData facet_buffer; //!< Used when the force is not computed by SurfaceForceIntegrator (reused from one call to the next)
 };
 
 #endif /* SURFACEFORCEMODEL_HPP_ */
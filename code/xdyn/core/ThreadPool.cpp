@@ -0,0 +1,127 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "ThreadPool.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+ThreadPool::ThreadPool(const size_t nb_of_threads) :
+        mutex(),
+        work_available(),
+        work_done(),
+        task(NULL),
+        nb_of_tasks(0),
+        next_task(0),
+        errors(),
+        nb_of_busy_workers(0),
+        generation(0),
+        stopping(false),
+        workers()
+{
+    if (nb_of_threads == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The number of threads should be at least 1");
+    }
+    for (size_t i = 1 ; i < nb_of_threads ; ++i)
+    {
+        workers.push_back(std::thread(&ThreadPool::work, this));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_available.notify_all();
+    for (auto& worker:workers)
+    {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::get_nb_of_threads() const
+{
+    return workers.size() + 1;
+}
+
+bool ThreadPool::runs_concurrently(const size_t nb_of_tasks_) const
+{
+    return not(workers.empty()) and (nb_of_tasks_ > 1);
+}
+
+void ThreadPool::run_tasks()
+{
+    for (size_t i = next_task++ ; i < nb_of_tasks ; i = next_task++)
+    {
+        try
+        {
+            (*task)(i);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::work()
+{
+    size_t last_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_available.wait(lock, [this, last_generation](){return stopping || (generation != last_generation);});
+            if (stopping)
+            {
+                return;
+            }
+            last_generation = generation;
+        }
+        run_tasks();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            nb_of_busy_workers--;
+        }
+        work_done.notify_one();
+    }
+}
+
+void ThreadPool::run(const size_t nb_of_tasks_, const std::function<void(const size_t)>& task_)
+{
+    if (not(runs_concurrently(nb_of_tasks_)))
+    {
+        for (size_t i = 0 ; i < nb_of_tasks_ ; ++i)
+        {
+            task_(i);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &task_;
+        nb_of_tasks = nb_of_tasks_;
+        next_task = 0;
+        errors.assign(nb_of_tasks_, std::exception_ptr());
+        nb_of_busy_workers = workers.size();
+        generation++;
+    }
+    work_available.notify_all();
+    run_tasks();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        work_done.wait(lock, [this](){return nb_of_busy_workers == 0;});
+        task = NULL;
+    }
+    for (const auto& error:errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
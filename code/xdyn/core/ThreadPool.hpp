@@ -0,0 +1,70 @@
+/*
+ * ThreadPool.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef THREADPOOL_HPP_
+#define THREADPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \brief Runs a given number of independent tasks on a fixed set of threads
+ *  \details Used by Sim to evaluate the bodies concurrently (one task per body).
+ *           The threads are created once (in the constructor) & reused for each
+ *           call to 'run', which only returns when all tasks are done.
+ *           The calling thread also runs tasks, so a pool with N threads only
+ *           creates N-1 worker threads.
+ *           If tasks throw, all tasks are nevertheless run & the exception
+ *           thrown by the task with the lowest index is rethrown by 'run': the
+ *           error reported does not depend on the scheduling of the threads.
+ *  \ingroup simulator
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/ThreadPoolTest.cpp ThreadPoolTest example
+ */
+class ThreadPool
+{
+    public:
+        ThreadPool(const size_t nb_of_threads //!< Total number of threads running the tasks (including the calling thread)
+                  );
+        ~ThreadPool();
+
+        size_t get_nb_of_threads() const;
+
+        /**  \brief Calls task(0), task(1), ..., task(nb_of_tasks-1) concurrently & waits for all of them to finish
+          */
+        void run(const size_t nb_of_tasks, const std::function<void(const size_t)>& task);
+
+        /**  \brief Would 'run' execute nb_of_tasks tasks on several threads? (otherwise they are run serially by the calling thread)
+          *  \details Lets the caller warn the models which are only deterministic if they are called serially (cf. Sim::dx_dt).
+          */
+        bool runs_concurrently(const size_t nb_of_tasks) const;
+
+    private:
+        ThreadPool(); // Disabled
+        ThreadPool(const ThreadPool&); // Disabled
+        ThreadPool& operator=(const ThreadPool&); // Disabled
+        void work();
+        void run_tasks();
+
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::condition_variable work_done;
+        const std::function<void(const size_t)>* task;
+        size_t nb_of_tasks;
+        std::atomic<size_t> next_task;
+        std::vector<std::exception_ptr> errors;
+        size_t nb_of_busy_workers;
+        size_t generation;
+        bool stopping;
+        std::vector<std::thread> workers;
+};
+
+#endif /* THREADPOOL_HPP_ */
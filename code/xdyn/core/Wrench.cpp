@@ -101,6 +101,35 @@ void Wrench::change_point_and_frame(const ssc::kinematics::Point& P, const std::
     change_frame(new_frame, k);
 }
 
+void Wrench::change_point_and_frame(const ssc::kinematics::Point& P, const std::string& new_frame, const ssc::kinematics::Transform& from_frame_to_frame_of_P, const ssc::kinematics::Transform& from_new_frame_to_frame)
+{
+    if (point.get_frame() != frame)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The point of the wrench should be expressed in frame '" << frame << "', but it is expressed in frame '" << point.get_frame() << "'");
+    }
+    if (P != point)
+    {
+        Eigen::Vector3d B_coord = P.v;
+        if (P.get_frame() != frame)
+        {
+            auto t = from_frame_to_frame_of_P;
+            t.swap();
+            B_coord = (t * P).v;
+        }
+        torque = torque + (point.v - B_coord).cross(force);
+        point = P;
+    }
+    if (new_frame != frame)
+    {
+        change_frame(new_frame, from_new_frame_to_frame.get_rot());
+    }
+}
+
+bool Wrench::is_expressed_in(const std::string& frame_) const
+{
+    return (frame == frame_) and (point.get_frame() == frame_);
+}
+
 Wrench Wrench::change_frame(const std::string& new_frame, const ssc::kinematics::RotationMatrix& R) const
 {
     Wrench ret(*this);
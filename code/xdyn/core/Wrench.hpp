@@ -39,6 +39,14 @@ public:
     void change_frame(const std::string& new_frame, const ssc::kinematics::KinematicsPtr& k);
     void transport_to(const ssc::kinematics::Point& P, const ssc::kinematics::KinematicsPtr& k);
     void change_point_and_frame(const ssc::kinematics::Point& P, const std::string new_frame, const ssc::kinematics::KinematicsPtr& k);
+    /**  \brief Same as change_point_and_frame(P, new_frame, k) for a wrench whose point is expressed in its frame, without looking up the transforms in Kinematics
+      */
+    void change_point_and_frame(const ssc::kinematics::Point& P,
+                                const std::string& new_frame,
+                                const ssc::kinematics::Transform& from_frame_to_frame_of_P, //!< k->get(get_frame(), P.get_frame())
+                                const ssc::kinematics::Transform& from_new_frame_to_frame   //!< k->get(new_frame, get_frame())
+                                );
+    bool is_expressed_in(const std::string& frame) const; //!< Are the wrench & its point both expressed in 'frame'?
 
     Wrench change_frame(const std::string& new_frame, const ssc::kinematics::RotationMatrix& R) const;
     Wrench change_frame(const std::string& new_frame, const ssc::kinematics::KinematicsPtr& k) const;
@@ -49,6 +49,38 @@ class RandomForce : public ForceModel
         ssc::random_data_generator::DataGenerator a;
 };
 
+class RemoteForce : public ForceModel
+{
+    public:
+        RemoteForce(const EnvironmentAndFrames& env)
+             : ForceModel("mock", std::vector<std::string>(), YamlPosition(), "body", env), dates_of_requests()
+        {
+        }
+
+        Wrench get_force(
+            const BodyStates& /*states*/,
+            const double /*t*/,
+            const EnvironmentAndFrames& /*env*/,
+            const std::map<std::string,double>& /*commands*/) const
+        {
+            const ssc::kinematics::Vector6d ret = ssc::kinematics::Vector6d::Zero();
+            return Wrench(ssc::kinematics::Point(name, 0, 0, 0), name, ret);
+        }
+
+        bool is_remote() const
+        {
+            return true;
+        }
+
+        std::vector<double> dates_of_requests;
+
+    private:
+        void send_request(const BodyStates& /*states*/, const double t, const EnvironmentAndFrames& /*env*/, const std::map<std::string,double>& /*commands*/)
+        {
+            dates_of_requests.push_back(t);
+        }
+};
+
 ForceModelTest::ForceModelTest() : a(ssc::random_data_generator::DataGenerator(545121))
 {
 }
@@ -83,3 +115,22 @@ TEST_F(ForceModelTest, bug_2838)
     ASSERT_NEAR((states.G - w.get_point()).norm(), 0, 1E-10);
 //! [ForceModelTest expected output]
 }
+
+TEST_F(ForceModelTest, only_remote_force_models_send_requests_before_being_evaluated)
+{
+    EnvironmentAndFrames env = make_env(a);
+    RandomForce local(a, env);
+    RemoteForce remote(env);
+    BodyStates states;
+    states.G = ssc::kinematics::Point("body", 1, 2, 3);
+    const std::map<std::string,double> commands;
+    ASSERT_FALSE(local.is_remote());
+    ASSERT_TRUE(remote.is_remote());
+    local.start(states, 12, env, commands);
+    remote.start(states, 12, env, commands);
+    ASSERT_EQ((size_t)1, remote.dates_of_requests.size());
+    ASSERT_EQ(12, remote.dates_of_requests.back());
+    ASSERT_EQ("body", local(states, 12, env, commands).get_frame());
+    ASSERT_EQ("body", remote(states, 12, env, commands).get_frame());
+    ASSERT_EQ((size_t)1, remote.dates_of_requests.size());
+}
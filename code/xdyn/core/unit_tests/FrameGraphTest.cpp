@@ -0,0 +1,103 @@
+/*
+ * FrameGraphTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "FrameGraphTest.hpp"
+#include "FrameGraph.hpp"
+#include "random_kinematics.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+FrameGraphTest::FrameGraphTest() : a(ssc::random_data_generator::DataGenerator(17102026))
+{
+}
+
+FrameGraphTest::~FrameGraphTest()
+{
+}
+
+void FrameGraphTest::SetUp()
+{
+}
+
+void FrameGraphTest::TearDown()
+{
+}
+
+TEST_F(FrameGraphTest, example)
+{
+//! [FrameGraphTest example]
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(random_transform(a, "NED", "body"));
+    FrameGraph frames;
+    const FrameHandle ned_to_body = frames.get_handle("NED", "body"); // When building the force models
+    frames.update(k);                                                 // Once per state update
+    const ssc::kinematics::Transform& T = frames.get(ned_to_body);    // No lookup in Kinematics
+//! [FrameGraphTest example]
+    ASSERT_TRUE(frames.is_up_to_date(ned_to_body));
+    const ssc::kinematics::Transform expected = k->get("NED", "body");
+    ASSERT_TRUE(expected.get_rot().isApprox(T.get_rot()));
+    ASSERT_TRUE(expected.get_point().v.isApprox(T.get_point().v));
+}
+
+TEST_F(FrameGraphTest, each_transform_is_only_computed_once)
+{
+    FrameGraph frames;
+    frames.get_handle("NED", "body");
+    frames.get_handle("NED", "body");
+    frames.get_handle("body", "NED");
+    ASSERT_EQ((size_t)2, frames.get_nb_of_transforms());
+}
+
+TEST_F(FrameGraphTest, transforms_are_only_up_to_date_between_update_and_invalidate)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(random_transform(a, "NED", "body"));
+    FrameGraph frames;
+    const FrameHandle ned_to_body = frames.get_handle("NED", "body");
+    ASSERT_FALSE(frames.is_up_to_date(ned_to_body));
+    ASSERT_THROW(frames.get(ned_to_body), InternalErrorException);
+    frames.update(k);
+    ASSERT_TRUE(frames.is_up_to_date(ned_to_body));
+    frames.invalidate();
+    ASSERT_FALSE(frames.is_up_to_date(ned_to_body));
+    ASSERT_THROW(frames.get(ned_to_body), InternalErrorException);
+}
+
+TEST_F(FrameGraphTest, update_uses_the_latest_transforms)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(random_transform(a, "NED", "body"));
+    FrameGraph frames;
+    const FrameHandle ned_to_body = frames.get_handle("NED", "body");
+    frames.update(k);
+    k->add(random_transform(a, "NED", "body"));
+    frames.update(k);
+    ASSERT_TRUE(k->get("NED", "body").get_rot().isApprox(frames.get(ned_to_body).get_rot()));
+    ASSERT_TRUE(k->get("NED", "body").get_point().v.isApprox(frames.get(ned_to_body).get_point().v));
+}
+
+TEST_F(FrameGraphTest, transforms_unknown_to_kinematics_are_never_up_to_date)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(random_transform(a, "NED", "body"));
+    FrameGraph frames;
+    const FrameHandle ned_to_body = frames.get_handle("NED", "body");
+    const FrameHandle ned_to_mesh = frames.get_handle("NED", "mesh(body)");
+    ASSERT_NO_THROW(frames.update(k));
+    ASSERT_TRUE(frames.is_up_to_date(ned_to_body));
+    ASSERT_FALSE(frames.is_up_to_date(ned_to_mesh));
+}
+
+TEST_F(FrameGraphTest, handles_of_other_frame_graphs_are_never_up_to_date)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(random_transform(a, "NED", "body"));
+    FrameGraph frames;
+    FrameGraph other_frames;
+    frames.get_handle("NED", "body");
+    const FrameHandle other_handle = other_frames.get_handle("NED", "body");
+    frames.update(k);
+    ASSERT_FALSE(frames.is_up_to_date(other_handle));
+    ASSERT_FALSE(frames.is_up_to_date(FrameHandle()));
+}
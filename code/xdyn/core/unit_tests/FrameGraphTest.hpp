@@ -0,0 +1,24 @@
+/*
+ * FrameGraphTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#ifndef FRAMEGRAPHTEST_HPP_
+#define FRAMEGRAPHTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class FrameGraphTest : public ::testing::Test
+{
+    protected:
+        FrameGraphTest();
+        virtual ~FrameGraphTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* FRAMEGRAPHTEST_HPP_ */
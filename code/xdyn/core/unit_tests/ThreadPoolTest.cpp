@@ -0,0 +1,95 @@
+/*
+ * ThreadPoolTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "ThreadPoolTest.hpp"
+#include "ThreadPool.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+#include <stdexcept>
+#include <string>
+
+ThreadPoolTest::ThreadPoolTest() : a(ssc::random_data_generator::DataGenerator(17102026))
+{
+}
+
+ThreadPoolTest::~ThreadPoolTest()
+{
+}
+
+void ThreadPoolTest::SetUp()
+{
+}
+
+void ThreadPoolTest::TearDown()
+{
+}
+
+TEST_F(ThreadPoolTest, example)
+{
+//! [ThreadPoolTest example]
+    ThreadPool pool(4);
+    std::vector<double> squares(100);
+    pool.run(squares.size(), [&squares](const size_t i){squares[i] = (double)(i*i);});
+//! [ThreadPoolTest example]
+    ASSERT_EQ((size_t)4, pool.get_nb_of_threads());
+    for (size_t i = 0 ; i < squares.size() ; ++i)
+    {
+        ASSERT_EQ((double)(i*i), squares[i]);
+    }
+}
+
+TEST_F(ThreadPoolTest, can_be_reused_many_times)
+{
+    const size_t nb_of_threads = a.random<size_t>().between(1, 8);
+    ThreadPool pool(nb_of_threads);
+    std::vector<size_t> out(a.random<size_t>().between(1, 30));
+    for (size_t k = 0 ; k < 1000 ; ++k)
+    {
+        pool.run(out.size(), [&out, k](const size_t i){out[i] = i + k;});
+        for (size_t i = 0 ; i < out.size() ; ++i)
+        {
+            ASSERT_EQ(i + k, out[i]) << "nb_of_threads = " << nb_of_threads;
+        }
+    }
+}
+
+TEST_F(ThreadPoolTest, should_rethrow_exception_of_first_failing_task)
+{
+    ThreadPool pool(3);
+    std::vector<bool> done(10, false);
+    for (size_t k = 0 ; k < 100 ; ++k)
+    {
+        try
+        {
+            pool.run(done.size(), [&done](const size_t i){if ((i == 3) || (i == 7)) throw std::runtime_error(std::to_string(i)); done[i] = true;});
+            FAIL() << "ThreadPool::run should have thrown";
+        }
+        catch (const std::runtime_error& e)
+        {
+            ASSERT_EQ("3", std::string(e.what()));
+        }
+    }
+    // All other tasks are run anyway
+    for (size_t i = 0 ; i < done.size() ; ++i)
+    {
+        ASSERT_EQ((i != 3) && (i != 7), done[i]) << "i = " << i;
+    }
+}
+
+TEST_F(ThreadPoolTest, tasks_only_run_concurrently_if_there_are_several_threads_and_several_tasks)
+{
+    ASSERT_FALSE(ThreadPool(1).runs_concurrently(8));
+    ASSERT_FALSE(ThreadPool(4).runs_concurrently(1));
+    ASSERT_TRUE(ThreadPool(4).runs_concurrently(2));
+    // Serial runs are done by the calling thread
+    ThreadPool pool(4);
+    std::thread::id id;
+    pool.run(1, [&id](const size_t){id = std::this_thread::get_id();});
+    ASSERT_EQ(std::this_thread::get_id(), id);
+}
+
+TEST_F(ThreadPoolTest, should_throw_if_number_of_threads_is_zero)
+{
+    ASSERT_THROW(ThreadPool(0), InternalErrorException);
+}
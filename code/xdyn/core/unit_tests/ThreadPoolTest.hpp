@@ -0,0 +1,24 @@
+/*
+ * ThreadPoolTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#ifndef THREADPOOLTEST_HPP_
+#define THREADPOOLTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class ThreadPoolTest : public ::testing::Test
+{
+    protected:
+        ThreadPoolTest();
+        virtual ~ThreadPoolTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* THREADPOOLTEST_HPP_ */
@@ -139,6 +139,32 @@ TEST_F(WrenchTest, can_change_point_in_different_frame)
     ASSERT_TRUE((torque + BA_2.cross(force)).isApprox(wrench.get_torque()));
 }
 
+TEST_F(WrenchTest, can_change_point_and_frame_with_transforms_computed_beforehand)
+{
+    const ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics);
+    const YamlPosition position(YamlCoordinates(a.random<double>(),a.random<double>(),a.random<double>()),
+                                YamlAngle(a.random<double>(), a.random<double>(), a.random<double>()),
+                                "body");
+    YamlRotation rotation_convention("angle", { "z", "y'", "x''" });
+    k->add(make_transform(position, "internal", rotation_convention));
+    const ssc::kinematics::Point G("body", 1, 2, 3);
+    Eigen::Vector3d force;
+    force << a.random<double>(), a.random<double>(), a.random<double>();
+    Eigen::Vector3d torque;
+    torque << a.random<double>(), a.random<double>(), a.random<double>();
+    const Wrench wrench(ssc::kinematics::Point("internal", 4, 5, 6), "internal", force, torque);
+    ASSERT_TRUE(wrench.is_expressed_in("internal"));
+    ASSERT_FALSE(wrench.is_expressed_in("body"));
+    const Wrench expected = wrench.change_point_and_frame(G, "body", k);
+    Wrench actual(wrench);
+    actual.change_point_and_frame(G, "body", k->get("internal", "body"), k->get("body", "internal"));
+    ASSERT_EQ("body", actual.get_frame());
+    ASSERT_EQ("body", actual.get_point().get_frame());
+    ASSERT_TRUE(G.v.isApprox(actual.get_point().v));
+    ASSERT_TRUE(expected.get_force().isApprox(actual.get_force()));
+    ASSERT_TRUE(expected.get_torque().isApprox(actual.get_torque()));
+}
+
 TEST_F(WrenchTest, addition_operator_works)
 {
     const ssc::kinematics::Point A("frame1", 1, 2, 3);
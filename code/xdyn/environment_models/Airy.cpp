@@ -11,24 +11,29 @@
 
 #include <ssc/macros.hpp>
 #include <Eigen/Dense>
+#include <cmath> // For isnan
 #include <vector>
 
-Airy::Airy(const FlatDiscreteDirectionalWaveSpectrum& spectrum) : WaveModel(spectrum)
+Airy::Airy(const FlatDiscreteDirectionalWaveSpectrum& spectrum) : WaveModel(spectrum), kernels(flat_spectrum)
 {
 }
 
-Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_): WaveModel(spectrum_)
+Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_): WaveModel(spectrum_), kernels(flat_spectrum)
 {
 }
 
-Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_, const double constant_random_phase) : WaveModel(spectrum_, constant_random_phase)
+Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_, const double constant_random_phase) : WaveModel(spectrum_, constant_random_phase), kernels(flat_spectrum)
 {
 }
 
-Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_, const int random_number_generator_seed) : WaveModel(spectrum_, random_number_generator_seed)
+Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_, const int random_number_generator_seed) : WaveModel(spectrum_, random_number_generator_seed), kernels(flat_spectrum)
 {
 }
 
+WaveKernelInstructionSet Airy::get_instruction_set() const
+{
+    return kernels.get_instruction_set();
+}
 
 double Airy::evaluate_rao(
         const double x,                           //!< x-position of the RAO's calculation point in the NED frame (in meters)
@@ -61,24 +66,69 @@ std::vector<double> Airy::elevation(
     const double t                //!< Current time instant (in seconds)
     ) const
 {
-    std::vector<double> zeta(x.size());
-    const size_t n = flat_spectrum.psi.size();
+    std::vector<double> zeta;
+    if (phasor_cache && phasor_cache->elevation(x, y, t, zeta))
+    {
+        return zeta;
+    }
+    zeta.resize(x.size());
+    kernels.elevation(x.size(), x.data(), y.data(), t, zeta.data());
+    return zeta;
+}
 
-    for (size_t j = 0; j < zeta.size(); ++j) {
-        for (size_t i = 0 ; i < n ; ++i)
+std::vector<double> Airy::dynamic_pressure(
+    const double rho,               //!< water density (in kg/m^3)
+    const double g,                 //!< gravity (in m/s^2)
+    const std::vector<double> &x,   //!< x-positions in the NED frame (in meters)
+    const std::vector<double> &y,   //!< y-positions in the NED frame (in meters)
+    const std::vector<double> &z,   //!< z-positions in the NED frame (in meters)
+    const std::vector<double> &eta, //!< Wave elevations at (x,y) in the NED frame (in meters)
+    const double t                  //!< Current time instant (in seconds)
+    ) const
+{
+    if (not(kernels.has_closed_form_depth_factor()))
+    {
+        return dynamic_pressure_with_depth_factor_closure(rho, g, x, y, z, eta, t);
+    }
+    const double h = kernels.get_depth();
+    std::vector<double> p(x.size(), 0);
+    // Only the points in the fluid are sent to the kernels
+    std::vector<size_t> idx;
+    std::vector<double> xs, ys, zs;
+    idx.reserve(x.size());
+    xs.reserve(x.size());
+    ys.reserve(x.size());
+    zs.reserve(x.size());
+    for (size_t j = 0; j < p.size(); ++j)
+    {
+        if (std::isnan(z[j]))
         {
-            const double a = flat_spectrum.a[i];
-            const double omega_t = flat_spectrum.omega[i] * t;
-            const double k_xCosPsi_ySinPsi = flat_spectrum.k[i] * (x.at(j) * flat_spectrum.cos_psi[i] + y.at(j) * flat_spectrum.sin_psi[i]);
-            const double theta = flat_spectrum.phase[i];
-            zeta.at(j) -= a * sin(-omega_t + k_xCosPsi_ySinPsi + theta);
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "z (value to rescale, in meters) was NaN");
+        }
+        if (std::isnan(eta[j]))
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "eta (wave height, in meters) was NaN");
+        }
+        const bool above_free_surface = z[j] < eta[j];
+        const bool below_seabed = (h > 0) && (z[j] > h);
+        if (not(above_free_surface) && not(below_seabed))
+        {
+            idx.push_back(j);
+            xs.push_back(x[j]);
+            ys.push_back(y[j]);
+            zs.push_back(kernels.rescaled_z(z[j], eta[j]));
         }
     }
-
-    return zeta;
+    std::vector<double> ps(idx.size());
+    kernels.dynamic_pressure(idx.size(), xs.data(), ys.data(), zs.data(), t, ps.data());
+    for (size_t j = 0; j < idx.size(); ++j)
+    {
+        p[idx[j]] = rho * g * ps[j];
+    }
+    return p;
 }
 
-std::vector<double> Airy::dynamic_pressure(
+std::vector<double> Airy::dynamic_pressure_with_depth_factor_closure(
     const double rho,               //!< water density (in kg/m^3)
     const double g,                 //!< gravity (in m/s^2)
     const std::vector<double> &x,   //!< x-positions in the NED frame (in meters)
@@ -132,6 +182,53 @@ ssc::kinematics::PointMatrix Airy::orbital_velocity(
         const double t,                //!< Current time instant (in seconds)
         const std::vector<double>& eta //!< Wave heights at x,y,t (in meters)
         ) const
+{
+    if (not(kernels.has_closed_form_depth_factor()))
+    {
+        return orbital_velocity_with_depth_factor_closure(g, x, y, z, t, eta);
+    }
+    const double h = kernels.get_depth();
+    ssc::kinematics::PointMatrix M("NED", x.size());
+    M.m.setZero();
+    // Only the points in the fluid are sent to the kernels. No stretching for the orbital velocity.
+    std::vector<size_t> idx;
+    std::vector<double> xs, ys, zs;
+    idx.reserve(x.size());
+    xs.reserve(x.size());
+    ys.reserve(x.size());
+    zs.reserve(x.size());
+    for (size_t point_index = 0; point_index < x.size(); ++point_index)
+    {
+        const bool above_free_surface = z.at(point_index) < eta.at(point_index);
+        const bool below_seabed = (h > 0) && (z[point_index] > h);
+        if (not(above_free_surface) && not(below_seabed))
+        {
+            idx.push_back(point_index);
+            xs.push_back(x[point_index]);
+            ys.push_back(y[point_index]);
+            zs.push_back(z[point_index]);
+        }
+    }
+    std::vector<double> u(idx.size()), v(idx.size()), w(idx.size());
+    kernels.orbital_velocity(idx.size(), xs.data(), ys.data(), zs.data(), t, u.data(), v.data(), w.data());
+    for (size_t j = 0; j < idx.size(); ++j)
+    {
+        const Eigen::Index col = static_cast<Eigen::Index>(idx[j]);
+        M.m(0, col) = u[j] * g;
+        M.m(1, col) = v[j] * g;
+        M.m(2, col) = w[j] * g;
+    }
+    return M;
+}
+
+ssc::kinematics::PointMatrix Airy::orbital_velocity_with_depth_factor_closure(
+        const double g,                //!< gravity (in m/s^2)
+        const std::vector<double>& x,  //!< x-positions in the NED frame (in meters)
+        const std::vector<double>& y,  //!< y-positions in the NED frame (in meters)
+        const std::vector<double>& z,  //!< z-positions in the NED frame (in meters)
+        const double t,                //!< Current time instant (in seconds)
+        const std::vector<double>& eta //!< Wave heights at x,y,t (in meters)
+        ) const
 {
     ssc::kinematics::PointMatrix M("NED", x.size());
     for (size_t point_index = 0; point_index < x.size(); ++point_index) {
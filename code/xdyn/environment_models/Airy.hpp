@@ -11,8 +11,10 @@
 #include <ssc/kinematics.hpp>
 
 #include "xdyn/environment_models/WaveModel.hpp"
+#include "xdyn/environment_models/WaveKernels.hpp"
 
 /** \brief First order Stokes wave model
+ *  \details The sums over the rays are evaluated by WaveKernels (SIMD if the CPU supports it).
  *  \ingroup wave_models
  *  \section ex1 Example
  *  \snippet environment_models/unit_tests/AiryTest.cpp AiryTest example
@@ -38,6 +40,10 @@ class Airy : public WaveModel
             const std::vector<double>& rao_phase //!< Phase of the RAO
             ) const;
 
+        /**  \brief Instruction set used to evaluate the elevation, dynamic pressure & orbital velocity
+          */
+        WaveKernelInstructionSet get_instruction_set() const;
+
     private:
         Airy(); // Disabled
 
@@ -95,6 +101,29 @@ class Airy : public WaveModel
             const std::vector<double> &eta, //!< Wave elevations at (x,y) in the NED frame (in meters)
             const double t                  //!< Current time instant (in seconds)
             ) const;
+
+        /**  \brief Evaluates pdyn_factor & pdyn_factor_sh through their std::function (no closed form available)
+          */
+        std::vector<double> dynamic_pressure_with_depth_factor_closure(
+            const double rho,               //!< water density (in kg/m^3)
+            const double g,                 //!< gravity (in m/s^2)
+            const std::vector<double> &x,   //!< x-positions in the NED frame (in meters)
+            const std::vector<double> &y,   //!< y-positions in the NED frame (in meters)
+            const std::vector<double> &z,   //!< z-positions in the NED frame (in meters)
+            const std::vector<double> &eta, //!< Wave elevations at (x,y) in the NED frame (in meters)
+            const double t                  //!< Current time instant (in seconds)
+            ) const;
+
+        ssc::kinematics::PointMatrix orbital_velocity_with_depth_factor_closure(
+            const double g,                //!< gravity (in m/s^2)
+            const std::vector<double>& x,  //!< x-positions in the NED frame (in meters)
+            const std::vector<double>& y,  //!< y-positions in the NED frame (in meters)
+            const std::vector<double>& z,  //!< z-positions in the NED frame (in meters)
+            const double t,                //!< Current time instant (in seconds)
+            const std::vector<double>& eta //!< Wave heights at x,y,t (in meters)
+            ) const;
+
+        WaveKernels kernels;
 };
 
 #endif /* AIRY_HPP_ */
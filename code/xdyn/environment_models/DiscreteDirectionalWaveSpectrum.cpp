@@ -12,6 +12,22 @@
 #include <cmath>
 #define PI M_PI
 
+DepthFactorParameters::DepthFactorParameters() :
+    known(false),
+    h(0),
+    stretching_delta(0),
+    stretching_h(0)
+{
+}
+
+DepthFactorParameters::DepthFactorParameters(const double h_, const double stretching_delta_, const double stretching_h_) :
+    known(true),
+    h(h_),
+    stretching_delta(stretching_delta_),
+    stretching_h(stretching_h_)
+{
+}
+
 FlatDiscreteDirectionalWaveSpectrum::FlatDiscreteDirectionalWaveSpectrum() :
     a(),
     omega(),
@@ -22,7 +38,8 @@ FlatDiscreteDirectionalWaveSpectrum::FlatDiscreteDirectionalWaveSpectrum() :
     phase(),
     band({}),
     pdyn_factor(),
-    pdyn_factor_sh()
+    pdyn_factor_sh(),
+    depth_factor()
 {
 }
 std::vector<double> FlatDiscreteDirectionalWaveSpectrum::get_periods() const
@@ -45,6 +62,7 @@ DiscreteDirectionalWaveSpectrum::DiscreteDirectionalWaveSpectrum() :
     phase(),
     pdyn_factor(),
     pdyn_factor_sh(),
+    depth_factor(),
     energy_fraction(1),
     periodic(false),
     resolution(0),
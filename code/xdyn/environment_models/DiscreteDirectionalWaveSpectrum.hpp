@@ -16,6 +16,21 @@
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 
+/** \brief Parameters of the closed-form expressions behind pdyn_factor & pdyn_factor_sh
+ *  \details Lets the wave kernels (cf. WaveKernels) evaluate the depth factors without
+ *            going through a std::function for each (point, ray) pair.
+ *  \ingroup wave_models
+ */
+struct DepthFactorParameters
+{
+    DepthFactorParameters();
+    DepthFactorParameters(const double h, const double stretching_delta, const double stretching_h);
+    bool known;              //!< False if pdyn_factor & pdyn_factor_sh were set without a closed form (eg. in unit tests)
+    double h;                //!< Water depth (in meters), 0 for infinite depth
+    double stretching_delta; //!< 0 for Wheeler stretching, 1 for linear extrapolation
+    double stretching_h;     //!< Depth over which the stretching is taken into account (in meters)
+};
+
 /** \author cady
  *  \date Jul 31, 2014, 1:08:15 PM
  *  \brief Used by 'discretize'
@@ -39,6 +54,7 @@ struct DiscreteDirectionalWaveSpectrum
 
     std::function<double(double,double,double)> pdyn_factor;    //!< Factor used when computing the dynamic pressure (no unit)
     std::function<double(double,double,double)> pdyn_factor_sh; //!< Factor used when computing the orbital velocity (no unit)
+    DepthFactorParameters depth_factor;                         //!< Closed form of pdyn_factor & pdyn_factor_sh
 
     double energy_fraction;                                     //!< Between 0 and 1: sum(rays taken into account)/sum(rays total)
     bool periodic;                                              //!< Space periodic waves or not
@@ -71,6 +87,7 @@ struct FlatDiscreteDirectionalWaveSpectrum
     std::vector<int> band;       // Used to allocate the different wave rays into the right renderer bands
     std::function<double(double,double,double)> pdyn_factor;    //!< Factor used when computing the dynamic pressure (no unit)
     std::function<double(double,double,double)> pdyn_factor_sh; //!< Factor used when computing the orbital velocity (no unit)
+    DepthFactorParameters depth_factor;                         //!< Closed form of pdyn_factor & pdyn_factor_sh
     std::vector<double> get_periods() const; //< Get the ray periods as a vector, from omega attribute (in s)
 };
 
@@ -39,3 +39,13 @@ double Stretching::rescaled_z(const double z, //!< z value we wish to rescale (i
     }
     return (z-h)*(delta*ksi-h)/(ksi-h)+h;
 }
+
+double Stretching::get_delta() const
+{
+    return delta;
+}
+
+double Stretching::get_h() const
+{
+    return h;
+}
@@ -30,6 +30,8 @@ class Stretching
         double rescaled_z(const double original_z, //!< z value we wish to rescale (in meters)
                           const double wave_height //!< Wave height (in meters), z being oriented downwards
                          ) const;
+        double get_delta() const;
+        double get_h() const;
 
     private:
         Stretching(); // Disabled
@@ -0,0 +1,49 @@
+/*
+ * WaveKernelRays.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEKERNELRAYS_HPP_
+#define WAVEKERNELRAYS_HPP_
+
+#include <cstddef>
+
+/** \brief Structure-of-arrays view of the rays, as consumed by the wave kernels
+ *  \details All arrays have 'n' elements, 'n' being a multiple of 8: the
+ *           extra rays have a zero amplitude so they do not contribute to the sums.
+ *           Only plain pointers are used here because this header is included by
+ *           the files compiled with -mavx2 or -mavx512f: those must not instantiate
+ *           any STL code, as the linker could then pick their AVX version of a
+ *           shared inline function for the whole binary.
+ *  \ingroup wave_models
+ */
+struct WaveKernelRays
+{
+    size_t n;                                 //!< Number of rays (padded to a multiple of 8)
+    const double* a;                          //!< Amplitude (in m)
+    const double* omega;                      //!< Angular frequency (in rad/s)
+    const double* k;                          //!< Wave number (in 1/m)
+    const double* k_cos_psi;                  //!< k*cos(psi) (in 1/m)
+    const double* k_sin_psi;                  //!< k*sin(psi) (in 1/m)
+    const double* phase;                      //!< Random phase (in rad)
+    const double* a_k_omega_cos_psi;          //!< a*k/omega*cos(psi) (in s), used for the orbital velocity
+    const double* a_k_omega_sin_psi;          //!< a*k/omega*sin(psi) (in s), used for the orbital velocity
+    const double* a_k_omega;                  //!< a*k/omega (in s), used for the orbital velocity
+    const double* inv_one_plus_exp_minus_2kh; //!< 1/(1+exp(-2kh)) (no unit), only used in finite depth
+    double h;                                 //!< Water depth (in m), 0 for infinite depth
+};
+
+#define WAVE_KERNELS_NB_OF_RAO_SUMS 6 //!< One per degree of freedom (X, Y, Z, K, M, N)
+
+// Implemented in WaveKernelsAVX2.cpp & WaveKernelsAVX512.cpp, which are only compiled on x86-64 (cf. XDYN_WAVE_KERNELS_X86)
+void wave_kernels_elevation_avx2(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double t, double* eta);
+void wave_kernels_dynamic_pressure_avx2(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* p);
+void wave_kernels_orbital_velocity_avx2(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* u, double* v, double* w);
+void wave_kernels_rao_sums_avx2(const WaveKernelRays& rays, const double* const* amplitudes, const double* const* phases, const double x, const double y, const double t, double* w);
+void wave_kernels_elevation_avx512(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double t, double* eta);
+void wave_kernels_dynamic_pressure_avx512(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* p);
+void wave_kernels_orbital_velocity_avx512(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* u, double* v, double* w);
+void wave_kernels_rao_sums_avx512(const WaveKernelRays& rays, const double* const* amplitudes, const double* const* phases, const double x, const double y, const double t, double* w);
+
+#endif /* WAVEKERNELRAYS_HPP_ */
@@ -0,0 +1,333 @@
+/*
+ * WaveKernels.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WaveKernels.hpp"
+#include "DiscreteDirectionalWaveSpectrum.hpp"
+#include <algorithm> // std::min
+#include <cmath>
+
+#define PADDING 8
+
+std::string to_string(const WaveKernelInstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case WaveKernelInstructionSet::AVX512:
+            return "AVX-512";
+        case WaveKernelInstructionSet::AVX2:
+            return "AVX2";
+        case WaveKernelInstructionSet::SCALAR:
+        default:
+            return "scalar";
+    }
+}
+
+WaveKernelInstructionSet WaveKernels::best_available_instruction_set()
+{
+#if defined(XDYN_WAVE_KERNELS_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return WaveKernelInstructionSet::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return WaveKernelInstructionSet::AVX2;
+    }
+#endif
+    return WaveKernelInstructionSet::SCALAR;
+}
+
+WaveKernels::WaveKernels() :
+    instruction_set(WaveKernelInstructionSet::SCALAR),
+    closed_form_depth_factor(false),
+    stretching_delta(0),
+    stretching_h(0),
+    a(),
+    omega(),
+    k(),
+    k_cos_psi(),
+    k_sin_psi(),
+    phase(),
+    a_k_omega_cos_psi(),
+    a_k_omega_sin_psi(),
+    a_k_omega(),
+    inv_one_plus_exp_minus_2kh(),
+    rays()
+{
+    update_view();
+}
+
+WaveKernels::WaveKernels(const FlatDiscreteDirectionalWaveSpectrum& spectrum) :
+    WaveKernels(spectrum, best_available_instruction_set())
+{
+}
+
+WaveKernels::WaveKernels(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const WaveKernelInstructionSet requested_instruction_set) :
+    instruction_set(std::min(requested_instruction_set, best_available_instruction_set())),
+    closed_form_depth_factor(spectrum.depth_factor.known),
+    stretching_delta(spectrum.depth_factor.stretching_delta),
+    stretching_h(spectrum.depth_factor.stretching_h),
+    a(),
+    omega(),
+    k(),
+    k_cos_psi(),
+    k_sin_psi(),
+    phase(),
+    a_k_omega_cos_psi(),
+    a_k_omega_sin_psi(),
+    a_k_omega(),
+    inv_one_plus_exp_minus_2kh(),
+    rays()
+{
+    const size_t n = spectrum.a.size();
+    const size_t padded_n = PADDING*((n + PADDING - 1)/PADDING);
+    // Padding rays have a zero amplitude (and no NaN), so they do not contribute to the sums
+    a.resize(padded_n, 0);
+    omega.resize(padded_n, 0);
+    k.resize(padded_n, 0);
+    k_cos_psi.resize(padded_n, 0);
+    k_sin_psi.resize(padded_n, 0);
+    phase.resize(padded_n, 0);
+    a_k_omega_cos_psi.resize(padded_n, 0);
+    a_k_omega_sin_psi.resize(padded_n, 0);
+    a_k_omega.resize(padded_n, 0);
+    inv_one_plus_exp_minus_2kh.resize(padded_n, 1);
+    const double h = spectrum.depth_factor.h;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        a[i] = spectrum.a[i];
+        omega[i] = spectrum.omega[i];
+        k[i] = spectrum.k[i];
+        k_cos_psi[i] = spectrum.k[i]*spectrum.cos_psi[i];
+        k_sin_psi[i] = spectrum.k[i]*spectrum.sin_psi[i];
+        phase[i] = spectrum.phase[i];
+        a_k_omega[i] = spectrum.a[i]*spectrum.k[i]/spectrum.omega[i];
+        a_k_omega_cos_psi[i] = a_k_omega[i]*spectrum.cos_psi[i];
+        a_k_omega_sin_psi[i] = a_k_omega[i]*spectrum.sin_psi[i];
+        if (h > 0)
+        {
+            inv_one_plus_exp_minus_2kh[i] = 1/(1 + std::exp(-2*spectrum.k[i]*h));
+        }
+    }
+    update_view();
+    rays.h = h;
+}
+
+WaveKernels::WaveKernels(const WaveKernels& rhs) :
+    instruction_set(rhs.instruction_set),
+    closed_form_depth_factor(rhs.closed_form_depth_factor),
+    stretching_delta(rhs.stretching_delta),
+    stretching_h(rhs.stretching_h),
+    a(rhs.a),
+    omega(rhs.omega),
+    k(rhs.k),
+    k_cos_psi(rhs.k_cos_psi),
+    k_sin_psi(rhs.k_sin_psi),
+    phase(rhs.phase),
+    a_k_omega_cos_psi(rhs.a_k_omega_cos_psi),
+    a_k_omega_sin_psi(rhs.a_k_omega_sin_psi),
+    a_k_omega(rhs.a_k_omega),
+    inv_one_plus_exp_minus_2kh(rhs.inv_one_plus_exp_minus_2kh),
+    rays(rhs.rays)
+{
+    update_view();
+}
+
+WaveKernels& WaveKernels::operator=(const WaveKernels& rhs)
+{
+    if (this != &rhs)
+    {
+        instruction_set = rhs.instruction_set;
+        closed_form_depth_factor = rhs.closed_form_depth_factor;
+        stretching_delta = rhs.stretching_delta;
+        stretching_h = rhs.stretching_h;
+        a = rhs.a;
+        omega = rhs.omega;
+        k = rhs.k;
+        k_cos_psi = rhs.k_cos_psi;
+        k_sin_psi = rhs.k_sin_psi;
+        phase = rhs.phase;
+        a_k_omega_cos_psi = rhs.a_k_omega_cos_psi;
+        a_k_omega_sin_psi = rhs.a_k_omega_sin_psi;
+        a_k_omega = rhs.a_k_omega;
+        inv_one_plus_exp_minus_2kh = rhs.inv_one_plus_exp_minus_2kh;
+        rays = rhs.rays;
+        update_view();
+    }
+    return *this;
+}
+
+void WaveKernels::update_view()
+{
+    rays.n = a.size();
+    rays.a = a.data();
+    rays.omega = omega.data();
+    rays.k = k.data();
+    rays.k_cos_psi = k_cos_psi.data();
+    rays.k_sin_psi = k_sin_psi.data();
+    rays.phase = phase.data();
+    rays.a_k_omega_cos_psi = a_k_omega_cos_psi.data();
+    rays.a_k_omega_sin_psi = a_k_omega_sin_psi.data();
+    rays.a_k_omega = a_k_omega.data();
+    rays.inv_one_plus_exp_minus_2kh = inv_one_plus_exp_minus_2kh.data();
+}
+
+WaveKernelInstructionSet WaveKernels::get_instruction_set() const
+{
+    return instruction_set;
+}
+
+bool WaveKernels::has_closed_form_depth_factor() const
+{
+    return closed_form_depth_factor;
+}
+
+size_t WaveKernels::get_nb_of_padded_rays() const
+{
+    return rays.n;
+}
+
+double WaveKernels::get_depth() const
+{
+    return rays.h;
+}
+
+double WaveKernels::rescaled_z(const double z, const double eta) const
+{
+    if ((stretching_h == 0) || (z > stretching_h))
+    {
+        return z;
+    }
+    return (z-stretching_h)*(stretching_delta*eta-stretching_h)/(eta-stretching_h)+stretching_h;
+}
+
+void WaveKernels::elevation(const size_t nb_of_points, const double* x, const double* y, const double t, double* eta) const
+{
+#if defined(XDYN_WAVE_KERNELS_X86)
+    switch (instruction_set)
+    {
+        case WaveKernelInstructionSet::AVX512:
+            wave_kernels_elevation_avx512(rays, nb_of_points, x, y, t, eta);
+            return;
+        case WaveKernelInstructionSet::AVX2:
+            wave_kernels_elevation_avx2(rays, nb_of_points, x, y, t, eta);
+            return;
+        case WaveKernelInstructionSet::SCALAR:
+        default:
+            break;
+    }
+#endif
+    for (size_t j = 0 ; j < nb_of_points ; ++j)
+    {
+        double zeta = 0;
+        for (size_t i = 0 ; i < rays.n ; ++i)
+        {
+            zeta -= a[i] * std::sin(-omega[i]*t + k_cos_psi[i]*x[j] + k_sin_psi[i]*y[j] + phase[i]);
+        }
+        eta[j] = zeta;
+    }
+}
+
+void WaveKernels::dynamic_pressure(const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* p) const
+{
+#if defined(XDYN_WAVE_KERNELS_X86)
+    switch (instruction_set)
+    {
+        case WaveKernelInstructionSet::AVX512:
+            wave_kernels_dynamic_pressure_avx512(rays, nb_of_points, x, y, z, t, p);
+            return;
+        case WaveKernelInstructionSet::AVX2:
+            wave_kernels_dynamic_pressure_avx2(rays, nb_of_points, x, y, z, t, p);
+            return;
+        case WaveKernelInstructionSet::SCALAR:
+        default:
+            break;
+    }
+#endif
+    const double h = rays.h;
+    for (size_t j = 0 ; j < nb_of_points ; ++j)
+    {
+        double sum = 0;
+        for (size_t i = 0 ; i < rays.n ; ++i)
+        {
+            const double f = h > 0 ? (std::exp(-k[i]*z[j]) + std::exp(-k[i]*(2*h-z[j])))*inv_one_plus_exp_minus_2kh[i]
+                                   : std::exp(-k[i]*z[j]);
+            sum += a[i] * f * std::sin(-omega[i]*t + k_cos_psi[i]*x[j] + k_sin_psi[i]*y[j] + phase[i]);
+        }
+        p[j] = sum;
+    }
+}
+
+void WaveKernels::orbital_velocity(const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* u, double* v, double* w) const
+{
+#if defined(XDYN_WAVE_KERNELS_X86)
+    switch (instruction_set)
+    {
+        case WaveKernelInstructionSet::AVX512:
+            wave_kernels_orbital_velocity_avx512(rays, nb_of_points, x, y, z, t, u, v, w);
+            return;
+        case WaveKernelInstructionSet::AVX2:
+            wave_kernels_orbital_velocity_avx2(rays, nb_of_points, x, y, z, t, u, v, w);
+            return;
+        case WaveKernelInstructionSet::SCALAR:
+        default:
+            break;
+    }
+#endif
+    const double h = rays.h;
+    for (size_t j = 0 ; j < nb_of_points ; ++j)
+    {
+        double sum_u = 0;
+        double sum_v = 0;
+        double sum_w = 0;
+        for (size_t i = 0 ; i < rays.n ; ++i)
+        {
+            const double e1 = std::exp(-k[i]*z[j]);
+            const double e2 = h > 0 ? std::exp(-k[i]*(2*h-z[j])) : 0;
+            const double f = h > 0 ? (e1 + e2)*inv_one_plus_exp_minus_2kh[i] : e1;
+            const double f_sh = h > 0 ? (e1 - e2)*inv_one_plus_exp_minus_2kh[i] : e1;
+            const double theta = -omega[i]*t + k_cos_psi[i]*x[j] + k_sin_psi[i]*y[j] + phase[i];
+            const double f_sin_theta = f * std::sin(theta);
+            sum_u += a_k_omega_cos_psi[i] * f_sin_theta;
+            sum_v += a_k_omega_sin_psi[i] * f_sin_theta;
+            sum_w += a_k_omega[i] * f_sh * std::cos(theta);
+        }
+        u[j] = sum_u;
+        v[j] = sum_v;
+        w[j] = sum_w;
+    }
+}
+
+void WaveKernels::rao_sums(const double* const* amplitudes, const double* const* phases, const double x, const double y, const double t, double* w) const
+{
+#if defined(XDYN_WAVE_KERNELS_X86)
+    switch (instruction_set)
+    {
+        case WaveKernelInstructionSet::AVX512:
+            wave_kernels_rao_sums_avx512(rays, amplitudes, phases, x, y, t, w);
+            return;
+        case WaveKernelInstructionSet::AVX2:
+            wave_kernels_rao_sums_avx2(rays, amplitudes, phases, x, y, t, w);
+            return;
+        case WaveKernelInstructionSet::SCALAR:
+        default:
+            break;
+    }
+#endif
+    for (size_t d = 0 ; d < WAVE_KERNELS_NB_OF_RAO_SUMS ; ++d)
+    {
+        w[d] = 0;
+    }
+    for (size_t i = 0 ; i < rays.n ; ++i)
+    {
+        const double theta = -omega[i]*t + k_cos_psi[i]*x + k_sin_psi[i]*y + phase[i];
+        for (size_t d = 0 ; d < WAVE_KERNELS_NB_OF_RAO_SUMS ; ++d)
+        {
+            w[d] += amplitudes[d][i] * std::sin(theta + phases[d][i]);
+        }
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * WaveKernels.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEKERNELS_HPP_
+#define WAVEKERNELS_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "xdyn/environment_models/WaveKernelRays.hpp"
+
+struct FlatDiscreteDirectionalWaveSpectrum;
+
+/** \brief Instruction sets the wave kernels can be compiled for
+ *  \ingroup wave_models
+ */
+enum class WaveKernelInstructionSet
+{
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+std::string to_string(const WaveKernelInstructionSet instruction_set);
+
+/** \brief Vectorized evaluation of the Airy sums (elevation, dynamic pressure & orbital velocity)
+ *  \details Each sum is evaluated for one point at a time, the rays being processed
+ *           four (AVX2) or eight (AVX-512) at a time. The instruction set is chosen
+ *           at run time, depending on the CPU, with a scalar fallback.
+ *           The depth factors f(k,z) are not obtained through the std::function
+ *           stored in FlatDiscreteDirectionalWaveSpectrum but from their closed form:
+ *           exp(-kz) in infinite depth, cosh(k(h-z))/cosh(kh) & sinh(k(h-z))/cosh(kh)
+ *           otherwise (written with decaying exponentials only, so they do not overflow).
+ *           The vectorized sin/cos/exp functions have a relative error of a few ulps,
+ *           so the results match the scalar loops within 1E-12 times the sum of the amplitudes.
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet environment_models/unit_tests/WaveKernelsTest.cpp WaveKernelsTest example
+ */
+class WaveKernels
+{
+    public:
+        WaveKernels();
+        /**  \brief Uses the best instruction set available on the current CPU
+          */
+        WaveKernels(const FlatDiscreteDirectionalWaveSpectrum& spectrum);
+        /**  \brief Uses the requested instruction set if the CPU supports it, or the best supported one below it.
+          */
+        WaveKernels(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const WaveKernelInstructionSet requested_instruction_set);
+        WaveKernels(const WaveKernels& rhs);
+        WaveKernels& operator=(const WaveKernels& rhs);
+
+        /**  \brief Best instruction set supported both by the CPU and by the current build
+          */
+        static WaveKernelInstructionSet best_available_instruction_set();
+
+        WaveKernelInstructionSet get_instruction_set() const;
+
+        /**  \brief True if the depth factors can be evaluated without the std::functions in the spectrum
+          *  \details False if the spectrum was built "by hand", eg. in unit tests.
+          */
+        bool has_closed_form_depth_factor() const;
+
+        /**  \brief eta[j] = -sum_i a_i sin(-omega_i t + k_i (x_j cos psi_i + y_j sin psi_i) + phase_i)
+          */
+        void elevation(
+            const size_t nb_of_points, //!< Number of elements in x, y & eta
+            const double* x,           //!< x-positions in the NED frame (in meters)
+            const double* y,           //!< y-positions in the NED frame (in meters)
+            const double t,            //!< Current time instant (in seconds)
+            double* eta                //!< Output: elevations (in meters)
+            ) const;
+
+        /**  \brief Dynamic pressure, divided by rho*g (in meters)
+          *  \details z_rescaled is the stretched z used in the depth factor. Points
+          *  that should have no pressure (above the free surface or below the seabed)
+          *  must be filtered out by the caller.
+          */
+        void dynamic_pressure(
+            const size_t nb_of_points, //!< Number of elements in x, y, z_rescaled & p
+            const double* x,           //!< x-positions in the NED frame (in meters)
+            const double* y,           //!< y-positions in the NED frame (in meters)
+            const double* z_rescaled,  //!< Stretched z-positions in the NED frame (in meters)
+            const double t,            //!< Current time instant (in seconds)
+            double* p                  //!< Output: sum_i a_i f(k_i,z_j) sin(theta_ij) (in meters)
+            ) const;
+
+        /**  \brief Orbital velocity, divided by g (in s)
+          *  \details Points above the free surface or below the seabed must be filtered out by the caller.
+          */
+        void orbital_velocity(
+            const size_t nb_of_points, //!< Number of elements in x, y, z, u, v & w
+            const double* x,           //!< x-positions in the NED frame (in meters)
+            const double* y,           //!< y-positions in the NED frame (in meters)
+            const double* z,           //!< z-positions in the NED frame (in meters)
+            const double t,            //!< Current time instant (in seconds)
+            double* u,                 //!< Output: velocity along x, divided by g (in s)
+            double* v,                 //!< Output: velocity along y, divided by g (in s)
+            double* w                  //!< Output: velocity along z, divided by g (in s)
+            ) const;
+
+        /**  \brief w[d] = sum_i A_d[i] sin(theta_i + phi_d[i]) at one point, for the six degrees of freedom d
+          *  \details theta_i = -omega_i t + k_i (x cos psi_i + y sin psi_i) + phase_i, as in 'elevation'.
+          *           Used by the RAO-based force models: A_d is the product of the ray amplitudes & of
+          *           the module of the RAO for degree of freedom d, phi_d its phase.
+          *           All arrays must have get_nb_of_padded_rays() elements (zero for the padding rays).
+          */
+        void rao_sums(
+            const double* const* amplitudes, //!< A_d, for d in [0,6)
+            const double* const* phases,     //!< phi_d, for d in [0,6) (in rad)
+            const double x,                  //!< x-position in the NED frame (in meters)
+            const double y,                  //!< y-position in the NED frame (in meters)
+            const double t,                  //!< Current time instant (in seconds)
+            double* w                        //!< Output: the six sums
+            ) const;
+
+        /**  \brief Number of rays, padded to a multiple of the widest SIMD register
+          */
+        size_t get_nb_of_padded_rays() const;
+
+        /**  \brief Delta-stretching of the z-axis, as in Stretching::rescaled_z
+          */
+        double rescaled_z(const double z, const double eta) const;
+
+        /**  \brief Water depth (in meters), 0 for infinite depth
+          */
+        double get_depth() const;
+
+    private:
+        void update_view();
+
+        WaveKernelInstructionSet instruction_set;
+        bool closed_form_depth_factor;
+        double stretching_delta;
+        double stretching_h;
+        std::vector<double> a;
+        std::vector<double> omega;
+        std::vector<double> k;
+        std::vector<double> k_cos_psi;
+        std::vector<double> k_sin_psi;
+        std::vector<double> phase;
+        std::vector<double> a_k_omega_cos_psi;
+        std::vector<double> a_k_omega_sin_psi;
+        std::vector<double> a_k_omega;
+        std::vector<double> inv_one_plus_exp_minus_2kh;
+        WaveKernelRays rays;
+};
+
+#endif /* WAVEKERNELS_HPP_ */
@@ -0,0 +1,71 @@
+/*
+ * WaveKernelsAVX2.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// This file is compiled with -mavx2 -mfma (cf. CMakeLists.txt) & only called if the CPU supports it.
+// It must not include any STL header (cf. WaveKernelRays.hpp).
+#include <immintrin.h>
+#include "xdyn/environment_models/WaveKernelsSIMD.hpp"
+
+namespace
+{
+    struct S
+    {
+        typedef __m256d type;
+        typedef __m256d mask;
+        static const size_t width = 4;
+        static type set1(const double x) {return _mm256_set1_pd(x);}
+        static type loadu(const double* p) {return _mm256_loadu_pd(p);}
+        static type add(const type a, const type b) {return _mm256_add_pd(a, b);}
+        static type sub(const type a, const type b) {return _mm256_sub_pd(a, b);}
+        static type mul(const type a, const type b) {return _mm256_mul_pd(a, b);}
+        static type div(const type a, const type b) {return _mm256_div_pd(a, b);}
+        static type fmadd(const type a, const type b, const type c) {return _mm256_fmadd_pd(a, b, c);}
+        static type fnmadd(const type a, const type b, const type c) {return _mm256_fnmadd_pd(a, b, c);}
+        static type min(const type a, const type b) {return _mm256_min_pd(a, b);}
+        static type max(const type a, const type b) {return _mm256_max_pd(a, b);}
+        static type floor(const type a) {return _mm256_floor_pd(a);}
+        static type abs(const type a) {return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);}
+        static type neg(const type a) {return _mm256_xor_pd(_mm256_set1_pd(-0.0), a);}
+        static mask equal(const type a, const type b) {return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);}
+        static mask less(const type a, const type b) {return _mm256_cmp_pd(a, b, _CMP_LT_OQ);}
+        static mask greater_or_equal(const type a, const type b) {return _mm256_cmp_pd(a, b, _CMP_GE_OQ);}
+        static mask mask_or(const mask a, const mask b) {return _mm256_or_pd(a, b);}
+        static type select(const mask m, const type if_true, const type if_false) {return _mm256_blendv_pd(if_false, if_true, m);}
+        static type ldexp(const type x, const type n)
+        {
+            // Build 2^n directly from its IEEE 754 representation (n is between -1022 & 1023 because exp clamps its argument)
+            const __m256i biased_exponent = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n)), _mm256_set1_epi64x(1023));
+            return _mm256_mul_pd(x, _mm256_castsi256_pd(_mm256_slli_epi64(biased_exponent, 52)));
+        }
+        static double reduce_add(const type a)
+        {
+            const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+        }
+    };
+}
+
+void wave_kernels_elevation_avx2(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double t, double* eta)
+{
+    wave_kernels_simd::elevation<S>(rays, nb_of_points, x, y, t, eta);
+}
+
+void wave_kernels_dynamic_pressure_avx2(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* p)
+{
+    if (rays.h > 0) wave_kernels_simd::dynamic_pressure<S,true>(rays, nb_of_points, x, y, z, t, p);
+    else            wave_kernels_simd::dynamic_pressure<S,false>(rays, nb_of_points, x, y, z, t, p);
+}
+
+void wave_kernels_orbital_velocity_avx2(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* u, double* v, double* w)
+{
+    if (rays.h > 0) wave_kernels_simd::orbital_velocity<S,true>(rays, nb_of_points, x, y, z, t, u, v, w);
+    else            wave_kernels_simd::orbital_velocity<S,false>(rays, nb_of_points, x, y, z, t, u, v, w);
+}
+
+void wave_kernels_rao_sums_avx2(const WaveKernelRays& rays, const double* const* amplitudes, const double* const* phases, const double x, const double y, const double t, double* w)
+{
+    wave_kernels_simd::rao_sums<S>(rays, amplitudes, phases, x, y, t, w);
+}
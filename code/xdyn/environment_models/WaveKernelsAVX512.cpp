@@ -0,0 +1,67 @@
+/*
+ * WaveKernelsAVX512.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// This file is compiled with -mavx512f (cf. CMakeLists.txt) & only called if the CPU supports it.
+// It must not include any STL header (cf. WaveKernelRays.hpp).
+// GCC 12's AVX-512 headers use _mm512_undefined_pd(), which wrongly triggers -Wmaybe-uninitialized (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#include "xdyn/environment_models/WaveKernelsSIMD.hpp"
+
+namespace
+{
+    struct S
+    {
+        typedef __m512d type;
+        typedef __mmask8 mask;
+        static const size_t width = 8;
+        static type set1(const double x) {return _mm512_set1_pd(x);}
+        static type loadu(const double* p) {return _mm512_loadu_pd(p);}
+        static type add(const type a, const type b) {return _mm512_add_pd(a, b);}
+        static type sub(const type a, const type b) {return _mm512_sub_pd(a, b);}
+        static type mul(const type a, const type b) {return _mm512_mul_pd(a, b);}
+        static type div(const type a, const type b) {return _mm512_div_pd(a, b);}
+        static type fmadd(const type a, const type b, const type c) {return _mm512_fmadd_pd(a, b, c);}
+        static type fnmadd(const type a, const type b, const type c) {return _mm512_fnmadd_pd(a, b, c);}
+        static type min(const type a, const type b) {return _mm512_min_pd(a, b);}
+        static type max(const type a, const type b) {return _mm512_max_pd(a, b);}
+        static type floor(const type a) {return _mm512_floor_pd(a);}
+        static type abs(const type a) {return _mm512_abs_pd(a);}
+        static type neg(const type a) {return _mm512_sub_pd(_mm512_setzero_pd(), a);}
+        static mask equal(const type a, const type b) {return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);}
+        static mask less(const type a, const type b) {return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);}
+        static mask greater_or_equal(const type a, const type b) {return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ);}
+        static mask mask_or(const mask a, const mask b) {return static_cast<mask>(a | b);}
+        static type select(const mask m, const type if_true, const type if_false) {return _mm512_mask_blend_pd(m, if_false, if_true);}
+        static type ldexp(const type x, const type n) {return _mm512_scalef_pd(x, n);}
+        static double reduce_add(const type a) {return _mm512_reduce_add_pd(a);}
+    };
+}
+
+void wave_kernels_elevation_avx512(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double t, double* eta)
+{
+    wave_kernels_simd::elevation<S>(rays, nb_of_points, x, y, t, eta);
+}
+
+void wave_kernels_dynamic_pressure_avx512(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* p)
+{
+    if (rays.h > 0) wave_kernels_simd::dynamic_pressure<S,true>(rays, nb_of_points, x, y, z, t, p);
+    else            wave_kernels_simd::dynamic_pressure<S,false>(rays, nb_of_points, x, y, z, t, p);
+}
+
+void wave_kernels_orbital_velocity_avx512(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* u, double* v, double* w)
+{
+    if (rays.h > 0) wave_kernels_simd::orbital_velocity<S,true>(rays, nb_of_points, x, y, z, t, u, v, w);
+    else            wave_kernels_simd::orbital_velocity<S,false>(rays, nb_of_points, x, y, z, t, u, v, w);
+}
+
+void wave_kernels_rao_sums_avx512(const WaveKernelRays& rays, const double* const* amplitudes, const double* const* phases, const double x, const double y, const double t, double* w)
+{
+    wave_kernels_simd::rao_sums<S>(rays, amplitudes, phases, x, y, t, w);
+}
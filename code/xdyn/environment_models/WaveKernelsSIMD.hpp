@@ -0,0 +1,220 @@
+/*
+ * WaveKernelsSIMD.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEKERNELSSIMD_HPP_
+#define WAVEKERNELSSIMD_HPP_
+
+#include "xdyn/environment_models/WaveKernelRays.hpp"
+
+/** \brief Generic wave kernels, written once for all instruction sets
+ *  \details Only included by WaveKernelsAVX2.cpp & WaveKernelsAVX512.cpp, each of
+ *           which defines a class 'S' (in an anonymous namespace, so all the
+ *           template instantiations below have internal linkage) with:
+ *           - type, mask & width
+ *           - set1, loadu, add, sub, mul, div, fmadd (a*b+c), fnmadd (c-a*b), min, max, floor, abs, neg
+ *           - equal, less, greater_or_equal, mask_or, select (mask ? a : b)
+ *           - ldexp (x*2^n, n being an integral value stored as a double) & reduce_add
+ *           sin, cos & exp are the Cephes polynomial approximations (S. L. Moshier),
+ *           which are accurate to a few ulps over the range we need.
+ *  \ingroup wave_models
+ */
+namespace wave_kernels_simd
+{
+    template <typename S> void sincos(const typename S::type x, typename S::type& s, typename S::type& c)
+    {
+        typedef typename S::type V;
+        // Cody-Waite reduction modulo pi/4 (pi/4 = DP1 + DP2 + DP3, DP1 & DP2 having few significant bits)
+        const V ax = S::abs(x);
+        V j = S::floor(S::mul(ax, S::set1(1.27323954473516268615))); // 4/pi
+        j = S::add(j, S::sub(j, S::mul(S::set1(2), S::floor(S::mul(j, S::set1(0.5)))))); // Round j up to the next even integer
+        V z = S::fnmadd(j, S::set1(7.85398125648498535156E-1), ax);
+        z = S::fnmadd(j, S::set1(3.77489470793079817668E-8), z);
+        z = S::fnmadd(j, S::set1(2.69515142907905952645E-15), z);
+        const V octant = S::sub(j, S::mul(S::set1(8), S::floor(S::mul(j, S::set1(0.125))))); // 0, 2, 4 or 6
+        const V zz = S::mul(z, z);
+        V ps = S::set1(1.58962301576546568060E-10);
+        ps = S::fmadd(ps, zz, S::set1(-2.50507477628578072866E-8));
+        ps = S::fmadd(ps, zz, S::set1(2.75573136213857245213E-6));
+        ps = S::fmadd(ps, zz, S::set1(-1.98412698295895385996E-4));
+        ps = S::fmadd(ps, zz, S::set1(8.33333333332211858878E-3));
+        ps = S::fmadd(ps, zz, S::set1(-1.66666666666666307295E-1));
+        const V sin_z = S::fmadd(S::mul(z, zz), ps, z);
+        V pc = S::set1(-1.13585365213876817300E-11);
+        pc = S::fmadd(pc, zz, S::set1(2.08757008419747316778E-9));
+        pc = S::fmadd(pc, zz, S::set1(-2.75573141792967388112E-7));
+        pc = S::fmadd(pc, zz, S::set1(2.48015872888517045348E-5));
+        pc = S::fmadd(pc, zz, S::set1(-1.38888888888730564116E-3));
+        pc = S::fmadd(pc, zz, S::set1(4.16666666666665929218E-2));
+        const V cos_z = S::fmadd(S::mul(zz, zz), pc, S::fnmadd(S::set1(0.5), zz, S::set1(1)));
+        const typename S::mask swap = S::mask_or(S::equal(octant, S::set1(2)), S::equal(octant, S::set1(6)));
+        const V s0 = S::select(swap, cos_z, sin_z);
+        const V c0 = S::select(swap, sin_z, cos_z);
+        // sin(z+pi/2) = cos(z), sin(z+pi) = -sin(z), sin(z+3pi/2) = -cos(z) & sin(-x) = -sin(x)
+        const V s1 = S::select(S::greater_or_equal(octant, S::set1(4)), S::neg(s0), s0);
+        s = S::select(S::less(x, S::set1(0)), S::neg(s1), s1);
+        // cos(z+pi/2) = -sin(z), cos(z+pi) = -cos(z), cos(z+3pi/2) = sin(z)
+        c = S::select(S::mask_or(S::equal(octant, S::set1(2)), S::equal(octant, S::set1(4))), S::neg(c0), c0);
+    }
+
+    template <typename S> typename S::type sin(const typename S::type x)
+    {
+        typename S::type s, c;
+        sincos<S>(x, s, c);
+        return s;
+    }
+
+    template <typename S> typename S::type exp(const typename S::type x_)
+    {
+        typedef typename S::type V;
+        // Below -708.39, exp(x) is subnormal: it is clamped to the smallest normal number, which is negligible for our purposes.
+        // Above 709.43, n would be 1024 & 2^n would overflow in ldexp: x is clamped so that n stays between -1022 & 1023
+        V x = S::max(S::min(x_, S::set1(709.43)), S::set1(-708.39));
+        const V n = S::floor(S::fmadd(x, S::set1(1.4426950408889634073599), S::set1(0.5))); // log2(e)
+        x = S::fnmadd(n, S::set1(6.93145751953125E-1), x);
+        x = S::fnmadd(n, S::set1(1.42860682030941723212E-6), x);
+        const V xx = S::mul(x, x);
+        V px = S::set1(1.26177193074810590878E-4);
+        px = S::fmadd(px, xx, S::set1(3.02994407707441961300E-2));
+        px = S::fmadd(px, xx, S::set1(9.99999999999999999910E-1));
+        px = S::mul(px, x);
+        V qx = S::set1(3.00198505138664455042E-6);
+        qx = S::fmadd(qx, xx, S::set1(2.52448340349684104192E-3));
+        qx = S::fmadd(qx, xx, S::set1(2.27265548208155028766E-1));
+        qx = S::fmadd(qx, xx, S::set1(2.00000000000000000009E0));
+        const V r = S::fmadd(S::set1(2), S::div(px, S::sub(qx, px)), S::set1(1));
+        return S::ldexp(r, n);
+    }
+
+    template <typename S> typename S::type phase(const WaveKernelRays& rays, const size_t i, const typename S::type x, const typename S::type y, const typename S::type t)
+    {
+        typename S::type theta = S::fmadd(S::loadu(rays.k_cos_psi + i), x, S::loadu(rays.phase + i));
+        theta = S::fmadd(S::loadu(rays.k_sin_psi + i), y, theta);
+        return S::fnmadd(S::loadu(rays.omega + i), t, theta);
+    }
+
+    template <typename S> void elevation(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double t, double* eta)
+    {
+        typedef typename S::type V;
+        const V vt = S::set1(t);
+        for (size_t j = 0 ; j < nb_of_points ; ++j)
+        {
+            const V vx = S::set1(x[j]);
+            const V vy = S::set1(y[j]);
+            V sum = S::set1(0);
+            for (size_t i = 0 ; i < rays.n ; i += S::width)
+            {
+                sum = S::fmadd(S::loadu(rays.a + i), sin<S>(phase<S>(rays, i, vx, vy, vt)), sum);
+            }
+            eta[j] = -S::reduce_add(sum);
+        }
+    }
+
+    // cosh(k(h-z))/cosh(kh) = (exp(-kz) + exp(-k(2h-z)))/(1+exp(-2kh)) & sinh(k(h-z))/cosh(kh) = (exp(-kz) - exp(-k(2h-z)))/(1+exp(-2kh))
+    template <typename S> void finite_depth_factors(const WaveKernelRays& rays, const size_t i, const typename S::type z, const typename S::type two_h_minus_z, typename S::type& f, typename S::type& f_sh)
+    {
+        typedef typename S::type V;
+        const V k = S::loadu(rays.k + i);
+        const V inv = S::loadu(rays.inv_one_plus_exp_minus_2kh + i);
+        const V e1 = exp<S>(S::neg(S::mul(k, z)));
+        const V e2 = exp<S>(S::neg(S::mul(k, two_h_minus_z)));
+        f = S::mul(S::add(e1, e2), inv);
+        f_sh = S::mul(S::sub(e1, e2), inv);
+    }
+
+    template <typename S, bool finite_depth> void dynamic_pressure(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* p)
+    {
+        typedef typename S::type V;
+        const V vt = S::set1(t);
+        for (size_t j = 0 ; j < nb_of_points ; ++j)
+        {
+            const V vx = S::set1(x[j]);
+            const V vy = S::set1(y[j]);
+            const V vz = S::set1(z[j]);
+            const V two_h_minus_z = S::set1(2*rays.h - z[j]);
+            V sum = S::set1(0);
+            for (size_t i = 0 ; i < rays.n ; i += S::width)
+            {
+                V f;
+                if (finite_depth)
+                {
+                    V f_sh;
+                    finite_depth_factors<S>(rays, i, vz, two_h_minus_z, f, f_sh);
+                }
+                else
+                {
+                    f = exp<S>(S::neg(S::mul(S::loadu(rays.k + i), vz)));
+                }
+                sum = S::fmadd(S::mul(S::loadu(rays.a + i), f), sin<S>(phase<S>(rays, i, vx, vy, vt)), sum);
+            }
+            p[j] = S::reduce_add(sum);
+        }
+    }
+
+    template <typename S, bool finite_depth> void orbital_velocity(const WaveKernelRays& rays, const size_t nb_of_points, const double* x, const double* y, const double* z, const double t, double* u, double* v, double* w)
+    {
+        typedef typename S::type V;
+        const V vt = S::set1(t);
+        for (size_t j = 0 ; j < nb_of_points ; ++j)
+        {
+            const V vx = S::set1(x[j]);
+            const V vy = S::set1(y[j]);
+            const V vz = S::set1(z[j]);
+            const V two_h_minus_z = S::set1(2*rays.h - z[j]);
+            V sum_u = S::set1(0);
+            V sum_v = S::set1(0);
+            V sum_w = S::set1(0);
+            for (size_t i = 0 ; i < rays.n ; i += S::width)
+            {
+                V f, f_sh;
+                if (finite_depth)
+                {
+                    finite_depth_factors<S>(rays, i, vz, two_h_minus_z, f, f_sh);
+                }
+                else
+                {
+                    f = exp<S>(S::neg(S::mul(S::loadu(rays.k + i), vz)));
+                    f_sh = f;
+                }
+                V sin_theta, cos_theta;
+                sincos<S>(phase<S>(rays, i, vx, vy, vt), sin_theta, cos_theta);
+                const V f_sin_theta = S::mul(f, sin_theta);
+                sum_u = S::fmadd(S::loadu(rays.a_k_omega_cos_psi + i), f_sin_theta, sum_u);
+                sum_v = S::fmadd(S::loadu(rays.a_k_omega_sin_psi + i), f_sin_theta, sum_v);
+                sum_w = S::fmadd(S::loadu(rays.a_k_omega + i), S::mul(f_sh, cos_theta), sum_w);
+            }
+            u[j] = S::reduce_add(sum_u);
+            v[j] = S::reduce_add(sum_v);
+            w[j] = S::reduce_add(sum_w);
+        }
+    }
+
+    template <typename S> void rao_sums(const WaveKernelRays& rays, const double* const* amplitudes, const double* const* phases, const double x, const double y, const double t, double* w)
+    {
+        typedef typename S::type V;
+        const V vx = S::set1(x);
+        const V vy = S::set1(y);
+        const V vt = S::set1(t);
+        V sums[WAVE_KERNELS_NB_OF_RAO_SUMS];
+        for (size_t d = 0 ; d < WAVE_KERNELS_NB_OF_RAO_SUMS ; ++d)
+        {
+            sums[d] = S::set1(0);
+        }
+        for (size_t i = 0 ; i < rays.n ; i += S::width)
+        {
+            const V theta = phase<S>(rays, i, vx, vy, vt);
+            for (size_t d = 0 ; d < WAVE_KERNELS_NB_OF_RAO_SUMS ; ++d)
+            {
+                sums[d] = S::fmadd(S::loadu(amplitudes[d] + i), sin<S>(S::add(theta, S::loadu(phases[d] + i))), sums[d]);
+            }
+        }
+        for (size_t d = 0 ; d < WAVE_KERNELS_NB_OF_RAO_SUMS ; ++d)
+        {
+            w[d] = S::reduce_add(sums[d]);
+        }
+    }
+}
+
+#endif /* WAVEKERNELSSIMD_HPP_ */
@@ -55,22 +55,22 @@ DiscreteDirectionalWaveSpectrum add_random_phases(DiscreteDirectionalWaveSpectru
     return spectrum;
 }
 
-WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum): flat_spectrum(flatten(spectrum))
+WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum): flat_spectrum(flatten(spectrum)), phasor_cache()
 {
     check_sizes();
 }
 
-WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum, const double constant_phase): flat_spectrum(flatten(add_constant_phases(spectrum, constant_phase)))
+WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum, const double constant_phase): flat_spectrum(flatten(add_constant_phases(spectrum, constant_phase))), phasor_cache()
 {
     check_sizes();
 }
 
-WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum, const int random_number_generator_seed) : flat_spectrum(flatten(add_random_phases(spectrum, random_number_generator_seed)))
+WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum, const int random_number_generator_seed) : flat_spectrum(flatten(add_random_phases(spectrum, random_number_generator_seed))), phasor_cache()
 {
     check_sizes();
 }
 
-WaveModel::WaveModel(const FlatDiscreteDirectionalWaveSpectrum& spectrum) : flat_spectrum(spectrum)
+WaveModel::WaveModel(const FlatDiscreteDirectionalWaveSpectrum& spectrum) : flat_spectrum(spectrum), phasor_cache()
 {
     check_sizes();
 }
@@ -122,6 +122,33 @@ WaveModel::~WaveModel()
 {
 }
 
+double WaveModel::get_maximum_elevation() const
+{
+    double ret = 0;
+    for (const auto a:flat_spectrum.a) ret += std::abs(a);
+    return ret;
+}
+
+void WaveModel::enable_phasor_cache(const size_t renormalization_period)
+{
+    phasor_cache.reset(new WavePhasorCache(flat_spectrum, renormalization_period));
+}
+
+void WaveModel::disable_phasor_cache()
+{
+    phasor_cache.reset();
+}
+
+bool WaveModel::has_phasor_cache() const
+{
+    return phasor_cache.get() != NULL;
+}
+
+void WaveModel::set_concurrent_calls(const bool concurrent_calls)
+{
+    if (phasor_cache) phasor_cache->set_concurrent_calls(concurrent_calls);
+}
+
 std::vector<double> WaveModel::get_elevation(
     const std::vector<double> &x, //!< x-positions in the NED frame (in meters)
     const std::vector<double> &y, //!< y-positions in the NED frame (in meters)
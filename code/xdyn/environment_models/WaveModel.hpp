@@ -9,6 +9,7 @@
 #define WAVEMODEL_HPP_
 
 #include "xdyn/environment_models/DiscreteDirectionalWaveSpectrum.hpp"
+#include "xdyn/environment_models/WavePhasorCache.hpp"
 
 #include <ssc/kinematics.hpp>
 #include <ssc/macros.hpp>
@@ -80,6 +81,26 @@ class WaveModel
             const double t                  //!< Current time instant (in seconds)
             ) const;
         FlatDiscreteDirectionalWaveSpectrum get_spectrum() const {return flat_spectrum;};
+        const FlatDiscreteDirectionalWaveSpectrum& get_flat_spectrum() const {return flat_spectrum;};
+
+        /**  \brief Upper bound of the absolute value of the elevation (in meters), valid everywhere & at all instants
+          *  \returns Sum of the amplitudes of the rays, for models which superpose the rays linearly
+          */
+        virtual double get_maximum_elevation() const;
+
+        /**  \brief Opt-in: evaluate the elevation by advancing the time phasors from one time step to the next
+          *  \details Only useful if the elevation is evaluated repeatedly at the same points
+          *           (eg. the wave output mesh), with a constant time step. Cf. WavePhasorCache.
+          */
+        void enable_phasor_cache(
+            const size_t renormalization_period = 64 //!< Number of time steps between two exact evaluations of exp(-i omega t)
+            );
+        void disable_phasor_cache();
+        bool has_phasor_cache() const;
+
+        /**  \brief Bypasses the phasor cache (if any) while the model is called concurrently (cf. WavePhasorCache::set_concurrent_calls)
+          */
+        void set_concurrent_calls(const bool concurrent_calls);
 
     private:
         WaveModel(); // Disabled
@@ -130,6 +151,7 @@ class WaveModel
 
     protected:
         FlatDiscreteDirectionalWaveSpectrum flat_spectrum;
+        TR1(shared_ptr)<WavePhasorCache> phasor_cache; //!< Null unless enable_phasor_cache was called
 };
 
 typedef TR1(shared_ptr)<WaveModel> WaveModelPtr;
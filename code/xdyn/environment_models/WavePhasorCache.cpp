@@ -0,0 +1,258 @@
+/*
+ * WavePhasorCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WavePhasorCache.hpp"
+#include "DiscreteDirectionalWaveSpectrum.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+#include <algorithm> // std::find, std::min_element
+#include <cmath>
+#include <functional> // std::hash
+#include <utility> // std::move
+
+// Relative tolerance on the time step, below which two time steps are considered equal
+#define DT_EPS 1E-9
+// Number of sets of points seen only once that we keep track of
+#define MAX_NB_OF_HASHES 8
+
+WavePhasorCache::SpacePhasors::SpacePhasors() : hash(0), last_use(0), x(), y(), sin_kappa(), cos_kappa()
+{
+}
+
+size_t hash_points(const std::vector<double>& x, const std::vector<double>& y);
+size_t hash_points(const std::vector<double>& x, const std::vector<double>& y)
+{
+    std::hash<double> h;
+    size_t ret = x.size();
+    for (size_t j = 0 ; j < x.size() ; ++j)
+    {
+        ret ^= h(x[j]) + 0x9e3779b9 + (ret << 6) + (ret >> 2);
+        ret ^= h(y[j]) + 0x9e3779b9 + (ret << 6) + (ret >> 2);
+    }
+    return ret;
+}
+
+WavePhasorCache::WavePhasorCache(
+    const FlatDiscreteDirectionalWaveSpectrum& spectrum,
+    const size_t renormalization_period_,
+    const size_t max_nb_of_cached_terms_) :
+        mutex(),
+        concurrent_calls(false),
+        renormalization_period(renormalization_period_),
+        max_nb_of_cached_terms(max_nb_of_cached_terms_),
+        a(spectrum.a),
+        omega(spectrum.omega),
+        k_cos_psi(spectrum.a.size()),
+        k_sin_psi(spectrum.a.size()),
+        phase(spectrum.phase),
+        a_cos_omega_t(spectrum.a.size()),
+        a_sin_omega_t(spectrum.a.size()),
+        cos_omega_dt(spectrum.a.size()),
+        sin_omega_dt(spectrum.a.size()),
+        time_phasors_initialized(false),
+        t_cached(0),
+        dt(0),
+        nb_of_steps_since_exact_evaluation(0),
+        space_phasors(),
+        hashes_seen_once(),
+        nb_of_calls(0),
+        nb_of_recurrence_steps(0),
+        nb_of_exact_evaluations(0),
+        nb_of_space_phasor_updates(0)
+{
+    if (renormalization_period == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The renormalization period of the phasor cache should be at least 1");
+    }
+    const size_t n = a.size();
+    if ((omega.size() != n) || (phase.size() != n) || (spectrum.k.size() != n) || (spectrum.cos_psi.size() != n) || (spectrum.sin_psi.size() != n))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The vectors of the flat spectrum do not have the same size");
+    }
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        k_cos_psi[i] = spectrum.k[i]*spectrum.cos_psi[i];
+        k_sin_psi[i] = spectrum.k[i]*spectrum.sin_psi[i];
+    }
+}
+
+size_t WavePhasorCache::get_nb_of_recurrence_steps() const
+{
+    return nb_of_recurrence_steps;
+}
+
+size_t WavePhasorCache::get_nb_of_exact_evaluations() const
+{
+    return nb_of_exact_evaluations;
+}
+
+size_t WavePhasorCache::get_nb_of_space_phasor_updates() const
+{
+    return nb_of_space_phasor_updates;
+}
+
+void WavePhasorCache::compute_time_phasors_exactly(const double t)
+{
+    for (size_t i = 0 ; i < a.size() ; ++i)
+    {
+        a_cos_omega_t[i] = a[i]*std::cos(omega[i]*t);
+        a_sin_omega_t[i] = a[i]*std::sin(omega[i]*t);
+    }
+    nb_of_steps_since_exact_evaluation = 0;
+    nb_of_exact_evaluations++;
+}
+
+void WavePhasorCache::set_time_step(const double new_dt)
+{
+    // If t goes backwards, the time phasors will be computed exactly until the time step is positive again
+    dt = new_dt > 0 ? new_dt : 0;
+    for (size_t i = 0 ; i < a.size() ; ++i)
+    {
+        cos_omega_dt[i] = std::cos(omega[i]*dt);
+        sin_omega_dt[i] = std::sin(omega[i]*dt);
+    }
+}
+
+void WavePhasorCache::update_time_phasors(const double t)
+{
+    if (time_phasors_initialized && (t == t_cached))
+    {
+        return;
+    }
+    const double new_dt = t - t_cached;
+    const bool same_dt = time_phasors_initialized && (dt > 0) && (std::abs(new_dt - dt) <= DT_EPS*dt);
+    if (same_dt && (nb_of_steps_since_exact_evaluation + 1 < renormalization_period))
+    {
+        // (C + iS)(c - is) with C=a.cos(omega.t), S=a.sin(omega.t), c=cos(omega.dt) & s=sin(omega.dt)
+        for (size_t i = 0 ; i < a.size() ; ++i)
+        {
+            const double C = a_cos_omega_t[i];
+            const double S = a_sin_omega_t[i];
+            a_cos_omega_t[i] = C*cos_omega_dt[i] - S*sin_omega_dt[i];
+            a_sin_omega_t[i] = S*cos_omega_dt[i] + C*sin_omega_dt[i];
+        }
+        nb_of_steps_since_exact_evaluation++;
+        nb_of_recurrence_steps++;
+    }
+    else
+    {
+        compute_time_phasors_exactly(t);
+        if (time_phasors_initialized && not(same_dt))
+        {
+            set_time_step(new_dt);
+        }
+    }
+    t_cached = t;
+    time_phasors_initialized = true;
+}
+
+void WavePhasorCache::compute_space_phasors(SpacePhasors& s) const
+{
+    const size_t n = a.size();
+    s.sin_kappa.resize(n*s.x.size());
+    s.cos_kappa.resize(n*s.x.size());
+    for (size_t j = 0 ; j < s.x.size() ; ++j)
+    {
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            const double kappa = k_cos_psi[i]*s.x[j] + k_sin_psi[i]*s.y[j] + phase[i];
+            s.sin_kappa[j*n+i] = std::sin(kappa);
+            s.cos_kappa[j*n+i] = std::cos(kappa);
+        }
+    }
+}
+
+const WavePhasorCache::SpacePhasors* WavePhasorCache::find_or_add_space_phasors(const std::vector<double>& x, const std::vector<double>& y)
+{
+    const size_t nb_of_terms = x.size()*a.size();
+    if (nb_of_terms > max_nb_of_cached_terms)
+    {
+        return NULL;
+    }
+    const size_t hash = hash_points(x, y);
+    for (auto& s:space_phasors)
+    {
+        if ((s.hash == hash) && (s.x == x) && (s.y == y))
+        {
+            s.last_use = nb_of_calls;
+            return &s;
+        }
+    }
+    const auto seen = std::find(hashes_seen_once.begin(), hashes_seen_once.end(), hash);
+    if (seen == hashes_seen_once.end())
+    {
+        if (hashes_seen_once.size() == MAX_NB_OF_HASHES)
+        {
+            hashes_seen_once.erase(hashes_seen_once.begin());
+        }
+        hashes_seen_once.push_back(hash);
+        return NULL;
+    }
+    hashes_seen_once.erase(seen);
+    // Evict the least recently used sets of points until the new one fits
+    size_t nb_of_cached_terms = 0;
+    for (const auto& s:space_phasors) nb_of_cached_terms += s.sin_kappa.size();
+    while (nb_of_cached_terms + nb_of_terms > max_nb_of_cached_terms)
+    {
+        const auto lru = std::min_element(space_phasors.begin(), space_phasors.end(),
+                                          [](const SpacePhasors& lhs, const SpacePhasors& rhs){return lhs.last_use < rhs.last_use;});
+        nb_of_cached_terms -= lru->sin_kappa.size();
+        space_phasors.erase(lru);
+    }
+    SpacePhasors s;
+    s.hash = hash;
+    s.last_use = nb_of_calls;
+    s.x = x;
+    s.y = y;
+    compute_space_phasors(s);
+    space_phasors.push_back(std::move(s));
+    nb_of_space_phasor_updates++;
+    return &space_phasors.back();
+}
+
+void WavePhasorCache::set_concurrent_calls(const bool concurrent_calls_)
+{
+    concurrent_calls = concurrent_calls_;
+}
+
+bool WavePhasorCache::elevation(
+    const std::vector<double>& x,
+    const std::vector<double>& y,
+    const double t,
+    std::vector<double>& eta)
+{
+    if (concurrent_calls)
+    {
+        // The order of the calls (hence the content of the cache) would depend on the scheduling of the threads
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+    if (not(lock.owns_lock()))
+    {
+        return false;
+    }
+    nb_of_calls++;
+    const SpacePhasors* s = find_or_add_space_phasors(x, y);
+    if (s == NULL)
+    {
+        return false;
+    }
+    update_time_phasors(t);
+    const size_t n = a.size();
+    eta.resize(x.size());
+    for (size_t j = 0 ; j < x.size() ; ++j)
+    {
+        const double* sin_kappa_j = s->sin_kappa.data() + j*n;
+        const double* cos_kappa_j = s->cos_kappa.data() + j*n;
+        double zeta = 0;
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            // a.sin(-omega.t + kappa) = sin(kappa).a.cos(omega.t) - cos(kappa).a.sin(omega.t)
+            zeta += cos_kappa_j[i]*a_sin_omega_t[i] - sin_kappa_j[i]*a_cos_omega_t[i];
+        }
+        eta[j] = zeta;
+    }
+    return true;
+}
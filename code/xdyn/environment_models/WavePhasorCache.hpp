@@ -0,0 +1,115 @@
+/*
+ * WavePhasorCache.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEPHASORCACHE_HPP_
+#define WAVEPHASORCACHE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+struct FlatDiscreteDirectionalWaveSpectrum;
+
+/** \brief Evaluates the wave elevation at a fixed set of points, for successive time steps
+ *  \details Each term of the Airy sum is split in a space part & a time part:
+ *           sin(-omega_i t + kappa_ij) = sin(kappa_ij) cos(omega_i t) - cos(kappa_ij) sin(omega_i t)
+ *           with kappa_ij = k_i (x_j cos psi_i + y_j sin psi_i) + phase_i.
+ *           The space phasors exp(i kappa_ij) are cached for the sets of points that are
+ *           evaluated repeatedly (eg. the wave output mesh or fixed wave probes). A set of
+ *           points is only cached the second time it is seen: the hull points, which move at
+ *           each time step, therefore keep the direct evaluation (cf. WaveKernels).
+ *           The time phasors exp(-i omega_i t) are advanced from one time step to the next by
+ *           a complex multiplication with exp(-i omega_i dt). Each term is therefore a complex
+ *           multiply-add instead of a sine.
+ *           Rounding errors accumulate along the recurrence, so the time phasors are
+ *           recomputed exactly (hence renormalized) every 'renormalization_period' steps.
+ *           If the time step changes (or if t goes backwards), the time phasors are
+ *           also recomputed exactly & the new time step is used for the next steps.
+ *           The cache is protected by a mutex: if it is busy (several threads evaluating
+ *           the waves at the same time) or if the points are not cached, the 'elevation'
+ *           method returns false & the caller should use the direct evaluation.
+ *           The cache is also bypassed while the caller announces concurrent calls (eg. the bodies
+ *           evaluated on several threads by Sim::dx_dt, cf. set_concurrent_calls), so the results
+ *           do not depend on the scheduling of the threads.
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet environment_models/unit_tests/WavePhasorCacheTest.cpp WavePhasorCacheTest example
+ */
+class WavePhasorCache
+{
+    public:
+        WavePhasorCache(
+            const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Rays to sum
+            const size_t renormalization_period = 64,            //!< Number of recurrence steps between two exact evaluations of the time phasors
+            const size_t max_nb_of_cached_terms = 1 << 22        //!< Maximum number of rays times number of cached points (each cached term uses two doubles)
+            );
+
+        /**  \brief Surface elevation, if it can be computed from the cache
+          *  \returns True if eta was computed, false if the caller should use the direct evaluation
+          */
+        bool elevation(
+            const std::vector<double>& x, //!< x-positions in the NED frame (in meters)
+            const std::vector<double>& y, //!< y-positions in the NED frame (in meters)
+            const double t,               //!< Current time instant (in seconds)
+            std::vector<double>& eta      //!< Output: elevations (in meters)
+            );
+
+        /**  \brief While true, 'elevation' always returns false (the content of the cache would depend on the order of the calls)
+          *  \details Must not be called while 'elevation' is running.
+          */
+        void set_concurrent_calls(const bool concurrent_calls);
+
+        size_t get_nb_of_recurrence_steps() const;   //!< Number of time steps for which the time phasors were obtained by recurrence
+        size_t get_nb_of_exact_evaluations() const;  //!< Number of time steps for which the time phasors were computed with std::cos & std::sin
+        size_t get_nb_of_space_phasor_updates() const; //!< Number of sets of points for which the space phasors were computed
+
+    private:
+        WavePhasorCache(); // Disabled
+        void update_time_phasors(const double t);
+        void compute_time_phasors_exactly(const double t);
+        void set_time_step(const double new_dt);
+        struct SpacePhasors
+        {
+            SpacePhasors();
+            size_t hash;
+            size_t last_use;
+            std::vector<double> x;
+            std::vector<double> y;
+            std::vector<double> sin_kappa; // exp(i kappa_ij), stored point by point (index j*nb_of_rays+i)
+            std::vector<double> cos_kappa;
+        };
+        const SpacePhasors* find_or_add_space_phasors(const std::vector<double>& x, const std::vector<double>& y);
+        void compute_space_phasors(SpacePhasors& s) const;
+
+        std::mutex mutex;
+        std::atomic<bool> concurrent_calls;
+        size_t renormalization_period;
+        size_t max_nb_of_cached_terms;
+        std::vector<double> a;
+        std::vector<double> omega;
+        std::vector<double> k_cos_psi;
+        std::vector<double> k_sin_psi;
+        std::vector<double> phase;
+        // Time phasors a_i exp(-i omega_i t): real part in a_cos_omega_t, opposite of the imaginary part in a_sin_omega_t
+        std::vector<double> a_cos_omega_t;
+        std::vector<double> a_sin_omega_t;
+        // exp(-i omega_i dt), used to advance the time phasors
+        std::vector<double> cos_omega_dt;
+        std::vector<double> sin_omega_dt;
+        bool time_phasors_initialized;
+        double t_cached;
+        double dt;
+        size_t nb_of_steps_since_exact_evaluation;
+        std::vector<SpacePhasors> space_phasors;
+        std::vector<size_t> hashes_seen_once; // Sets of points seen once, which will be cached if they are seen again
+        size_t nb_of_calls;
+        size_t nb_of_recurrence_steps;
+        size_t nb_of_exact_evaluations;
+        size_t nb_of_space_phasor_updates;
+};
+
+#endif /* WAVEPHASORCACHE_HPP_ */
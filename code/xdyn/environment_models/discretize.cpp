@@ -107,6 +107,7 @@ DiscreteDirectionalWaveSpectrum discretize(
     for (const auto omega:ret.omega) ret.k.push_back(S.get_wave_number(omega));
     ret.pdyn_factor = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
     ret.pdyn_factor_sh = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
+    ret.depth_factor = DepthFactorParameters(0, stretching.get_delta(), stretching.get_h());
     return ret;
 }
 
@@ -145,6 +146,7 @@ DiscreteDirectionalWaveSpectrum discretize(
     }
     ret.pdyn_factor = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,h,eta,stretching);};
     ret.pdyn_factor_sh = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor_sh(k,z,h,eta,stretching);};
+    ret.depth_factor = DepthFactorParameters(h, stretching.get_delta(), stretching.get_h());
     return ret;
 }
 
@@ -161,6 +163,7 @@ FlatDiscreteDirectionalWaveSpectrum flatten(
     FlatDiscreteDirectionalWaveSpectrum ret;
     ret.pdyn_factor = spectrum.pdyn_factor;
     ret.pdyn_factor_sh = spectrum.pdyn_factor_sh;
+    ret.depth_factor = spectrum.depth_factor;
     const size_t nOmega = spectrum.omega.size();
     const size_t nPsi = spectrum.psi.size();
     if (nOmega * nPsi > 0)
@@ -290,6 +293,7 @@ FlatDiscreteDirectionalWaveSpectrum filter(
     FlatDiscreteDirectionalWaveSpectrum ret;
     ret.pdyn_factor=spectrum.pdyn_factor;
     ret.pdyn_factor_sh=spectrum.pdyn_factor_sh;
+    ret.depth_factor=spectrum.depth_factor;
     for (size_t i = 0 ; i < n; ++i)
     {
         a = spectrum.a.at(i);
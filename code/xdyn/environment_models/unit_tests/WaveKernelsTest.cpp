@@ -0,0 +1,215 @@
+/*
+ * WaveKernelsTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WaveKernelsTest.hpp"
+#include "WaveKernels.hpp"
+#include "Airy.hpp"
+#include "BretschneiderSpectrum.hpp"
+#include "Cos2sDirectionalSpreading.hpp"
+#include "Stretching.hpp"
+#include "discretize.hpp"
+#include "xdyn/external_data_structures/YamlWaveModelInput.hpp"
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+WaveKernelsTest::WaveKernelsTest() : a(ssc::random_data_generator::DataGenerator(2026))
+{
+}
+
+WaveKernelsTest::~WaveKernelsTest()
+{
+}
+
+void WaveKernelsTest::SetUp()
+{
+}
+
+void WaveKernelsTest::TearDown()
+{
+}
+
+// Tolerance documented in WaveKernels.hpp, relative to the sum of the amplitudes
+#define REL_EPS 1E-12
+
+namespace
+{
+    DiscreteDirectionalWaveSpectrum spectrum(const double h, const double stretching_h)
+    {
+        YamlStretching ys;
+        ys.h = stretching_h;
+        ys.delta = 0.5;
+        const Stretching s(ys);
+        const double Hs = 5;
+        const double Tp = 9;
+        // 47 rays: not a multiple of the SIMD width, so the padding is tested too
+        if (h > 0) return discretize(BretschneiderSpectrum(Hs, Tp), Cos2sDirectionalSpreading(PI/3, 2), 0.3, 2.5, 47, 1, h, s, false);
+        return discretize(BretschneiderSpectrum(Hs, Tp), Cos2sDirectionalSpreading(PI/3, 2), 0.3, 2.5, 47, 1, s, false);
+    }
+
+    double sum_of_amplitudes(const FlatDiscreteDirectionalWaveSpectrum& s)
+    {
+        double ret = 0;
+        for (const auto amplitude:s.a) ret += std::abs(amplitude);
+        return ret;
+    }
+
+    std::vector<WaveKernelInstructionSet> available_instruction_sets()
+    {
+        std::vector<WaveKernelInstructionSet> ret;
+        const WaveKernelInstructionSet best = WaveKernels::best_available_instruction_set();
+        for (const auto i:{WaveKernelInstructionSet::SCALAR, WaveKernelInstructionSet::AVX2, WaveKernelInstructionSet::AVX512})
+        {
+            if (i <= best) ret.push_back(i);
+        }
+        return ret;
+    }
+}
+
+TEST_F(WaveKernelsTest, simd_elevation_should_match_std_sin)
+{
+    //! [WaveKernelsTest example]
+    const FlatDiscreteDirectionalWaveSpectrum s = flatten(spectrum(0, 0));
+    const size_t n = 200;
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        x[i] = a.random<double>().between(-300, 300);
+        y[i] = a.random<double>().between(-300, 300);
+    }
+    const double t = a.random<double>().between(0, 500);
+    std::vector<double> reference(n);
+    WaveKernels(s, WaveKernelInstructionSet::SCALAR).elevation(n, x.data(), y.data(), t, reference.data());
+    //! [WaveKernelsTest example]
+    const double eps = REL_EPS*sum_of_amplitudes(s);
+    for (const auto instruction_set:available_instruction_sets())
+    {
+        const WaveKernels kernels(s, instruction_set);
+        ASSERT_EQ(instruction_set, kernels.get_instruction_set());
+        std::vector<double> eta(n);
+        kernels.elevation(n, x.data(), y.data(), t, eta.data());
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            ASSERT_NEAR(reference[i], eta[i], eps) << "Instruction set: " << to_string(instruction_set) << ", i = " << i;
+        }
+    }
+}
+
+TEST_F(WaveKernelsTest, simd_dynamic_pressure_and_orbital_velocity_should_match_scalar_in_finite_and_infinite_depth)
+{
+    for (const double h:{0., 60.})
+    {
+        const FlatDiscreteDirectionalWaveSpectrum s = flatten(spectrum(h, 0));
+        const size_t n = 100;
+        std::vector<double> x(n), y(n), z(n);
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            x[i] = a.random<double>().between(-300, 300);
+            y[i] = a.random<double>().between(-300, 300);
+            z[i] = a.random<double>().between(-2, 59);
+        }
+        const double t = a.random<double>().between(0, 500);
+        const WaveKernels scalar(s, WaveKernelInstructionSet::SCALAR);
+        std::vector<double> p_ref(n), u_ref(n), v_ref(n), w_ref(n);
+        scalar.dynamic_pressure(n, x.data(), y.data(), z.data(), t, p_ref.data());
+        scalar.orbital_velocity(n, x.data(), y.data(), z.data(), t, u_ref.data(), v_ref.data(), w_ref.data());
+        const double eps = REL_EPS*sum_of_amplitudes(s);
+        for (const auto instruction_set:available_instruction_sets())
+        {
+            const WaveKernels kernels(s, instruction_set);
+            std::vector<double> p(n), u(n), v(n), w(n);
+            kernels.dynamic_pressure(n, x.data(), y.data(), z.data(), t, p.data());
+            kernels.orbital_velocity(n, x.data(), y.data(), z.data(), t, u.data(), v.data(), w.data());
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                ASSERT_NEAR(p_ref[i], p[i], eps) << "Instruction set: " << to_string(instruction_set) << ", h = " << h << ", i = " << i;
+                ASSERT_NEAR(u_ref[i], u[i], eps) << "Instruction set: " << to_string(instruction_set) << ", h = " << h << ", i = " << i;
+                ASSERT_NEAR(v_ref[i], v[i], eps) << "Instruction set: " << to_string(instruction_set) << ", h = " << h << ", i = " << i;
+                ASSERT_NEAR(w_ref[i], w[i], eps) << "Instruction set: " << to_string(instruction_set) << ", h = " << h << ", i = " << i;
+            }
+        }
+    }
+}
+
+TEST_F(WaveKernelsTest, simd_rao_sums_should_match_scalar)
+{
+    const FlatDiscreteDirectionalWaveSpectrum s = flatten(spectrum(0, 0));
+    const WaveKernels scalar(s, WaveKernelInstructionSet::SCALAR);
+    std::vector<std::vector<double> > amplitudes(6, std::vector<double>(scalar.get_nb_of_padded_rays(), 0));
+    std::vector<std::vector<double> > phases(6, std::vector<double>(scalar.get_nb_of_padded_rays(), 0));
+    const double* A[6];
+    const double* phi[6];
+    for (size_t d = 0 ; d < 6 ; ++d)
+    {
+        for (size_t i = 0 ; i < s.a.size() ; ++i)
+        {
+            amplitudes[d][i] = s.a[i]*a.random<double>().between(0, 2);
+            phases[d][i] = a.random<double>().between(-PI, PI);
+        }
+        A[d] = amplitudes[d].data();
+        phi[d] = phases[d].data();
+    }
+    const double x = a.random<double>().between(-300, 300);
+    const double y = a.random<double>().between(-300, 300);
+    const double t = a.random<double>().between(0, 500);
+    double w_ref[6];
+    scalar.rao_sums(A, phi, x, y, t, w_ref);
+    for (size_t d = 0 ; d < 6 ; ++d)
+    {
+        double expected = 0;
+        for (size_t i = 0 ; i < s.a.size() ; ++i)
+        {
+            expected += amplitudes[d][i]*std::sin(-s.omega[i]*t + s.k[i]*(x*s.cos_psi[i] + y*s.sin_psi[i]) + s.phase[i] + phases[d][i]);
+        }
+        ASSERT_NEAR(expected, w_ref[d], REL_EPS*2*sum_of_amplitudes(s)) << "d = " << d;
+    }
+    for (const auto instruction_set:available_instruction_sets())
+    {
+        double w[6];
+        WaveKernels(s, instruction_set).rao_sums(A, phi, x, y, t, w);
+        for (size_t d = 0 ; d < 6 ; ++d)
+        {
+            ASSERT_NEAR(w_ref[d], w[d], REL_EPS*2*sum_of_amplitudes(s)) << "Instruction set: " << to_string(instruction_set) << ", d = " << d;
+        }
+    }
+}
+
+TEST_F(WaveKernelsTest, airy_should_give_the_same_results_with_and_without_closed_form_depth_factors)
+{
+    const double g = 9.81;
+    const double rho = 1025;
+    for (const double h:{0., 60.})
+    {
+        const DiscreteDirectionalWaveSpectrum with_closed_form = spectrum(h, 10);
+        DiscreteDirectionalWaveSpectrum with_closures_only = with_closed_form;
+        with_closures_only.depth_factor = DepthFactorParameters();
+        const Airy fast(with_closed_form, 12);
+        const Airy reference(with_closures_only, 12);
+        const size_t n = 100;
+        std::vector<double> x(n), y(n), z(n);
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            x[i] = a.random<double>().between(-300, 300);
+            y[i] = a.random<double>().between(-300, 300);
+            z[i] = a.random<double>().between(-5, 65);
+        }
+        const double t = a.random<double>().between(0, 500);
+        const std::vector<double> eta = reference.get_elevation(x, y, t);
+        const std::vector<double> p_ref = reference.get_dynamic_pressure(rho, g, x, y, z, eta, t);
+        const std::vector<double> p = fast.get_dynamic_pressure(rho, g, x, y, z, eta, t);
+        const ssc::kinematics::PointMatrix V_ref = reference.get_orbital_velocity(g, x, y, z, t, eta);
+        const ssc::kinematics::PointMatrix V = fast.get_orbital_velocity(g, x, y, z, t, eta);
+        const double eps = REL_EPS*sum_of_amplitudes(fast.get_spectrum());
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            ASSERT_NEAR(p_ref[i], p[i], rho*g*eps) << "h = " << h << ", i = " << i;
+            for (Eigen::Index j = 0 ; j < 3 ; ++j)
+            {
+                ASSERT_NEAR(V_ref.m(j, (Eigen::Index)i), V.m(j, (Eigen::Index)i), g*eps) << "h = " << h << ", i = " << i;
+            }
+        }
+    }
+}
@@ -0,0 +1,23 @@
+/*
+ * WaveKernelsTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEKERNELSTEST_HPP_
+#define WAVEKERNELSTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class WaveKernelsTest : public ::testing::Test
+{
+    protected:
+        WaveKernelsTest();
+        virtual ~WaveKernelsTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* WAVEKERNELSTEST_HPP_ */
@@ -0,0 +1,193 @@
+/*
+ * WavePhasorCacheTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WavePhasorCacheTest.hpp"
+#include "WavePhasorCache.hpp"
+#include "Airy.hpp"
+#include "BretschneiderSpectrum.hpp"
+#include "Cos2sDirectionalSpreading.hpp"
+#include "Stretching.hpp"
+#include "discretize.hpp"
+#include "xdyn/external_data_structures/YamlWaveModelInput.hpp"
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+WavePhasorCacheTest::WavePhasorCacheTest() : a(ssc::random_data_generator::DataGenerator(1717))
+{
+}
+
+WavePhasorCacheTest::~WavePhasorCacheTest()
+{
+}
+
+void WavePhasorCacheTest::SetUp()
+{
+}
+
+void WavePhasorCacheTest::TearDown()
+{
+}
+
+// Relative to the sum of the amplitudes
+#define REL_EPS 1E-12
+
+namespace
+{
+    FlatDiscreteDirectionalWaveSpectrum spectrum()
+    {
+        YamlStretching ys;
+        const Stretching s(ys);
+        return flatten(discretize(BretschneiderSpectrum(4, 8), Cos2sDirectionalSpreading(PI/6, 2), 0.3, 2.5, 30, 5, s, false));
+    }
+
+    std::vector<double> direct_elevation(const FlatDiscreteDirectionalWaveSpectrum& s, const std::vector<double>& x, const std::vector<double>& y, const double t)
+    {
+        std::vector<double> eta(x.size());
+        for (size_t j = 0 ; j < x.size() ; ++j)
+        {
+            for (size_t i = 0 ; i < s.a.size() ; ++i)
+            {
+                eta[j] -= s.a[i] * std::sin(-s.omega[i]*t + s.k[i]*(x[j]*s.cos_psi[i] + y[j]*s.sin_psi[i]) + s.phase[i]);
+            }
+        }
+        return eta;
+    }
+
+    double sum_of_amplitudes(const FlatDiscreteDirectionalWaveSpectrum& s)
+    {
+        double ret = 0;
+        for (const auto amplitude:s.a) ret += amplitude;
+        return ret;
+    }
+}
+
+TEST_F(WavePhasorCacheTest, should_match_direct_evaluation_over_many_time_steps)
+{
+    //! [WavePhasorCacheTest example]
+    const FlatDiscreteDirectionalWaveSpectrum s = spectrum();
+    WavePhasorCache cache(s, 16);
+    const size_t n = 50;
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        x[i] = a.random<double>().between(-200, 200);
+        y[i] = a.random<double>().between(-200, 200);
+    }
+    const double dt = 0.2;
+    std::vector<double> eta;
+    // Points are only cached the second time they are seen
+    ASSERT_FALSE(cache.elevation(x, y, 0, eta));
+    for (size_t k = 0 ; k < 100 ; ++k)
+    {
+        const double t = 10 + (double)k*dt;
+        ASSERT_TRUE(cache.elevation(x, y, t, eta));
+        const std::vector<double> reference = direct_elevation(s, x, y, t);
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            ASSERT_NEAR(reference[i], eta[i], REL_EPS*sum_of_amplitudes(s)) << "t = " << t << ", i = " << i;
+        }
+    }
+    //! [WavePhasorCacheTest example]
+    ASSERT_EQ(1, cache.get_nb_of_space_phasor_updates());
+    // First two time steps are computed exactly (no known time step), then one exact evaluation every 16 steps
+    ASSERT_EQ(2 + 98/16, cache.get_nb_of_exact_evaluations());
+    ASSERT_EQ(100 - cache.get_nb_of_exact_evaluations(), cache.get_nb_of_recurrence_steps());
+}
+
+TEST_F(WavePhasorCacheTest, should_recompute_time_phasors_if_time_step_changes_or_time_goes_backwards)
+{
+    const FlatDiscreteDirectionalWaveSpectrum s = spectrum();
+    WavePhasorCache cache(s);
+    const std::vector<double> x = {1, 2, 3};
+    const std::vector<double> y = {4, 5, 6};
+    std::vector<double> eta;
+    ASSERT_FALSE(cache.elevation(x, y, 0, eta));
+    for (const double t:{0., 0.1, 0.2, 0.3, 0.5, 0.7, 0.6, 0.65, 0.7, 0.7})
+    {
+        ASSERT_TRUE(cache.elevation(x, y, t, eta));
+        const std::vector<double> reference = direct_elevation(s, x, y, t);
+        for (size_t i = 0 ; i < x.size() ; ++i)
+        {
+            ASSERT_NEAR(reference[i], eta[i], REL_EPS*sum_of_amplitudes(s)) << "t = " << t << ", i = " << i;
+        }
+    }
+    // Exact for t = 0, 0.1 (dt unknown), 0.5 (new dt), 0.6 (backwards), 0.65 (new dt)
+    ASSERT_EQ(5, cache.get_nb_of_exact_evaluations());
+    // Recurrence for 0.2, 0.3, 0.7 (after 0.5) & 0.7 (after 0.65). The last call reuses the same phasors
+    ASSERT_EQ(4, cache.get_nb_of_recurrence_steps());
+}
+
+TEST_F(WavePhasorCacheTest, moving_points_are_not_cached)
+{
+    const FlatDiscreteDirectionalWaveSpectrum s = spectrum();
+    WavePhasorCache cache(s);
+    const std::vector<double> x_mesh = {0, 10, 20};
+    const std::vector<double> y_mesh = {0, 0, 0};
+    std::vector<double> eta;
+    ASSERT_FALSE(cache.elevation(x_mesh, y_mesh, 0, eta));
+    for (size_t k = 0 ; k < 20 ; ++k)
+    {
+        const double t = 0.1*(double)k;
+        // Hull points: different at each call
+        ASSERT_FALSE(cache.elevation({t, 1+t}, {2*t, 3*t}, t, eta));
+        ASSERT_TRUE(cache.elevation(x_mesh, y_mesh, t, eta));
+    }
+    ASSERT_EQ(1, cache.get_nb_of_space_phasor_updates());
+}
+
+TEST_F(WavePhasorCacheTest, sets_of_points_too_large_are_not_cached)
+{
+    const FlatDiscreteDirectionalWaveSpectrum s = spectrum();
+    WavePhasorCache cache(s, 64, 2*s.a.size());
+    const std::vector<double> x = {1, 2, 3};
+    const std::vector<double> y = {4, 5, 6};
+    std::vector<double> eta;
+    ASSERT_FALSE(cache.elevation(x, y, 0, eta));
+    ASSERT_FALSE(cache.elevation(x, y, 0, eta));
+    ASSERT_FALSE(cache.elevation({1, 2}, {4, 5}, 0, eta));
+    ASSERT_TRUE(cache.elevation({1, 2}, {4, 5}, 0, eta));
+}
+
+TEST_F(WavePhasorCacheTest, cache_is_bypassed_while_called_concurrently)
+{
+    const FlatDiscreteDirectionalWaveSpectrum s = spectrum();
+    WavePhasorCache cache(s);
+    const std::vector<double> x = {1, 2, 3};
+    const std::vector<double> y = {4, 5, 6};
+    std::vector<double> eta;
+    ASSERT_FALSE(cache.elevation(x, y, 0, eta));
+    ASSERT_TRUE(cache.elevation(x, y, 0.1, eta));
+    cache.set_concurrent_calls(true);
+    ASSERT_FALSE(cache.elevation(x, y, 0.2, eta));
+    cache.set_concurrent_calls(false);
+    ASSERT_TRUE(cache.elevation(x, y, 0.2, eta));
+    ASSERT_EQ(1, cache.get_nb_of_space_phasor_updates());
+}
+
+TEST_F(WavePhasorCacheTest, airy_should_give_the_same_elevations_with_and_without_phasor_cache)
+{
+    const FlatDiscreteDirectionalWaveSpectrum s = spectrum();
+    const Airy reference(s);
+    Airy cached(s);
+    ASSERT_FALSE(cached.has_phasor_cache());
+    cached.enable_phasor_cache();
+    ASSERT_TRUE(cached.has_phasor_cache());
+    const std::vector<double> x = {-12, 0, 35, 100};
+    const std::vector<double> y = {3, 0, -41, 7};
+    for (size_t k = 0 ; k < 200 ; ++k)
+    {
+        const double t = 0.05*(double)k;
+        const std::vector<double> eta_ref = reference.get_elevation(x, y, t);
+        const std::vector<double> eta = cached.get_elevation(x, y, t);
+        for (size_t i = 0 ; i < x.size() ; ++i)
+        {
+            ASSERT_NEAR(eta_ref[i], eta[i], REL_EPS*sum_of_amplitudes(s)) << "t = " << t << ", i = " << i;
+        }
+    }
+    cached.disable_phasor_cache();
+    ASSERT_FALSE(cached.has_phasor_cache());
+}
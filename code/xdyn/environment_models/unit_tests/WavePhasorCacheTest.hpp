@@ -0,0 +1,23 @@
+/*
+ * WavePhasorCacheTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEPHASORCACHETEST_HPP_
+#define WAVEPHASORCACHETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class WavePhasorCacheTest : public ::testing::Test
+{
+    protected:
+        WavePhasorCacheTest();
+        virtual ~WavePhasorCacheTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* WAVEPHASORCACHETEST_HPP_ */
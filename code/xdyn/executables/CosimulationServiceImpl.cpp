@@ -9,14 +9,14 @@
 #include "xdyn/external_data_structures/YamlSimServerInputs.hpp"
 #include <sstream>
 
-CosimulationServiceImpl::CosimulationServiceImpl(const XdynForCS& simserver_, ErrorReporter& error_outputter_):
-        simserver(simserver_),
-        error_outputter(error_outputter_)
+CosimulationServiceImpl::CosimulationServiceImpl(Sessions<XdynForCS>& sessions_):
+        sessions(sessions_)
 {}
 
-YamlSimServerInputs from_grpc(grpc::ServerContext* , const CosimulationRequestEuler* request)
+YamlSimServerInputs from_grpc(grpc::ServerContext* context, const CosimulationRequestEuler* request)
 {
     YamlSimServerInputs server_inputs;
+    server_inputs.session = get_session_id(context);
     ssc::kinematics::EulerAngles angles;
     YamlRotation rot;
     rot.order_by = "angle";
@@ -57,9 +57,10 @@ YamlSimServerInputs from_grpc(grpc::ServerContext* , const CosimulationRequestEu
     return server_inputs;
 }
 
-YamlSimServerInputs from_grpc(grpc::ServerContext* , const CosimulationRequestQuaternion* request)
+YamlSimServerInputs from_grpc(grpc::ServerContext* context, const CosimulationRequestQuaternion* request)
 {
     YamlSimServerInputs server_inputs;
+    server_inputs.session = get_session_id(context);
     if (request)
     {
         server_inputs.Dt = request->dt();
@@ -9,6 +9,7 @@
 #define EXECUTABLES_INC_XDYNFORCSGRPC_HPP_
 
 #include "xdyn/external_data_structures/YamlSimServerInputs.hpp"
+#include "xdyn/observers_and_api/Sessions.hpp"
 #include "xdyn/observers_and_api/XdynForCS.hpp"
 #include "ErrorReporter.hpp"
 #include "cosimulation.grpc.pb.h"
@@ -25,7 +26,7 @@ grpc::Status to_grpc(grpc::ServerContext* context, const std::vector<YamlState>&
 
 class CosimulationServiceImpl final : public Cosimulation::Service {
     public:
-        explicit CosimulationServiceImpl(const XdynForCS& simserver, ErrorReporter& outputter);
+        explicit CosimulationServiceImpl(Sessions<XdynForCS>& sessions);
         grpc::Status step_quaternion(grpc::ServerContext* context, const CosimulationRequestQuaternion* request, CosimulationResponse* response) override;
         grpc::Status step_euler_321(grpc::ServerContext* context, const CosimulationRequestEuler* request, CosimulationResponse* response) override;
 
@@ -41,14 +42,13 @@ class CosimulationServiceImpl final : public Cosimulation::Service {
                 {
                     check_states_size(request);
                     const YamlSimServerInputs inputs = from_grpc(context, request);
-                    output = simserver.handle(inputs);
+                    sessions.run(inputs.session, [&inputs, &output](XdynForCS& simserver){output = simserver.handle(inputs);});
                     run_status = to_grpc(context, output, response);
                 };
-            error_outputter.run_and_report_errors_without_yaml_dump(f);
-            return to_gRPC_status(error_outputter);
+            // gRPC calls this method concurrently, so each call has its own ErrorReporter
+            return run_and_report_errors_as_gRPC_status(f);
         }
-        XdynForCS simserver;
-        ErrorReporter& error_outputter;
+        Sessions<XdynForCS>& sessions;
 };
 
 #endif /* EXECUTABLES_INC_XDYNFORCSGRPC_HPP_ */
@@ -3,7 +3,11 @@
 
 #include <iostream>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <thread>
+#include <utility> // std::pair
 // For handling Ctrl+C
 #include <unistd.h>
 #include <cstdio>
@@ -14,6 +18,7 @@
 #include <ssc/macros.hpp>
 
 #include "xdyn/observers_and_api/JSONSerializer.hpp"
+#include "xdyn/observers_and_api/Sessions.hpp"
 #include "ErrorReporter.hpp"
 
 volatile sig_atomic_t stop;
@@ -41,7 +46,7 @@ template<class ServiceT>
 class JSONWebSocketServer
 {
     public:
-        JSONWebSocketServer(const ServiceT& service, const bool verbose) : handler(service, verbose)
+        JSONWebSocketServer(Sessions<ServiceT>& sessions, const bool verbose) : handler(sessions, verbose)
         {
         }
         virtual ~JSONWebSocketServer()
@@ -55,9 +60,11 @@ class JSONWebSocketServer
             signal(SIGINT, stop_simulation);
             while(!stop)
             {
-                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                handler.send_replies(std::chrono::milliseconds(500));
             }
             std::cout << std::endl << "Gracefully stopping the websocket server..." << std::endl;
+            // The pending jobs are run & their replies sent while the connections still exist
+            handler.stop();
         }
 
     private:
@@ -69,13 +76,17 @@ class JSONWebSocketServer
         class JSONHandler : public ssc::websocket::MessageHandler
         {
             public:
-                JSONHandler(const ServiceT& simserver, const bool verbose_) : sim_server(simserver), verbose(verbose_), error_outputter()
+                JSONHandler(Sessions<ServiceT>& sessions_, const bool verbose_) : sessions(sessions_), verbose(verbose_), replies_mutex(), reply_available(), replies()
                 {
                 }
                 virtual ~JSONHandler()
                 {
+                    // So no job uses this handler once it is destroyed (eg. if 'start' threw): their replies are discarded
+                    sessions.stop();
                 }
 
+                // Only deserializes the request: the simulation is run by one of the threads of 'sessions',
+                // so the requests of the different sessions (ie. of the different clients) are handled concurrently.
                 void operator()(const ssc::websocket::Message& msg)
                 {
                     const std::string input_json = msg.get_payload();
@@ -83,32 +94,96 @@ class JSONWebSocketServer
                     {
                         std::cout << current_date_time() << " Received: " << input_json << std::endl;
                     }
-                    const auto f = [&input_json, this, &msg]()
+                    YamlSimServerInputs inputs;
+                    ErrorReporter error_outputter;
+                    error_outputter.run_and_report_errors_without_yaml_dump([&inputs, &input_json](){inputs = deserialize(input_json);});
+                    if (error_outputter.contains_errors())
+                    {
+                        reply_error(msg, error_outputter);
+                        return;
+                    }
+                    const bool verbose_ = verbose;
+                    const auto job = [this, inputs, msg, verbose_](ServiceT& sim_server)
                     {
-                        SimServerInputs server_inputs(deserialize(input_json), sim_server.get_Tmax());
+                        SimServerInputs server_inputs(inputs, sim_server.get_Tmax());
                         const std::string output_json = serialize(sim_server.handle(server_inputs));
-                        if (verbose)
+                        if (verbose_)
                         {
                             std::cout << current_date_time() << " Sending: " << output_json << std::endl;
                         }
-                        msg.send_text(output_json);
+                        reply(msg, output_json);
                     };
-                    error_outputter.run_and_report_errors_without_yaml_dump(f);
+                    const auto on_error = [this, msg](const std::exception_ptr& e)
+                    {
+                        ErrorReporter error_reporter;
+                        error_reporter.run_and_report_errors_without_yaml_dump([&e](){std::rethrow_exception(e);});
+                        reply_error(msg, error_reporter);
+                    };
+                    // Fails if the server is being stopped
+                    error_outputter.run_and_report_errors_without_yaml_dump([this, &inputs, &job, &on_error](){sessions.post(inputs.session, job, on_error);});
                     if (error_outputter.contains_errors())
                     {
-                        msg.send_text(replace_newlines_by_spaces(std::string("{\"error\": \"") + error_outputter.get_message() + "\"}"));
+                        reply_error(msg, error_outputter);
                     }
                 }
 
+                /**  \brief Sends the replies of the jobs which are done, waiting at most 'timeout' for the first one
+                  *  \details Only called by the thread running JSONWebSocketServer::start: the worker threads of
+                  *           'sessions' never use the connections themselves.
+                  */
+                void send_replies(const std::chrono::milliseconds& timeout)
+                {
+                    std::deque<std::pair<ssc::websocket::Message, std::string> > to_send;
+                    {
+                        std::unique_lock<std::mutex> lock(replies_mutex);
+                        reply_available.wait_for(lock, timeout, [this]{return not(replies.empty());});
+                        to_send.swap(replies);
+                    }
+                    for (const auto& r:to_send)
+                    {
+                        try
+                        {
+                            r.first.send_text(r.second);
+                        }
+                        catch (const std::exception& e)
+                        {
+                            std::cerr << current_date_time() << " Unable to send a reply (the client may have disconnected): " << e.what() << std::endl;
+                        }
+                    }
+                }
+
+                /**  \brief Runs the jobs which were already posted & sends their replies
+                  */
+                void stop()
+                {
+                    sessions.stop();
+                    send_replies(std::chrono::milliseconds(0));
+                }
+
             private:
-                std::string replace_newlines_by_spaces(std::string str)
+                static std::string replace_newlines_by_spaces(std::string str)
                 {
                     boost::replace_all(str, "\n", " ");
                     return str;
                 }
-                ServiceT sim_server;
+                void reply_error(const ssc::websocket::Message& msg, const ErrorReporter& error_outputter)
+                {
+                    reply(msg, replace_newlines_by_spaces(std::string("{\"error\": \"") + error_outputter.get_message() + "\"}"));
+                }
+                // Called by any thread: the reply is sent by send_replies
+                void reply(const ssc::websocket::Message& msg, const std::string& text)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(replies_mutex);
+                        replies.push_back(std::make_pair(msg, text));
+                    }
+                    reply_available.notify_one();
+                }
+                Sessions<ServiceT>& sessions;
                 const bool verbose;
-                ErrorReporter error_outputter;
+                std::mutex replies_mutex;
+                std::condition_variable reply_available;
+                std::deque<std::pair<ssc::websocket::Message, std::string> > replies; //!< Not sent yet
         };
 
         JSONHandler handler;
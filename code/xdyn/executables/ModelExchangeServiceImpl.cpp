@@ -13,14 +13,14 @@
 #include <sstream>
 #include <tuple>
 
-ModelExchangeServiceImpl::ModelExchangeServiceImpl(const XdynForME& xdyn_, ErrorReporter& error_outputter_):
-simserver(xdyn_),
-error_outputter(error_outputter_)
+ModelExchangeServiceImpl::ModelExchangeServiceImpl(Sessions<XdynForME>& sessions_):
+sessions(sessions_)
 {}
 
-YamlSimServerInputs from_grpc(grpc::ServerContext* , const ModelExchangeRequestEuler* request)
+YamlSimServerInputs from_grpc(grpc::ServerContext* context, const ModelExchangeRequestEuler* request)
 {
     YamlSimServerInputs server_inputs;
+    server_inputs.session = get_session_id(context);
     ssc::kinematics::EulerAngles angles;
     YamlRotation rot;
     rot.order_by = "angle";
@@ -61,9 +61,10 @@ YamlSimServerInputs from_grpc(grpc::ServerContext* , const ModelExchangeRequestE
     return server_inputs;
 }
 
-YamlSimServerInputs from_grpc(grpc::ServerContext* , const ModelExchangeRequestQuaternion* request)
+YamlSimServerInputs from_grpc(grpc::ServerContext* context, const ModelExchangeRequestQuaternion* request)
 {
     YamlSimServerInputs server_inputs;
+    server_inputs.session = get_session_id(context);
     if (request)
     {
 
@@ -11,6 +11,7 @@
 #include "model_exchange.grpc.pb.h"
 #include "model_exchange.pb.h"
 #include "xdyn/external_data_structures/YamlSimServerInputs.hpp"
+#include "xdyn/observers_and_api/Sessions.hpp"
 #include "xdyn/observers_and_api/XdynForME.hpp"
 #include "ErrorReporter.hpp"
 #include "gRPCChecks.hpp"
@@ -26,7 +27,7 @@ template <> void check_states_size<ModelExchangeRequestQuaternion>(const ModelEx
 
 class ModelExchangeServiceImpl final : public ModelExchange::Service {
     public:
-        explicit ModelExchangeServiceImpl(const XdynForME& xdyn, ErrorReporter& error_outputter);
+        explicit ModelExchangeServiceImpl(Sessions<XdynForME>& sessions);
         grpc::Status dx_dt_quaternion(grpc::ServerContext* context, const ModelExchangeRequestQuaternion* request, ModelExchangeResponse* response) override;
         grpc::Status dx_dt_euler_321(grpc::ServerContext* context, const ModelExchangeRequestEuler* request, ModelExchangeResponse* response) override;
 
@@ -42,14 +43,13 @@ class ModelExchangeServiceImpl final : public ModelExchange::Service {
                 {
                     check_states_size(request);
                     const YamlSimServerInputs inputs = from_grpc(context, request);
-                    output = simserver.handle(inputs);
+                    sessions.run(inputs.session, [&inputs, &output](XdynForME& simserver){output = simserver.handle(inputs);});
                     run_status = to_grpc(context, output, response);
                 };
-            error_outputter.run_and_report_errors_without_yaml_dump(f);
-            return to_gRPC_status(error_outputter);
+            // gRPC calls this method concurrently, so each call has its own ErrorReporter
+            return run_and_report_errors_as_gRPC_status(f);
         }
-        XdynForME simserver;
-        ErrorReporter& error_outputter;
+        Sessions<XdynForME>& sessions;
 };
 
 #endif /* EXECUTABLES_INC_MODELEXCHANGESERVICEIMPL_HPP_ */
@@ -22,6 +22,7 @@ struct XdynCommandLineArguments
     double tstart;
     double tend;
     bool catch_exceptions;
+    size_t nb_of_threads; //!< Number of threads used to evaluate the bodies concurrently
     bool empty() const;
 };
 
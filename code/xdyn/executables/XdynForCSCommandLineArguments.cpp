@@ -11,7 +11,7 @@
 #include "XdynForCSCommandLineArguments.hpp"
 
 XdynForCSCommandLineArguments::XdynForCSCommandLineArguments() : yaml_filenames(),
-solver(), initial_timestep(), catch_exceptions(), address({"127.0.0.1"}), port(0), verbose(false), show_help(false), show_websocket_debug_information(false), grpc(false)
+solver(), initial_timestep(), catch_exceptions(), address({"127.0.0.1"}), port(0), verbose(false), show_help(false), show_websocket_debug_information(false), grpc(false), session(false), nb_of_threads(1), max_nb_of_sessions(1)
 {
 }
 
@@ -27,6 +27,9 @@ struct XdynForCSCommandLineArguments
     bool show_help;
     bool show_websocket_debug_information;
     bool grpc;
+    bool session;
+    size_t nb_of_threads;      //!< Number of threads handling the requests of the different sessions
+    size_t max_nb_of_sessions; //!< Number of sessions kept by the server
 };
 
 #endif /* XDYNFORCSCOMMANDLINEARGUMENTS_HPP_ */
\ No newline at end of file
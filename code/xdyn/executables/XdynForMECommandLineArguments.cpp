@@ -16,7 +16,10 @@ XdynForMECommandLineArguments::XdynForMECommandLineArguments() : yaml_filenames(
                          verbose(false),
                          show_help(false),
                          show_websocket_debug_information(false),
-                         grpc(false)
+                         grpc(false),
+                         session(false),
+                         nb_of_threads(1),
+                         max_nb_of_sessions(1)
 {
 }
 
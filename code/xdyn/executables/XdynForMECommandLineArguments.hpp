@@ -25,6 +25,9 @@ struct XdynForMECommandLineArguments
     bool show_help;
     bool show_websocket_debug_information;
     bool grpc;
+    bool session;
+    size_t nb_of_threads;      //!< Number of threads handling the requests of the different sessions
+    size_t max_nb_of_sessions; //!< Number of sessions kept by the server
 };
 
 #endif /* XDYNFORMECOMMANDLINEARGUMENTS_HPP_ */
@@ -0,0 +1,205 @@
+/*
+ * benchmark_history.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Micro-benchmark of History (circular buffer) against its former implementation, which
+// stored the points in a std::vector & erased the oldest ones at each call to 'record'
+// (moving the whole history in memory). The workload mimics the radiation damping force
+// model: one value recorded per time step, with a long history (Tmax of 30 to 60 s) & a
+// few values retrieved at each step.
+// Usage: benchmark_history [Tmax (s)] [dt (s)] [nb_of_time_steps]
+
+#include "xdyn/hdb_interpolators/History.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+bool former_almost_equal(const double a, const double b, const int64_t maxUlpsDiff);
+bool former_almost_equal(const double a, const double b, const int64_t maxUlpsDiff)
+{
+    int64_t ia = 0;
+    int64_t ib = 0;
+    std::memcpy(&ia, &a, sizeof(double));
+    std::memcpy(&ib, &b, sizeof(double));
+    if ((ia < 0) != (ib < 0)) return a == b;
+    return std::abs(ia - ib) <= maxUlpsDiff;
+}
+
+// Former implementation of History::record, History::operator() & History::average
+class FormerHistory
+{
+    public:
+        FormerHistory(const double Tmax_) : Tmax(Tmax_), L(), oldest_recorded_instant(0)
+        {
+        }
+
+        double operator()(double tau) const
+        {
+            if (std::abs(tau-Tmax)<1E-12) tau = Tmax;
+            if (tau>Tmax) return get_value(Tmax);
+            if (L.empty()) return 0;
+            return get_value(tau);
+        }
+
+        void record(double t, const double val)
+        {
+            if (not(L.empty()) && former_almost_equal(t,L.back().first,4)) t = L.back().first;
+            if (L.empty()) oldest_recorded_instant = t;
+            oldest_recorded_instant = std::min(oldest_recorded_instant, t);
+            const size_t idx = find_braketing_position(t);
+            if ((idx != L.size()) and (former_almost_equal(L[idx].first, t, 4))) L[idx] = std::make_pair(t, val);
+            else                                                                 L.insert(L.begin() + (long) (idx), std::make_pair(t, val));
+            if (get_current_time() - oldest_recorded_instant >= Tmax)
+            {
+                oldest_recorded_instant = get_current_time()-Tmax;
+                const double vmin = interpolate_value_in_interval(1, oldest_recorded_instant);
+                L.erase(L.begin(), L.begin() + (long) find_braketing_position(oldest_recorded_instant));
+                if (not(former_almost_equal(L.front().first, oldest_recorded_instant,32)))
+                {
+                    L.insert(L.begin(), std::make_pair(oldest_recorded_instant, vmin));
+                }
+            }
+        }
+
+        double average(double T) const
+        {
+            if (L.empty()) return 0;
+            if (L.size()==1) return L.front().second;
+            if (T==0) return L.back().second;
+            T = std::min(T, L.back().first - L.front().first);
+            const double t = get_current_time() - T;
+            const size_t idx = find_braketing_position(t);
+            const double integral_of_first_interval = trapeze(t, interpolate_value_in_interval(idx, t), L.at(idx).first, L.at(idx).second);
+            double integral_from_t_to_now = 0;
+            for (size_t i = idx ; i < L.size()-1 ; ++i)
+            {
+                integral_from_t_to_now += trapeze(L.at(i).first, L.at(i).second, L.at(i+1).first, L.at(i+1).second);
+            }
+            return (integral_of_first_interval + integral_from_t_to_now)/T;
+        }
+
+        size_t size() const
+        {
+            return L.size();
+        }
+
+    private:
+        FormerHistory(); // Disabled
+
+        double get_current_time() const
+        {
+            return L.empty() ? oldest_recorded_instant : L.back().first;
+        }
+
+        double get_value(const double tau) const
+        {
+            const double t = get_current_time();
+            return interpolate_value_in_interval(find_braketing_position(t-tau), t-tau);
+        }
+
+        double interpolate_value_in_interval(const size_t idx, const double t) const
+        {
+            if ((idx == 0) or (idx >= L.size())) return L[0].second;
+            const double tA = L[idx-1].first;
+            const double tB = L[idx].first;
+            const double yA = L[idx-1].second;
+            const double yB = L[idx].second;
+            if (std::abs(t-tA) < 1E-12) return yA;
+            if (std::abs(t-tB) < 1E-12) return yB;
+            return (t-tA)/(tB-tA)*(yB-yA) + yA;
+        }
+
+        size_t find_braketing_position(const double t) const
+        {
+            if (L.empty())return 0;
+            if (L.back().first < t)           return L.size();
+            if (L.front().first >= t)         return 0;
+            size_t idx_lower = 0;
+            size_t idx_greater = L.size()-1;
+            while (true)
+            {
+                if (t==L[idx_lower].first)   return idx_lower;
+                if (t==L[idx_greater].first) return idx_greater;
+                if (idx_greater<=idx_lower+1) return idx_greater;
+                const size_t idx_middle = (size_t)std::floor(((double)idx_lower+(double)idx_greater)/2.);
+                if (t==L[idx_middle].first) return idx_middle;
+                if (t < L[idx_middle].first) idx_greater = idx_middle;
+                else                         idx_lower = idx_middle;
+            }
+            return L.size();
+        }
+
+        double trapeze(const double xa, const double ya, const double xb, const double yb) const
+        {
+            return (xb-xa)*(ya+yb)/2.;
+        }
+
+        double Tmax;
+        std::vector<std::pair<double,double> > L;
+        double oldest_recorded_instant;
+};
+
+struct Results
+{
+    Results() : microseconds_per_step(0), checksum(), size(0) {}
+    double microseconds_per_step;
+    std::vector<double> checksum; //!< Values retrieved at each time step, to check both implementations give the same results
+    size_t size;
+};
+
+template <typename H> Results run(H h, const double Tmax, const double dt, const size_t nb_of_time_steps)
+{
+    Results ret;
+    ret.checksum.reserve(nb_of_time_steps);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0 ; i < nb_of_time_steps ; ++i)
+    {
+        const double t = (double)i*dt;
+        h.record(t, std::sin(0.7*t) + 0.1*std::cos(5.3*t));
+        double s = h.average(1);
+        for (size_t j = 0 ; j <= 10 ; ++j)
+        {
+            s += h(Tmax*(double)j/10.);
+        }
+        ret.checksum.push_back(s);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    ret.microseconds_per_step = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / 1E3 / (double)nb_of_time_steps;
+    ret.size = h.size();
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    const double Tmax = argc > 1 ? std::atof(argv[1]) : 60;
+    const double dt = argc > 2 ? std::atof(argv[2]) : 0.01;
+    const size_t nb_of_time_steps = argc > 3 ? (size_t)std::atol(argv[3]) : 100000;
+    std::cout << "Tmax: " << Tmax << " s, dt: " << dt << " s, time steps: " << nb_of_time_steps << std::endl;
+
+    const Results former = run(FormerHistory(Tmax), Tmax, dt, nb_of_time_steps);
+    const Results current = run(History(Tmax), Tmax, dt, nb_of_time_steps);
+
+    double max_error = 0;
+    for (size_t i = 0 ; i < nb_of_time_steps ; ++i)
+    {
+        max_error = std::max(max_error, std::abs(current.checksum[i] - former.checksum[i]));
+    }
+    std::cout << "Points in history: " << current.size << " (former implementation: " << former.size << ")" << std::endl
+              << std::setprecision(3) << std::fixed
+              << "std::vector (former): " << former.microseconds_per_step << " us per time step" << std::endl
+              << "Circular buffer     : " << current.microseconds_per_step << " us per time step" << std::endl
+              << "Speed-up            : " << former.microseconds_per_step/current.microseconds_per_step << std::endl
+              << std::scientific
+              << "Max. difference     : " << max_error << std::endl;
+    return EXIT_SUCCESS;
+}
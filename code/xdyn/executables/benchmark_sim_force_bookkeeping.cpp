@@ -0,0 +1,223 @@
+/*
+ * benchmark_sim_force_bookkeeping.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Micro-benchmark of the bookkeeping of Sim::dx_dt (3 bodies, 30 force models) against the
+// former implementation, which looked up the bodies' force models & wrenches by name
+// (std::map<std::string,...>) and copied the force vectors & BodyStates at each call.
+// The force models are cheap (gravity, damping & constant forces) so the bookkeeping dominates.
+// Usage: benchmark_sim_force_bookkeeping [nb_of_calls]
+
+#include <vector> // Needs to be declared before ssc/macros.hpp to overload <<
+#include <google/protobuf/stubs/common.h>
+#include "xdyn/core/Sim.hpp"
+#include "xdyn/observers_and_api/simulator_api.hpp"
+#include "xdyn/yaml_parser/SimulatorYamlParser.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#define NB_OF_BODIES 3
+#define NB_OF_CONSTANT_FORCES_PER_BODY 7 // + gravity, linear & quadratic damping: 10 force models per body
+
+std::string yaml_for_benchmark();
+std::string yaml_for_benchmark()
+{
+    std::stringstream ss;
+    ss << "rotations convention: [psi, theta', phi'']\n"
+       << "environmental constants:\n"
+       << "    g: {value: 9.81, unit: m/s^2}\n"
+       << "    rho: {value: 1026, unit: kg/m^3}\n"
+       << "    nu: {value: 1.18e-6, unit: m^2/s}\n"
+       << "environment models: []\n"
+       << "bodies: # All bodies have NED as parent frame\n";
+    for (size_t i = 0 ; i < NB_OF_BODIES ; ++i)
+    {
+        const std::string name = "body" + std::to_string(i);
+        ss << "  - name: " << name << "\n"
+           << "    position of body frame relative to mesh:\n"
+           << "        frame: mesh\n"
+           << "        x: {value: 0, unit: m}\n"
+           << "        y: {value: 0, unit: m}\n"
+           << "        z: {value: 0, unit: m}\n"
+           << "        phi: {value: 0, unit: rad}\n"
+           << "        theta: {value: 0, unit: rad}\n"
+           << "        psi: {value: 0, unit: rad}\n"
+           << "    initial position of body frame relative to NED:\n"
+           << "        frame: NED\n"
+           << "        x: {value: " << 10*i << ", unit: m}\n"
+           << "        y: {value: 0, unit: m}\n"
+           << "        z: {value: 0, unit: m}\n"
+           << "        phi: {value: 0.1, unit: rad}\n"
+           << "        theta: {value: 0, unit: rad}\n"
+           << "        psi: {value: 0, unit: rad}\n"
+           << "    initial velocity of body frame relative to NED:\n"
+           << "        frame: " << name << "\n"
+           << "        u: {value: 1, unit: m/s}\n"
+           << "        v: {value: 0, unit: m/s}\n"
+           << "        w: {value: 0.1, unit: m/s}\n"
+           << "        p: {value: 0.01, unit: rad/s}\n"
+           << "        q: {value: 0, unit: rad/s}\n"
+           << "        r: {value: 0.02, unit: rad/s}\n"
+           << "    dynamics:\n"
+           << "        hydrodynamic forces calculation point in body frame:\n"
+           << "            x: {value: 0, unit: m}\n"
+           << "            y: {value: 0, unit: m}\n"
+           << "            z: {value: 0, unit: m}\n"
+           << "        centre of inertia:\n"
+           << "            frame: " << name << "\n"
+           << "            x: {value: 0, unit: m}\n"
+           << "            y: {value: 0, unit: m}\n"
+           << "            z: {value: 0.5, unit: m}\n"
+           << "        rigid body inertia matrix at the center of gravity and projected in the body frame:\n"
+           << "            row 1: [1E6,0,0,0,0,0]\n"
+           << "            row 2: [0,1E6,0,0,0,0]\n"
+           << "            row 3: [0,0,1E6,0,0,0]\n"
+           << "            row 4: [0,0,0,1E6,0,0]\n"
+           << "            row 5: [0,0,0,0,1E6,0]\n"
+           << "            row 6: [0,0,0,0,0,1E6]\n"
+           << "        added mass matrix at the center of gravity and projected in the body frame:\n"
+           << "            row 1: [0,0,0,0,0,0]\n"
+           << "            row 2: [0,0,0,0,0,0]\n"
+           << "            row 3: [0,0,0,0,0,0]\n"
+           << "            row 4: [0,0,0,0,0,0]\n"
+           << "            row 5: [0,0,0,0,0,0]\n"
+           << "            row 6: [0,0,0,0,0,0]\n"
+           << "    external forces:\n"
+           << "      - model: gravity\n"
+           << "      - model: linear damping\n"
+           << "        damping matrix at the center of gravity projected in the body frame:\n"
+           << "            row 1: [ 1E3, 0, 0, 0, 0, 0]\n"
+           << "            row 2: [ 0, 1E3, 0, 0, 0, 0]\n"
+           << "            row 3: [ 0, 0, 1E3, 0, 0, 0]\n"
+           << "            row 4: [ 0, 0, 0, 1E3, 0, 0]\n"
+           << "            row 5: [ 0, 0, 0, 0, 1E3, 0]\n"
+           << "            row 6: [ 0, 0, 0, 0, 0, 1E3]\n"
+           << "      - model: quadratic damping\n"
+           << "        damping matrix at the center of gravity projected in the body frame:\n"
+           << "            row 1: [ 1E2, 0, 0, 0, 0, 0]\n"
+           << "            row 2: [ 0, 1E2, 0, 0, 0, 0]\n"
+           << "            row 3: [ 0, 0, 1E2, 0, 0, 0]\n"
+           << "            row 4: [ 0, 0, 0, 1E2, 0, 0]\n"
+           << "            row 5: [ 0, 0, 0, 0, 1E2, 0]\n"
+           << "            row 6: [ 0, 0, 0, 0, 0, 1E2]\n";
+        for (size_t j = 0 ; j < NB_OF_CONSTANT_FORCES_PER_BODY ; ++j)
+        {
+            ss << "      - model: constant force\n"
+               << "        frame: NED\n"
+               << "        x: {value: " << j << ", unit: m}\n"
+               << "        y: {value: 0, unit: m}\n"
+               << "        z: {value: 0, unit: m}\n"
+               << "        X: {value: 1, unit: kN}\n"
+               << "        Y: {value: 2, unit: kN}\n"
+               << "        Z: {value: 3, unit: kN}\n"
+               << "        K: {value: 0, unit: kN*m}\n"
+               << "        M: {value: 0, unit: kN*m}\n"
+               << "        N: {value: 0, unit: kN*m}\n";
+        }
+    }
+    return ss.str();
+}
+
+ssc::kinematics::Wrench project_in_NED(const ssc::kinematics::Wrench& F, const ssc::kinematics::RotationMatrix& R);
+ssc::kinematics::Wrench project_in_NED(const ssc::kinematics::Wrench& F, const ssc::kinematics::RotationMatrix& R)
+{
+    return ssc::kinematics::Wrench(ssc::kinematics::Point("NED"),R*F.force,R*F.torque);
+}
+
+// Former implementation of Sim::dx_dt & Sim::sum_of_forces (before the bodies & force models were resolved to indices)
+class FormerBookkeeping
+{
+    public:
+        FormerBookkeeping(const Sim& sys) : bodies(sys.get_bodies()), forces(sys.get_forces()), env(sys.get_env()), command_listener(sys.get_command_listener()),
+            sum_of_forces_in_body_frame(), sum_of_forces_in_NED_frame(), fictitious_forces_in_body_frame(), fictitious_forces_in_NED_frame()
+        {
+        }
+
+        void dx_dt(const StateType& x, StateType& dxdt, const double t)
+        {
+            for (auto body: bodies)
+            {
+                body->update(env,x,t);
+                const auto Fext = sum_of_forces(x, body, t);
+                body->calculate_state_derivatives(Fext, x, dxdt, t, env);
+            }
+        }
+
+    private:
+        ssc::kinematics::UnsafeWrench sum_of_forces(const StateType& x, const BodyPtr& body, const double t)
+        {
+            const Eigen::Vector3d uvw = body->get_uvw(x);
+            const Eigen::Vector3d pqr = body->get_pqr(x);
+            const BodyStates states = body->get_states();
+            fictitious_forces_in_body_frame[body->get_name()] = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia,uvw, pqr));
+            sum_of_forces_in_body_frame[body->get_name()] = fictitious_forces_in_body_frame[body->get_name()];
+            const auto forces_of_body = forces[body->get_name()];
+            for (auto force:forces_of_body)
+            {
+                const ssc::kinematics::Wrench tau = force->operator()(states, t, env, command_listener);
+                sum_of_forces_in_body_frame[body->get_name()] += tau;
+            }
+            sum_of_forces_in_NED_frame[body->get_name()] = project_in_NED(sum_of_forces_in_body_frame[body->get_name()],states.get_rot_from_ned_to_body());
+            fictitious_forces_in_NED_frame[body->get_name()] = project_in_NED(fictitious_forces_in_body_frame[body->get_name()],states.get_rot_from_ned_to_body());
+            return sum_of_forces_in_body_frame[body->get_name()];
+        }
+
+        std::vector<BodyPtr> bodies;
+        std::map<std::string,std::vector<ForcePtr> > forces;
+        EnvironmentAndFrames env;
+        ssc::data_source::DataSource& command_listener;
+        std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_body_frame;
+        std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_NED_frame;
+        std::map<std::string,ssc::kinematics::UnsafeWrench> fictitious_forces_in_body_frame;
+        std::map<std::string,ssc::kinematics::UnsafeWrench> fictitious_forces_in_NED_frame;
+};
+
+template <typename F> double microseconds_per_call(const size_t nb_of_calls, const F& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0 ; i < nb_of_calls ; ++i)
+    {
+        f((double)i*1E-3);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / 1E3 / (double)nb_of_calls;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t nb_of_calls = argc > 1 ? (size_t)std::atol(argv[1]) : 20000;
+    Sim sys = get_system(SimulatorYamlParser(yaml_for_benchmark()).parse(), 0);
+    FormerBookkeeping former(sys);
+    const StateType x = sys.state;
+    StateType dxdt_former(x.size(), 0);
+    StateType dxdt(x.size(), 0);
+
+    size_t nb_of_force_models = 0;
+    for (const auto& forces:sys.get_forces()) nb_of_force_models += forces.second.size();
+    std::cout << "Bodies: " << sys.get_bodies().size() << ", force models: " << nb_of_force_models << ", calls to dx_dt: " << nb_of_calls << std::endl;
+
+    // The force models memoize their last evaluation so t changes at each call to avoid measuring the cache
+    const double t_former = microseconds_per_call(nb_of_calls, [&former, &x, &dxdt_former](const double t){former.dx_dt(x, dxdt_former, t);});
+    const double t_sim = microseconds_per_call(nb_of_calls, [&sys, &x, &dxdt](const double t){sys.dx_dt(x, dxdt, t);});
+
+    double max_error = 0;
+    for (size_t i = 0 ; i < x.size() ; ++i)
+    {
+        max_error = std::max(max_error, std::abs(dxdt[i] - dxdt_former[i]));
+    }
+    std::cout << std::setprecision(3) << std::fixed
+              << "String-keyed bookkeeping (former): " << t_former << " us per call to dx_dt" << std::endl
+              << "Index-addressed bookkeeping      : " << t_sim << " us per call to dx_dt" << std::endl
+              << "Overhead reduction               : " << (t_former - t_sim) << " us per call (" << 100*(t_former - t_sim)/t_former << " %)" << std::endl
+              << std::scientific
+              << "Max. difference on dx/dt         : " << max_error << std::endl;
+    google::protobuf::ShutdownProtobufLibrary();
+    return EXIT_SUCCESS;
+}
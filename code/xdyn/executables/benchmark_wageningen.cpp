@@ -0,0 +1,124 @@
+/*
+ * benchmark_wageningen.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Micro-benchmark of the evaluation of Kt & Kq for a vessel with four Wageningen B-series propellers:
+// polynomials in J precomputed for each propeller (WageningenPolynomial) against the former
+// implementation, which summed the 39 & 47 terms of the series with four std::pow per term.
+// Each "call" evaluates Kt & Kq for the four propellers (like one evaluation of the state derivatives).
+// The pitch is either fixed or changed at each call (controllable pitch propellers).
+// Usage: benchmark_wageningen [nb_of_calls]
+
+#include <vector> // Needs to be declared before ssc/macros.hpp to overload <<
+#include <google/protobuf/stubs/common.h>
+#include "xdyn/core/EnvironmentAndFrames.hpp"
+#include "xdyn/force_models/WageningenControlledForceModel.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#define NB_OF_PROPELLERS 4
+
+WageningenControlledForceModel::Yaml propeller(const size_t i);
+WageningenControlledForceModel::Yaml propeller(const size_t i)
+{
+    WageningenControlledForceModel::Yaml ret;
+    ret.name = "propeller" + std::to_string(i);
+    ret.position_of_propeller_frame.frame = "ship";
+    ret.position_of_propeller_frame.coordinates.x = -40;
+    ret.position_of_propeller_frame.coordinates.y = (i % 2) ? 5. : -5.;
+    ret.wake_coefficient = 0.9;
+    ret.relative_rotative_efficiency = 1;
+    ret.thrust_deduction_factor = 0.7;
+    ret.rotating_clockwise = (i % 2);
+    ret.diameter = 2;
+    ret.number_of_blades = (i < 2) ? 4 : 5; // Main & wing propellers
+    ret.blade_area_ratio = (i < 2) ? 0.55 : 0.7;
+    return ret;
+}
+
+double J_at(const size_t call, const size_t propeller);
+double J_at(const size_t call, const size_t propeller)
+{
+    return 0.75 + 0.7*std::sin(1E-3*(double)call + (double)propeller);
+}
+
+double P_D_at(const size_t call, const bool fixed_pitch);
+double P_D_at(const size_t call, const bool fixed_pitch)
+{
+    return fixed_pitch ? 1.0 : 0.95 + 0.4*std::cos(1E-3*(double)call);
+}
+
+template <typename F> double microseconds_per_call(const size_t nb_of_calls, const F& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0 ; i < nb_of_calls ; ++i)
+    {
+        f(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / 1E3 / (double)nb_of_calls;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t nb_of_calls = argc > 1 ? (size_t)std::atol(argv[1]) : 200000;
+    EnvironmentAndFrames env;
+    env.rho = 1026;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    std::vector<TR1(shared_ptr)<WageningenControlledForceModel> > propellers;
+    std::vector<WageningenControlledForceModel::Yaml> inputs;
+    for (size_t i = 0 ; i < NB_OF_PROPELLERS ; ++i)
+    {
+        inputs.push_back(propeller(i));
+        propellers.push_back(TR1(shared_ptr)<WageningenControlledForceModel>(new WageningenControlledForceModel(inputs.back(), "ship", env)));
+    }
+    std::cout << "Propellers: " << propellers.size() << ", calls: " << nb_of_calls << std::endl;
+
+    for (const bool fixed_pitch:{true, false})
+    {
+        double sum_former = 0;
+        double sum = 0;
+        double max_error = 0;
+        const double t_former = microseconds_per_call(nb_of_calls, [&](const size_t call)
+        {
+            const double P_D = P_D_at(call, fixed_pitch);
+            for (size_t i = 0 ; i < NB_OF_PROPELLERS ; ++i)
+            {
+                const double J = J_at(call, i);
+                sum_former += propellers[i]->Kt(inputs[i].number_of_blades, inputs[i].blade_area_ratio, P_D, J)
+                            + propellers[i]->Kq(inputs[i].number_of_blades, inputs[i].blade_area_ratio, P_D, J);
+            }
+        });
+        std::map<std::string,double> commands;
+        const double t_polynomial = microseconds_per_call(nb_of_calls, [&](const size_t call)
+        {
+            commands["P/D"] = P_D_at(call, fixed_pitch);
+            for (size_t i = 0 ; i < NB_OF_PROPELLERS ; ++i)
+            {
+                const double J = J_at(call, i);
+                const double KtKq = propellers[i]->get_Kt(commands, J) + propellers[i]->get_Kq(commands, J);
+                sum += KtKq;
+                if (call % 1000 == 0)
+                {
+                    const double former = propellers[i]->Kt(inputs[i].number_of_blades, inputs[i].blade_area_ratio, commands["P/D"], J)
+                                        + propellers[i]->Kq(inputs[i].number_of_blades, inputs[i].blade_area_ratio, commands["P/D"], J);
+                    max_error = std::max(max_error, std::abs(KtKq - former));
+                }
+            }
+        });
+        std::cout << std::setprecision(3) << std::fixed
+                  << (fixed_pitch ? "Fixed pitch" : "Controllable pitch (P/D changes at each call)") << std::endl
+                  << "  Series with std::pow (former): " << t_former << " us per call" << std::endl
+                  << "  Precomputed polynomials in J : " << t_polynomial << " us per call (" << t_former/t_polynomial << " times faster)" << std::endl
+                  << std::scientific
+                  << "  Max. difference on Kt+Kq     : " << max_error << " (checksums: " << sum_former << ", " << sum << ")" << std::endl;
+    }
+    google::protobuf::ShutdownProtobufLibrary();
+    return EXIT_SUCCESS;
+}
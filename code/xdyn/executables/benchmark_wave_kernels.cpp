@@ -0,0 +1,177 @@
+/*
+ * benchmark_wave_kernels.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Micro-benchmark of the wave kernels (cf. WaveKernels) against the former scalar
+// implementation of Airy (one std::function call & one transcendental per term).
+// Usage: benchmark_wave_kernels [nb_of_points] [nb_of_frequencies] [nb_of_directions]
+
+#include <vector> // Needs to be declared before ssc/macros.hpp to overload <<
+#include <google/protobuf/stubs/common.h>
+#include "xdyn/environment_models/Airy.hpp"
+#include "xdyn/environment_models/JonswapSpectrum.hpp"
+#include "xdyn/environment_models/Cos2sDirectionalSpreading.hpp"
+#include "xdyn/environment_models/Stretching.hpp"
+#include "xdyn/environment_models/WaveKernels.hpp"
+#include "xdyn/environment_models/discretize.hpp"
+#include "xdyn/external_data_structures/YamlWaveModelInput.hpp"
+#include <ssc/random_data_generator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+// Former implementation of Airy::elevation, Airy::dynamic_pressure & Airy::orbital_velocity (before the wave kernels)
+std::vector<double> reference_elevation(const FlatDiscreteDirectionalWaveSpectrum& s, const std::vector<double>& x, const std::vector<double>& y, const double t);
+std::vector<double> reference_elevation(const FlatDiscreteDirectionalWaveSpectrum& s, const std::vector<double>& x, const std::vector<double>& y, const double t)
+{
+    std::vector<double> zeta(x.size());
+    for (size_t j = 0; j < zeta.size(); ++j)
+    {
+        for (size_t i = 0 ; i < s.psi.size() ; ++i)
+        {
+            zeta.at(j) -= s.a[i] * sin(-s.omega[i] * t + s.k[i] * (x.at(j) * s.cos_psi[i] + y.at(j) * s.sin_psi[i]) + s.phase[i]);
+        }
+    }
+    return zeta;
+}
+
+std::vector<double> reference_dynamic_pressure(const FlatDiscreteDirectionalWaveSpectrum& s, const double rho, const double g, const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const std::vector<double>& eta, const double t);
+std::vector<double> reference_dynamic_pressure(const FlatDiscreteDirectionalWaveSpectrum& s, const double rho, const double g, const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const std::vector<double>& eta, const double t)
+{
+    std::vector<double> p(x.size(), 0);
+    for (size_t j = 0; j < p.size(); ++j)
+    {
+        if (z[j] >= eta[j])
+        {
+            for (size_t i = 0; i < s.psi.size(); ++i)
+            {
+                p[j] += s.a[i] * s.pdyn_factor(s.k[i], z[j], eta[j]) * sin(-s.omega[i] * t + s.k[i] * (x[j] * s.cos_psi[i] + y[j] * s.sin_psi[i]) + s.phase[i]);
+            }
+            p[j] *= rho * g;
+        }
+    }
+    return p;
+}
+
+ssc::kinematics::PointMatrix reference_orbital_velocity(const FlatDiscreteDirectionalWaveSpectrum& s, const double g, const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t, const std::vector<double>& eta);
+ssc::kinematics::PointMatrix reference_orbital_velocity(const FlatDiscreteDirectionalWaveSpectrum& s, const double g, const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t, const std::vector<double>& eta)
+{
+    ssc::kinematics::PointMatrix M("NED", x.size());
+    M.m.setZero();
+    for (size_t j = 0; j < x.size(); ++j)
+    {
+        if (z[j] >= eta[j])
+        {
+            double u = 0, v = 0, w = 0;
+            for (size_t i = 0 ; i < s.psi.size() ; ++i)
+            {
+                const double theta = -s.omega[i] * t + s.k[i] * (x[j] * s.cos_psi[i] + y[j] * s.sin_psi[i]) + s.phase[i];
+                const double a_k_omega = s.a[i] * s.k[i] / s.omega[i];
+                const double a_k_omega_pdyn_factor_sin_theta = a_k_omega * s.pdyn_factor(s.k[i], z[j], 0) * sin(theta);
+                u += a_k_omega_pdyn_factor_sin_theta * s.cos_psi[i];
+                v += a_k_omega_pdyn_factor_sin_theta * s.sin_psi[i];
+                w += a_k_omega * s.pdyn_factor_sh(s.k[i], z[j], 0) * cos(theta);
+            }
+            M.m(0, static_cast<Eigen::Index>(j)) = u * g;
+            M.m(1, static_cast<Eigen::Index>(j)) = v * g;
+            M.m(2, static_cast<Eigen::Index>(j)) = w * g;
+        }
+    }
+    return M;
+}
+
+double milliseconds_per_call(const std::function<void()>& f, const size_t nb_of_calls);
+double milliseconds_per_call(const std::function<void()>& f, const size_t nb_of_calls)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0 ; i < nb_of_calls ; ++i) f();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count()/(double)nb_of_calls;
+}
+
+double max_abs_difference(const std::vector<double>& a, const std::vector<double>& b);
+double max_abs_difference(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double ret = 0;
+    for (size_t i = 0 ; i < a.size() ; ++i) ret = std::max(ret, std::abs(a[i]-b[i]));
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t nb_of_points = argc > 1 ? (size_t)std::atoi(argv[1]) : 10000;
+    const size_t nfreq = argc > 2 ? (size_t)std::atoi(argv[2]) : 100;
+    const size_t ndir = argc > 3 ? (size_t)std::atoi(argv[3]) : 20;
+    const size_t nb_of_calls = 3;
+    const double g = 9.81;
+    const double rho = 1025;
+    const double t = 1234.5;
+
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Stretching stretching(ys);
+    const DiscreteDirectionalWaveSpectrum A = discretize(JonswapSpectrum(5, 10, 3.3), Cos2sDirectionalSpreading(PI/4, 10), 0.1, 3, nfreq, ndir, stretching, false);
+    const Airy wave(A, 1);
+    const FlatDiscreteDirectionalWaveSpectrum spectrum = wave.get_spectrum();
+    double sum_of_amplitudes = 0;
+    for (const auto a:spectrum.a) sum_of_amplitudes += a;
+
+    ssc::random_data_generator::DataGenerator gen(2026);
+    std::vector<double> x(nb_of_points), y(nb_of_points), z(nb_of_points);
+    for (size_t i = 0 ; i < nb_of_points ; ++i)
+    {
+        x[i] = gen.random<double>().between(-150, 150);
+        y[i] = gen.random<double>().between(-30, 30);
+        z[i] = gen.random<double>().between(-5, 20);
+    }
+    const std::vector<double> eta = reference_elevation(spectrum, x, y, t);
+
+    std::cout << spectrum.a.size() << " rays, " << nb_of_points << " points, best instruction set: " << to_string(wave.get_instruction_set()) << std::endl;
+    std::cout << std::setprecision(3);
+
+    std::vector<double> eta_ref, p_ref;
+    ssc::kinematics::PointMatrix V_ref;
+    std::cout << "former Airy implementation:" << std::endl
+              << "    elevation:        " << milliseconds_per_call([&](){eta_ref = reference_elevation(spectrum, x, y, t);}, nb_of_calls) << " ms" << std::endl
+              << "    dynamic pressure: " << milliseconds_per_call([&](){p_ref = reference_dynamic_pressure(spectrum, rho, g, x, y, z, eta, t);}, nb_of_calls) << " ms" << std::endl
+              << "    orbital velocity: " << milliseconds_per_call([&](){V_ref = reference_orbital_velocity(spectrum, g, x, y, z, t, eta);}, nb_of_calls) << " ms" << std::endl;
+    std::vector<double> u_ref(nb_of_points);
+    for (size_t i = 0 ; i < nb_of_points ; ++i) u_ref[i] = V_ref.m(0, static_cast<Eigen::Index>(i));
+
+    for (const auto instruction_set:{WaveKernelInstructionSet::SCALAR, WaveKernelInstructionSet::AVX2, WaveKernelInstructionSet::AVX512})
+    {
+        if (instruction_set > WaveKernels::best_available_instruction_set()) continue;
+        const WaveKernels kernels(spectrum, instruction_set);
+        std::vector<double> eta_k(nb_of_points), p_k(nb_of_points), u(nb_of_points), v(nb_of_points), w(nb_of_points);
+        std::vector<double> z_rescaled(nb_of_points);
+        for (size_t i = 0 ; i < nb_of_points ; ++i) z_rescaled[i] = kernels.rescaled_z(z[i], eta[i]);
+        std::cout << "wave kernels (" << to_string(instruction_set) << "):" << std::endl
+                  << "    elevation:        " << milliseconds_per_call([&](){kernels.elevation(nb_of_points, x.data(), y.data(), t, eta_k.data());}, nb_of_calls) << " ms" << std::endl
+                  << "    dynamic pressure: " << milliseconds_per_call([&](){kernels.dynamic_pressure(nb_of_points, x.data(), y.data(), z_rescaled.data(), t, p_k.data());}, nb_of_calls) << " ms" << std::endl
+                  << "    orbital velocity: " << milliseconds_per_call([&](){kernels.orbital_velocity(nb_of_points, x.data(), y.data(), z.data(), t, u.data(), v.data(), w.data());}, nb_of_calls) << " ms" << std::endl;
+        std::cout << "    max. difference on elevation: " << max_abs_difference(eta_ref, eta_k)/sum_of_amplitudes << " x sum(a)" << std::endl;
+    }
+
+    std::vector<double> p_airy;
+    ssc::kinematics::PointMatrix V_airy;
+    std::cout << "Airy (" << to_string(wave.get_instruction_set()) << "):" << std::endl
+              << "    dynamic pressure: " << milliseconds_per_call([&](){p_airy = wave.get_dynamic_pressure(rho, g, x, y, z, eta, t);}, nb_of_calls) << " ms" << std::endl
+              << "    orbital velocity: " << milliseconds_per_call([&](){V_airy = wave.get_orbital_velocity(g, x, y, z, t, eta);}, nb_of_calls) << " ms" << std::endl;
+    std::vector<double> u_airy(nb_of_points);
+    for (size_t i = 0 ; i < nb_of_points ; ++i) u_airy[i] = V_airy.m(0, static_cast<Eigen::Index>(i));
+    std::cout << "    max. difference on dynamic pressure: " << max_abs_difference(p_ref, p_airy)/(rho*g*sum_of_amplitudes) << " x rho g sum(a)" << std::endl
+              << "    max. difference on orbital velocity: " << max_abs_difference(u_ref, u_airy)/(g*sum_of_amplitudes) << " x g sum(a)" << std::endl;
+    google::protobuf::ShutdownProtobufLibrary();
+    return 0;
+}
@@ -39,6 +39,10 @@ std::string serialize_command(const XdynCommandLineArguments& inputData)
     s << " --tend " << inputData.tend<<" ";
     s << " --dt " << inputData.initial_timestep<<" ";
     s << " --solver "<<inputData.solver;
+    if (inputData.nb_of_threads > 1)
+    {
+        s << " --threads " << inputData.nb_of_threads;
+    }
     if (not(inputData.output_filename.empty()))
     {
         s << " -o " << inputData.output_filename;
@@ -10,6 +10,9 @@
 #include "boost_program_options_descriptions/OptionPrinter.hpp"
 #include <ssc/check_ssc_version.hpp>
 
+#include <algorithm> // std::max
+#include <thread>
+
 std::string description(const std::string& des)
 {
     std::stringstream ss;
@@ -45,6 +48,7 @@ BooleanArguments parse_input(int argc, char **argv, const po::options_descriptio
     ret.verbose = vm.count("verbose")>0;
     ret.show_websocket_debug_information = vm.count("websocket-debug")>0;
     ret.grpc = vm.count("grpc")>0;
+    ret.session = vm.count("session")>0;
     return ret;
 }
 
@@ -66,3 +70,8 @@ void copy_stream(const std::ostream& from_stream, std::ostream& to_stream)
     to_stream.clear(from_stream.rdstate());                          //2
     to_stream.basic_ios<char>::rdbuf(from_stream.rdbuf());           //3
 }
+
+size_t get_nb_of_cores()
+{
+    return (size_t)std::max(1U, std::thread::hardware_concurrency());
+}
@@ -18,6 +18,7 @@ struct BooleanArguments
     bool show_help;
     bool show_websocket_debug_information;
     bool grpc;
+    bool session;
 };
 
 #include "boost/program_options.hpp"
@@ -27,5 +28,6 @@ std::string description(const std::string& des);
 void print_usage(std::ostream& os, const po::options_description& desc, const std::string& program_name, const std::string& des);
 BooleanArguments parse_input(int argc, char **argv, const po::options_description& desc);
 void copy_stream(const std::ostream& from_stream, std::ostream& to_stream);
+size_t get_nb_of_cores(); //!< Default number of threads of the servers (at least 1)
 
 #endif /* EXECUTABLES_INC_DISPLAY_COMMAND_LINE_ARGUMENTS_HPP_ */
@@ -20,6 +20,15 @@ grpc::Status to_gRPC_status(const ErrorReporter& error_outputter)
     return grpc::Status(grpc::StatusCode::UNKNOWN, std::string("Reached the end of a switch case in ") + std::string(__PRETTY_FUNCTION__));
 }
 
+std::string get_session_id(const grpc::ServerContext* context)
+{
+    if (not(context)) return "";
+    const auto& metadata = context->client_metadata();
+    const auto it = metadata.find(SESSION_METADATA_KEY);
+    if (it == metadata.end()) return "";
+    return std::string(it->second.data(), it->second.size());
+}
+
 grpc::Status run_and_report_errors_as_gRPC_status(const std::function<void(void)>& f)
 {
     ErrorReporter error_outputter;
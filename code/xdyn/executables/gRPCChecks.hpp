@@ -11,6 +11,12 @@
 grpc::Status to_gRPC_status(const ErrorReporter& error_outputter);
 grpc::Status run_and_report_errors_as_gRPC_status(const std::function<void(void)>& f);
 
+#define SESSION_METADATA_KEY "xdyn-session"
+/**  \brief Value of the 'xdyn-session' metadata sent by the client (empty for the default session)
+  *  \details The servers handle the requests of each session with a separate simulator (cf. Sessions).
+  */
+std::string get_session_id(const grpc::ServerContext* context);
+
 #define SIZE size()
 #define PASTER(x,y) x ## _ ## y
 #define EVALUATOR(x,y)  PASTER(x,y)
@@ -42,7 +48,7 @@ grpc::Status run_and_report_errors_as_gRPC_status(const std::function<void(void)
 template <typename Request> void check_euler_states_size(const Request* request)
 {
     CHECK_REQUEST_POINTER()
-    const auto states = request->states();
+    const auto& states = request->states();
     CHECK_SIZE(x);
     CHECK_SIZE(y);
     CHECK_SIZE(z);
@@ -61,7 +67,7 @@ template <typename Request> void check_euler_states_size(const Request* request)
 template <typename Request> void check_quaternion_states_size(const Request* request)
 {
     CHECK_REQUEST_POINTER()
-    const auto states = request->states();
+    const auto& states = request->states();
     CHECK_SIZE(x);
     CHECK_SIZE(y);
     CHECK_SIZE(z);
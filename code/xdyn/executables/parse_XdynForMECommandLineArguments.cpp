@@ -36,6 +36,16 @@ bool invalid(const XdynForMECommandLineArguments& input)
         std::cerr << "Error: you cannot start this websocket server on port " << input.port << ": only range 1024-65535 is available." << std::endl;
         return true;
     }
+    if (input.nb_of_threads == 0)
+    {
+        std::cerr << "Error: the number of threads should be at least 1." << std::endl;
+        return true;
+    }
+    if (input.max_nb_of_sessions == 0)
+    {
+        std::cerr << "Error: the maximum number of sessions should be at least 1." << std::endl;
+        return true;
+    }
     return false;
 }
 
@@ -51,6 +61,9 @@ po::options_description get_options_description(XdynForMECommandLineArguments& i
         ("port,p",     po::value<short unsigned int>(&input_data.port),                  "port for the websocket server. Available values are 1024-65535 (2^16, but port 0 is reserved and unavailable and ports in range 1-1023 are privileged (application needs to be run as root to have access to those ports)")
         ("debug,d",                                                                      "Used by the application's support team to help error diagnosis. Allows us to pinpoint the exact location in code where the error occurred (do not catch exceptions), eg. for use in a debugger.")
         ("grpc,g",                                                                       "Launch a gRPC server instead of the (default) JSON+websocket server.")
+        ("session",                                                                      "Keep the state history between requests: each request then only needs the states which were not sent before, followed by the state at which the derivatives are computed (the history is replaced if the request has 'reset' set to true or starts before the latest state received).")
+        ("threads",    po::value<size_t>(&input_data.nb_of_threads)->default_value(get_nb_of_cores()), "Number of threads running the simulations of the different sessions (ie. clients) concurrently. A client can choose its session with the 'session' field of the JSON requests or the 'xdyn-session' gRPC metadata.")
+        ("max-sessions", po::value<size_t>(&input_data.max_nb_of_sessions)->default_value(64), "Maximum number of sessions kept by the server: when there are more, the least recently used sessions are forgotten (their next request then starts a new simulation).")
     ;
     return desc;
 }
@@ -64,6 +77,7 @@ int get_input_data(int argc, char **argv, XdynForMECommandLineArguments& input_d
     input_data.show_help = has.help;
     input_data.show_websocket_debug_information = has.show_websocket_debug_information;
     input_data.grpc = has.grpc;
+    input_data.session = has.session;
     if (has.help)
     {
         print_usage(std::cout, desc, argv[0], "This is a ship simulator (model exchange version)");
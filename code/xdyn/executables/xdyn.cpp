@@ -25,19 +25,19 @@ void solve(const std::string& solver_name, Sim& sys, ssc::solver::Scheduler& sch
 {
     if (solver_name=="euler")
     {
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
     }
     else if (solver_name=="rk4")
     {
-        ssc::solver::quicksolve<ssc::solver::RK4Stepper>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::RK4Stepper>(sys, scheduler, observer, controllers);
     }
     else if (solver_name=="rkck")
     {
-        ssc::solver::quicksolve<ssc::solver::RKCK>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::RKCK>(sys, scheduler, observer, controllers);
     }
     else
     {
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
     }
 }
 
@@ -69,6 +69,7 @@ void run_simulation(const XdynCommandLineArguments& input_data, ErrorReporter& e
     {
         const auto input = SimulatorYamlParser(yaml_input).parse();
         auto sys = get_system(input, input_data.tstart);
+        sys.set_number_of_threads(input_data.nb_of_threads);
         ssc::solver::Scheduler scheduler(input_data.tstart, input_data.tend, input_data.initial_timestep);
         const auto controllers = get_initialized_controllers(input_data.tstart, input.controllers, input.commands, scheduler, sys);
         auto observers_description = build_observers_description(yaml_input);
@@ -5,28 +5,45 @@
 #include "ErrorReporter.hpp"
 #include "xdyn/observers_and_api/XdynForCS.hpp"
 #include "xdyn/observers_and_api/gRPCProtoBufServer.hpp"
+#include "xdyn/observers_and_api/Sessions.hpp"
+#include "xdyn/observers_and_api/simulator_api.hpp"
+#include "xdyn/yaml_parser/SimulatorYamlParser.hpp"
 
 #include <ssc/text_file_reader.hpp>
 
-XdynForCS get_SimServer(const XdynForCSCommandLineArguments& input_data, const std::string& yaml);
-XdynForCS get_SimServer(const XdynForCSCommandLineArguments& input_data, const std::string& yaml)
+// The YAML is parsed & the meshes are read (and simplified) once: each session builds its own Sim
+// from the parsed model & the meshes (the hydrodynamic databases are shared by all sessions, cf. HydroDBCache)
+Sessions<XdynForCS>::Factory get_SimServer_factory(const XdynForCSCommandLineArguments& input_data, const std::string& yaml);
+Sessions<XdynForCS>::Factory get_SimServer_factory(const XdynForCSCommandLineArguments& input_data, const std::string& yaml)
 {
-    return XdynForCS(yaml, input_data.solver, input_data.initial_timestep);
+    const std::shared_ptr<YamlSimulatorInput> model(new YamlSimulatorInput(SimulatorYamlParser(yaml).parse()));
+    const std::shared_ptr<const MeshMap> meshes(new MeshMap(read_meshes(*model)));
+    const std::string solver = input_data.solver;
+    const double dt = input_data.initial_timestep;
+    const bool session = input_data.session;
+    const Sessions<XdynForCS>::Factory make_simserver = [model, meshes, solver, dt, session]()
+    {
+        std::shared_ptr<XdynForCS> ret(new XdynForCS(*model, *meshes, solver, dt));
+        ret->set_session_mode(session);
+        return ret;
+    };
+    make_simserver(); // So invalid models are reported before the server starts
+    return make_simserver;
 }
 
 void start_ws_server(const XdynForCSCommandLineArguments& input_data, const std::string& yaml);
 void start_ws_server(const XdynForCSCommandLineArguments& input_data, const std::string& yaml)
 {
-    JSONWebSocketServer<XdynForCS> server(get_SimServer(input_data, yaml), input_data.verbose);
+    Sessions<XdynForCS> sessions(get_SimServer_factory(input_data, yaml), input_data.nb_of_threads, input_data.max_nb_of_sessions, input_data.session);
+    JSONWebSocketServer<XdynForCS> server(sessions, input_data.verbose);
     server.start(input_data.address, input_data.port, input_data.show_websocket_debug_information);
 }
 
 void start_grpc_server(const XdynForCSCommandLineArguments& input_data, const std::string& yaml);
 void start_grpc_server(const XdynForCSCommandLineArguments& input_data, const std::string& yaml)
 {
-    XdynForCS simserver = get_SimServer(input_data, yaml);
-    ErrorReporter error_outputter;
-    std::shared_ptr<grpc::Service> handler(new CosimulationServiceImpl(simserver, error_outputter));
+    Sessions<XdynForCS> sessions(get_SimServer_factory(input_data, yaml), input_data.nb_of_threads, input_data.max_nb_of_sessions, input_data.session);
+    std::shared_ptr<grpc::Service> handler(new CosimulationServiceImpl(sessions));
     gRPCProtoBufServer server(handler);
     server.start(input_data.port);
 }
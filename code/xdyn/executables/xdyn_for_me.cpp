@@ -5,24 +5,45 @@
 #include "ErrorReporter.hpp"
 #include "xdyn/observers_and_api/XdynForME.hpp"
 #include "xdyn/observers_and_api/gRPCProtoBufServer.hpp"
+#include "xdyn/observers_and_api/Sessions.hpp"
+#include "xdyn/observers_and_api/simulator_api.hpp"
+#include "xdyn/yaml_parser/SimulatorYamlParser.hpp"
 
 #include <ssc/text_file_reader.hpp>
 
+// The YAML is parsed & the meshes are read (and simplified) once: each session builds its own Sim
+// from the parsed model & the meshes (the hydrodynamic databases are shared by all sessions, cf. HydroDBCache)
+Sessions<XdynForME>::Factory get_xdyn_factory(const XdynForMECommandLineArguments& input_data, const std::string& yaml);
+Sessions<XdynForME>::Factory get_xdyn_factory(const XdynForMECommandLineArguments& input_data, const std::string& yaml)
+{
+    const std::shared_ptr<YamlSimulatorInput> model(new YamlSimulatorInput(SimulatorYamlParser(yaml).parse()));
+    const std::shared_ptr<const MeshMap> meshes(new MeshMap(read_meshes(*model)));
+    const bool session = input_data.session;
+    const Sessions<XdynForME>::Factory make_xdyn = [model, meshes, session]()
+    {
+        std::shared_ptr<XdynForME> ret(new XdynForME(*model, *meshes));
+        ret->set_session_mode(session);
+        return ret;
+    };
+    make_xdyn(); // So invalid models are reported before the server starts
+    return make_xdyn;
+}
+
 void start_ws_server(const XdynForMECommandLineArguments& input_data);
 void start_ws_server(const XdynForMECommandLineArguments& input_data)
 {
     const ssc::text_file_reader::TextFileReader yaml_reader(input_data.yaml_filenames);
     const auto yaml = yaml_reader.get_contents();
-    JSONWebSocketServer<XdynForME> server(XdynForME(yaml), input_data.verbose);
+    Sessions<XdynForME> sessions(get_xdyn_factory(input_data, yaml), input_data.nb_of_threads, input_data.max_nb_of_sessions, input_data.session);
+    JSONWebSocketServer<XdynForME> server(sessions, input_data.verbose);
     server.start(input_data.address, input_data.port, input_data.show_websocket_debug_information);
 }
 
 void start_grpc_server(const XdynForMECommandLineArguments& input_data, const std::string& yaml);
 void start_grpc_server(const XdynForMECommandLineArguments& input_data, const std::string& yaml)
 {
-    XdynForME xdyn(yaml);
-    ErrorReporter error_outputter;
-    std::shared_ptr<grpc::Service> handler(new ModelExchangeServiceImpl(xdyn, error_outputter));
+    Sessions<XdynForME> sessions(get_xdyn_factory(input_data, yaml), input_data.nb_of_threads, input_data.max_nb_of_sessions, input_data.session);
+    std::shared_ptr<grpc::Service> handler(new ModelExchangeServiceImpl(sessions));
     gRPCProtoBufServer server(handler);
     server.start(input_data.port);
 }
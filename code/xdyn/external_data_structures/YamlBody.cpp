@@ -10,6 +10,7 @@
 YamlBody::YamlBody() :
     name(),
     mesh(),
+    mesh_simplification(),
     position_of_body_frame_relative_to_mesh(),
     initial_position_of_body_frame_relative_to_NED_projected_in_NED(),
     initial_velocity_of_body_frame_relative_to_NED_projected_in_body(),
@@ -20,6 +21,13 @@ YamlBody::YamlBody() :
 {
 }
 
+YamlMeshSimplification::YamlMeshSimplification() :
+    simplify(false),
+    edges_per_wavelength(0),
+    z_of_waterplane(0)
+{
+}
+
 YamlCSVDOF::YamlCSVDOF() :
     YamlDOF<std::string>(),
     filename()
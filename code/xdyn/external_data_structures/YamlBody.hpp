@@ -65,11 +65,20 @@ struct YamlFilteredStates
     std::string psi;
 };
 
+struct YamlMeshSimplification
+{
+    YamlMeshSimplification();
+    bool simplify;                  //!< False if there is no 'mesh simplification' section
+    double edges_per_wavelength;    //!< Number of facet edges per shortest wavelength of the wave spectra
+    double z_of_waterplane;         //!< z-coordinate (in the mesh frame) of the waterplane, whose area is preserved
+};
+
 struct YamlBody
 {
     YamlBody();
     std::string name;
     std::string mesh;
+    YamlMeshSimplification mesh_simplification;
     YamlPosition position_of_body_frame_relative_to_mesh;
     YamlPosition initial_position_of_body_frame_relative_to_NED_projected_in_NED;
     YamlSpeed initial_velocity_of_body_frame_relative_to_NED_projected_in_body;
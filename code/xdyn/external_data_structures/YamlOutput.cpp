@@ -7,6 +7,6 @@
 
 #include "YamlOutput.hpp"
 
-YamlOutput::YamlOutput() : filename(), format(), address(), port(), data(), full_output(false)
+YamlOutput::YamlOutput() : filename(), format(), address(), port(), data(), full_output(false), buffer_size(1), chunk_size(0), compression_level(0), asynchronous(false), queue_size(1024), backpressure("block"), decimation(10)
 {
 }
@@ -20,6 +20,13 @@ struct YamlOutput
     short unsigned int port;
     std::vector<std::string> data;
     bool full_output;
+    size_t buffer_size;            //!< HDF5 only: number of time steps kept in memory before being written to the file
+    size_t chunk_size;             //!< HDF5 only: number of time steps per chunk of each dataset (0 means same as buffer_size)
+    unsigned int compression_level; //!< HDF5 only: 0 for no compression, 1 (fastest) to 9 (smallest files) for shuffle + deflate
+    bool asynchronous;             //!< Serialize the outputs in a background thread (cf. AsyncObserver)
+    size_t queue_size;             //!< Asynchronous outputs only: maximum number of time steps waiting to be serialized
+    std::string backpressure;      //!< Asynchronous outputs only: what to do when the queue is full ('block', 'drop oldest' or 'decimate')
+    size_t decimation;             //!< Asynchronous outputs only: with 'decimate', one time step out of 'decimation' is kept once the queue is half full
 };
 
 #endif /* YAMLOUTPUT_HPP_ */
@@ -19,6 +19,9 @@ YamlRadiationDamping::YamlRadiationDamping() : hdb_filename(),
                                                output_Br_and_K(),
                                                calculation_point_in_body_frame(),
                                                remove_constant_speed(false),
-                                               forward_speed_correction(false)
+                                               forward_speed_correction(false),
+                                               use_state_space_approximation(false),
+                                               max_nb_of_exponentials(10),
+                                               output_state_space_fidelity(false)
 {
 }
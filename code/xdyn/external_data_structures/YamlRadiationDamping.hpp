@@ -30,6 +30,9 @@ struct YamlRadiationDamping
     YamlCoordinates     calculation_point_in_body_frame;                      //!< Where were the damping matrices (read from the HDB file) computed?
     bool                remove_constant_speed;                                //!< Should the constant (mean) velocity be subtracted from the total velocity before in this model
     bool                forward_speed_correction;                             //!< Should a forward speed correction be applied (if the HDB results are at zero forward speed)
+    bool                use_state_space_approximation;                        //!< Should the retardation functions be approximated by sums of exponentials (integrated recursively) instead of computing the convolutions at each time step?
+    size_t              max_nb_of_exponentials;                               //!< Maximum number of exponentials approximating each retardation function (only used if use_state_space_approximation is true)
+    bool                output_state_space_fidelity;                          //!< Should the program output the accuracy of the approximation of each retardation function (only used if use_state_space_approximation is true)
 };
 
 #endif /* YAMLRADIATIONDAMPING_HPP_ */
@@ -6,5 +6,7 @@ YamlSimServerInputs::YamlSimServerInputs()
     , commands()
     , requested_output()
     , controllers()
+    , reset(false)
+    , session()
 {
 }
@@ -14,6 +14,8 @@ struct YamlSimServerInputs
     std::map<std::string, double> commands;
     std::vector<std::string> requested_output;
     std::vector<YamlController> controllers;
+    bool reset; //!< In session mode, should the states replace the history kept by the server (instead of being appended to it)?
+    std::string session; //!< Identifies the client, for servers handling several clients at once (empty for the default session)
 };
 
 
@@ -0,0 +1,246 @@
+/*
+ * hdb_binary.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "hdb_binary.hpp"
+
+#include <cstring>
+
+#define MAGIC "XDYNHDB"
+#define MAGIC_SIZE 8
+
+class BinaryWriter
+{
+    public:
+        BinaryWriter() : out() {}
+
+        template <typename T> void write_pod(const T& val)
+        {
+            out.append(reinterpret_cast<const char*>(&val), sizeof(T));
+        }
+
+        void write(const double val)
+        {
+            write_pod(val);
+        }
+
+        void write(const std::string& s)
+        {
+            write_pod((uint64_t)s.size());
+            out.append(s);
+        }
+
+        template <typename T> void write(const std::vector<T>& v)
+        {
+            write_pod((uint64_t)v.size());
+            for (const auto& t:v) write(t);
+        }
+
+        void write(const std::vector<double>& v)
+        {
+            write_pod((uint64_t)v.size());
+            if (not(v.empty())) out.append(reinterpret_cast<const char*>(v.data()), v.size()*sizeof(double));
+        }
+
+        template <typename T> void write(const hdb::Key<T>& k)
+        {
+            write(k.header);
+            write(k.value);
+        }
+
+        void write(const hdb::VectorSection& s)
+        {
+            write(s.header);
+            write(s.values);
+        }
+
+        void write(const hdb::MatrixSection& s)
+        {
+            write(s.header);
+            write(s.values);
+        }
+
+        void write(const hdb::SectionWithId& s)
+        {
+            write(s.header);
+            write(s.id);
+            write(s.values);
+        }
+
+        void write(const hdb::ListOfMatrixSections& s)
+        {
+            write(s.header);
+            write(s.sections);
+        }
+
+        void write(const hdb::ListOfMatrixSectionsWithId& s)
+        {
+            write(s.header);
+            write(s.sections_with_id);
+        }
+
+        std::string out;
+};
+
+class BinaryReader
+{
+    public:
+        BinaryReader(const std::string& in_, const size_t pos_) : in(in_), pos(pos_), ok(true) {}
+
+        template <typename T> void read_pod(T& val)
+        {
+            if (not(can_read(sizeof(T)))) return;
+            std::memcpy(&val, in.data() + pos, sizeof(T));
+            pos += sizeof(T);
+        }
+
+        void read(double& val)
+        {
+            read_pod(val);
+        }
+
+        void read(std::string& s)
+        {
+            const size_t n = read_size(1);
+            if (not(ok)) return;
+            s.assign(in, pos, n);
+            pos += n;
+        }
+
+        template <typename T> void read(std::vector<T>& v)
+        {
+            const size_t n = read_size(1);
+            v.clear();
+            for (size_t i = 0 ; ok and (i < n) ; ++i)
+            {
+                v.push_back(T());
+                read(v.back());
+            }
+        }
+
+        void read(std::vector<double>& v)
+        {
+            const size_t n = read_size(sizeof(double));
+            if (not(ok)) return;
+            v.resize(n);
+            if (n) std::memcpy(v.data(), in.data() + pos, n*sizeof(double));
+            pos += n*sizeof(double);
+        }
+
+        template <typename T> void read(hdb::Key<T>& k)
+        {
+            read(k.header);
+            read(k.value);
+        }
+
+        void read(hdb::VectorSection& s)
+        {
+            read(s.header);
+            read(s.values);
+        }
+
+        void read(hdb::MatrixSection& s)
+        {
+            read(s.header);
+            read(s.values);
+        }
+
+        void read(hdb::SectionWithId& s)
+        {
+            read(s.header);
+            read(s.id);
+            read(s.values);
+        }
+
+        void read(hdb::ListOfMatrixSections& s)
+        {
+            read(s.header);
+            read(s.sections);
+        }
+
+        void read(hdb::ListOfMatrixSectionsWithId& s)
+        {
+            read(s.header);
+            read(s.sections_with_id);
+        }
+
+        bool is_ok() const
+        {
+            return ok;
+        }
+
+        bool is_at_end() const
+        {
+            return pos == in.size();
+        }
+
+    private:
+        BinaryReader();
+
+        bool can_read(const size_t nb_of_bytes)
+        {
+            ok = ok and (nb_of_bytes <= in.size() - pos);
+            return ok;
+        }
+
+        // Each element takes at least min_element_size bytes: checking this before allocating
+        // anything means a corrupted size cannot trigger a huge allocation
+        size_t read_size(const size_t min_element_size)
+        {
+            uint64_t n = 0;
+            read_pod(n);
+            ok = ok and (n <= (in.size() - pos)/min_element_size);
+            return ok ? (size_t)n : 0;
+        }
+
+        const std::string& in;
+        size_t pos;
+        bool ok;
+};
+
+std::string hdb::to_binary(const AST& ast, const uint64_t content_hash)
+{
+    BinaryWriter writer;
+    writer.out.append(MAGIC, MAGIC_SIZE);
+    writer.write_pod(BINARY_FORMAT_VERSION);
+    writer.write_pod(content_hash);
+    writer.write(ast.string_keys);
+    writer.write(ast.value_keys);
+    writer.write(ast.vector_sections);
+    writer.write(ast.matrix_sections);
+    writer.write(ast.lists_of_matrix_sections);
+    writer.write(ast.lists_of_matrix_sections_with_id);
+    return writer.out;
+}
+
+bool hdb::from_binary(const std::string& contents, const uint64_t content_hash, AST& ast)
+{
+    if ((contents.size() < MAGIC_SIZE) or (contents.compare(0, MAGIC_SIZE, std::string(MAGIC, MAGIC_SIZE)) != 0))
+    {
+        return false;
+    }
+    BinaryReader reader(contents, MAGIC_SIZE);
+    uint32_t version = 0;
+    uint64_t hash = 0;
+    reader.read_pod(version);
+    reader.read_pod(hash);
+    if (not(reader.is_ok()) or (version != BINARY_FORMAT_VERSION) or (hash != content_hash))
+    {
+        return false;
+    }
+    AST ret;
+    reader.read(ret.string_keys);
+    reader.read(ret.value_keys);
+    reader.read(ret.vector_sections);
+    reader.read(ret.matrix_sections);
+    reader.read(ret.lists_of_matrix_sections);
+    reader.read(ret.lists_of_matrix_sections_with_id);
+    if (not(reader.is_ok()) or not(reader.is_at_end()))
+    {
+        return false;
+    }
+    ast = ret;
+    return true;
+}
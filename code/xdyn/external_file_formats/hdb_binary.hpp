@@ -0,0 +1,37 @@
+/*
+ * hdb_binary.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HDB_BINARY_HPP_
+#define HDB_BINARY_HPP_
+
+#include "hdb_parser_internal_data_structures.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace hdb
+{
+    /** \brief Version of the binary format: increment it whenever hdb::AST or the layout changes
+     */
+    const uint32_t BINARY_FORMAT_VERSION = 1;
+
+    /** \brief Binary image of an AST (eg. for a sidecar file next to the HDB file)
+     *  \details Header: "XDYNHDB" (8 bytes, NUL-terminated), format version (uint32), content_hash (uint64).
+     *           Then each member of the AST, in declaration order: every vector is its size (uint64) followed by
+     *           its elements, every string its size (uint64) followed by its characters & every number is stored
+     *           as in memory (IEEE 754 doubles), so the file is not portable between little & big endian machines.
+     *  \param content_hash Hash of the text the AST was parsed from, to detect stale binary files
+     */
+    std::string to_binary(const AST& ast, const uint64_t content_hash);
+
+    /** \brief Reads an AST written by to_binary
+     *  \returns false (& leaves 'ast' unchanged) if 'contents' was written with another format version,
+     *           for another content_hash, or is truncated
+     */
+    bool from_binary(const std::string& contents, const uint64_t content_hash, AST& ast);
+}
+
+#endif /* HDB_BINARY_HPP_ */
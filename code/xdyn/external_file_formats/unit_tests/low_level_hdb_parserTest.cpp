@@ -7,6 +7,7 @@
 
 #include "low_level_hdb_parserTest.hpp"
 #include "xdyn/test_data_generator/hdb_data.hpp"
+#include "xdyn/external_file_formats/hdb_binary.hpp"
 #include "xdyn/external_file_formats/hdb_to_ast.hpp"
 #include "xdyn/external_file_formats/hdb_parser_internal_data_structures.hpp"
 #include "xdyn/external_file_formats/hdb_grammar.hpp"
@@ -353,3 +354,38 @@ TEST_F(low_level_hdb_parserTest, can_parse_file_to_internal_data_structure)
     ASSERT_EQ(3, hdb_file.lists_of_matrix_sections_with_id.size());
     ASSERT_EQ(2, hdb_file.vector_sections.size());
 }
+
+TEST_F(low_level_hdb_parserTest, can_convert_ast_to_binary_and_back)
+{
+    const hdb::AST hdb_file = hdb::parse(test_data::test_ship_hdb());
+    const std::string binary = hdb::to_binary(hdb_file, 123);
+    hdb::AST read;
+    ASSERT_TRUE(hdb::from_binary(binary, 123, read));
+    ASSERT_EQ(binary, hdb::to_binary(read, 123));
+    ASSERT_EQ(hdb_file.string_keys.front().value, read.string_keys.front().value);
+    ASSERT_EQ(hdb_file.lists_of_matrix_sections_with_id.size(), read.lists_of_matrix_sections_with_id.size());
+    ASSERT_EQ(hdb_file.lists_of_matrix_sections_with_id.at(2).sections_with_id.at(1).values, read.lists_of_matrix_sections_with_id.at(2).sections_with_id.at(1).values);
+}
+
+TEST_F(low_level_hdb_parserTest, binary_ast_is_rejected_if_hash_or_version_do_not_match)
+{
+    const std::string binary = hdb::to_binary(hdb::parse(test_data::test_ship_hdb()), 123);
+    hdb::AST read;
+    ASSERT_FALSE(hdb::from_binary(binary, 124, read));
+    std::string other_version = binary;
+    other_version[8] = (char)(hdb::BINARY_FORMAT_VERSION + 1);
+    ASSERT_FALSE(hdb::from_binary(other_version, 123, read));
+    ASSERT_TRUE(read.string_keys.empty());
+}
+
+TEST_F(low_level_hdb_parserTest, truncated_binary_ast_is_rejected)
+{
+    const std::string binary = hdb::to_binary(hdb::parse(test_data::test_ship_hdb()), 123);
+    hdb::AST read;
+    for (const size_t size:{(size_t)0, (size_t)5, (size_t)20, binary.size()/2, binary.size()-1})
+    {
+        ASSERT_FALSE(hdb::from_binary(binary.substr(0, size), 123, read)) << "size = " << size;
+    }
+    ASSERT_FALSE(hdb::from_binary(binary + " ", 123, read));
+    ASSERT_TRUE(read.string_keys.empty());
+}
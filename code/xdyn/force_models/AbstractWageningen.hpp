@@ -9,6 +9,7 @@
 #define ABSTRACTWAGENINGEN_HPP_
 
 #include "xdyn/core/ForceModel.hpp"
+#include "WageningenPolynomial.hpp"
 
 /** \details This class was created to
  *  \addtogroup module
@@ -34,7 +35,7 @@ class AbstractWageningen : public ForceModel
             double diameter;
         };
         AbstractWageningen(const Yaml& input, const std::string& body_name, const EnvironmentAndFrames& env);
-        virtual double get_Kt(const std::map<std::string,double>& commands, const double J) const = 0;
+        virtual double get_Kt(const std::map<std::string,double>& commands, const double J) const = 0; //!< Polynomial series can be precomputed with WageningenPolynomial
         virtual double get_Kq(const std::map<std::string,double>& commands, const double J) const = 0;
         Wrench get_force(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const;
         double advance_ratio(const BodyStates& states, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const;
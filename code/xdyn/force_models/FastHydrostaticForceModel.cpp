@@ -67,19 +67,19 @@ std::function<SurfaceForceModel::DF(const FacetIterator &, const size_t, const E
                                       const FacetIterator& /*end_facet*/,
                                       const EnvironmentAndFrames& /*env*/,
                                       const BodyStates& /*states*/,
-                                      const double /*t*/) const
+                                      const double /*t*/,
+                                      const FacetData& facets) const
 {
-    return [this](const FacetIterator &that_facet,
-                  const size_t,
-                  const EnvironmentAndFrames &env,
-                  const BodyStates &states,
-                  const double /*t*/)
+    return [this, &facets](const FacetIterator &that_facet,
+                           const size_t that_facet_index,
+                           const EnvironmentAndFrames &env,
+                           const BodyStates &states,
+                           const double /*t*/)
     {
         if (that_facet->area == 0) return DF(EPoint(0,0,0),EPoint(0,0,0));
-        const double zG = zg_calculator->get_zG_in_NED(that_facet->centre_of_gravity);
-        const EPoint dS = that_facet->area*that_facet->unit_normal;
+        const double zG = facets.zG[that_facet_index];
         const EPoint C = get_application_point(that_facet, states, zG);
-        return DF(-env.rho*env.g*zG*dS,C);
+        return DF(-env.rho*env.g*zG*facets.dS[that_facet_index],C);
     };
 }
 
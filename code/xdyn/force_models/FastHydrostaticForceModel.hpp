@@ -23,7 +23,8 @@ class FastHydrostaticForceModel : public ImmersedSurfaceForceModel
                                   const FacetIterator& end_facet,
                                   const EnvironmentAndFrames& env,
                                   const BodyStates& states,
-                                  const double t
+                                  const double t,
+                                  const FacetData& facets
                                  ) const;
         std::string get_name() const;
         static std::string model_name();
@@ -32,8 +32,10 @@ class FroudeKrylovForceModel : public ImmersedSurfaceForceModel
                                   const FacetIterator& end_facet,
                                   const EnvironmentAndFrames& env,
                                   const BodyStates& states,
-                                  const double t
+                                  const double t,
+                                  const FacetData& facets
                                  ) const;
+        bool uses_wave_data_on_facets() const;
         static std::string model_name();
 
     private:
@@ -127,6 +127,11 @@ void GMForceModel::extra_observations(Observer& observer) const
     observer.write_before_solver_step(*GZ,DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"GZ"},std::string("GZ(") + get_body_name() + ")"));
 }
 
+bool GMForceModel::can_share_surface_integration() const
+{
+    return false;
+}
+
 double GMForceModel::pe(const BodyStates& , const std::vector<double>& , const EnvironmentAndFrames& ) const
 {
     return 0;
@@ -137,7 +142,8 @@ std::function<GMForceModel::DF(const FacetIterator &, const size_t, const Enviro
                          const FacetIterator& /*end_facet*/,
                          const EnvironmentAndFrames& /*env*/,
                          const BodyStates& /*states*/,
-                         const double /*t*/) const
+                         const double /*t*/,
+                         const FacetData& /*facets*/) const
 {
     return [](const FacetIterator &,
               const size_t,
@@ -37,10 +37,12 @@ class GMForceModel : public ImmersedSurfaceForceModel
                                   const FacetIterator& end_facet,
                                   const EnvironmentAndFrames& env,
                                   const BodyStates& states,
-                                  const double t
+                                  const double t,
+                                  const FacetData& facets
                                  ) const;
         static Yaml parse(const std::string& yaml);
         Wrench get_force(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const;
+        bool can_share_surface_integration() const;
         void extra_observations(Observer& ) const;
         static std::string model_name();
         double get_GM() const;
@@ -7,13 +7,15 @@
 
 #include "ManeuveringForceModel.hpp"
 #include "maneuvering_compiler.hpp"
-#include "maneuvering_DataSource_builder.hpp"
 #include "xdyn/core/EnvironmentAndFrames.hpp"
 #include "xdyn/core/yaml2eigen.hpp"
 #include "xdyn/exceptions/InvalidInputException.hpp"
 #include "xdyn/yaml_parser/external_data_structures_parsers.hpp"
 #include "yaml.h"
 
+#include <algorithm>
+#include <iterator>
+
 ManeuveringForceModel::Yaml::Yaml():
     name(),
     frame_of_reference(),
@@ -65,40 +67,105 @@ ManeuveringForceModel::Yaml ManeuveringForceModel::parse(const std::string& yaml
     return ret;
 }
 
+ManeuveringForceModel::Input::Input(const std::string& name_) :
+        source(COMMAND),
+        name(name_)
+{
+    if (name == "g")   source = G;
+    if (name == "nu")  source = NU;
+    if (name == "rho") source = RHO;
+}
+
 ManeuveringForceModel::ManeuveringForceModel(const Yaml& data, const std::string& body_name_, const EnvironmentAndFrames& env) :
         ForceModel(data.name, data.commands, data.frame_of_reference, body_name_, env),
         m(),
-        ds(new ssc::data_source::DataSource())
+        program(new maneuvering::Program(maneuvering::compile_program(data.var2expr, {"X", "Y", "Z", "K", "M", "N"}, env.rot))),
+        inputs(),
+        environment_inputs(),
+        command_inputs(),
+        position_of_commands(),
+        size_of_map_of_commands(0)
 {
     env.k->add(make_transform(data.frame_of_reference, data.name, env.rot));
     for (auto var2expr:data.var2expr)
     {
         m[var2expr.first] = maneuvering::compile(var2expr.second, env.rot);
     }
-    ds->set("g", env.g);
-    ds->set("nu", env.nu);
-    ds->set("rho", env.rho);
-    maneuvering::build_ds(*ds, m);
+    for (const auto& input:program->get_inputs()) inputs.push_back(Input(input));
+    for (size_t i = 0 ; i < inputs.size() ; ++i)
+    {
+        if (inputs[i].source == Input::COMMAND) command_inputs.push_back(i);
+        else                                    environment_inputs.push_back(i);
+    }
+    std::sort(command_inputs.begin(), command_inputs.end(), [this](const size_t i, const size_t j){return inputs[i].name < inputs[j].name;});
+    position_of_commands.reserve(command_inputs.size());
+}
+
+double ManeuveringForceModel::get_value(const Input& input, const EnvironmentAndFrames& env) const
+{
+    switch(input.source)
+    {
+        case Input::G:   return env.g;
+        case Input::NU:  return env.nu;
+        case Input::RHO: return env.rho;
+        default:         break;
+    }
+    return 0;
+}
+
+/**  \brief Sets the inputs of 'program' which are commands, using the positions found by find_commands
+  *  \returns False (& does not set all inputs) if 'commands' does not contain the same names as the map in which the positions were found
+  */
+bool ManeuveringForceModel::set_commands(const std::map<std::string,double>& commands) const
+{
+    if (command_inputs.empty()) return true;
+    if ((commands.size() != size_of_map_of_commands) or (position_of_commands.size() != command_inputs.size())) return false;
+    auto command = commands.begin();
+    size_t position = 0;
+    for (size_t j = 0 ; j < command_inputs.size() ; ++j)
+    {
+        std::advance(command, (long)(position_of_commands[j] - position));
+        position = position_of_commands[j];
+        if (command->first != inputs[command_inputs[j]].name) return false;
+        program->set_input(command_inputs[j], command->second);
+    }
+    return true;
+}
+
+void ManeuveringForceModel::find_commands(const std::map<std::string,double>& commands) const
+{
+    position_of_commands.clear();
+    auto command = commands.begin();
+    size_t position = 0;
+    // Both 'command_inputs' & 'commands' are sorted by name
+    for (const size_t i:command_inputs)
+    {
+        while ((command != commands.end()) and (command->first < inputs[i].name))
+        {
+            ++command;
+            ++position;
+        }
+        if ((command == commands.end()) or (command->first != inputs[i].name))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unable to evaluate maneuvering model '" << name << "': '" << inputs[i].name << "' is neither a variable of the model, nor 'g', 'nu', 'rho', 't' or one of its commands.");
+        }
+        position_of_commands.push_back(position);
+    }
+    size_of_map_of_commands = commands.size();
 }
 
 Wrench ManeuveringForceModel::get_force(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const
 {
-    ds->check_in(__PRETTY_FUNCTION__);
-    ds->set("g", env.g);
-    ds->set("nu", env.nu);
-    ds->set("rho", env.rho);
-    ds->set("states", states);
-    ds->set("t", t);
-    for (const auto& command: commands) ds->set(command.first, command.second);
+    for (const size_t i:environment_inputs) program->set_input(i, get_value(inputs[i], env));
+    if (not(set_commands(commands)))
+    {
+        find_commands(commands);
+        set_commands(commands);
+    }
+    program->run(states, t);
 
     ssc::kinematics::Vector6d tau = ssc::kinematics::Vector6d::Zero();
-    tau(0) = ds->get<double>("X");
-    tau(1) = ds->get<double>("Y");
-    tau(2) = ds->get<double>("Z");
-    tau(3) = ds->get<double>("K");
-    tau(4) = ds->get<double>("M");
-    tau(5) = ds->get<double>("N");
-    ds->check_out();
+    for (size_t i = 0 ; i < 6 ; ++i) tau((int)i) = program->get_output(i);
     return Wrench(ssc::kinematics::Point(name,0,0,0), name, tau);
 }
 
@@ -11,8 +11,8 @@
 #include "xdyn/core/ForceModel.hpp"
 #include "xdyn/external_data_structures/YamlPosition.hpp"
 #include "ManeuveringInternal.hpp"
+#include "maneuvering_bytecode.hpp"
 
-#include <ssc/data_source.hpp>
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 
@@ -42,8 +42,25 @@ class ManeuveringForceModel : public ForceModel
 
     private:
         ManeuveringForceModel();
+        struct Input
+        {
+            enum Source {G, NU, RHO, COMMAND};
+            Input(const std::string& name);
+            Source source;
+            std::string name;
+        };
+        double get_value(const Input& input, const EnvironmentAndFrames& env) const;
+        bool set_commands(const std::map<std::string,double>& commands) const;
+        void find_commands(const std::map<std::string,double>& commands) const;
         std::map<std::string, maneuvering::NodePtr> m;
-        TR1(shared_ptr)<ssc::data_source::DataSource> ds;
+        TR1(shared_ptr)<maneuvering::Program> program; //!< Computes X, Y, Z, K, M & N (in that order)
+        std::vector<Input> inputs;                     //!< Where to get each input of 'program'
+        std::vector<size_t> environment_inputs;        //!< Indexes in 'inputs' of g, nu & rho
+        std::vector<size_t> command_inputs;            //!< Indexes in 'inputs' of the commands, sorted by name (like the map given to get_force)
+        // The map of commands is rebuilt by ForceModel::get_commands at each evaluation & also contains the values of the DataSource,
+        // so the positions of the commands are found in the first map & then only checked (cf. set_commands)
+        mutable std::vector<size_t> position_of_commands; //!< Position in the map of commands of each element of 'command_inputs'
+        mutable size_t size_of_map_of_commands;           //!< Size of the map in which position_of_commands was found
 };
 
 #endif /* MANEUVERINGFORCEMODEL_HPP_ */
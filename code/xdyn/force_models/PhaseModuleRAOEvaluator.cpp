@@ -48,7 +48,8 @@ PhaseModuleRAOEvaluator::PhaseModuleRAOEvaluator(
     const std::string& force_model_name):
                 rao_interpolator(rao_interpolator_),
                 H0(rao_interpolator.get_rao_calculation_point()),
-                use_encounter_period(rao_interpolator.using_encounter_period())
+                use_encounter_period(rao_interpolator.using_encounter_period()),
+                ray_tables()
 {
     if (env.w.use_count()>0)
     {
@@ -73,6 +74,14 @@ PhaseModuleRAOEvaluator::PhaseModuleRAOEvaluator(
 }
 
 void PhaseModuleRAOEvaluator::check_spectra_periods_are_in_rao_period_bounds(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra) const
+{
+    for (const auto& spectrum: spectra)
+    {
+        check_spectrum_periods_are_in_rao_period_bounds(spectrum);
+    }
+}
+
+void PhaseModuleRAOEvaluator::check_spectrum_periods_are_in_rao_period_bounds(const FlatDiscreteDirectionalWaveSpectrum& spectrum) const
 {
     // When calling this method, `rao_interpolator.get_module_periods` vector is defined
     const std::vector<double>& periods = rao_interpolator.get_module_periods();
@@ -80,18 +89,14 @@ void PhaseModuleRAOEvaluator::check_spectra_periods_are_in_rao_period_bounds(con
     {
         const double period_min = *std::min_element(periods.begin(), periods.end());
         const double period_max = *std::max_element(periods.begin(), periods.end());
-        for (const auto& spectrum: spectra)
-        {
-            const std::vector<double> spectrum_periods = spectrum.get_periods();
-            check_all_values_are_within_bounds(period_min, spectrum_periods, period_max);
-        }
+        check_all_values_are_within_bounds(period_min, spectrum.get_periods(), period_max);
     }
 }
 
 ssc::kinematics::Vector6d PhaseModuleRAOEvaluator::evaluate(const BodyStates& states, const double t, const EnvironmentAndFrames& env)
 {
     ssc::kinematics::Vector6d w = ssc::kinematics::Vector6d::Zero();
-    auto T = env.k->get("NED", states.name);
+    auto T = env.frames->is_up_to_date(states.ned_to_body) ? env.frames->get(states.ned_to_body) : env.k->get("NED", states.name);
     T.swap();
     const Eigen::Vector2d x = (T*ssc::kinematics::Point(states.name,H0)).v.head(2); // Position on horizontal plane of calculation point
     const double psi = states.get_angles().psi;
@@ -100,6 +105,10 @@ ssc::kinematics::Vector6d PhaseModuleRAOEvaluator::evaluate(const BodyStates& st
     {
         try
         {
+            if (evaluate_with_ray_tables(env, psi, x, t, w))
+            {
+                return express_aquaplus_wrench_in_xdyn_coordinates(w);
+            }
             const auto directional_spectra = env.w->get_flat_directional_spectra(x(0), x(1), t);
             check_spectra_periods_are_in_rao_period_bounds(directional_spectra);
             for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx) // For each degree of freedom (X, Y, Z, K, M, N)
@@ -145,6 +154,37 @@ ssc::kinematics::Vector6d PhaseModuleRAOEvaluator::evaluate(const BodyStates& st
     return ww;
 }
 
+/* Without the encounter period correction, the RAO of each ray only depends on the incidence:
+ * if the spectra are known in advance, the RAOs are tabulated once (cf. RaoRayTable).
+ */
+bool PhaseModuleRAOEvaluator::evaluate_with_ray_tables(const EnvironmentAndFrames& env, const double psi, const Eigen::Vector2d& x, const double t, ssc::kinematics::Vector6d& w)
+{
+    if (use_encounter_period) return false;
+    const std::vector<const FlatDiscreteDirectionalWaveSpectrum*> spectra = env.w->get_constant_flat_directional_spectra();
+    if (spectra.empty()) return false;
+    bool tables_are_up_to_date = spectra.size() == ray_tables.size();
+    for (size_t i = 0 ; tables_are_up_to_date and (i < spectra.size()) ; ++i)
+    {
+        tables_are_up_to_date = ray_tables[i].is_for(*spectra[i]);
+    }
+    if (not(tables_are_up_to_date))
+    {
+        ray_tables.clear();
+        for (const auto spectrum:spectra)
+        {
+            check_spectrum_periods_are_in_rao_period_bounds(*spectrum);
+            ray_tables.push_back(RaoRayTable(rao_interpolator, *spectrum));
+        }
+    }
+    ssc::kinematics::Vector6d w_rays = ssc::kinematics::Vector6d::Zero();
+    for (auto& table:ray_tables)
+    {
+        if (not(table.add_force(psi, x(0), x(1), t, w_rays))) return false;
+    }
+    w += w_rays;
+    return true;
+}
+
 double PhaseModuleRAOEvaluator::get_interpolation_period(const double wave_angular_frequency, const Eigen::Vector2d& Vs, const Eigen::Vector2d& k) const
 {
     double encounter_period;
@@ -1,6 +1,7 @@
 #ifndef _PHASEMODULERAOEVALUATORHPP_
 #define _PHASEMODULERAOEVALUATORHPP_
 
+#include "RaoRayTable.hpp"
 #include "xdyn/hdb_interpolators/RaoInterpolator.hpp"
 #include <ssc/kinematics.hpp>
 #include <string>
@@ -28,7 +29,10 @@ class PhaseModuleRAOEvaluator
         RaoInterpolator rao_interpolator;
         Eigen::Vector3d H0;
         bool use_encounter_period;
+        std::vector<RaoRayTable> ray_tables; //!< Only used without the encounter period correction, if the spectra are constant
         void check_spectra_periods_are_in_rao_period_bounds(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra) const;
+        void check_spectrum_periods_are_in_rao_period_bounds(const FlatDiscreteDirectionalWaveSpectrum& spectrum) const;
+        bool evaluate_with_ray_tables(const EnvironmentAndFrames& env, const double psi, const Eigen::Vector2d& x, const double t, ssc::kinematics::Vector6d& w);
 };
 
 #endif /* _PHASEMODULERAOEVALUATORHPP_ */
@@ -12,9 +12,9 @@
 #include "xdyn/exceptions/InternalErrorException.hpp"
 #include "xdyn/hdb_interpolators/History.hpp"
 #include "xdyn/hdb_interpolators/HydroDBParser.hpp"
-#include "xdyn/hdb_interpolators/HDBParser.hpp"
-#include "xdyn/hdb_interpolators/PrecalParser.hpp"
+#include "xdyn/hdb_interpolators/PronyApproximation.hpp"
 #include "xdyn/hdb_interpolators/RadiationDampingBuilder.hpp"
+#include "xdyn/hdb_interpolators/StateSpaceConvolution.hpp"
 #include "xdyn/yaml_parser/external_data_structures_parsers.hpp"
 
 #include <ssc/macros.hpp>
@@ -110,6 +110,22 @@ std::function<double(double)> operator-(const std::function<double(double)>& f,
     return [f, g](double x){return f(x) - g(x);};
 }
 
+/** \brief Index of the first point of history strictly after t (h.size() if there is none)
+ */
+size_t index_of_first_instant_after(const History& h, const double t);
+size_t index_of_first_instant_after(const History& h, const double t)
+{
+    size_t lower = 0;
+    size_t upper = h.size();
+    while (lower < upper)
+    {
+        const size_t middle = (lower + upper)/2;
+        if (h[(int)middle].first > t) upper = middle;
+        else                          lower = middle + 1;
+    }
+    return lower;
+}
+
 std::function<double(double)> operator-(const std::function<double(double)>& f, const double a);
 std::function<double(double)> operator-(const std::function<double(double)>& f, const double a)
 {
@@ -118,12 +134,60 @@ std::function<double(double)> operator-(const std::function<double(double)>& f,
 
 class RadiationDampingForceModel::Impl
 {
+    private:
+        /* Convolution of velocity j with a retardation function approximated by a sum of exponentials,
+         * contributing to force i (multiplied by sign & by average velocity U or V for the forward speed correction terms).
+         * The convolution between Tmin & Tmax is the difference of the convolutions from Tmin & from Tmax to infinity.
+         */
+        struct StateSpaceTerm
+        {
+            StateSpaceTerm(const size_t i_, const size_t j_, const int average_velocity_index_, const double sign_, const PronyApproximation& K, const double Tmax) :
+                i(i_), j(j_), average_velocity_index(average_velocity_index_), sign(sign_), from_tmin(K, K.get_tau0()), from_tmax(K, Tmax)
+            {
+            }
+            size_t i;
+            size_t j;
+            int average_velocity_index; //!< -1 (none), 0 (U) or 1 (V)
+            double sign;
+            StateSpaceConvolution from_tmin;
+            StateSpaceConvolution from_tmax;
+        };
+
+        /* How far one convolution has been integrated (the velocity being delayed by Tmin or Tmax)
+         */
+        struct StateSpaceCursor
+        {
+            StateSpaceCursor() : active(false), t(0), v(0), intervals(), last_interval()
+            {
+            }
+            bool active;    //!< False while the history is shorter than the delay
+            double t;       //!< Instant up to which the convolution has been integrated
+            double v;       //!< Velocity at t
+            std::vector<std::array<double,3> > intervals; //!< (v0, v1, dt) to integrate at the current evaluation
+            std::array<double,3> last_interval;           //!< From t to the current instant minus the delay (not committed)
+        };
+
+        /* How far the convolutions of one velocity have been integrated
+         */
+        struct StateSpaceCursors
+        {
+            StateSpaceCursors() : started(false), restarted(false), t_start(0), from_tmin(), from_tmax()
+            {
+            }
+            bool started;   //!< Have the convolutions been initialized with the current history?
+            bool restarted; //!< Should the states of the convolutions be reset before integrating the intervals?
+            double t_start; //!< Instant at which the convolutions were started
+            StateSpaceCursor from_tmin;
+            StateSpaceCursor from_tmax;
+        };
+
     public:
         Impl(const TR1(shared_ptr)<HydroDBParser>& parser_, const YamlRadiationDamping& yaml) : parser{parser_}, builder(RadiationDampingBuilder(yaml.type_of_quadrature_for_convolution, yaml.type_of_quadrature_for_cos_transform)),
         A(), Ka(), Kb(), omega(parser->get_angular_frequencies()), taus(),
         n(yaml.nb_of_points_for_retardation_function_discretization), Tmin(yaml.tau_min), Tmax(yaml.tau_max),
         H0(yaml.calculation_point_in_body_frame.x,yaml.calculation_point_in_body_frame.y,yaml.calculation_point_in_body_frame.y),
-        remove_constant_speed(yaml.remove_constant_speed), forward_speed_correction(yaml.forward_speed_correction)
+        remove_constant_speed(yaml.remove_constant_speed), forward_speed_correction(yaml.forward_speed_correction),
+        use_state_space_approximation(yaml.use_state_space_approximation), state_space_terms(), cursors()
         {
             CSVWriter omega_writer(std::cerr, "omega", omega);
             taus = builder.build_regular_intervals(Tmin,Tmax,n);
@@ -159,6 +223,90 @@ class RadiationDampingForceModel::Impl
                 std::cerr << std::endl << "Debugging information for retardation functions K:" << std::endl;
                 tau_writer.print();
             }
+            if (use_state_space_approximation)
+            {
+                build_state_space_approximation(yaml.max_nb_of_exponentials, yaml.output_state_space_fidelity);
+            }
+        }
+
+        /* Each retardation function is approximated by a sum of exponentials, so each convolution
+         * can be integrated recursively (cf. StateSpaceConvolution). With the forward speed correction,
+         * the retardation functions of the three last columns depend on the average velocities U & V
+         * (cf. get_K below): as the convolution is linear, the terms in Ka are convolved separately
+         * & multiplied by U or V at each time step.
+         */
+        void build_state_space_approximation(const size_t max_nb_of_exponentials, const bool output_fidelity)
+        {
+            if (max_nb_of_exponentials == 0)
+            {
+                THROW(__PRETTY_FUNCTION__, InvalidInputException, "The maximum number of exponentials per retardation function should be at least 1 (in the 'radiation damping' force model)");
+            }
+            if (output_fidelity)
+            {
+                std::cerr << "Fidelity of the state space approximation of the retardation functions (radiation damping):" << std::endl
+                          << "K,nb of exponentials,relative RMS error on K,relative error on convolution" << std::endl;
+            }
+            size_t nb_of_zero_retardation_functions = 0;
+            const auto approximate = [this, max_nb_of_exponentials, output_fidelity, &nb_of_zero_retardation_functions](const std::string& name, const std::function<double(double)>& K, const size_t i, const size_t j)
+                {
+                    const PronyApproximation approximation(K, taus, max_nb_of_exponentials);
+                    if (not(approximation.size()))
+                    {
+                        nb_of_zero_retardation_functions++;
+                    }
+                    else if (output_fidelity)
+                    {
+                        std::cerr << name << '_' << i+1 << j+1 << ',' << approximation.size() << ',' << approximation.get_relative_error() << ',' << convolution_error(approximation, K) << std::endl;
+                    }
+                    return approximation;
+                };
+            for (size_t i = 0 ; i < 6 ; ++i)
+            {
+                for (size_t j = 0 ; j < 6 ; ++j)
+                {
+                    add_state_space_term(i, j, -1, 1, approximate("K", Kb[i][j], i, j));
+                }
+                if (forward_speed_correction)
+                {
+                    const auto Ka1 = approximate("Ka", Ka[i][0], i, 0);
+                    const auto Ka2 = approximate("Ka", Ka[i][1], i, 1);
+                    const auto Ka3 = approximate("Ka", Ka[i][2], i, 2);
+                    add_state_space_term(i, 3, 1, 1, Ka3);   // V*Ka(i,3)
+                    add_state_space_term(i, 4, 0, -1, Ka3);  // -U*Ka(i,3)
+                    add_state_space_term(i, 5, 0, 1, Ka2);   // U*Ka(i,2)
+                    add_state_space_term(i, 5, 1, -1, Ka1);  // -V*Ka(i,1)
+                }
+            }
+            if (output_fidelity)
+            {
+                std::cerr << "Retardation functions equal to zero (ignored): " << nb_of_zero_retardation_functions << std::endl;
+            }
+        }
+
+        void add_state_space_term(const size_t i, const size_t j, const int average_velocity_index, const double sign, const PronyApproximation& K)
+        {
+            if (K.size())
+            {
+                state_space_terms.push_back(StateSpaceTerm(i, j, average_velocity_index, sign, K, Tmax));
+            }
+        }
+
+        /* Compares the steady-state responses to harmonic velocities (at frequencies spanning the hydrodynamic database)
+         * given by the approximation & by the direct convolution, relatively to the largest response.
+         */
+        double convolution_error(const PronyApproximation& approximation, const std::function<double(double)>& K) const
+        {
+            double max_error = 0;
+            double max_response = 0;
+            for (const auto w:builder.build_regular_intervals(omega.front(), omega.back(), 20))
+            {
+                const double real_part = builder.convolution([w](const double tau){return std::cos(w*tau);}, K, Tmin, Tmax);
+                const double imaginary_part = -builder.convolution([w](const double tau){return std::sin(w*tau);}, K, Tmin, Tmax);
+                const std::complex<double> direct(real_part, imaginary_part);
+                max_error = std::max(max_error, std::abs(approximation.fourier_transform(w, Tmax) - direct));
+                max_response = std::max(max_response, std::abs(direct));
+            }
+            return max_response > 0 ? max_error/max_response : max_error;
         }
 
         std::function<double(double)> get_Ma(const size_t i, const size_t j) const
@@ -241,7 +389,7 @@ class RadiationDampingForceModel::Impl
 
         double get_convolution(const size_t i, const size_t j, const BodyStates& states, const std::array<double, 6>& average_velocities)
         {
-            const History his = get_velocity_history_from_index(j, states);
+            const History& his = get_velocity_history_from_index(j, states);
             if(his.get_duration() >= Tmin)
             {
                 // Removing the average velocity to get only the oscillation velocity
@@ -302,7 +450,7 @@ class RadiationDampingForceModel::Impl
             return ret;
         }
 
-        History get_velocity_history_from_index(const size_t i, const BodyStates& states) const
+        const History& get_velocity_history_from_index(const size_t i, const BodyStates& states) const
         {
             switch(i)
             {
@@ -312,8 +460,107 @@ class RadiationDampingForceModel::Impl
                 case 3: return states.p;
                 case 4: return states.q;
                 case 5: return states.r;
-                default: return History();
+                default: break;
+            }
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Velocity index should be between 0 & 5, but got " << i);
+            return states.u;
+        }
+
+        /* Finds the intervals of the velocity history which have not been integrated yet by the state space approximation.
+         * The convolution at t needs the velocities up to t-delay: the intervals between the points of history before t-delay are
+         * committed (except the one ending at the last point of history, whose value may be replaced, eg. by the next
+         * stage of a Runge-Kutta scheme), the remaining part is only used for the current evaluation.
+         */
+        void update_cursor(StateSpaceCursor& cursor, const History& h, const double delay) const
+        {
+            cursor.intervals.clear();
+            const double T = h.get_current_time() - delay;
+            cursor.active = T >= cursor.t;
+            if (not(cursor.active)) return; // History shorter than the delay: the convolution is zero
+            const size_t n = h.size();
+            for (size_t idx = index_of_first_instant_after(h, cursor.t) ; idx + 1 < n ; ++idx)
+            {
+                const std::pair<double,double> p = h[(int)idx];
+                if (p.first > T) break;
+                cursor.intervals.push_back({cursor.v, p.second, p.first - cursor.t});
+                cursor.t = p.first;
+                cursor.v = p.second;
+            }
+            cursor.last_interval = {cursor.v, h(delay), T - cursor.t};
+        }
+
+        void update_cursors(StateSpaceCursors& cursors_, const History& h) const
+        {
+            cursors_.restarted = false;
+            cursors_.from_tmin.active = false;
+            cursors_.from_tmax.active = false;
+            if (h.is_empty()) return;
+            const double t = h.get_current_time();
+            const std::pair<double,double> front = h[0];
+            if (cursors_.started)
+            {
+                // If the history was reset or replaced (eg. by the simulator API), start over
+                const StateSpaceCursor& cursor = cursors_.from_tmin;
+                const bool committed_point_is_in_history = cursor.t >= front.first;
+                if ((t - Tmin < cursor.t) or (committed_point_is_in_history and (std::abs(h(t - cursor.t) - cursor.v) > 1E-9*(1+std::abs(cursor.v)))))
+                {
+                    cursors_.started = false;
+                }
+            }
+            if (not(cursors_.started))
+            {
+                if (t - Tmin < front.first) return; // History shorter than Tmin: the convolution is zero
+                cursors_.started = true;
+                cursors_.restarted = true;
+                cursors_.t_start = front.first;
+                for (auto cursor:{&cursors_.from_tmin, &cursors_.from_tmax})
+                {
+                    cursor->t = front.first;
+                    cursor->v = front.second;
+                }
+            }
+            update_cursor(cursors_.from_tmin, h, Tmin);
+            update_cursor(cursors_.from_tmax, h, Tmax);
+        }
+
+        static double get_value(StateSpaceConvolution& convolution, const StateSpaceCursor& cursor)
+        {
+            if (not(cursor.active)) return 0;
+            for (const auto& interval:cursor.intervals)
+            {
+                convolution.advance(interval[0], interval[1], interval[2]);
             }
+            return convolution.get_value(cursor.last_interval[0], cursor.last_interval[1], cursor.last_interval[2]);
+        }
+
+        ssc::kinematics::Vector6d get_convoluted_matrix_product_from_state_space(const BodyStates& states, const std::array<double, 6>& average_velocities)
+        {
+            for (size_t j = 0 ; j < 6 ; ++j)
+            {
+                update_cursors(cursors[j], get_velocity_history_from_index(j, states));
+            }
+            ssc::kinematics::Vector6d ret = ssc::kinematics::Vector6d::Zero();
+            for (auto& term:state_space_terms)
+            {
+                const StateSpaceCursors& cursors_ = cursors[term.j];
+                if (cursors_.restarted)
+                {
+                    term.from_tmin.reset();
+                    term.from_tmax.reset();
+                }
+                if (not(cursors_.from_tmin.active)) continue;
+                double convolution = get_value(term.from_tmin, cursors_.from_tmin) - get_value(term.from_tmax, cursors_.from_tmax);
+                if (remove_constant_speed)
+                {
+                    // Removing the average velocity amounts to subtracting its product with the integral of K
+                    // (between Tmin & Tmax, but never exceeding the part of history which was convolved)
+                    const double t = get_velocity_history_from_index(term.j, states).get_current_time();
+                    convolution -= average_velocities[term.j]*term.from_tmin.integral_of_kernel(std::min(Tmax, t - cursors_.t_start));
+                }
+                const double weight = term.average_velocity_index < 0 ? term.sign : term.sign*average_velocities[(size_t)term.average_velocity_index];
+                ret(static_cast<Eigen::Index>(term.i)) += weight*convolution;
+            }
+            return ret;
         }
 
         Wrench get_wrench(const BodyStates& states)
@@ -322,7 +569,8 @@ class RadiationDampingForceModel::Impl
             const ssc::kinematics::Point H(states.name,H0);
             const auto average_velocities = get_average_velocities(states);
 
-            ssc::kinematics::Vector6d W = -get_convoluted_matrix_product(states, average_velocities);
+            ssc::kinematics::Vector6d W = use_state_space_approximation ? -get_convoluted_matrix_product_from_state_space(states, average_velocities)
+                                                                        : -get_convoluted_matrix_product(states, average_velocities);
 
             if (forward_speed_correction)
             {
@@ -348,6 +596,7 @@ class RadiationDampingForceModel::Impl
 
     private:
         Impl();
+
         TR1(shared_ptr)<HydroDBParser> parser;
         RadiationDampingBuilder builder;
         Eigen::Matrix<double, 6, 6> A;
@@ -361,6 +610,9 @@ class RadiationDampingForceModel::Impl
         Eigen::Vector3d H0;
         bool remove_constant_speed;
         bool forward_speed_correction;
+        bool use_state_space_approximation;
+        std::vector<StateSpaceTerm> state_space_terms;
+        std::array<StateSpaceCursors, 6> cursors;
 };
 
 
@@ -442,20 +694,25 @@ RadiationDampingForceModel::Input RadiationDampingForceModel::parse(const std::s
     {
         node["forward speed correction"] >> input.forward_speed_correction;
     }
+    if (node.FindValue("use state space approximation"))
+    {
+        node["use state space approximation"] >> input.use_state_space_approximation;
+    }
+    if (node.FindValue("max nb of exponentials per retardation function"))
+    {
+        node["max nb of exponentials per retardation function"] >> input.max_nb_of_exponentials;
+    }
+    if (node.FindValue("output state space approximation fidelity"))
+    {
+        node["output state space approximation fidelity"] >> input.output_state_space_fidelity;
+    }
     if (parse_hdb_or_precalr)
     {
-        if (not(input.hdb_filename.empty()))
-        {
-            ret.parser = TR1(shared_ptr)<HydroDBParser>(new HDBParser(HDBParser::from_file(input.hdb_filename)));
-        }
-        else
+        if (input.hdb_filename.empty() and input.precal_r_filename.empty())
         {
-            if (input.precal_r_filename.empty())
-            {
-                THROW(__PRETTY_FUNCTION__, InvalidInputException, "Neither hdb nor raodb were defined: you need to define one of the keys 'hdb' or 'raodb' in the YAML file, with a non-empty string.");
-            }
-            ret.parser = TR1(shared_ptr)<HydroDBParser>(new PrecalParser(PrecalParser::from_file(input.precal_r_filename)));
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "Neither hdb nor raodb were defined: you need to define one of the keys 'hdb' or 'raodb' in the YAML file, with a non-empty string.");
         }
+        ret.parser = parser_factory(input.hdb_filename, input.precal_r_filename);
     }
     ret.yaml = input;
     return ret;
@@ -0,0 +1,172 @@
+/*
+ * RaoRayTable.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "RaoRayTable.hpp"
+#include <ssc/exception_handling.hpp>
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define TWOPI (2*M_PI)
+
+#include <algorithm>
+#include <map>
+
+#define MAX_INCIDENCE_STEP (M_PI/180)
+
+double normalize_incidence(const double beta);
+double normalize_incidence(const double beta)
+{
+    return beta - TWOPI*std::floor(beta/TWOPI);
+}
+
+/* When the RAO is mirrored, RaoInterpolator::interpolate_module changes the sign of Fy, Mx & Mz
+ * for incidences above pi: the module is discontinuous there, so we tabulate it without
+ * this change of sign (which makes it continuous) & apply it when evaluating the force.
+ */
+double mirror_sign(const bool mirror, const size_t degree_of_freedom_idx, const double beta);
+double mirror_sign(const bool mirror, const size_t degree_of_freedom_idx, const double beta)
+{
+    const bool odd_axis = (degree_of_freedom_idx == 1) or (degree_of_freedom_idx == 3) or (degree_of_freedom_idx == 5);
+    return (mirror and odd_axis and (normalize_incidence(beta) > M_PI)) ? -1 : 1;
+}
+
+std::vector<double> build_incidence_grid(const RaoInterpolator& rao_interpolator);
+std::vector<double> build_incidence_grid(const RaoInterpolator& rao_interpolator)
+{
+    std::vector<double> nodes = {0, TWOPI};
+    for (const auto& psis:{rao_interpolator.rao.module_incidence, rao_interpolator.rao.phase_incidence})
+    {
+        for (const auto psi:psis)
+        {
+            const double beta = normalize_incidence(psi);
+            nodes.push_back(beta);
+            if (rao_interpolator.mirror) nodes.push_back(TWOPI - beta);
+        }
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end(), [](const double a, const double b){return b - a < 1E-12;}), nodes.end());
+    nodes.back() = TWOPI;
+    std::vector<double> ret;
+    for (size_t i = 0 ; i + 1 < nodes.size() ; ++i)
+    {
+        const size_t n = (size_t)std::ceil((nodes[i+1] - nodes[i])/MAX_INCIDENCE_STEP);
+        for (size_t j = 0 ; j < n ; ++j)
+        {
+            ret.push_back(nodes[i] + (nodes[i+1] - nodes[i])*(double)j/(double)n);
+        }
+    }
+    ret.push_back(TWOPI);
+    return ret;
+}
+
+RaoRayTable::RaoRayTable(RaoInterpolator& rao_interpolator, const FlatDiscreteDirectionalWaveSpectrum& spectrum_) :
+    spectrum(spectrum_),
+    nb_of_rays(spectrum_.omega.size()),
+    mirror(rao_interpolator.mirror),
+    kernels(spectrum_),
+    incidences(build_incidence_grid(rao_interpolator)),
+    directions(),
+    direction_of_ray(),
+    period_of_ray(),
+    module(),
+    phase(),
+    valid_incidence(),
+    incidence_of_direction(),
+    weight_of_direction(),
+    mirrored_direction(),
+    amplitudes(6, std::vector<double>(kernels.get_nb_of_padded_rays(), 0)),
+    phases(6, std::vector<double>(kernels.get_nb_of_padded_rays(), 0))
+{
+    std::map<double, size_t> period_indices;
+    std::map<double, size_t> direction_indices;
+    std::vector<double> periods;
+    for (size_t i = 0 ; i < nb_of_rays ; ++i)
+    {
+        const double period = TWOPI/spectrum_.omega[i];
+        const auto p = period_indices.insert(std::make_pair(period, periods.size()));
+        if (p.second) periods.push_back(period);
+        period_of_ray.push_back(p.first->second);
+        const auto d = direction_indices.insert(std::make_pair(spectrum_.psi[i], directions.size()));
+        if (d.second) directions.push_back(spectrum_.psi[i]);
+        direction_of_ray.push_back(d.first->second);
+    }
+    incidence_of_direction.resize(directions.size(), 0);
+    weight_of_direction.resize(directions.size(), 0);
+    mirrored_direction.resize(directions.size(), false);
+    valid_incidence.resize(incidences.size(), true);
+    module.resize(periods.size()*6*incidences.size(), 0);
+    phase.resize(module.size(), 0);
+    for (size_t p = 0 ; p < periods.size() ; ++p)
+    {
+        for (size_t d = 0 ; d < 6 ; ++d)
+        {
+            for (size_t j = 0 ; j < incidences.size() ; ++j)
+            {
+                // Last node: limit from the left (RaoInterpolator would otherwise evaluate the RAO at 0)
+                const double beta = (j + 1 == incidences.size()) ? std::nextafter(TWOPI, 0.) : incidences[j];
+                try
+                {
+                    module[index(p, d, j)] = mirror_sign(mirror, d, beta)*rao_interpolator.interpolate_module(d, periods[p], beta);
+                    phase[index(p, d, j)] = -rao_interpolator.interpolate_phase(d, periods[p], beta);
+                }
+                catch (const ssc::exception_handling::Exception&)
+                {
+                    // The database does not cover this incidence: only an error if a ray actually reaches it
+                    valid_incidence[j] = false;
+                }
+            }
+        }
+    }
+}
+
+size_t RaoRayTable::index(const size_t period_idx, const size_t degree_of_freedom_idx, const size_t incidence_idx) const
+{
+    return (period_idx*6 + degree_of_freedom_idx)*incidences.size() + incidence_idx;
+}
+
+bool RaoRayTable::is_for(const FlatDiscreteDirectionalWaveSpectrum& spectrum_) const
+{
+    return (spectrum_.a == spectrum.a) and (spectrum_.omega == spectrum.omega) and (spectrum_.psi == spectrum.psi)
+       and (spectrum_.k == spectrum.k) and (spectrum_.phase == spectrum.phase);
+}
+
+bool RaoRayTable::add_force(const double psi, const double x, const double y, const double t, ssc::kinematics::Vector6d& w)
+{
+    for (size_t k = 0 ; k < directions.size() ; ++k)
+    {
+        const double beta = normalize_incidence(psi - directions[k]);
+        const size_t j = std::min((size_t)(std::upper_bound(incidences.begin(), incidences.end(), beta) - incidences.begin()), incidences.size() - 1) - 1;
+        if (not(valid_incidence[j]) or not(valid_incidence[j+1])) return false;
+        incidence_of_direction[k] = j;
+        weight_of_direction[k] = (beta - incidences[j])/(incidences[j+1] - incidences[j]);
+        mirrored_direction[k] = mirror_sign(mirror, 1, beta) < 0;
+    }
+    for (size_t i = 0 ; i < nb_of_rays ; ++i)
+    {
+        const size_t k = direction_of_ray[i];
+        const double u = weight_of_direction[k];
+        for (size_t d = 0 ; d < 6 ; ++d)
+        {
+            const size_t idx = index(period_of_ray[i], d, incidence_of_direction[k]);
+            const double sign = (mirrored_direction[k] and (d % 2 == 1)) ? -1 : 1;
+            amplitudes[d][i] = sign*spectrum.a[i]*((1-u)*module[idx] + u*module[idx+1]);
+            phases[d][i] = (1-u)*phase[idx] + u*phase[idx+1];
+        }
+    }
+    const double* amplitudes_[6];
+    const double* phases_[6];
+    for (size_t d = 0 ; d < 6 ; ++d)
+    {
+        amplitudes_[d] = amplitudes[d].data();
+        phases_[d] = phases[d].data();
+    }
+    double sums[6];
+    kernels.rao_sums(amplitudes_, phases_, x, y, t, sums);
+    for (size_t d = 0 ; d < 6 ; ++d)
+    {
+        w((int)d) -= sums[d];
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+/*
+ * RaoRayTable.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef RAORAYTABLE_HPP_
+#define RAORAYTABLE_HPP_
+
+#include "xdyn/environment_models/DiscreteDirectionalWaveSpectrum.hpp"
+#include "xdyn/environment_models/WaveKernels.hpp"
+#include "xdyn/hdb_interpolators/RaoInterpolator.hpp"
+#include <ssc/kinematics.hpp>
+#include <vector>
+
+/** \brief RAO of each ray of a wave spectrum, tabulated against the incidence
+ *  \details Without the encounter period correction, the RAO of a ray only depends on its
+ *           period (which is constant) & on its incidence (ship heading minus direction of
+ *           propagation). For each period of the spectrum, the module & the phase are
+ *           interpolated once, for incidences between 0 & 2 pi: at the incidences of the
+ *           hydrodynamic database (& their mirror images), which are the nodes of the
+ *           bilinear interpolation done by RaoInterpolator, and at intermediate incidences
+ *           at most one degree apart. At each time step, each direction of propagation is
+ *           located once in this grid, the RAO of each ray is interpolated linearly and the
+ *           sums over the rays are evaluated by the SIMD wave kernels (cf. WaveKernels::rao_sums).
+ *           This gives the same results as interpolating the RAO of each ray at each time step,
+ *           which is what PhaseModuleRAOEvaluator does with the encounter period correction.
+ *  \addtogroup force_models
+ *  \ingroup force_models
+ *  \section ex1 Example
+ *  \snippet force_models/unit_tests/DiffractionForceModelTest.cpp DiffractionForceModelTest ray_tables_example
+ */
+class RaoRayTable
+{
+    public:
+        RaoRayTable(RaoInterpolator& rao_interpolator, const FlatDiscreteDirectionalWaveSpectrum& spectrum);
+
+        /**  \brief Was this table built for this spectrum?
+          *  \details Compares the rays (not the addresses), so a table is never used for
+          *           a spectrum which was regenerated in place.
+          */
+        bool is_for(const FlatDiscreteDirectionalWaveSpectrum& spectrum) const;
+
+        /**  \brief Adds the force of all the rays (in the RAO's coordinates) to w
+          *  \returns false (& leaves w unchanged) if a ray's incidence is not covered by the database,
+          *           in which case the RAO should be interpolated directly (to get RaoInterpolator's error message)
+          */
+        bool add_force(
+            const double psi,            //!< Ship heading (in rad)
+            const double x,              //!< x-position of the calculation point in the NED frame (in meters)
+            const double y,              //!< y-position of the calculation point in the NED frame (in meters)
+            const double t,              //!< Current time instant (in seconds)
+            ssc::kinematics::Vector6d& w //!< Force to which the rays' contribution is added
+            );
+
+    private:
+        RaoRayTable();
+        size_t index(const size_t period_idx, const size_t degree_of_freedom_idx, const size_t incidence_idx) const;
+
+        FlatDiscreteDirectionalWaveSpectrum spectrum; //!< Copy of the spectrum the table was built for
+        size_t nb_of_rays;
+        bool mirror;
+        WaveKernels kernels;
+        std::vector<double> incidences;              //!< Interpolation grid, from 0 to 2 pi (in rad)
+        std::vector<double> directions;              //!< Distinct directions of propagation of the rays (in rad)
+        std::vector<size_t> direction_of_ray;        //!< Index in 'directions'
+        std::vector<size_t> period_of_ray;           //!< Index of the ray's period in the tables
+        std::vector<double> module;                  //!< Module of the RAO (without the change of sign of the mirror), for each period, degree of freedom & incidence
+        std::vector<double> phase;                   //!< Opposite of the phase of the RAO (as used in the sums), same layout as 'module'
+        std::vector<bool> valid_incidence;           //!< False if RaoInterpolator could not interpolate the RAO at this node of 'incidences'
+        std::vector<size_t> incidence_of_direction;  //!< Lower bound of the interval of 'incidences' of each direction, at the current time step
+        std::vector<double> weight_of_direction;     //!< Linear interpolation weight of each direction, at the current time step
+        std::vector<bool> mirrored_direction;        //!< Should Fy, Mx & Mz change sign for this direction (cf. RaoInterpolator::interpolate_module), at the current time step
+        std::vector<std::vector<double> > amplitudes; //!< Amplitude times module, for each degree of freedom & each ray (padded)
+        std::vector<std::vector<double> > phases;     //!< For each degree of freedom & each ray (padded)
+};
+
+#endif /* RAORAYTABLE_HPP_ */
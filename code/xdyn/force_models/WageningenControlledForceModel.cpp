@@ -26,16 +26,24 @@ WageningenControlledForceModel::Yaml::Yaml(const AbstractWageningen::Yaml& y) :
 {
 }
 
+double saturate(const double J);
+double saturate(const double J)
+{
+    return std::max(std::min(J,1.5),0.);
+}
+
 double WageningenControlledForceModel::get_Kt(const std::map<std::string,double>& commands, const double J) const
 {
     const double P_D = commands.at("P/D");
-    return Kt(Z, AE_A0, P_D, J);
+    check(P_D, J);
+    return kt(P_D, saturate(J));
 }
 
 double WageningenControlledForceModel::get_Kq(const std::map<std::string,double>& commands, const double J) const
 {
     const double P_D = commands.at("P/D");
-    return Kq(Z, AE_A0, P_D, J);
+    check(P_D, J);
+    return kq(P_D, saturate(J));
 }
 
 WageningenControlledForceModel::WageningenControlledForceModel(const Yaml& input, const std::string& body_name_, const EnvironmentAndFrames& env) :
@@ -51,7 +59,9 @@ WageningenControlledForceModel::WageningenControlledForceModel(const Yaml& input
             sq{0,2,1,0,0,1,2,0,1,0,1,2,2,1,0,3,0,1,0,1,3,0,3,2,0,0,3,3,0,3,0,1,0,2,0,1,3,3,1,2,0,0,0,0,3,0,1},
             tq{0,0,1,2,1,1,1,2,0,1,1,1,0,1,2,0,3,3,0,0,0,1,1,2,3,6,0,3,6,0,6,0,2,3,6,1,2,6,0,0,2,6,0,3,3,6,6},
             uq{0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,2,2,2,2,2,2,2,2,0,0,0,1,1,2,2,2,2,0,0,0,1,1,1,1,2,2,2,2,2},
-            vq{0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2}
+            vq{0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2},
+            kt(NB_COEFF_KT, ct, st, tt, ut, vt, AE_A0, Z),
+            kq(NB_COEFF_KQ, cq, sq, tq, uq, vq, AE_A0, Z)
 {
     commands.push_back("P/D");
     if ((Z<2) or (Z>7))
@@ -84,12 +94,6 @@ void WageningenControlledForceModel::check(const double P_D, const double J) con
     }
 }
 
-double saturate(const double J);
-double saturate(const double J)
-{
-    return std::max(std::min(J,1.5),0.);
-}
-
 double WageningenControlledForceModel::Kt(const size_t Z, const double AE_A0_, const double P_D, const double J) const
 {
     check(P_D, J);
@@ -30,10 +30,10 @@ class WageningenControlledForceModel : public AbstractWageningen
         };
 
         WageningenControlledForceModel(const Yaml& input, const std::string& body_name, const EnvironmentAndFrames& env);
-        double get_Kt(const std::map<std::string,double>& commands, const double J) const;
-        double get_Kq(const std::map<std::string,double>& commands, const double J) const;
-        double Kt(const size_t Z, const double AE_A0, const double P_D, const double J) const;
-        double Kq(const size_t Z, const double AE_A0, const double P_D, const double J) const;
+        double get_Kt(const std::map<std::string,double>& commands, const double J) const; //!< Uses the polynomial in J precomputed for the propeller's Z & AE/A0
+        double get_Kq(const std::map<std::string,double>& commands, const double J) const; //!< Uses the polynomial in J precomputed for the propeller's Z & AE/A0
+        double Kt(const size_t Z, const double AE_A0, const double P_D, const double J) const; //!< Sum of the series, for any Z & AE/A0
+        double Kq(const size_t Z, const double AE_A0, const double P_D, const double J) const; //!< Sum of the series, for any Z & AE/A0
         static std::string model_name();
         static Yaml parse(const std::string& yaml);
 
@@ -54,6 +54,9 @@ class WageningenControlledForceModel : public AbstractWageningen
         const size_t tq[NB_COEFF_KQ]; //!< Exponents for P/D for Kq for the Wageningen B-series
         const size_t uq[NB_COEFF_KQ]; //!< Exponents for the blade area ratio for Kq for the Wageningen B-series
         const size_t vq[NB_COEFF_KQ]; //!< Exponents for number of blades for Kq for the Wageningen B-series
+
+        const WageningenPolynomial kt; //!< Kt for Z & AE_A0
+        const WageningenPolynomial kq; //!< Kq for Z & AE_A0
 };
 
 #endif /* WAGENINGENCONTROLLEDFORCEMODEL_HPP_ */
@@ -0,0 +1,51 @@
+/*
+ * WageningenPolynomial.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WageningenPolynomial.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+double horner(const std::vector<double>& coefficients, const double x);
+double horner(const std::vector<double>& coefficients, const double x)
+{
+    double ret = 0;
+    for (auto it = coefficients.rbegin() ; it != coefficients.rend() ; ++it) ret = ret*x + *it;
+    return ret;
+}
+
+WageningenPolynomial::WageningenPolynomial(const size_t nb_of_terms, const double* c, const size_t* s, const size_t* t, const size_t* u, const size_t* v, const double AE_A0, const size_t Z) :
+    coefficients(),
+    P_D_of_coefficients_in_J(std::nan("")),
+    coefficients_in_J()
+{
+    const size_t max_s = nb_of_terms ? *std::max_element(s, s+nb_of_terms) : 0;
+    const size_t max_t = nb_of_terms ? *std::max_element(t, t+nb_of_terms) : 0;
+    coefficients.resize(max_s+1, std::vector<double>(max_t+1, 0));
+    for (size_t i = 0 ; i < nb_of_terms ; ++i)
+    {
+        coefficients[s[i]][t[i]] += c[i]*std::pow(AE_A0, u[i])*std::pow(Z, v[i]);
+    }
+    coefficients_in_J.resize(max_s+1, 0);
+}
+
+void WageningenPolynomial::collapse(const double P_D) const
+{
+    for (size_t k = 0 ; k < coefficients.size() ; ++k) coefficients_in_J[k] = horner(coefficients[k], P_D);
+    P_D_of_coefficients_in_J = P_D;
+}
+
+double WageningenPolynomial::operator()(const double P_D, const double J) const
+{
+    if (P_D != P_D_of_coefficients_in_J) collapse(P_D);
+    return horner(coefficients_in_J, J);
+}
+
+std::vector<double> WageningenPolynomial::get_coefficients_in_J(const double P_D) const
+{
+    if (P_D != P_D_of_coefficients_in_J) collapse(P_D);
+    return coefficients_in_J;
+}
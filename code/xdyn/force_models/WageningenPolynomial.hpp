@@ -0,0 +1,53 @@
+/*
+ * WageningenPolynomial.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAGENINGENPOLYNOMIAL_HPP_
+#define WAGENINGENPOLYNOMIAL_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/** \brief Kt or Kq of a propeller of the Wageningen B-series, as a polynomial in the advance ratio J
+ *  \details The series sum c[i]*J^s[i]*(P/D)^t[i]*(AE/A0)^u[i]*Z^v[i] is collapsed at construction
+ *           (Z & AE/A0 being fixed) into a polynomial in J & P/D. Its coefficients in J are computed
+ *           (using Horner's scheme in P/D) when P/D changes & the polynomial in J is then
+ *           evaluated with Horner's scheme, so no std::pow is needed after construction.
+ *           Not thread-safe (the coefficients in J are cached), but each force model is only evaluated
+ *           by the thread computing its body.
+ *  \addtogroup force_models
+ *  \ingroup force_models
+ *  \section ex1 Example
+ *  \snippet force_models/unit_tests/WageningenControlledForceModelTest.cpp WageningenControlledForceModelTest polynomial_example
+ */
+class WageningenPolynomial
+{
+    public:
+        WageningenPolynomial(const size_t nb_of_terms,
+                             const double* c,   //!< Coefficients of the series (nb_of_terms values)
+                             const size_t* s,   //!< Exponents of J (nb_of_terms values)
+                             const size_t* t,   //!< Exponents of P/D (nb_of_terms values)
+                             const size_t* u,   //!< Exponents of AE/A0 (nb_of_terms values)
+                             const size_t* v,   //!< Exponents of Z (nb_of_terms values)
+                             const double AE_A0,//!< Blade area ratio
+                             const size_t Z     //!< Number of blades
+                             );
+
+        double operator()(const double P_D, const double J) const;
+
+        /**  \brief Coefficients of the polynomial in J for a given P/D (the coefficient of J^k being at index k)
+          */
+        std::vector<double> get_coefficients_in_J(const double P_D) const;
+
+    private:
+        WageningenPolynomial();
+        void collapse(const double P_D) const;
+
+        std::vector<std::vector<double> > coefficients;     //!< coefficients[k][l] is the coefficient of J^k*(P/D)^l
+        mutable double P_D_of_coefficients_in_J;            //!< P/D for which 'coefficients_in_J' were computed (NaN initially)
+        mutable std::vector<double> coefficients_in_J;      //!< coefficients_in_J[k] is the coefficient of J^k for P_D_of_coefficients_in_J
+};
+
+#endif /* WAGENINGENPOLYNOMIAL_HPP_ */
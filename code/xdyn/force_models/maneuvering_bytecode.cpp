@@ -0,0 +1,228 @@
+/*
+ * maneuvering_bytecode.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "maneuvering_bytecode.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace maneuvering;
+
+bool is_state(const Opcode op);
+bool is_state(const Opcode op)
+{
+    return op >= Opcode::X;
+}
+
+bool is_unary(const Opcode op);
+bool is_unary(const Opcode op)
+{
+    return op >= Opcode::COS;
+}
+
+bool is_commutative(const Opcode op);
+bool is_commutative(const Opcode op)
+{
+    return (op == Opcode::ADD) or (op == Opcode::MUL);
+}
+
+double apply(const Opcode op, const double lhs, const double rhs);
+double apply(const Opcode op, const double lhs, const double rhs)
+{
+    switch(op)
+    {
+        case Opcode::ADD:   return lhs + rhs;
+        case Opcode::SUB:   return lhs - rhs;
+        case Opcode::MUL:   return lhs * rhs;
+        case Opcode::DIV:   return lhs / rhs;
+        case Opcode::POW:   return std::pow(lhs, rhs);
+        case Opcode::COS:   return std::cos(lhs);
+        case Opcode::SIN:   return std::sin(lhs);
+        case Opcode::EXP:   return std::exp(lhs);
+        case Opcode::ABS:   return std::abs(lhs);
+        case Opcode::LOG:   return std::log(lhs);
+        case Opcode::SQRT:  return std::sqrt(lhs);
+        default:            break;
+    }
+    THROW(__PRETTY_FUNCTION__, InternalErrorException, "The states cannot be evaluated without the history of the body");
+    return std::nan("");
+}
+
+Instruction::Instruction(const Opcode op_, const size_t out_, const size_t lhs_, const size_t rhs_) :
+    op(op_),
+    out(out_),
+    lhs(lhs_),
+    rhs(rhs_)
+{
+}
+
+Program::Program(const YamlRotation& rot_) :
+    rot(rot_),
+    registers(),
+    register_is_constant(),
+    instructions(),
+    constants(),
+    emitted(),
+    input_names(),
+    input_registers(),
+    output_names(),
+    output_registers(),
+    time_register(0)
+{
+    time_register = new_register(0);
+}
+
+size_t Program::new_register(const double initial_value)
+{
+    registers.push_back(initial_value);
+    register_is_constant.push_back(false);
+    return registers.size() - 1;
+}
+
+bool Program::is_constant(const size_t reg) const
+{
+    return register_is_constant.at(reg);
+}
+
+size_t Program::constant(const double val)
+{
+    // NaN is not ordered & -0 compares equal to 0, so they are never shared
+    const bool can_be_shared = not(std::isnan(val)) and not((val == 0) and std::signbit(val));
+    if (can_be_shared)
+    {
+        const auto it = constants.find(val);
+        if (it != constants.end()) return it->second;
+    }
+    const size_t reg = new_register(val);
+    register_is_constant[reg] = true;
+    if (can_be_shared) constants[val] = reg;
+    return reg;
+}
+
+size_t Program::input(const std::string& name)
+{
+    const auto it = std::find(input_names.begin(), input_names.end(), name);
+    if (it != input_names.end()) return input_registers[(size_t)(it - input_names.begin())];
+    input_names.push_back(name);
+    input_registers.push_back(new_register(0));
+    return input_registers.back();
+}
+
+size_t Program::time() const
+{
+    return time_register;
+}
+
+size_t Program::emit(const Opcode op, size_t lhs, size_t rhs)
+{
+    if ((lhs >= registers.size()) or (rhs >= registers.size()))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Invalid register: the program only has " << registers.size() << " registers.");
+    }
+    if (is_unary(op))                           rhs = 0;
+    if (is_commutative(op) and (rhs < lhs))     std::swap(lhs, rhs);
+    const auto key = std::make_tuple(op, lhs, rhs);
+    const auto it = emitted.find(key);
+    if (it != emitted.end()) return it->second;
+    const bool operands_are_constant = is_constant(lhs) and (is_unary(op) or is_constant(rhs));
+    size_t reg = 0;
+    if (not(is_state(op)) and operands_are_constant)
+    {
+        reg = constant(apply(op, registers[lhs], registers[rhs]));
+    }
+    else
+    {
+        reg = new_register(0);
+        instructions.push_back(Instruction(op, reg, lhs, rhs));
+    }
+    emitted[key] = reg;
+    return reg;
+}
+
+void Program::set_output(const std::string& name, const size_t reg)
+{
+    output_names.push_back(name);
+    output_registers.push_back(reg);
+}
+
+std::vector<std::string> Program::get_inputs() const
+{
+    return input_names;
+}
+
+std::vector<std::string> Program::get_outputs() const
+{
+    return output_names;
+}
+
+size_t Program::get_nb_of_instructions() const
+{
+    return instructions.size();
+}
+
+void Program::set_input(const size_t input_index, const double val)
+{
+    registers[input_registers.at(input_index)] = val;
+}
+
+double Program::execute(const Instruction& i, const BodyStates& states, const double t) const
+{
+    const double lhs = registers[i.lhs];
+    switch(i.op)
+    {
+        case Opcode::X:     return states.x(t-lhs);
+        case Opcode::Y:     return states.y(t-lhs);
+        case Opcode::Z:     return states.z(t-lhs);
+        case Opcode::U:     return states.u(t-lhs);
+        case Opcode::V:     return states.v(t-lhs);
+        case Opcode::W:     return states.w(t-lhs);
+        case Opcode::P:     return states.p(t-lhs);
+        case Opcode::Q:     return states.q(t-lhs);
+        case Opcode::R:     return states.r(t-lhs);
+        case Opcode::QR:    return states.qr(t-lhs);
+        case Opcode::QI:    return states.qi(t-lhs);
+        case Opcode::QJ:    return states.qj(t-lhs);
+        case Opcode::QK:    return states.qk(t-lhs);
+        case Opcode::PHI:
+        case Opcode::THETA:
+        case Opcode::PSI:
+        {
+            const ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(states.qr(t-lhs),states.qi(t-lhs),states.qj(t-lhs),states.qk(t-lhs)).matrix();
+            const ssc::kinematics::EulerAngles angles = BodyStates::convert(R, rot);
+            if (i.op == Opcode::PHI)   return angles.phi;
+            if (i.op == Opcode::THETA) return angles.theta;
+                                       return angles.psi;
+        }
+        default:
+            break;
+    }
+    return apply(i.op, lhs, registers[i.rhs]);
+}
+
+void Program::run(const BodyStates& states, const double t)
+{
+    registers[time_register] = t;
+    for (const auto& instruction:instructions)
+    {
+        registers[instruction.out] = execute(instruction, states, t);
+    }
+}
+
+double Program::get_output(const size_t output_index) const
+{
+    return registers[output_registers.at(output_index)];
+}
+
+double Program::get_output(const std::string& name) const
+{
+    const auto it = std::find(output_names.begin(), output_names.end(), name);
+    if (it == output_names.end())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unknown output '" << name << "'");
+    }
+    return get_output((size_t)(it - output_names.begin()));
+}
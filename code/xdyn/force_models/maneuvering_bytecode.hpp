@@ -0,0 +1,83 @@
+/*
+ * maneuvering_bytecode.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef MANEUVERING_BYTECODE_HPP_
+#define MANEUVERING_BYTECODE_HPP_
+
+#include "xdyn/core/BodyStates.hpp"
+#include "xdyn/external_data_structures/YamlRotation.hpp"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace maneuvering
+{
+    enum class Opcode {ADD, SUB, MUL, DIV, POW, COS, SIN, EXP, ABS, LOG, SQRT,
+                       X, Y, Z, U, V, W, P, Q, R, QR, QI, QJ, QK, PHI, THETA, PSI};
+
+    struct Instruction
+    {
+        Instruction(const Opcode op, const size_t out, const size_t lhs, const size_t rhs);
+        Opcode op;
+        size_t out; //!< Register written by the instruction
+        size_t lhs; //!< First operand (for the states, the register containing their argument)
+        size_t rhs; //!< Second operand (only used by binary operators)
+    };
+
+    /** \brief Register-based bytecode evaluating several maneuvering expressions at once
+     *  \details Built by maneuvering::compile_program: the constants, inputs (environment constants & commands)
+     *           & time each have a register, and each instruction writes its own register. Identical
+     *           subexpressions (in the same or in different expressions) share the same instruction
+     *           & instructions whose operands are constants are evaluated when they are emitted,
+     *           so 'run' is a single loop over the instructions, without any allocation or name lookup.
+     *  \addtogroup force_models
+     *  \ingroup force_models
+     *  \section ex1 Example
+     *  \snippet force_models/unit_tests/maneuvering_compilerTest.cpp maneuvering_compilerTest compile_program_example
+     */
+    class Program
+    {
+        public:
+            Program(const YamlRotation& rot);
+
+            size_t constant(const double val);                                    //!< Register containing val (shared by all the constants with the same value)
+            size_t input(const std::string& name);                                //!< Register of an input (created if needed)
+            size_t time() const;                                                  //!< Register containing the current instant
+            size_t emit(const Opcode op, const size_t lhs, const size_t rhs = 0); //!< Register containing the result of the instruction (created if needed)
+            void set_output(const std::string& name, const size_t reg);
+
+            std::vector<std::string> get_inputs() const;                          //!< Names of the inputs, indexed like in 'set_input'
+            std::vector<std::string> get_outputs() const;                         //!< Names of the outputs, indexed like in 'get_output'
+            size_t get_nb_of_instructions() const;
+
+            void set_input(const size_t input_index, const double val);
+            void run(const BodyStates& states, const double t);
+            double get_output(const size_t output_index) const;                   //!< Value computed by the last call to 'run'
+            double get_output(const std::string& name) const;                     //!< Slower than get_output(size_t): for tests
+
+        private:
+            Program();
+            size_t new_register(const double initial_value);
+            bool is_constant(const size_t reg) const;
+            double execute(const Instruction& instruction, const BodyStates& states, const double t) const;
+
+            YamlRotation rot;
+            std::vector<double> registers;
+            std::vector<bool> register_is_constant;
+            std::vector<Instruction> instructions;
+            std::map<double, size_t> constants;                                   //!< Register of each constant
+            std::map<std::tuple<Opcode,size_t,size_t>, size_t> emitted;           //!< Register of each instruction, to share common subexpressions
+            std::vector<std::string> input_names;
+            std::vector<size_t> input_registers;
+            std::vector<std::string> output_names;
+            std::vector<size_t> output_registers;
+            size_t time_register;
+    };
+}
+
+#endif /* MANEUVERING_BYTECODE_HPP_ */
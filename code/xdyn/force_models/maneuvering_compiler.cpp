@@ -9,6 +9,9 @@
 #include "maneuvering_compiler.hpp"
 #include "ManeuveringInternal.hpp"
 #include "maneuvering_grammar.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
+
+#include <set>
 
 using namespace maneuvering;
 using boost::spirit::ascii::blank;
@@ -164,24 +167,134 @@ namespace maneuvering
             YamlRotation rot;
     };
 
-    NodePtr compile(const std::string& expression, const YamlRotation& rot)
+    Expr parse(const std::string& expression);
+    Expr parse(const std::string& expression)
     {
         std::string::const_iterator b = expression.begin(), e = expression.end();
         Expr ast;
         ArithmeticGrammar g;
         qi::phrase_parse(b, e, g.expr, blank, ast);
+        return ast;
+    }
+
+    class BytecodeGenerator: public boost::static_visitor<size_t>
+    {
+        public:
+            BytecodeGenerator(Program& program_, const std::map<std::string, std::string>& var2expr_) :
+                program(program_),
+                var2expr(var2expr_),
+                registers_of_variables(),
+                variables_being_compiled()
+            {
+            }
+
+            size_t compile_variable(const std::string& name)
+            {
+                const auto compiled = registers_of_variables.find(name);
+                if (compiled != registers_of_variables.end()) return compiled->second;
+                const auto var = var2expr.find(name);
+                if (var == var2expr.end()) return program.input(name);
+                if (variables_being_compiled.count(name))
+                {
+                    THROW(__PRETTY_FUNCTION__, InvalidInputException, "Circular definition of '" << name << "' in maneuvering model: its expression ('" << var->second << "') depends on itself.");
+                }
+                variables_being_compiled.insert(name);
+                const size_t reg = this->operator()(parse(var->second));
+                variables_being_compiled.erase(name);
+                registers_of_variables[name] = reg;
+                return reg;
+            }
+
+            size_t operator()(const Nil& )
+            {
+                return program.constant(std::nan(""));
+            }
+            size_t operator()(const double& d)
+            {
+                return program.constant(d);
+            }
+            size_t operator()(const Identifier& name)
+            {
+                if (name == "t") return program.time();
+                                 return compile_variable(name);
+            }
+            size_t operator()(const Base& d)
+            {
+                return boost::apply_visitor(*this,d);
+            }
+            size_t operator()(const Factor& d)
+            {
+                size_t ret = this->operator ()(d.base);
+                for (auto e:d.exponents) ret = program.emit(Opcode::POW, ret, this->operator()(e));
+                return ret;
+            }
+            size_t operator()(const ::Term& d)
+            {
+                size_t ret = this->operator ()(d.first);
+                for (auto op:d.rest) ret = emit(op.operator_, ret, this->operator()(op.factor));
+                return ret;
+            }
+            size_t operator()(const ::Expr& d)
+            {
+                size_t ret = this->operator ()(d.first);
+                for (auto op:d.rest) ret = emit(op.operator_, ret, this->operator()(op.term));
+                return ret;
+            }
+            size_t operator()(const Atom& d)
+            {
+                return boost::apply_visitor(*this,d);
+            }
+            size_t operator()(const FunctionCall& d)
+            {
+                const auto function = functions().find(d.function);
+                if (function == functions().end()) return compile_variable(PrettyPrinter()(d));
+                return program.emit(function->second, this->operator()(d.expr));
+            }
+
+        private:
+            BytecodeGenerator();
+            size_t emit(const std::string& operator_, const size_t lhs, const size_t rhs)
+            {
+                if (operator_ == "-") return program.emit(Opcode::SUB, lhs, rhs);
+                if (operator_ == "+") return program.emit(Opcode::ADD, lhs, rhs);
+                if (operator_ == "*") return program.emit(Opcode::MUL, lhs, rhs);
+                                      return program.emit(Opcode::DIV, lhs, rhs);
+            }
+            static const std::map<std::string, Opcode>& functions()
+            {
+                static const std::map<std::string, Opcode> ret = {
+                    {"cos", Opcode::COS}, {"sin", Opcode::SIN}, {"exp", Opcode::EXP}, {"abs", Opcode::ABS},
+                    {"log", Opcode::LOG}, {"sqrt", Opcode::SQRT},
+                    {"x", Opcode::X}, {"y", Opcode::Y}, {"z", Opcode::Z}, {"u", Opcode::U}, {"v", Opcode::V},
+                    {"w", Opcode::W}, {"p", Opcode::P}, {"q", Opcode::Q}, {"r", Opcode::R},
+                    {"phi", Opcode::PHI}, {"theta", Opcode::THETA}, {"psi", Opcode::PSI},
+                    {"qr", Opcode::QR}, {"qi", Opcode::QI}, {"qj", Opcode::QJ}, {"qk", Opcode::QK}};
+                return ret;
+            }
+            Program& program;
+            const std::map<std::string, std::string>& var2expr;
+            std::map<std::string, size_t> registers_of_variables;
+            std::set<std::string> variables_being_compiled;
+    };
+
+    NodePtr compile(const std::string& expression, const YamlRotation& rot)
+    {
         Evaluator evaluate(rot);
-        return evaluate(ast);
+        return evaluate(parse(expression));
+    }
+
+    Program compile_program(const std::map<std::string, std::string>& var2expr, const std::vector<std::string>& outputs, const YamlRotation& rot)
+    {
+        Program program(rot);
+        BytecodeGenerator generate(program, var2expr);
+        for (const auto& output:outputs) program.set_output(output, generate.compile_variable(output));
+        return program;
     }
 
     std::string print(const std::string& expression)
     {
-        std::string::const_iterator b = expression.begin(), e = expression.end();
-        Expr ast;
-        ArithmeticGrammar g;
-        qi::phrase_parse(b, e, g.expr, blank, ast);
         PrettyPrinter pretty_print;
-        return pretty_print(ast);
+        return pretty_print(parse(expression));
     }
 
     double get_Tmax(const NodePtr& node)
@@ -10,10 +10,24 @@
 #define MANEUVERING_COMPILER_HPP_
 
 #include "ManeuveringInternal.hpp"
+#include "maneuvering_bytecode.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
 
 namespace maneuvering
 {
     NodePtr compile(const std::string& expression, const YamlRotation& rot);
+
+    /**  \brief Lowers the expressions of the outputs (& of the variables they use) into a single Program
+      *  \details The identifiers which are neither 't' nor a key of var2expr are inputs of the Program.
+      *           Throws an InvalidInputException if a variable depends on itself.
+      */
+    Program compile_program(const std::map<std::string, std::string>& var2expr, //!< Expression of each variable (eg. "X" -> "0.5*rho*Vs^2*L^2*X_")
+                            const std::vector<std::string>& outputs,            //!< Variables computed by the Program (eg. "X", "Y", "Z", "K", "M", "N")
+                            const YamlRotation& rot                             //!< Rotation convention, for phi, theta & psi
+                            );
     std::string print(const std::string& expression);
     double get_Tmax(const NodePtr& node);
 }
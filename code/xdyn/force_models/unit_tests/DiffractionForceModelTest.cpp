@@ -297,3 +297,44 @@ TEST_F(DiffractionForceModelTest, precal_r_example)
     ASSERT_NEAR(-F.M(), 0.977144E+05 * 1e3 * sin(- (138.608902) * M_PI / 180.), small_relative_error(F.M()));
     ASSERT_NEAR(-F.N(), 0.108441E+06 * 1e3 * sin(- (59.445541) * M_PI / 180.), small_relative_error(F.N()));
 }
+
+TEST_F(DiffractionForceModelTest, ray_tables_should_give_the_same_forces_as_the_interpolation_of_each_ray)
+{
+    {
+        std::ofstream hdb_file("data.hdb");
+        hdb_file << test_data::bug_3210();
+    }
+    //! [DiffractionForceModelTest ray_tables_example]
+    EnvironmentAndFrames env = get_waves_env(64., 0.);
+    const std::vector<WaveModelPtr> models = {get_wave_model(10., 0.), get_wave_model(64., 5.*M_PI/180, 2.), get_wave_model(90., -3.*M_PI/180, 0.5)};
+    env.w = SurfaceElevationPtr(new SurfaceElevationFromWaves(models));
+    YamlRAO input;
+    input.calculation_point = YamlCoordinates(0.696, 0, 1.418);
+    input.hdb_filename = "data.hdb";
+    input.mirror = true;
+    // Without the encounter period correction, the RAO of each ray is tabulated against the incidence
+    input.use_encounter_period = false;
+    const DiffractionForceModel with_ray_tables(input, BODY_NAME, env);
+    // At zero speed, the encounter period is the wave period, but the RAO is interpolated for each ray at each time step
+    input.use_encounter_period = true;
+    const DiffractionForceModel without_ray_tables(input, BODY_NAME, env);
+    //! [DiffractionForceModelTest ray_tables_example]
+    // The database only covers incidences between -30° & 30°
+    for (const double psi:{-24., -10., 0., 12., 24.})
+    {
+        BodyStates states = get_states_with_forward_speed(0.);
+        states.qr.record(0, cos(psi*M_PI/360));
+        states.qk.record(0, sin(psi*M_PI/360));
+        for (const double t:{0., 3.7, 21.})
+        {
+            const auto F = with_ray_tables.get_force(states, t, env, {});
+            const auto F_ref = without_ray_tables.get_force(states, t, env, {});
+            ASSERT_NEAR(F_ref.X(), F.X(), 1E-6*std::abs(F_ref.X()) + 1E-6) << "psi = " << psi << "°, t = " << t;
+            ASSERT_NEAR(F_ref.Y(), F.Y(), 1E-6*std::abs(F_ref.Y()) + 1E-6) << "psi = " << psi << "°, t = " << t;
+            ASSERT_NEAR(F_ref.Z(), F.Z(), 1E-6*std::abs(F_ref.Z()) + 1E-6) << "psi = " << psi << "°, t = " << t;
+            ASSERT_NEAR(F_ref.K(), F.K(), 1E-6*std::abs(F_ref.K()) + 1E-6) << "psi = " << psi << "°, t = " << t;
+            ASSERT_NEAR(F_ref.M(), F.M(), 1E-6*std::abs(F_ref.M()) + 1E-6) << "psi = " << psi << "°, t = " << t;
+            ASSERT_NEAR(F_ref.N(), F.N(), 1E-6*std::abs(F_ref.N()) + 1E-6) << "psi = " << psi << "°, t = " << t;
+        }
+    }
+}
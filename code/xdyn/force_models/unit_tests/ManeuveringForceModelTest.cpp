@@ -9,6 +9,7 @@
 #include "ManeuveringInternal.hpp"
 #include "xdyn/core/EnvironmentAndFrames.hpp"
 #include "xdyn/core/unit_tests/generate_body_for_tests.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
 #include "xdyn/test_data_generator/yaml_data.hpp"
 #include "gmock/gmock.h"
 
@@ -682,3 +683,42 @@ TEST_F(ManeuveringForceModelTest, can_get_Tmax)
     ManeuveringForceModel force(data,"ball", env);
     ASSERT_DOUBLE_EQ(10, force.get_Tmax());
 }
+
+TEST_F(ManeuveringForceModelTest, commands_are_found_even_if_the_map_of_commands_changes)
+{
+    const std::string yaml = "reference frame:\n"
+                             "    frame: some body\n"
+                             "    x: {value: 0, unit: m}\n"
+                             "    y: {value: 0, unit: m}\n"
+                             "    z: {value: 0, unit: m}\n"
+                             "    phi: {value: 0, unit: rad}\n"
+                             "    theta: {value: 0, unit: deg}\n"
+                             "    psi: {value: 0, unit: deg}\n"
+                             "name: something\n"
+                             "commands: [beta, alpha]\n"
+                             "X: 2*alpha\n"
+                             "Y: 3*beta\n"
+                             "Z: rho*alpha\n"
+                             "K: 0\n"
+                             "M: 0\n"
+                             "N: 0\n";
+    const auto env = get_env_with_default_rotation_convention();
+    const ManeuveringForceModel force(ManeuveringForceModel::parse(yaml), "some body", env);
+    const auto states = get_body("some body")->get_states();
+    const auto F1 = force.get_force(states, 0, env, {{"alpha", 1}, {"beta", 2}, {"t", 0}});
+    ASSERT_DOUBLE_EQ(2, F1.X());
+    ASSERT_DOUBLE_EQ(6, F1.Y());
+    ASSERT_DOUBLE_EQ(1024, F1.Z());
+    const auto F2 = force.get_force(states, 0, env, {{"alpha", 3}, {"beta", 4}, {"t", 0}});
+    ASSERT_DOUBLE_EQ(6, F2.X());
+    ASSERT_DOUBLE_EQ(12, F2.Y());
+    // Other values of the DataSource, before & between the commands
+    const auto F3 = force.get_force(states, 0, env, {{"a", 10}, {"alpha", 5}, {"b", 20}, {"beta", 6}, {"t", 0}});
+    ASSERT_DOUBLE_EQ(10, F3.X());
+    ASSERT_DOUBLE_EQ(18, F3.Y());
+    // Same size as the previous map, but the commands are not at the same positions
+    const auto F4 = force.get_force(states, 0, env, {{"alpha", 7}, {"b", 20}, {"beta", 8}, {"c", 30}, {"t", 0}});
+    ASSERT_DOUBLE_EQ(14, F4.X());
+    ASSERT_DOUBLE_EQ(24, F4.Y());
+    ASSERT_THROW(force.get_force(states, 0, env, {{"alpha", 7}, {"t", 0}}), InvalidInputException);
+}
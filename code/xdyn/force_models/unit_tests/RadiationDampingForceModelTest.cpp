@@ -163,6 +163,58 @@ TEST_F(RadiationDampingForceModelTest, example)
 //! [RadiationDampingForceModelTest expected output]
 }
 
+TEST_F(RadiationDampingForceModelTest, state_space_approximation_should_match_analytical_results)
+{
+    const auto yaml = get_yaml_data(false);
+    RadiationDampingForceModel::Input input;
+    input.parser = get_hdb_data(yaml);
+    input.yaml = yaml;
+    input.yaml.use_state_space_approximation = true;
+    const EnvironmentAndFrames env;
+    const std::string body_name = a.random<std::string>();
+    RadiationDampingForceModel F(input, body_name, env);
+    BodyStates states(100);
+    states.name = body_name;
+    const double T = 10.0;
+    const double tend = record_sine(states, 0, T, 10, 100);
+    const auto K = test_data::analytical_K;
+    std::function<double(double)> g = [K, T](double t){return K(t)*sin(-2*PI*t/T);};
+    const double Fexpected = -ssc::integrate::ClenshawCurtisCosine(g,0).integrate_f(yaml.tau_min,yaml.tau_max);
+
+    const auto Frad = F.get_force(states, tend, env, {});
+    ASSERT_SMALL_RELATIVE_ERROR(Fexpected, Frad.X(), EPS);
+    ASSERT_SMALL_RELATIVE_ERROR(Fexpected, Frad.Y(), EPS);
+    ASSERT_SMALL_RELATIVE_ERROR(Fexpected, Frad.Z(), EPS);
+    ASSERT_SMALL_RELATIVE_ERROR(Fexpected, Frad.K(), EPS);
+    ASSERT_SMALL_RELATIVE_ERROR(Fexpected, Frad.M(), EPS);
+    ASSERT_SMALL_RELATIVE_ERROR(Fexpected, Frad.N(), EPS);
+}
+
+TEST_F(RadiationDampingForceModelTest, state_space_approximation_should_give_the_same_results_when_called_at_each_time_step)
+{
+    const auto yaml = get_yaml_data(false);
+    RadiationDampingForceModel::Input input;
+    input.parser = get_hdb_data(yaml);
+    input.yaml = yaml;
+    input.yaml.use_state_space_approximation = true;
+    const EnvironmentAndFrames env;
+    const std::string body_name = a.random<std::string>();
+    RadiationDampingForceModel F_at_each_step(input, body_name, env);
+    RadiationDampingForceModel F_at_the_end(input, body_name, env);
+    BodyStates states(100);
+    states.name = body_name;
+    for (size_t i = 0 ; i <= 200 ; ++i)
+    {
+        const double t = 0.5*(double)i;
+        record(states, t, sin(0.7*t) + 0.2*cos(2.3*t));
+        F_at_each_step.get_force(states, t, env, {});
+    }
+    const auto F1 = F_at_each_step.get_force(states, 100, env, {});
+    const auto F2 = F_at_the_end.get_force(states, 100, env, {});
+    ASSERT_SMALL_RELATIVE_ERROR(F2.X(), F1.X(), 1E-6);
+    ASSERT_SMALL_RELATIVE_ERROR(F2.N(), F1.N(), 1E-6);
+}
+
 TEST_F(RadiationDampingForceModelTest, results_are_zero_for_constant_velocity)
 {
     const auto yaml = get_yaml_data(false);
@@ -404,6 +456,35 @@ TEST_F(RadiationDampingForceModelTest, precal_r_filename_is_read_properly)
     ASSERT_EQ("test_ship.ini", RadiationDampingForceModel::parse(valid_yaml,false).yaml.precal_r_filename);
 }
 
+TEST_F(RadiationDampingForceModelTest, can_parse_state_space_approximation_parameters)
+{
+    const std::string yaml = "model: radiation damping\n"
+                             "hdb: test_ship.hdb\n"
+                             "type of quadrature for cos transform: simpson\n"
+                             "type of quadrature for convolution: clenshaw-curtis\n"
+                             "nb of points for retardation function discretization: 50\n"
+                             "omega min: {value: 0, unit: rad/s}\n"
+                             "omega max: {value: 30, unit: rad/s}\n"
+                             "tau min: {value: 0.2094395, unit: s}\n"
+                             "tau max: {value: 10, unit: s}\n"
+                             "output Br and K: false\n"
+                             "use state space approximation: true\n"
+                             "max nb of exponentials per retardation function: 6\n"
+                             "output state space approximation fidelity: true\n"
+                             "calculation point in body frame:\n"
+                             "    x: {value: 0.696, unit: m}\n"
+                             "    y: {value: 0, unit: m}\n"
+                             "    z: {value: 1.418, unit: m}\n";
+    const YamlRadiationDamping r = RadiationDampingForceModel::parse(yaml,false).yaml;
+    ASSERT_TRUE(r.use_state_space_approximation);
+    ASSERT_EQ(6, r.max_nb_of_exponentials);
+    ASSERT_TRUE(r.output_state_space_fidelity);
+    const YamlRadiationDamping default_values = RadiationDampingForceModel::parse(test_data::radiation_damping(),false).yaml;
+    ASSERT_FALSE(default_values.use_state_space_approximation);
+    ASSERT_EQ(10, default_values.max_nb_of_exponentials);
+    ASSERT_FALSE(default_values.output_state_space_fidelity);
+}
+
 TEST_F(RadiationDampingForceModelTest, can_use_data_from_precal_r)
 {
     const std::string yaml = "model: radiation damping\n"
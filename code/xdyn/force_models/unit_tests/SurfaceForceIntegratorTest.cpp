@@ -0,0 +1,145 @@
+/*
+ * SurfaceForceIntegratorTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "SurfaceForceIntegratorTest.hpp"
+#include "ExactHydrostaticForceModel.hpp"
+#include "FastHydrostaticForceModel.hpp"
+#include "FroudeKrylovForceModel.hpp"
+#include "env_for_tests.hpp"
+#include "xdyn/core/BodyWithSurfaceForces.hpp"
+#include "xdyn/core/SurfaceForceIntegrator.hpp"
+#include "xdyn/core/unit_tests/generate_body_for_tests.hpp"
+#include "xdyn/environment_models/Airy.hpp"
+#include "xdyn/environment_models/BretschneiderSpectrum.hpp"
+#include "xdyn/environment_models/Cos2sDirectionalSpreading.hpp"
+#include "xdyn/environment_models/discretize.hpp"
+#include "xdyn/environment_models/Stretching.hpp"
+#include "xdyn/external_data_structures/YamlWaveModelInput.hpp"
+#include "xdyn/test_data_generator/TriMeshTestData.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#include <stdexcept>
+#define PI M_PI
+
+SurfaceForceIntegratorTest::SurfaceForceIntegratorTest() : a(ssc::random_data_generator::DataGenerator(2026))
+{
+}
+
+SurfaceForceIntegratorTest::~SurfaceForceIntegratorTest()
+{
+}
+
+void SurfaceForceIntegratorTest::SetUp()
+{
+}
+
+void SurfaceForceIntegratorTest::TearDown()
+{
+}
+
+TR1(shared_ptr)<WaveModel> SurfaceForceIntegratorTest::get_wave_model() const
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Stretching ss(ys);
+    const DiscreteDirectionalWaveSpectrum A = discretize(BretschneiderSpectrum(2, 6), Cos2sDirectionalSpreading(PI/4, 2), 0.5, 2, 10, 5, ss, false);
+    return TR1(shared_ptr)<WaveModel>(new Airy(A, 1));
+}
+
+TEST_F(SurfaceForceIntegratorTest, example)
+{
+//! [SurfaceForceIntegratorTest example]
+    const EnvironmentAndFrames env = get_environment_and_frames(get_wave_model());
+    BodyStates states = get_body(BODY, cube(4, 0, 0, 0))->get_states();
+    states.G = ssc::kinematics::Point("NED", 0.1, 0.2, 0.3);
+    BodyPtr body(new BodyWithSurfaceForces(states, 0, BlockedDOF(""), YamlFilteredStates()));
+    const ListOfForces forces = {ForcePtr(new FroudeKrylovForceModel(BODY, env)),
+                                 ForcePtr(new ExactHydrostaticForceModel(BODY, env)),
+                                 ForcePtr(new FastHydrostaticForceModel(BODY, env))};
+    SurfaceForceIntegrator integrator(forces);
+    const double t = 3.2;
+    body->update_intersection_with_free_surface(env, t);
+    integrator.integrate(body->get_states(), t, env);
+    // Each model returns the force integrated by SurfaceForceIntegrator
+    const Wrench Ffk = forces[0]->get_force(body->get_states(), t, env, {});
+//! [SurfaceForceIntegratorTest example]
+    ASSERT_EQ(3, integrator.get_nb_of_models());
+    std::vector<Wrench> fused = {Ffk};
+    for (size_t i = 1 ; i < forces.size() ; ++i)
+    {
+        fused.push_back(forces[i]->get_force(body->get_states(), t, env, {}));
+    }
+    // Integrating each model separately should give exactly the same results
+    for (size_t i = 0 ; i < forces.size() ; ++i)
+    {
+        const Wrench F = forces[i]->get_force(body->get_states(), t, env, {});
+        ASSERT_DOUBLE_EQ(F.X(), fused[i].X()) << forces[i]->get_name();
+        ASSERT_DOUBLE_EQ(F.Y(), fused[i].Y()) << forces[i]->get_name();
+        ASSERT_DOUBLE_EQ(F.Z(), fused[i].Z()) << forces[i]->get_name();
+        ASSERT_DOUBLE_EQ(F.K(), fused[i].K()) << forces[i]->get_name();
+        ASSERT_DOUBLE_EQ(F.M(), fused[i].M()) << forces[i]->get_name();
+        ASSERT_DOUBLE_EQ(F.N(), fused[i].N()) << forces[i]->get_name();
+    }
+    ASSERT_NE(0, fused[0].X());
+    ASSERT_NE(0, fused[1].Z());
+}
+
+TEST_F(SurfaceForceIntegratorTest, forces_are_only_used_once)
+{
+    const EnvironmentAndFrames env = get_environment_and_frames(get_wave_model());
+    BodyStates states = get_body(BODY, cube(4, 0, 0, 0))->get_states();
+    BodyPtr body(new BodyWithSurfaceForces(states, 0, BlockedDOF(""), YamlFilteredStates()));
+    const ListOfForces forces = {ForcePtr(new FroudeKrylovForceModel(BODY, env)),
+                                 ForcePtr(new ExactHydrostaticForceModel(BODY, env))};
+    SurfaceForceIntegrator integrator(forces);
+    body->update_intersection_with_free_surface(env, 0);
+    integrator.integrate(body->get_states(), 0, env);
+    integrator.discard_unused_forces();
+    // The force is integrated again, at the new instant
+    body->update_intersection_with_free_surface(env, 2);
+    const Wrench F = forces[0]->get_force(body->get_states(), 2, env, {});
+    integrator.integrate(body->get_states(), 2, env);
+    const Wrench F_fused = forces[0]->get_force(body->get_states(), 2, env, {});
+    ASSERT_DOUBLE_EQ(F.X(), F_fused.X());
+    ASSERT_DOUBLE_EQ(F.M(), F_fused.M());
+}
+
+TEST_F(SurfaceForceIntegratorTest, unused_forces_are_discarded_even_if_an_exception_is_thrown)
+{
+    const EnvironmentAndFrames env = get_environment_and_frames(get_wave_model());
+    BodyStates states = get_body(BODY, cube(4, 0, 0, 0))->get_states();
+    BodyPtr body(new BodyWithSurfaceForces(states, 0, BlockedDOF(""), YamlFilteredStates()));
+    const ListOfForces forces = {ForcePtr(new FroudeKrylovForceModel(BODY, env)),
+                                 ForcePtr(new ExactHydrostaticForceModel(BODY, env))};
+    SurfaceForceIntegrator integrator(forces);
+    body->update_intersection_with_free_surface(env, 0);
+    try
+    {
+        integrator.integrate(body->get_states(), 0, env);
+        const SurfaceForceIntegrator::UnusedForcesDiscarder discard_unused_forces_on_exit(integrator);
+        throw std::runtime_error("eg. a force model which could not be evaluated");
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+    // The force integrated at t = 0 should not be returned at t = 2
+    body->update_intersection_with_free_surface(env, 2);
+    const Wrench F = forces[0]->get_force(body->get_states(), 2, env, {});
+    integrator.integrate(body->get_states(), 2, env);
+    const Wrench F_fused = forces[0]->get_force(body->get_states(), 2, env, {});
+    integrator.discard_unused_forces();
+    ASSERT_DOUBLE_EQ(F.X(), F_fused.X());
+    ASSERT_DOUBLE_EQ(F.M(), F_fused.M());
+}
+
+TEST_F(SurfaceForceIntegratorTest, does_nothing_with_fewer_than_two_surface_force_models)
+{
+    const EnvironmentAndFrames env = get_environment_and_frames(get_wave_model());
+    ASSERT_EQ(0, SurfaceForceIntegrator({ForcePtr(new FroudeKrylovForceModel(BODY, env))}).get_nb_of_models());
+    ASSERT_EQ(0, SurfaceForceIntegrator(ListOfForces()).get_nb_of_models());
+}
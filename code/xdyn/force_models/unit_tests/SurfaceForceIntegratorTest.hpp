@@ -0,0 +1,27 @@
+/*
+ * SurfaceForceIntegratorTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SURFACEFORCEINTEGRATORTEST_HPP_
+#define SURFACEFORCEINTEGRATORTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+#include <ssc/macros.hpp>
+#include "xdyn/environment_models/WaveModel.hpp"
+#include TR1INC(memory)
+
+class SurfaceForceIntegratorTest : public ::testing::Test
+{
+    protected:
+        SurfaceForceIntegratorTest();
+        virtual ~SurfaceForceIntegratorTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        TR1(shared_ptr)<WaveModel> get_wave_model() const;
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* SURFACEFORCEINTEGRATORTEST_HPP_ */
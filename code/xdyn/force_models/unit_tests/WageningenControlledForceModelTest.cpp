@@ -440,3 +440,48 @@ TEST_F(WageningenControlledForceModelTest, bug_2825_can_use_propeller_with_rpm_n
     ASSERT_NEAR(0, w.get_force(states, a.random<double>(), env, commands).M(), EPS);
     ASSERT_NEAR(0, w.get_force(states, a.random<double>(), env, commands).N(), EPS);
 }
+
+TEST_F(WageningenControlledForceModelTest, polynomial_example)
+{
+//! [WageningenControlledForceModelTest polynomial_example]
+    // 1*Z + 2*J*(P/D) + 3*J^2*(AE/A0)
+    const double c[3] = {1, 2, 3};
+    const size_t s[3] = {0, 1, 2};
+    const size_t t[3] = {0, 1, 0};
+    const size_t u[3] = {0, 0, 1};
+    const size_t v[3] = {1, 0, 0};
+    const WageningenPolynomial polynomial(3, c, s, t, u, v, 0.5, 4);
+    const double P_D = 0.8;
+    const double J = 0.3;
+//! [WageningenControlledForceModelTest polynomial_example]
+    ASSERT_DOUBLE_EQ(4 + 2*J*P_D + 3*J*J*0.5, polynomial(P_D, J));
+    const std::vector<double> coefficients = polynomial.get_coefficients_in_J(P_D);
+    ASSERT_EQ(3, coefficients.size());
+    ASSERT_DOUBLE_EQ(4, coefficients[0]);
+    ASSERT_DOUBLE_EQ(2*P_D, coefficients[1]);
+    ASSERT_DOUBLE_EQ(1.5, coefficients[2]);
+    ASSERT_DOUBLE_EQ(4 + 2*J + 1.5*J*J, polynomial(1, J));
+    ASSERT_DOUBLE_EQ(4 + 2*J*P_D + 1.5*J*J, polynomial(P_D, J));
+}
+
+TEST_F(WageningenControlledForceModelTest, precomputed_polynomials_give_the_same_Kt_and_Kq_as_the_series)
+{
+    for (size_t i = 0 ; i < NB_TRIALS ; ++i)
+    {
+        auto input = WageningenControlledForceModel::parse(test_data::wageningen());
+        input.number_of_blades = a.random<size_t>().between(2,7);
+        input.blade_area_ratio = a.random<double>().between(0.3,1.05);
+        const WageningenControlledForceModel w(input, "", get_env());
+        std::map<std::string,double> commands;
+        for (size_t j = 0 ; j < 3 ; ++j)
+        {
+            commands["P/D"] = a.random<double>().between(0.5,1.4);
+            const double J = a.random<double>().between(0,1.5);
+            const double Kt = w.Kt(input.number_of_blades, input.blade_area_ratio, commands["P/D"], J);
+            const double Kq = w.Kq(input.number_of_blades, input.blade_area_ratio, commands["P/D"], J);
+            ASSERT_NEAR(Kt, w.get_Kt(commands, J), 1E-12);
+            ASSERT_NEAR(Kq, w.get_Kq(commands, J), 1E-12);
+        }
+    }
+}
+
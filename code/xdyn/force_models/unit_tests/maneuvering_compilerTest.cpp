@@ -8,6 +8,7 @@
 
 #include "maneuvering_compilerTest.hpp"
 #include "maneuvering_compiler.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
 
 maneuvering_compilerTest::maneuvering_compilerTest() : a(ssc::random_data_generator::DataGenerator(2121545))
 {
@@ -163,3 +164,69 @@ TEST_F(maneuvering_compilerTest, can_get_Tmax)
     EXPECT_DOUBLE_EQ(1E15, maneuvering::get_Tmax(maneuvering::compile("x(t-x(t))", YamlRotation())));
     EXPECT_DOUBLE_EQ(1, maneuvering::get_Tmax(maneuvering::compile("x(t-cos(x(t)))", YamlRotation())));
 }
+
+TEST_F(maneuvering_compilerTest, compile_program_example)
+{
+//! [maneuvering_compilerTest compile_program_example]
+    const std::map<std::string, std::string> var2expr = {{"X", "2*Y+sqrt(x(t))"}, {"Y", "y(t)^2"}, {"Z", "rho*Y"}};
+    maneuvering::Program program = maneuvering::compile_program(var2expr, {"X", "Y", "Z"}, YamlRotation());
+    BodyStates states;
+    states.x.record(0, 16);
+    states.y.record(0, 3);
+    program.set_input(0, 1000); // The only input is rho
+    program.run(states, 0);
+//! [maneuvering_compilerTest compile_program_example]
+    ASSERT_EQ(std::vector<std::string>({"rho"}), program.get_inputs());
+    ASSERT_DOUBLE_EQ(22, program.get_output(0));
+    ASSERT_DOUBLE_EQ(9, program.get_output(1));
+    ASSERT_DOUBLE_EQ(9000, program.get_output(2));
+    ASSERT_DOUBLE_EQ(9000, program.get_output("Z"));
+}
+
+TEST_F(maneuvering_compilerTest, compiled_program_gives_the_same_results_as_the_expressions)
+{
+    BodyStates states(3);
+    states.x.record(-10, 13);
+    states.x.record(0, 23);
+    states.y.record(0, 2);
+    const std::vector<std::string> expressions = {"x(0)", "x(t)", "x(t-3)", "x(t-3)^y(t)", "cos(x(t))*sin(y(t))/exp(2)", "log(abs(-2.5e3))-3"};
+    for (const auto& expression:expressions)
+    {
+        maneuvering::Program program = maneuvering::compile_program({{"out", expression}}, {"out"}, YamlRotation());
+        program.run(states, 0);
+        ASSERT_DOUBLE_EQ(test_compile(expression, states), program.get_output(0)) << expression;
+    }
+}
+
+TEST_F(maneuvering_compilerTest, compiled_program_shares_common_subexpressions)
+{
+    const std::map<std::string, std::string> var2expr = {{"X", "Vs*2+1"}, {"Y", "3*Vs*u(t)"}, {"Vs", "sqrt(u(t)^2+v(t)^2)"}};
+    const maneuvering::Program program = maneuvering::compile_program(var2expr, {"X", "Y"}, YamlRotation());
+    // u, v, u^2, v^2, +, sqrt, *2, +1, 3*Vs, *u
+    ASSERT_EQ(10, program.get_nb_of_instructions());
+}
+
+TEST_F(maneuvering_compilerTest, compiled_program_evaluates_constant_subexpressions_once)
+{
+    const std::map<std::string, std::string> var2expr = {{"X", "0.5*L^2*Xu"}, {"L", "21.569"}, {"Xu", "-0.041"}};
+    maneuvering::Program program = maneuvering::compile_program(var2expr, {"X"}, YamlRotation());
+    ASSERT_EQ(0, program.get_nb_of_instructions());
+    program.run(BodyStates(), 0);
+    ASSERT_DOUBLE_EQ(0.5*21.569*21.569*(-0.041), program.get_output(0));
+}
+
+TEST_F(maneuvering_compilerTest, compiled_program_reads_unknown_identifiers_from_its_inputs)
+{
+    maneuvering::Program program = maneuvering::compile_program({{"X", "a*t+b*a+c"}, {"c", "2"}}, {"X"}, YamlRotation());
+    ASSERT_EQ(std::vector<std::string>({"a","b"}), program.get_inputs());
+    program.set_input(0, 3);
+    program.set_input(1, 5);
+    program.run(BodyStates(), 7);
+    ASSERT_DOUBLE_EQ(3*7+5*3+2, program.get_output(0));
+}
+
+TEST_F(maneuvering_compilerTest, cannot_compile_program_with_circular_definitions)
+{
+    ASSERT_THROW(maneuvering::compile_program({{"X", "2*Y"}, {"Y", "u(t)+X"}}, {"X"}, YamlRotation()), InvalidInputException);
+    ASSERT_THROW(maneuvering::compile_program({{"X", "X"}}, {"X"}, YamlRotation()), InvalidInputException);
+}
@@ -0,0 +1,101 @@
+/*
+ * EulerAnglesHistory.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "EulerAnglesHistory.hpp"
+#include "xdyn/core/BodyStates.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <algorithm> // std::lower_bound
+#include <utility>   // std::swap
+
+EulerAnglesHistory::Points::Points() : t(), qr(), qi(), qj(), qk(), phi(), theta(), psi()
+{
+}
+
+void EulerAnglesHistory::Points::resize(const size_t n)
+{
+    t.resize(n);
+    qr.resize(n);
+    qi.resize(n);
+    qj.resize(n);
+    qk.resize(n);
+    phi.resize(n);
+    theta.resize(n);
+    psi.resize(n);
+}
+
+EulerAnglesHistory::EulerAnglesHistory() : current(), next(), nb_of_conversions(0)
+{
+}
+
+void EulerAnglesHistory::update(const std::vector<double>& t,
+                                const std::vector<double>& qr,
+                                const std::vector<double>& qi,
+                                const std::vector<double>& qj,
+                                const std::vector<double>& qk,
+                                const YamlRotation& rot)
+{
+    const size_t n = t.size();
+    if ((qr.size() != n) or (qi.size() != n) or (qj.size() != n) or (qk.size() != n))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The instants & the components of the quaternions should have the same size: got "
+              << n << " instants & " << qr.size() << ", " << qi.size() << ", " << qj.size() << " & " << qk.size() << " values for qr, qi, qj & qk.");
+    }
+    next.resize(n);
+    nb_of_conversions = 0;
+    // Position, in the points of the previous call, of the oldest instant
+    size_t p = n ? (size_t)(std::lower_bound(current.t.begin(), current.t.end(), t.front()) - current.t.begin()) : 0;
+    for (size_t i = 0 ; i < n ; ++i, ++p)
+    {
+        next.t[i] = t[i];
+        next.qr[i] = qr[i];
+        next.qi[i] = qi[i];
+        next.qj[i] = qj[i];
+        next.qk[i] = qk[i];
+        const bool is_unchanged = (p < current.t.size())
+                              and (current.t[p] == t[i])
+                              and (current.qr[p] == qr[i])
+                              and (current.qi[p] == qi[i])
+                              and (current.qj[p] == qj[i])
+                              and (current.qk[p] == qk[i]);
+        if (is_unchanged)
+        {
+            next.phi[i] = current.phi[p];
+            next.theta[i] = current.theta[p];
+            next.psi[i] = current.psi[p];
+        }
+        else
+        {
+            const ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(qr[i],qi[i],qj[i],qk[i]).matrix();
+            const ssc::kinematics::EulerAngles angles = BodyStates::convert(R, rot);
+            next.phi[i] = angles.phi;
+            next.theta[i] = angles.theta;
+            next.psi[i] = angles.psi;
+            nb_of_conversions++;
+        }
+    }
+    std::swap(current, next);
+}
+
+const std::vector<double>& EulerAnglesHistory::get_phi() const
+{
+    return current.phi;
+}
+
+const std::vector<double>& EulerAnglesHistory::get_theta() const
+{
+    return current.theta;
+}
+
+const std::vector<double>& EulerAnglesHistory::get_psi() const
+{
+    return current.psi;
+}
+
+size_t EulerAnglesHistory::get_nb_of_conversions() const
+{
+    return nb_of_conversions;
+}
@@ -0,0 +1,64 @@
+/*
+ * EulerAnglesHistory.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef GRPC_INC_EULERANGLESHISTORY_HPP_
+#define GRPC_INC_EULERANGLESHISTORY_HPP_
+
+#include "xdyn/external_data_structures/YamlRotation.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/** \brief Euler angles of the state history sent to the gRPC force models, converted incrementally
+ *  \details The whole history (max_history_length seconds) is sent at each evaluation of a gRPC force model,
+ *           but from one evaluation to the next, most points are unchanged: only the points whose instant or
+ *           quaternion differ from the ones of the previous call are converted (usually the latest points).
+ *           The results are exactly the ones of BodyStates::convert. The rotation convention should be
+ *           the same for all calls.
+ *  \addtogroup grpc
+ *  \ingroup grpc
+ *  \section ex1 Example
+ *  \snippet grpc/unit_tests/EulerAnglesHistoryTest.cpp EulerAnglesHistoryTest example
+ */
+class EulerAnglesHistory
+{
+    public:
+        EulerAnglesHistory();
+
+        /**  \brief Converts the quaternions (qr[i],qi[i],qj[i],qk[i]) at the instants t[i] (in increasing order)
+          */
+        void update(const std::vector<double>& t,
+                    const std::vector<double>& qr,
+                    const std::vector<double>& qi,
+                    const std::vector<double>& qj,
+                    const std::vector<double>& qk,
+                    const YamlRotation& rot);
+
+        const std::vector<double>& get_phi() const;
+        const std::vector<double>& get_theta() const;
+        const std::vector<double>& get_psi() const;
+        size_t get_nb_of_conversions() const; //!< Number of points converted by the latest call to 'update'
+
+    private:
+        struct Points
+        {
+            Points();
+            void resize(const size_t n);
+            std::vector<double> t;
+            std::vector<double> qr;
+            std::vector<double> qi;
+            std::vector<double> qj;
+            std::vector<double> qk;
+            std::vector<double> phi;
+            std::vector<double> theta;
+            std::vector<double> psi;
+        };
+        Points current;
+        Points next;     //!< Filled by 'update' then swapped with 'current', so the vectors are only allocated once
+        size_t nb_of_conversions;
+};
+
+#endif /* GRPC_INC_EULERANGLESHISTORY_HPP_ */
@@ -13,6 +13,7 @@
 #include "ToGRPC.hpp"
 #include "FromGRPC.hpp"
 #include "xdyn/core/Body.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
 #include "xdyn/hdb_interpolators/HydroDBParser.hpp"
 
 #include <ssc/macros.hpp>
@@ -22,6 +23,7 @@
 #include "yaml.h"
 
 #include <memory> // std::make_shared
+#include <utility> // std::move
 #include <vector>
 
 template <> std::string get_type_of_service<GRPCForceModel>()
@@ -34,7 +36,8 @@ GRPCForceModel::Input::Input():
     name(),
     yaml(),
     hdb_filename(),
-    precal_filename()
+    precal_filename(),
+    fixed_wave_query_points(false)
 {}
 
 class GRPCForceModel::Impl
@@ -52,10 +55,29 @@ class GRPCForceModel::Impl
             , from_grpc(FromGRPC())
             , commands()
             , force_frame()
+            , euler_angles()
+            , wave_request()
+            , wave_request_was_received(false)
+            , completion_queue()
+            , pending_force()
         {
             set_parameters(input.yaml, body_name, input.name);
         }
 
+        ~Impl()
+        {
+            if (pending_force)
+            {
+                pending_force->context.TryCancel(); // Its response is received (& ignored) below
+            }
+            completion_queue.Shutdown();
+            void* tag = nullptr;
+            bool ok = false;
+            while (completion_queue.Next(&tag, &ok))
+            {
+            }
+        }
+
         GRPCForceModel::Input get_input() const
         {
             return input;
@@ -90,17 +112,35 @@ class GRPCForceModel::Impl
             return from_grpc.to_wave_request(response);
         }
 
-        ssc::kinematics::Vector6d force(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
+        /**  \brief Sends the 'force' request using gRPC's asynchronous API: the response is received by 'force'
+          */
+        void send_force_request(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
         {
-            ForceResponse response;
-            grpc::ClientContext context;
-            const auto states = to_grpc.from_state(state, max_history_length, env);
+            if (pending_force)
+            {
+                // Its response was never used (eg. the force was then computed with other states): it is discarded
+                wait_for_pending_force();
+            }
+            const auto states = to_grpc.from_state(state, max_history_length, env, euler_angles);
             const auto wave_information = get_wave_information(t, state.x(0), state.y(0), state.z(0), env);
             const auto filtered_states = to_grpc.from_filtered_states(state.get_filtered_states());
-            const grpc::Status status = stub->force(&context, to_grpc.from_force_request(states, commands, wave_information, instance_name, filtered_states), &response);
-            throw_if_invalid_status<Input,GRPCForceModel>(input, "force", status);
-            extra_observations = std::map<std::string,double>(response.extra_observations().begin(),response.extra_observations().end());
-            return from_grpc.to_force(response);
+            const ForceRequest request = to_grpc.from_force_request(states, commands, wave_information, instance_name, filtered_states);
+            pending_force.reset(new PendingForce(t, state.get_current_state_values(0), commands));
+            pending_force->reader = stub->PrepareAsyncforce(&pending_force->context, request, &completion_queue);
+            pending_force->reader->StartCall();
+            pending_force->reader->Finish(&pending_force->response, &pending_force->status, pending_force.get());
+        }
+
+        ssc::kinematics::Vector6d force(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
+        {
+            if (not(pending_force and pending_force->was_sent_for(t, state.get_current_state_values(0), commands)))
+            {
+                send_force_request(t, state, commands, env, instance_name);
+            }
+            const std::unique_ptr<PendingForce> done = wait_for_pending_force();
+            throw_if_invalid_status<Input,GRPCForceModel>(input, "force", done->status);
+            extra_observations = std::map<std::string,double>(done->response.extra_observations().begin(),done->response.extra_observations().end());
+            return from_grpc.to_force(done->response);
         }
 
         double get_Tmax() const
@@ -127,11 +167,56 @@ class GRPCForceModel::Impl
 
     private:
         Impl(); // Disabled
-        WaveInformation* get_wave_information(const double t, const double x, const double y, const double z, const EnvironmentAndFrames& env) const
+        Impl(const Impl&); // Disabled
+        Impl& operator=(const Impl&); // Disabled
+
+        struct PendingForce
+        {
+            PendingForce(const double t_, const std::vector<double>& states_, const std::map<std::string,double>& commands_) :
+                context(), response(), status(), reader(), t(t_), states(states_), commands(commands_)
+            {
+            }
+            bool was_sent_for(const double t_, const std::vector<double>& states_, const std::map<std::string,double>& commands_) const
+            {
+                return (t == t_) and (states == states_) and (commands == commands_);
+            }
+            grpc::ClientContext context;
+            ForceResponse response;
+            grpc::Status status;
+            std::unique_ptr<grpc::ClientAsyncResponseReader<ForceResponse> > reader;
+            double t;
+            std::vector<double> states;
+            std::map<std::string,double> commands;
+        };
+
+        std::unique_ptr<PendingForce> wait_for_pending_force()
+        {
+            void* tag = nullptr;
+            bool ok = false;
+            if (not(completion_queue.Next(&tag, &ok)) or (tag != pending_force.get()))
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unable to get the response of gRPC force model '" << input.name << "' (at " << input.url << ")");
+            }
+            return std::move(pending_force);
+        }
+
+        WaveInformation* get_wave_information(const double t, const double x, const double y, const double z, const EnvironmentAndFrames& env)
         {
             if (needs_wave_outputs)
             {
-                const WaveRequest wave_request = required_wave_information(t, x, y, z);
+                if (input.fixed_wave_query_points and wave_request_was_received)
+                {
+                    // Saves one round trip per evaluation: only the instant changes
+                    wave_request.elevations.t = t;
+                    wave_request.dynamic_pressures.t = t;
+                    wave_request.orbital_velocities.t = t;
+                    wave_request.spectrum.t = t;
+                }
+                else
+                {
+                    wave_request = required_wave_information(t, x, y, z);
+                    wave_request_was_received = true;
+                }
                 return to_grpc.from_wave_information(wave_request, t, env);
             }
             return new WaveInformation();
@@ -146,6 +231,11 @@ class GRPCForceModel::Impl
         FromGRPC from_grpc;
         std::vector<std::string> commands;
         YamlPosition force_frame;
+        EulerAnglesHistory euler_angles;
+        WaveRequest wave_request;        //!< Latest response of the server to 'required_wave_information'
+        bool wave_request_was_received;
+        grpc::CompletionQueue completion_queue;      //!< Receives the responses to the 'force' requests
+        std::unique_ptr<PendingForce> pending_force; //!< 'force' request whose response was not received yet (if any)
 };
 
 std::string GRPCForceModel::model_name() {return "grpc";}
@@ -174,6 +264,10 @@ GRPCForceModel::Input GRPCForceModel::parse(const std::string& yaml)
     {
         node["raodb"] >> ret.precal_filename;
     }
+    if (node.FindValue("fixed wave query points"))
+    {
+        node["fixed wave query points"] >> ret.fixed_wave_query_points;
+    }
     YAML::Emitter out;
     out << node;
     ret.yaml = out.c_str();
@@ -210,3 +304,13 @@ double GRPCForceModel::get_Tmax() const
 {
     return pimpl->get_Tmax();
 }
+
+bool GRPCForceModel::is_remote() const
+{
+    return true;
+}
+
+void GRPCForceModel::send_request(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands)
+{
+    pimpl->send_force_request(t, states, commands, env, get_name());
+}
@@ -22,15 +22,18 @@ class GRPCForceModel : public ForceModel
             std::string yaml;
             std::string hdb_filename;
             std::string precal_filename;
+            bool fixed_wave_query_points; //!< Does the model always need the wave data at the same points? (if so, they are only requested once)
         };
         GRPCForceModel(const Input& input, const std::string& body_name, const EnvironmentAndFrames& env);
         Wrench get_force(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) const override;
         static Input parse(const std::string& yaml);
         static std::string model_name();
         double get_Tmax() const override;
+        bool is_remote() const override;
 
     private:
         void extra_observations(Observer& observer) const override;
+        void send_request(const BodyStates& states, const double t, const EnvironmentAndFrames& env, const std::map<std::string,double>& commands) override;
         GRPCForceModel(); // Disabled
         class Impl;
         TR1(shared_ptr)<Impl> pimpl;
@@ -5,6 +5,7 @@
  *      Author: cady
  */
 #include "SurfaceElevationFromGRPC.hpp"
+#include "WaveQueryCache.hpp"
 
 #include "wave_grpc.grpc.pb.h"
 #include "wave_types.grpc.pb.h"
@@ -23,6 +24,9 @@
 #include <vector>
 #include <string>
 
+// Per kind of query: enough for the stages of a Runge-Kutta step, for several bodies & for the observers
+#define NB_OF_CACHED_WAVE_QUERIES 16
+
 class SurfaceElevationFromGRPC::Impl
 {
     public:
@@ -30,6 +34,10 @@ class SurfaceElevationFromGRPC::Impl
             : url(url_)
             , stub(Waves::NewStub(grpc::CreateChannel(url, grpc::InsecureChannelCredentials())))
             , yaml(yaml_)
+            , elevations_cache(NB_OF_CACHED_WAVE_QUERIES)
+            , dynamic_pressures_cache(NB_OF_CACHED_WAVE_QUERIES)
+            , orbital_velocities_cache(NB_OF_CACHED_WAVE_QUERIES)
+            , spectra_cache(NB_OF_CACHED_WAVE_QUERIES)
         {
             SetParameterRequest request;
             request.set_parameters(yaml);
@@ -241,6 +249,29 @@ class SurfaceElevationFromGRPC::Impl
         }
 
         std::vector<double> elevations(const std::vector<double>& x, const std::vector<double>& y, const double t)
+        {
+            return elevations_cache.get(t, x, y, std::vector<double>(), [this, &x, &y, t](){return send_elevations_query(x, y, t);});
+        }
+
+        std::vector<double> dynamic_pressures(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t)
+        {
+            return dynamic_pressures_cache.get(t, x, y, z, [this, &x, &y, &z, t](){return send_dynamic_pressures_query(x, y, z, t);});
+        }
+
+        ssc::kinematics::PointMatrix orbital_velocities(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t)
+        {
+            return orbital_velocities_cache.get(t, x, y, z, [this, &x, &y, &z, t](){return send_orbital_velocities_query(x, y, z, t);});
+        }
+
+        std::vector<FlatDiscreteDirectionalWaveSpectrum> flat_directional_spectra(const double x, const double y, const double t)
+        {
+            return spectra_cache.get(t, std::vector<double>(1, x), std::vector<double>(1, y), std::vector<double>(), [this, x, y, t](){return send_spectrum_query(x, y, t);});
+        }
+
+    private:
+        Impl();
+
+        std::vector<double> send_elevations_query(const std::vector<double>& x, const std::vector<double>& y, const double t) const
         {
             XYTGrid request;
             *request.mutable_x() = {x.begin(),x.end()};
@@ -257,7 +288,7 @@ class SurfaceElevationFromGRPC::Impl
             return ret;
         }
 
-        std::vector<double> dynamic_pressures(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t)
+        std::vector<double> send_dynamic_pressures_query(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t) const
         {
             XYZTGrid request;
             *request.mutable_x() = {x.begin(),x.end()};
@@ -279,7 +310,7 @@ class SurfaceElevationFromGRPC::Impl
             return ret;
         }
 
-        ssc::kinematics::PointMatrix orbital_velocities(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t)
+        ssc::kinematics::PointMatrix send_orbital_velocities_query(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const double t) const
         {
             XYZTGrid request;
             *request.mutable_x() = {x.begin(),x.end()};
@@ -320,7 +351,7 @@ class SurfaceElevationFromGRPC::Impl
             return ret;
         }
 
-        std::vector<FlatDiscreteDirectionalWaveSpectrum> flat_directional_spectra(const double x, const double y, const double t)
+        std::vector<FlatDiscreteDirectionalWaveSpectrum> send_spectrum_query(const double x, const double y, const double t) const
         {
             SpectrumRequest request;
             request.set_x(x);
@@ -354,11 +385,14 @@ class SurfaceElevationFromGRPC::Impl
             return ret;
         }
 
-    private:
-        Impl();
         std::string url;
         std::unique_ptr<Waves::Stub> stub;
         std::string yaml;
+        // The gRPC stub can be used by several threads, so the caches are the only state shared by the bodies
+        WaveQueryCache<std::vector<double> > elevations_cache;
+        WaveQueryCache<std::vector<double> > dynamic_pressures_cache;
+        WaveQueryCache<ssc::kinematics::PointMatrix> orbital_velocities_cache;
+        WaveQueryCache<std::vector<FlatDiscreteDirectionalWaveSpectrum> > spectra_cache;
 
 };
 
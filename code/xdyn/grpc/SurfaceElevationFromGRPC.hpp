@@ -13,6 +13,8 @@
 struct YamlGRPC;
 
 /** \brief Call an external "wave" model through a gRPC interface (cf. https://grpc.io/)
+ *  \details The latest responses of the server are kept (cf. WaveQueryCache), so a query repeated
+ *           at the same points & instant (eg. by several force models) is only sent once.
  *  \ingroup wave_models
  */
 class SurfaceElevationFromGRPC : public SurfaceElevationInterface
@@ -127,26 +127,17 @@ WaveInformation* ToGRPC::from_wave_information(const WaveRequest& wave_request,
     return wave_information;
 }
 
-States* ToGRPC::from_state(const BodyStates& state, const double max_history_length, const EnvironmentAndFrames& env) const
+States* ToGRPC::from_state(const BodyStates& state, const double max_history_length, const EnvironmentAndFrames& env, EulerAnglesHistory& euler_angles) const
 {
+    const auto t = state.x.get_dates(max_history_length);
     const auto qr = state.qr.get_values(max_history_length);
     const auto qi = state.qi.get_values(max_history_length);
     const auto qj = state.qj.get_values(max_history_length);
     const auto qk = state.qk.get_values(max_history_length);
-    std::vector<double> phi(qr.size());
-    std::vector<double> theta(qr.size());
-    std::vector<double> psi(qr.size());
-    for (size_t i = 0 ; i < qr.size() ; ++i)
-    {
-        ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(qr[i],qi[i],qj[i],qk[i]).matrix();
-        const ssc::kinematics::EulerAngles euler_angles = state.convert(R, env.rot);
-        phi[i] = euler_angles.phi;
-        theta[i] = euler_angles.theta;
-        psi[i] = euler_angles.psi;
-    }
+    euler_angles.update(t, qr, qi, qj, qk, env.rot);
     States* ret = new States();
 
-    copy_from_double_vector(state.x.get_dates(max_history_length), ret->mutable_t());
+    copy_from_double_vector(t, ret->mutable_t());
     copy_from_double_vector(state.x.get_values(max_history_length), ret->mutable_x());
     copy_from_double_vector(state.y.get_values(max_history_length), ret->mutable_y());
     copy_from_double_vector(state.z.get_values(max_history_length), ret->mutable_z());
@@ -160,9 +151,9 @@ States* ToGRPC::from_state(const BodyStates& state, const double max_history_len
     copy_from_double_vector(qi, ret->mutable_qi());
     copy_from_double_vector(qj, ret->mutable_qj());
     copy_from_double_vector(qk, ret->mutable_qk());
-    copy_from_double_vector(phi, ret->mutable_phi());
-    copy_from_double_vector(theta, ret->mutable_theta());
-    copy_from_double_vector(psi, ret->mutable_psi());
+    copy_from_double_vector(euler_angles.get_phi(), ret->mutable_phi());
+    copy_from_double_vector(euler_angles.get_theta(), ret->mutable_theta());
+    copy_from_double_vector(euler_angles.get_psi(), ret->mutable_psi());
     copy_from_string_vector(env.rot.convention, ret->mutable_rotations_convention());
     return ret;
 }
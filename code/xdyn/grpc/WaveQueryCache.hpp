@@ -0,0 +1,113 @@
+/*
+ * WaveQueryCache.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WAVEQUERYCACHE_HPP_
+#define WAVEQUERYCACHE_HPP_
+
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/** \brief Latest responses of a remote wave model (eg. SurfaceElevationFromGRPC) to a given kind of query
+ *  \details The waves are often requested several times at the same points & instant during a time step
+ *           (eg. by several force models of a body, or by the observers after the solver's last evaluation):
+ *           only the first of these queries is sent to the server. The responses are identified by the instant
+ *           & the coordinates of the points (compared exactly), the oldest one being forgotten when the cache is full.
+ *           Can be called by several threads (eg. the bodies evaluated by Sim::dx_dt): the queries themselves
+ *           are sent without locking the cache, so they can be handled concurrently by the server.
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet grpc/unit_tests/WaveQueryCacheTest.cpp WaveQueryCacheTest example
+ */
+template <typename ResponseT> class WaveQueryCache
+{
+    public:
+        WaveQueryCache(const size_t max_nb_of_responses_ //!< Number of responses kept (at least 1)
+                      ) :
+            max_nb_of_responses(max_nb_of_responses_),
+            mutex(),
+            responses(),
+            nb_of_queries(0),
+            nb_of_hits(0)
+        {
+            if (max_nb_of_responses == 0)
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "The cache should be able to store at least one response");
+            }
+        }
+
+        /**  \brief Cached response to the query at (x,y,z,t), or the value returned by 'send_query' (which is then cached)
+          *  \details 'z' is empty for the queries which do not depend on it (eg. the wave elevations).
+          *           If 'send_query' throws, nothing is cached.
+          */
+        ResponseT get(const double t, const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const std::function<ResponseT()>& send_query)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                nb_of_queries++;
+                for (const auto& response:responses)
+                {
+                    if (response.is_for(t, x, y, z))
+                    {
+                        nb_of_hits++;
+                        return response.value;
+                    }
+                }
+            }
+            const ResponseT value = send_query();
+            std::lock_guard<std::mutex> lock(mutex);
+            responses.push_back(Response(t, x, y, z, value));
+            if (responses.size() > max_nb_of_responses) responses.pop_front();
+            return value;
+        }
+
+        size_t get_nb_of_queries() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return nb_of_queries;
+        }
+
+        size_t get_nb_of_hits() const //!< Number of queries which were not sent to the server
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return nb_of_hits;
+        }
+
+    private:
+        WaveQueryCache(); // Disabled
+        WaveQueryCache(const WaveQueryCache&); // Disabled
+        WaveQueryCache& operator=(const WaveQueryCache&); // Disabled
+
+        struct Response
+        {
+            Response(const double t_, const std::vector<double>& x_, const std::vector<double>& y_, const std::vector<double>& z_, const ResponseT& value_) :
+                t(t_), x(x_), y(y_), z(z_), value(value_)
+            {
+            }
+            bool is_for(const double t_, const std::vector<double>& x_, const std::vector<double>& y_, const std::vector<double>& z_) const
+            {
+                // The instant is compared first: it is the cheapest test & the one which usually fails
+                return (t == t_) and (x == x_) and (y == y_) and (z == z_);
+            }
+            double t;
+            std::vector<double> x;
+            std::vector<double> y;
+            std::vector<double> z;
+            ResponseT value;
+        };
+
+        const size_t max_nb_of_responses;
+        mutable std::mutex mutex;
+        std::deque<Response> responses; //!< Oldest first
+        size_t nb_of_queries;
+        size_t nb_of_hits;
+};
+
+#endif /* WAVEQUERYCACHE_HPP_ */
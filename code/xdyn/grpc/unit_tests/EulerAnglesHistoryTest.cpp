@@ -0,0 +1,137 @@
+/*
+ * EulerAnglesHistoryTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "EulerAnglesHistoryTest.hpp"
+#include "EulerAnglesHistory.hpp"
+#include "xdyn/core/BodyStates.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <cmath>
+
+EulerAnglesHistoryTest::EulerAnglesHistoryTest()
+{
+}
+
+EulerAnglesHistoryTest::~EulerAnglesHistoryTest()
+{
+}
+
+void EulerAnglesHistoryTest::SetUp()
+{
+}
+
+void EulerAnglesHistoryTest::TearDown()
+{
+}
+
+struct Quaternions
+{
+    Quaternions(const size_t first, const size_t n) : t(), qr(), qi(), qj(), qk()
+    {
+        for (size_t i = first ; i < first + n ; ++i)
+        {
+            const double psi = 0.1*(double)i;
+            const double phi = 0.05*std::sin((double)i);
+            t.push_back(0.5*(double)i);
+            qr.push_back(std::cos(psi/2)*std::cos(phi/2));
+            qi.push_back(std::cos(psi/2)*std::sin(phi/2));
+            qj.push_back(-std::sin(psi/2)*std::sin(phi/2));
+            qk.push_back(std::sin(psi/2)*std::cos(phi/2));
+        }
+    }
+    std::vector<double> t;
+    std::vector<double> qr;
+    std::vector<double> qi;
+    std::vector<double> qj;
+    std::vector<double> qk;
+};
+
+YamlRotation rotation_convention();
+YamlRotation rotation_convention()
+{
+    return YamlRotation("angle", {"z","y'","x''"});
+}
+
+void check_angles(const Quaternions& q, const EulerAnglesHistory& angles);
+void check_angles(const Quaternions& q, const EulerAnglesHistory& angles)
+{
+    ASSERT_EQ(q.t.size(), angles.get_phi().size());
+    ASSERT_EQ(q.t.size(), angles.get_theta().size());
+    ASSERT_EQ(q.t.size(), angles.get_psi().size());
+    for (size_t i = 0 ; i < q.t.size() ; ++i)
+    {
+        const ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(q.qr[i],q.qi[i],q.qj[i],q.qk[i]).matrix();
+        const ssc::kinematics::EulerAngles expected = BodyStates::convert(R, rotation_convention());
+        ASSERT_EQ(expected.phi, angles.get_phi()[i]) << "i = " << i;
+        ASSERT_EQ(expected.theta, angles.get_theta()[i]) << "i = " << i;
+        ASSERT_EQ(expected.psi, angles.get_psi()[i]) << "i = " << i;
+    }
+}
+
+TEST_F(EulerAnglesHistoryTest, example)
+{
+//! [EulerAnglesHistoryTest example]
+    EulerAnglesHistory angles;
+    const Quaternions q(0, 10);
+    angles.update(q.t, q.qr, q.qi, q.qj, q.qk, rotation_convention());
+//! [EulerAnglesHistoryTest example]
+    ASSERT_EQ((size_t)10, angles.get_nb_of_conversions());
+    check_angles(q, angles);
+}
+
+TEST_F(EulerAnglesHistoryTest, only_the_new_points_are_converted_when_the_window_slides)
+{
+    EulerAnglesHistory angles;
+    const Quaternions q1(0, 10);
+    angles.update(q1.t, q1.qr, q1.qi, q1.qj, q1.qk, rotation_convention());
+    const Quaternions q2(3, 10);
+    angles.update(q2.t, q2.qr, q2.qi, q2.qj, q2.qk, rotation_convention());
+    ASSERT_EQ((size_t)3, angles.get_nb_of_conversions());
+    check_angles(q2, angles);
+    const Quaternions q3(3, 11);
+    angles.update(q3.t, q3.qr, q3.qi, q3.qj, q3.qk, rotation_convention());
+    ASSERT_EQ((size_t)1, angles.get_nb_of_conversions());
+    check_angles(q3, angles);
+    angles.update(q3.t, q3.qr, q3.qi, q3.qj, q3.qk, rotation_convention());
+    ASSERT_EQ((size_t)0, angles.get_nb_of_conversions());
+    check_angles(q3, angles);
+}
+
+TEST_F(EulerAnglesHistoryTest, points_whose_quaternion_changed_are_converted_again)
+{
+    EulerAnglesHistory angles;
+    Quaternions q(0, 10);
+    angles.update(q.t, q.qr, q.qi, q.qj, q.qk, rotation_convention());
+    // Eg. the tentative states at the next stage of a Runge-Kutta step
+    q.qk.back() = -q.qk.back();
+    angles.update(q.t, q.qr, q.qi, q.qj, q.qk, rotation_convention());
+    ASSERT_EQ((size_t)1, angles.get_nb_of_conversions());
+    check_angles(q, angles);
+    // Eg. a history which was replaced
+    const Quaternions other(20, 10);
+    angles.update(other.t, other.qr, other.qi, other.qj, other.qk, rotation_convention());
+    ASSERT_EQ((size_t)10, angles.get_nb_of_conversions());
+    check_angles(other, angles);
+}
+
+TEST_F(EulerAnglesHistoryTest, can_convert_an_empty_history)
+{
+    EulerAnglesHistory angles;
+    const Quaternions q(0, 10);
+    angles.update(q.t, q.qr, q.qi, q.qj, q.qk, rotation_convention());
+    const std::vector<double> empty;
+    angles.update(empty, empty, empty, empty, empty, rotation_convention());
+    ASSERT_TRUE(angles.get_phi().empty());
+    ASSERT_EQ((size_t)0, angles.get_nb_of_conversions());
+}
+
+TEST_F(EulerAnglesHistoryTest, should_throw_if_sizes_do_not_match)
+{
+    EulerAnglesHistory angles;
+    Quaternions q(0, 10);
+    q.qj.pop_back();
+    ASSERT_THROW(angles.update(q.t, q.qr, q.qi, q.qj, q.qk, rotation_convention()), InternalErrorException);
+}
@@ -0,0 +1,21 @@
+/*
+ * EulerAnglesHistoryTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef GRPC_UNIT_TESTS_INC_EULERANGLESHISTORYTEST_HPP_
+#define GRPC_UNIT_TESTS_INC_EULERANGLESHISTORYTEST_HPP_
+
+#include "gtest/gtest.h"
+
+class EulerAnglesHistoryTest : public ::testing::Test
+{
+    protected:
+        EulerAnglesHistoryTest();
+        virtual ~EulerAnglesHistoryTest();
+        virtual void SetUp();
+        virtual void TearDown();
+};
+
+#endif /* GRPC_UNIT_TESTS_INC_EULERANGLESHISTORYTEST_HPP_ */
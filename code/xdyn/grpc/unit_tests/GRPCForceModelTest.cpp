@@ -62,6 +62,13 @@ TEST_F(GRPCForceModelTest, can_parse_precal)
     ASSERT_EQ("some_precal.ini", input.precal_filename);
 }
 
+TEST_F(GRPCForceModelTest, can_parse_fixed_wave_query_points)
+{
+    ASSERT_FALSE(GRPCForceModel::parse(test_data::gRPC_force_model()).fixed_wave_query_points);
+    ASSERT_TRUE(GRPCForceModel::parse(test_data::gRPC_force_model()+"fixed wave query points: true\n").fixed_wave_query_points);
+    ASSERT_FALSE(GRPCForceModel::parse(test_data::gRPC_force_model()+"fixed wave query points: false\n").fixed_wave_query_points);
+}
+
 TEST_F(GRPCForceModelTest, should_throw_if_both_hdb_and_precal_are_defined_in_any_order)
 {
     ASSERT_THROW(GRPCForceModel::parse(test_data::gRPC_force_model()+"hdb: some_hdb.hdb\n"+"raodb: some_precal.ini\n"), InvalidInputException);
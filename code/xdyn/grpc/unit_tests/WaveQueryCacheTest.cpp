@@ -0,0 +1,152 @@
+/*
+ * WaveQueryCacheTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WaveQueryCacheTest.hpp"
+#include "WaveQueryCache.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <stdexcept>
+#include <thread>
+
+WaveQueryCacheTest::WaveQueryCacheTest()
+{
+}
+
+WaveQueryCacheTest::~WaveQueryCacheTest()
+{
+}
+
+void WaveQueryCacheTest::SetUp()
+{
+}
+
+void WaveQueryCacheTest::TearDown()
+{
+}
+
+struct FakeWaveServer
+{
+    FakeWaveServer() : nb_of_queries(0)
+    {
+    }
+
+    std::vector<double> elevations(const std::vector<double>& x, const std::vector<double>& y, const double t)
+    {
+        nb_of_queries++;
+        std::vector<double> ret;
+        for (size_t i = 0 ; i < x.size() ; ++i)
+        {
+            ret.push_back(x[i] + 10*y[i] + 100*t);
+        }
+        return ret;
+    }
+
+    size_t nb_of_queries;
+};
+
+TEST_F(WaveQueryCacheTest, identical_queries_are_only_sent_once)
+{
+//! [WaveQueryCacheTest example]
+    FakeWaveServer server;
+    WaveQueryCache<std::vector<double> > cache(4);
+    const std::vector<double> x = {1, 2, 3};
+    const std::vector<double> y = {4, 5, 6};
+    const auto eta = [&server, &x, &y](){return server.elevations(x, y, 0.5);};
+    const std::vector<double> first = cache.get(0.5, x, y, std::vector<double>(), eta);
+    const std::vector<double> second = cache.get(0.5, x, y, std::vector<double>(), eta);
+//! [WaveQueryCacheTest example]
+    ASSERT_EQ((size_t)1, server.nb_of_queries);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(std::vector<double>({91, 102, 113}), second);
+    ASSERT_EQ((size_t)2, cache.get_nb_of_queries());
+    ASSERT_EQ((size_t)1, cache.get_nb_of_hits());
+}
+
+TEST_F(WaveQueryCacheTest, queries_at_other_instants_or_points_are_sent)
+{
+    FakeWaveServer server;
+    WaveQueryCache<std::vector<double> > cache(4);
+    const std::vector<double> x = {1, 2};
+    const std::vector<double> y = {3, 4};
+    const std::vector<double> other_y = {3, 4.5};
+    ASSERT_EQ(std::vector<double>({31, 42}), cache.get(0, x, y, std::vector<double>(), [&](){return server.elevations(x, y, 0);}));
+    ASSERT_EQ(std::vector<double>({131, 142}), cache.get(1, x, y, std::vector<double>(), [&](){return server.elevations(x, y, 1);}));
+    ASSERT_EQ(std::vector<double>({31, 47}), cache.get(0, x, other_y, std::vector<double>(), [&](){return server.elevations(x, other_y, 0);}));
+    ASSERT_EQ((size_t)3, server.nb_of_queries);
+    ASSERT_EQ((size_t)0, cache.get_nb_of_hits());
+}
+
+TEST_F(WaveQueryCacheTest, z_is_part_of_the_query)
+{
+    WaveQueryCache<double> cache(4);
+    const std::vector<double> x = {1};
+    const std::vector<double> y = {2};
+    ASSERT_EQ(1, cache.get(0, x, y, std::vector<double>(1, 3), [](){return 1.;}));
+    ASSERT_EQ(2, cache.get(0, x, y, std::vector<double>(1, 4), [](){return 2.;}));
+    ASSERT_EQ(1, cache.get(0, x, y, std::vector<double>(1, 3), [](){return 3.;}));
+}
+
+TEST_F(WaveQueryCacheTest, oldest_response_is_forgotten_when_the_cache_is_full)
+{
+    FakeWaveServer server;
+    WaveQueryCache<std::vector<double> > cache(2);
+    const std::vector<double> x = {1};
+    const std::vector<double> y = {2};
+    for (const double t:{0., 1., 2.})
+    {
+        cache.get(t, x, y, std::vector<double>(), [&](){return server.elevations(x, y, t);});
+    }
+    ASSERT_EQ((size_t)3, server.nb_of_queries);
+    cache.get(2, x, y, std::vector<double>(), [&](){return server.elevations(x, y, 2);});
+    cache.get(1, x, y, std::vector<double>(), [&](){return server.elevations(x, y, 1);});
+    ASSERT_EQ((size_t)3, server.nb_of_queries);
+    cache.get(0, x, y, std::vector<double>(), [&](){return server.elevations(x, y, 0);});
+    ASSERT_EQ((size_t)4, server.nb_of_queries);
+}
+
+TEST_F(WaveQueryCacheTest, failed_queries_are_not_cached)
+{
+    WaveQueryCache<double> cache(2);
+    const std::vector<double> x = {1};
+    ASSERT_THROW(cache.get(0, x, x, x, []() -> double {throw std::runtime_error("server unavailable");}), std::runtime_error);
+    ASSERT_EQ(4, cache.get(0, x, x, x, [](){return 4.;}));
+}
+
+TEST_F(WaveQueryCacheTest, cache_should_be_able_to_store_at_least_one_response)
+{
+    ASSERT_THROW(WaveQueryCache<double>(0), InternalErrorException);
+}
+
+TEST_F(WaveQueryCacheTest, can_be_used_by_several_threads)
+{
+    WaveQueryCache<std::vector<double> > cache(8);
+    std::vector<std::thread> threads;
+    std::vector<int> results_are_right(8, 0); // Not std::vector<bool>, whose elements cannot be written concurrently
+    for (size_t i = 0 ; i < results_are_right.size() ; ++i)
+    {
+        threads.push_back(std::thread([&cache, &results_are_right, i]()
+        {
+            bool ok = true;
+            for (size_t j = 0 ; j < 1000 ; ++j)
+            {
+                const double t = (double)(j % 4);
+                const std::vector<double> x(1, (double)(i % 2));
+                const std::vector<double> y(1, 0);
+                ok = ok and (cache.get(t, x, y, std::vector<double>(), [&x, t](){return std::vector<double>(1, x[0] + 100*t);}) == std::vector<double>(1, x[0] + 100*t));
+            }
+            results_are_right[i] = ok;
+        }));
+    }
+    for (auto& thread:threads)
+    {
+        thread.join();
+    }
+    for (const int ok:results_are_right)
+    {
+        ASSERT_TRUE(ok);
+    }
+    ASSERT_EQ((size_t)8000, cache.get_nb_of_queries());
+}
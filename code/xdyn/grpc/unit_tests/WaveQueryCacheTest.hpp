@@ -0,0 +1,21 @@
+/*
+ * WaveQueryCacheTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef GRPC_UNIT_TESTS_INC_WAVEQUERYCACHETEST_HPP_
+#define GRPC_UNIT_TESTS_INC_WAVEQUERYCACHETEST_HPP_
+
+#include "gtest/gtest.h"
+
+class WaveQueryCacheTest : public ::testing::Test
+{
+    protected:
+        WaveQueryCacheTest();
+        virtual ~WaveQueryCacheTest();
+        virtual void SetUp();
+        virtual void TearDown();
+};
+
+#endif /* GRPC_UNIT_TESTS_INC_WAVEQUERYCACHETEST_HPP_ */
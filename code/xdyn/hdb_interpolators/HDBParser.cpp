@@ -46,9 +46,13 @@ class HDBParser::Impl
         {
         }
 
-        Impl(const std::string& data)
+        Impl(const std::string& data) : Impl(hdb::parse(data))
+        {
+        }
+
+        Impl(const hdb::AST& tree_)
         : omega_rad()
-        , tree(hdb::parse(data))
+        , tree(tree_)
         , M()
         , Ma()
         , Br()
@@ -618,6 +622,10 @@ HDBParser::HDBParser(const std::string& data) : pimpl(new Impl(data))
 {
 }
 
+HDBParser::HDBParser(const hdb::AST& tree) : pimpl(new Impl(tree))
+{
+}
+
 HDBParser::HDBParser() : pimpl(new Impl())
 {
 }
@@ -791,6 +799,11 @@ HDBParser HDBParser::from_string(const std::string& contents)
     return HDBParser(contents);
 }
 
+HDBParser HDBParser::from_ast(const hdb::AST& tree)
+{
+    return HDBParser(tree);
+}
+
 std::array<std::vector<std::vector<double> >,6 > HDBParser::get_wave_drift_tables() const
 {
     return pimpl->get_wave_drift_tables();
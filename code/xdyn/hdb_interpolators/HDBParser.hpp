@@ -13,6 +13,11 @@
 
 #include "HydroDBParser.hpp"
 
+namespace hdb
+{
+    struct AST;
+}
+
 /** \brief
  *  \details
  *  \addtogroup hdb_interpolators
@@ -27,6 +32,7 @@ class HDBParser : public HydroDBParser
     public:
         static HDBParser from_file(const std::string& filename);
         static HDBParser from_string(const std::string& contents);
+        static HDBParser from_ast(const hdb::AST& tree); //!< For HDB files which were already parsed (cf. HydroDBCache)
         virtual ~HDBParser();
         double get_forward_speed() const; //!< Speed at which the radiation damping matrices were calculated. Used to determine if we can apply a forward-speed correction
         TimestampedMatrices get_added_mass_array() const;
@@ -78,6 +84,7 @@ class HDBParser : public HydroDBParser
 
     private:
         HDBParser(const std::string& data);
+        HDBParser(const hdb::AST& tree);
         class Impl;
         TR1(shared_ptr)<Impl> pimpl;
 };
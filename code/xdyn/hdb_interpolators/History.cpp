@@ -43,7 +43,9 @@ bool almost_equal(const double a, const double b, const int maxUlpsDiff)
     return false;
 }
 
-History::History(const double Tmax_) : Tmax(Tmax_), L(), oldest_recorded_instant(0)
+History::History(const double Tmax_) : Tmax(Tmax_), buffer(), first(0), n(0), oldest_recorded_instant(0),
+                                        tentative(false), tentative_value_replaced_newest_point(false), replaced_point(),
+                                        oldest_recorded_instant_before_tentative_value(0)
 {
 }
 
@@ -54,8 +56,64 @@ double get_tmax(const std::vector<std::pair<double,double> >& L)
     return L.back().first - L.front().first;
 }
 
-History::History(const Container& L_) : Tmax(get_tmax(L_)), L(L_), oldest_recorded_instant(L.empty()?0:L.front().first)
+History::History(const Container& L_) : Tmax(get_tmax(L_)), buffer(), first(0), n(0), oldest_recorded_instant(L_.empty()?0:L_.front().first),
+                                        tentative(false), tentative_value_replaced_newest_point(false), replaced_point(),
+                                        oldest_recorded_instant_before_tentative_value(0)
 {
+    for (const auto& p:L_) push_back(p);
+}
+
+const History::TimeValue& History::at(const size_t i) const
+{
+    return buffer[(first + i) & (buffer.size() - 1)];
+}
+
+History::TimeValue& History::at(const size_t i)
+{
+    return buffer[(first + i) & (buffer.size() - 1)];
+}
+
+const History::TimeValue& History::front() const
+{
+    return buffer[first];
+}
+
+const History::TimeValue& History::back() const
+{
+    return at(n-1);
+}
+
+void History::grow()
+{
+    Container bigger(buffer.empty() ? 16 : 2*buffer.size());
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        bigger[i] = at(i);
+    }
+    buffer.swap(bigger);
+    first = 0;
+}
+
+void History::push_back(const TimeValue& p)
+{
+    if (n == buffer.size()) grow();
+    buffer[(first + n) & (buffer.size() - 1)] = p;
+    n++;
+}
+
+void History::push_front(const TimeValue& p)
+{
+    if (n == buffer.size()) grow();
+    first = (first + buffer.size() - 1) & (buffer.size() - 1);
+    buffer[first] = p;
+    n++;
+}
+
+void History::pop_front(const size_t nb_of_points)
+{
+    if (nb_of_points == 0) return;
+    first = (first + nb_of_points) & (buffer.size() - 1);
+    n -= nb_of_points;
 }
 
 double History::operator()(double tau //!< How far back in history do we need to go (in seconds)?
@@ -72,7 +130,7 @@ double History::operator()(double tau //!< How far back in history do we need to
         THROW(__PRETTY_FUNCTION__, InternalErrorException,
                 "Requesting value in the future: asked for t-tau with tau = " << tau);
     }
-    if (L.empty())
+    if (n == 0)
     {
         return 0;
     }
@@ -81,7 +139,7 @@ double History::operator()(double tau //!< How far back in history do we need to
 
 double History::get_current_time() const
 {
-    return L.empty() ? oldest_recorded_instant : L.back().first;
+    return n == 0 ? oldest_recorded_instant : back().first;
 }
 
 double History::get_value(const double tau) const
@@ -93,14 +151,16 @@ double History::get_value(const double tau) const
 
 double History::interpolate_value_in_interval(const size_t idx, const double t) const
 {
-    if ((idx == 0) or (idx >= L.size()))
+    if ((idx == 0) or (idx >= n))
     {
-        return L[0].second;
+        return front().second;
     }
-    const double tA = L[idx-1].first;
-    const double tB = L[idx].first;
-    const double yA = L[idx-1].second;
-    const double yB = L[idx].second;
+    const TimeValue& A = at(idx-1);
+    const TimeValue& B = at(idx);
+    const double tA = A.first;
+    const double tB = B.first;
+    const double yA = A.second;
+    const double yB = B.second;
 
     if (std::abs(t-tA) < 1E-12)
     {
@@ -113,29 +173,20 @@ double History::interpolate_value_in_interval(const size_t idx, const double t)
     return (t-tA)/(tB-tA)*(yB-yA) + yA;
 }
 
-void History::throw_if_already_added(const size_t idx, const double t, const double val) const
-{
-    if ((idx != L.size()) and (L[idx].first == t) and (val != L[idx].second))
-    {
-        THROW(__PRETTY_FUNCTION__, InternalErrorException,
-                "Attempting to insert the same instant in History with different value: t = " << t << " already exists.");
-    }
-}
-
 size_t History::find_braketing_position(const double t) const
 {
-    if (L.empty())return 0;
-    if (L.back().first < t)           return L.size();
-    if (L.front().first >= t)         return 0;
+    if (n == 0)                       return 0;
+    if (back().first < t)             return n;
+    if (front().first >= t)           return 0;
     size_t idx_lower = 0;
-    size_t idx_greater = L.size()-1;
+    size_t idx_greater = n-1;
     while (true)
     {
-        if (t==L[idx_lower].first)
+        if (t==at(idx_lower).first)
         {
             return idx_lower;
         }
-        if (t==L[idx_greater].first)
+        if (t==at(idx_greater).first)
         {
             return idx_greater;
         }
@@ -144,7 +195,7 @@ size_t History::find_braketing_position(const double t) const
             return idx_greater;
         }
         const size_t idx_middle = (size_t)std::floor(((double)idx_lower+(double)idx_greater)/2.);
-        const auto middle = L[idx_middle];
+        const TimeValue& middle = at(idx_middle);
         if (t==middle.first)
         {
             return idx_middle;
@@ -158,7 +209,7 @@ size_t History::find_braketing_position(const double t) const
             idx_lower = idx_middle;
         }
     }
-    return L.size();
+    return n;
 }
 
 void History::shift_oldest_recorded_instant_if_necessary()
@@ -167,45 +218,42 @@ void History::shift_oldest_recorded_instant_if_necessary()
     {
         oldest_recorded_instant = get_current_time()-Tmax;
         const double vmin = interpolate_value_in_interval(1, oldest_recorded_instant);
-        const size_t idx = find_braketing_position(oldest_recorded_instant);
-        L.erase(L.begin(), L.begin() + (long) (idx));
-        if (not(almost_equal(L.front().first, oldest_recorded_instant,32)))
+        pop_front(find_braketing_position(oldest_recorded_instant));
+        if (not(almost_equal(front().first, oldest_recorded_instant,32)))
         {
-            L.insert(L.begin(), std::make_pair(oldest_recorded_instant, vmin));
+            push_front(std::make_pair(oldest_recorded_instant, vmin));
         }
     }
 }
 
 void History::add_value_to_history(const double t, const double val)
 {
-    const size_t idx = find_braketing_position(t);
-    if ((idx != L.size()) and (almost_equal(L[idx].first, t)))
+    // 'record' checked t is not before the last recorded instant (& rounded it to that instant if they were almost equal)
+    if ((n != 0) and (back().first == t))
     {
-        L[idx] = std::make_pair(t, val);
+        at(n-1).second = val;
     }
     else
     {
-        L.insert(L.begin() + (long) (idx), std::make_pair(t, val));
+        push_back(std::make_pair(t, val));
     }
 }
 
 void History::update_oldest_recorded_instant(const double t)
 {
-    if (L.empty()) oldest_recorded_instant = t;
+    if (n == 0) oldest_recorded_instant = t;
     oldest_recorded_instant = std::min(oldest_recorded_instant, t);
 }
 
-void History::record(double t, //!< Instant corresponding to the value being added
-                     const double val //!< Value to add
-                    )
+double History::check_instant_can_be_recorded(double t) const
 {
-    if (not(L.empty()))
+    if (n != 0)
     {
-        if  (almost_equal(t,L.back().first))
+        if  (almost_equal(t,back().first))
         {
-            t = L.back().first;
+            t = back().first;
         }
-        if (t < L.back().first)
+        if (t < back().first)
         {
             THROW(__PRETTY_FUNCTION__
                  , InternalErrorException
@@ -213,20 +261,73 @@ void History::record(double t, //!< Instant corresponding to the value being add
                    << t
                    <<
                    ", but the latest timestamp in history is "
-                   << L.back().first
+                   << back().first
                    << " (t-thistory.back = "
-                    << t-L.back().first
+                    << t-back().first
                     << ")");
         }
     }
+    return t;
+}
+
+void History::record(double t, //!< Instant corresponding to the value being added
+                     const double val //!< Value to add
+                    )
+{
+    discard_tentative_value();
+    t = check_instant_can_be_recorded(t);
     update_oldest_recorded_instant(t);
     add_value_to_history(t, val);
     shift_oldest_recorded_instant_if_necessary();
 }
 
+void History::record_tentatively(double t, //!< Instant corresponding to the value being added
+                                 const double val //!< Value to add
+                                )
+{
+    discard_tentative_value();
+    t = check_instant_can_be_recorded(t);
+    oldest_recorded_instant_before_tentative_value = oldest_recorded_instant;
+    update_oldest_recorded_instant(t);
+    tentative_value_replaced_newest_point = (n != 0) and (back().first == t);
+    if (tentative_value_replaced_newest_point) replaced_point = back();
+    add_value_to_history(t, val);
+    tentative = true;
+}
+
+void History::commit()
+{
+    if (tentative)
+    {
+        tentative = false;
+        shift_oldest_recorded_instant_if_necessary();
+    }
+}
+
+void History::discard_tentative_value()
+{
+    if (tentative)
+    {
+        if (tentative_value_replaced_newest_point) at(n-1) = replaced_point;
+        else                                       n--;
+        oldest_recorded_instant = oldest_recorded_instant_before_tentative_value;
+        tentative = false;
+    }
+}
+
+bool History::has_tentative_value() const
+{
+    return tentative;
+}
+
+bool History::can_record(const double t) const
+{
+    return (n == 0) or (t >= back().first) or almost_equal(t, back().first);
+}
+
 size_t History::size() const
 {
-    return L.size();
+    return n;
 }
 
 double History::get_Tmax() const
@@ -236,18 +337,18 @@ double History::get_Tmax() const
 
 double History::get_duration() const
 {
-    if (L.empty()) return 0;
-    return L.back().first - L.front().first;
+    if (n == 0) return 0;
+    return back().first - front().first;
 }
 
 std::ostream& operator<<(std::ostream& os, const History& h)
 {
     os << "[";
-    for (size_t i = 0 ; i < h.L.size() -1 ; ++i)
+    for (size_t i = 0 ; i + 1 < h.n ; ++i)
     {
-        os << "(" << h.L.at(i).first << "," << h.L.at(i).second << "), ";
+        os << "(" << h.at(i).first << "," << h.at(i).second << "), ";
     }
-    if (not(h.L.empty())) os << "(" << h.L.back().first << "," << h.L.back().second << ")";
+    if (h.n != 0) os << "(" << h.back().first << "," << h.back().second << ")";
     os << "]";
     return os;
 }
@@ -260,9 +361,11 @@ double History::trapeze(const double xa, const double ya, const double xb, const
 double History::integrate(const size_t idx) const
 {
     double ret = 0;
-    for (size_t i = idx ; i < L.size()-1 ; ++i)
+    for (size_t i = idx ; i + 1 < n ; ++i)
     {
-        ret += trapeze(L.at(i).first, L.at(i).second, L.at(i+1).first, L.at(i+1).second);
+        const TimeValue& a = at(i);
+        const TimeValue& b = at(i+1);
+        ret += trapeze(a.first, a.second, b.first, b.second);
     }
     return ret;
 }
@@ -279,15 +382,15 @@ void History::check_if_average_can_be_retrieved(const double T) const
 
 double History::average(double T) const
 {
-    if (L.empty()) return 0;
-    if (L.size()==1) return L.front().second;
-    if (T==0) return L.back().second;
+    if (n == 0) return 0;
+    if (n == 1) return front().second;
+    if (T==0) return back().second;
     check_if_average_can_be_retrieved(T);
     T = std::min(T, get_duration());
     const double t = get_current_time() - T;
     const size_t idx = find_braketing_position(t);
     const double first_value = interpolate_value_in_interval(idx, t);
-    const double integral_of_first_interval = trapeze(t, first_value, L.at(idx).first, L.at(idx).second);
+    const double integral_of_first_interval = trapeze(t, first_value, at(idx).first, at(idx).second);
     const double integral_from_t_to_now = integrate(idx);
     return  (integral_of_first_interval + integral_from_t_to_now)/T;
 }
@@ -296,23 +399,25 @@ std::pair<double,double> History::operator[](const int index) const
 {
     if(index>=0)
     {
-        return L[(size_t)index];
+        return at((size_t)index);
     }
     else
     {
-        return L[L.size()+(size_t)index];
+        return at(n+(size_t)index);
     }
 }
 
 void History::reset()
 {
-    L.clear();
+    first = 0;
+    n = 0;
     oldest_recorded_instant = 0;
+    tentative = false;
 }
 
 bool History::is_empty() const
 {
-    return L.size() == 0;
+    return n == 0;
 }
 
 std::vector<double> History::get_values(const double tmax) const
@@ -322,13 +427,13 @@ std::vector<double> History::get_values(const double tmax) const
         return {this->operator()(0)};
     }
     std::vector<double> ret;
-    ret.reserve(L.size());
+    ret.reserve(n);
     const double t = get_current_time();
-    for (size_t i = 0 ; i < L.size() ; ++i)
+    for (size_t i = 0 ; i < n ; ++i)
     {
-        if (tmax >= t - L[i].first)
+        if (tmax >= t - at(i).first)
         {
-            ret.push_back(L[i].second);
+            ret.push_back(at(i).second);
         }
     }
     return ret;
@@ -342,13 +447,13 @@ std::vector<double> History::get_dates(const double tmax) const
         return {t};
     }
     std::vector<double> ret;
-    ret.reserve(L.size());
+    ret.reserve(n);
 
-    for (size_t i = 0 ; i < L.size() ; ++i)
+    for (size_t i = 0 ; i < n ; ++i)
     {
-        if (tmax >= t - L[i].first)
+        if (tmax >= t - at(i).first)
         {
-            ret.push_back(L[i].first);
+            ret.push_back(at(i).first);
         }
     }
     return ret;
@@ -12,8 +12,11 @@
 #include <sstream>
 #include <vector>
 
-/** \brief
- *  \details
+/** \brief Values of a scalar over a sliding time window, which can be interpolated & averaged
+ *  \details The points are stored in a circular buffer (whose capacity is a power of two & only
+ *           grows when the history gets longer): recording a new value & forgetting the oldest ones
+ *           does not move the other points in memory, so 'record' costs O(1) (amortized), however long
+ *           the history. Retrieving a value is a binary search (O(log n)).
  *  \addtogroup hdb_interpolators
  *  \ingroup hdb_interpolators
  *  \section ex1 Example
@@ -50,6 +53,30 @@ class History
                     const double val //!< Value to add
                     );
 
+        /**  \brief Adds a value which can still be discarded (eg. the states at an intermediate stage of a Runge-Kutta step)
+          *  \details Until the next call to 'record', 'record_tentatively', 'commit' or 'discard_tentative_value',
+          *           the other methods see this value as if it had been recorded, but the oldest values are only
+          *           forgotten when it is committed. There is at most one tentative value, which is always the newest.
+          *  \snippet hdb_interpolators/unit_tests/HistoryTest.cpp HistoryTest record_tentatively_example
+          */
+        void record_tentatively(double t, //!< Instant corresponding to the value being added
+                                const double val //!< Value to add
+                                );
+
+        /**  \brief Makes the tentative value (if any) permanent, as if it had been added by 'record'
+          */
+        void commit();
+
+        /**  \brief Removes the tentative value (if any), restoring the value it replaced if it was added at the newest recorded instant
+          */
+        void discard_tentative_value();
+
+        bool has_tentative_value() const;
+
+        /**  \brief Can a value be recorded at t (ie. is t not before the newest recorded instant)?
+          */
+        bool can_record(const double t) const;
+
         /**  \brief Number of points in history
           *  \snippet hdb_interpolator/unit_tests/HistoryTest.cpp HistoryTest size_example
           */
@@ -83,20 +110,34 @@ class History
         typedef std::pair<double,double> TimeValue;
         typedef std::vector<TimeValue> Container;
 
-        void throw_if_already_added(const size_t idx, const double t, const double val) const;
+        const TimeValue& at(const size_t i) const; //!< i-th oldest point in history (no bound checking)
+        TimeValue& at(const size_t i);
+        const TimeValue& front() const;
+        const TimeValue& back() const;
+        void push_back(const TimeValue& p);
+        void push_front(const TimeValue& p);
+        void pop_front(const size_t nb_of_points);
+        void grow();
         size_t find_braketing_position(const double t) const;
         double interpolate_value_in_interval(const size_t idx, const double t) const;
         double get_value(const double tau) const;
         void shift_oldest_recorded_instant_if_necessary();
         void add_value_to_history(const double t, const double val);
+        double check_instant_can_be_recorded(double t) const;
         void update_oldest_recorded_instant(const double t);
         double trapeze(const double xa, const double ya, const double xb, const double yb) const;
         double integrate(const size_t idx) const;
         void check_if_average_can_be_retrieved(const double T) const;
 
         double Tmax;
-        Container L;
+        Container buffer;    //!< Circular buffer: its size is a power of two (or zero)
+        size_t first;        //!< Position in 'buffer' of the oldest point in history
+        size_t n;            //!< Number of points in history
         double oldest_recorded_instant;
+        bool tentative;                                 //!< Is the newest point in history tentative (cf. 'record_tentatively')?
+        bool tentative_value_replaced_newest_point;     //!< Was the tentative value added at the instant of the newest recorded point?
+        TimeValue replaced_point;                       //!< Newest recorded point, if the tentative value replaced it
+        double oldest_recorded_instant_before_tentative_value;
 
     public:
         History(const Container& L); // For testing purposes only
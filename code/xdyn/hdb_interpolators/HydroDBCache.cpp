@@ -0,0 +1,169 @@
+/*
+ * HydroDBCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "HydroDBCache.hpp"
+#include "HDBParser.hpp"
+#include "PrecalParser.hpp"
+#include "xdyn/external_file_formats/hdb_binary.hpp"
+#include "xdyn/external_file_formats/hdb_to_ast.hpp"
+
+#include <ssc/text_file_reader.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+namespace
+{
+    struct Entry
+    {
+        Entry() : hash(0), parser() {}
+        uint64_t hash;
+        std::shared_ptr<HydroDBParser> parser;
+    };
+
+    bool binary_files_requested_by_environment()
+    {
+        const char* env = std::getenv("XDYN_HDB_BINARY_CACHE");
+        return env and (std::string(env) != "0");
+    }
+
+    struct Cache
+    {
+        Cache() : mutex(), entries(), use_binary_files(binary_files_requested_by_environment()) {}
+        std::mutex mutex;
+        std::map<std::string, Entry> entries; //!< Keyed by the type & path of the file
+        bool use_binary_files;
+    };
+
+    Cache& cache()
+    {
+        static Cache c;
+        return c;
+    }
+
+    bool read_binary_file(const std::string& path, const uint64_t hash, hdb::AST& ast)
+    {
+        std::ifstream file(path.c_str(), std::ios::binary);
+        if (not(file.good())) return false;
+        const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return hdb::from_binary(contents, hash, ast);
+    }
+
+    void write_binary_file(const std::string& path, const uint64_t hash, const hdb::AST& ast)
+    {
+        // Written to a temporary file first, so other processes never read a partial file
+        const std::string tmp = path + ".tmp";
+        {
+            std::ofstream file(tmp.c_str(), std::ios::binary | std::ios::trunc);
+            const std::string contents = hdb::to_binary(ast, hash);
+            file.write(contents.data(), (std::streamsize)contents.size());
+            if (not(file.good()))
+            {
+                std::cerr << "Warning: unable to write the binary version of the HDB file to '" << tmp << "': the HDB file will be parsed again next time." << std::endl;
+                std::remove(tmp.c_str());
+                return;
+            }
+        }
+        std::remove(path.c_str()); // std::rename does not overwrite existing files on Windows
+        if (std::rename(tmp.c_str(), path.c_str()) != 0)
+        {
+            std::cerr << "Warning: unable to rename '" << tmp << "' to '" << path << "': the HDB file will be parsed again next time." << std::endl;
+            std::remove(tmp.c_str());
+        }
+    }
+
+    std::shared_ptr<HydroDBParser> parse_hdb(const std::string& hdb_filename, const std::string& contents, const uint64_t hash, const bool use_binary_files)
+    {
+        if (not(use_binary_files))
+        {
+            return std::shared_ptr<HydroDBParser>(new HDBParser(HDBParser::from_string(contents)));
+        }
+        const std::string binary = HydroDBCache::binary_filename(hdb_filename);
+        hdb::AST ast;
+        if (not(read_binary_file(binary, hash, ast)))
+        {
+            ast = hdb::parse(contents);
+            write_binary_file(binary, hash, ast);
+        }
+        return std::shared_ptr<HydroDBParser>(new HDBParser(HDBParser::from_ast(ast)));
+    }
+}
+
+std::shared_ptr<HydroDBParser> HydroDBCache::get(const std::string& hdb_filename, const std::string& precal_filename)
+{
+    const bool is_hdb = not(hdb_filename.empty());
+    if (not(is_hdb) and precal_filename.empty())
+    {
+        return std::shared_ptr<HydroDBParser>();
+    }
+    const std::string& filename = is_hdb ? hdb_filename : precal_filename;
+    const std::string contents = ssc::text_file_reader::TextFileReader(filename).get_contents();
+    const uint64_t h = hash(contents);
+    Cache& c = cache();
+    // The lock is held while parsing so each file is only parsed once, even if several threads ask for it
+    std::lock_guard<std::mutex> lock(c.mutex);
+    Entry& entry = c.entries[(is_hdb ? "hdb:" : "precal:") + filename];
+    if (entry.parser and (entry.hash == h))
+    {
+        return entry.parser;
+    }
+    const std::shared_ptr<HydroDBParser> parser = is_hdb ? parse_hdb(hdb_filename, contents, h, c.use_binary_files)
+                                                         : std::shared_ptr<HydroDBParser>(new PrecalParser(PrecalParser::from_string(contents)));
+    entry.hash = h;
+    entry.parser = parser;
+    return parser;
+}
+
+void HydroDBCache::clear()
+{
+    Cache& c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    c.entries.clear();
+}
+
+size_t HydroDBCache::size()
+{
+    Cache& c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    size_t n = 0;
+    for (const auto& entry:c.entries) n += entry.second.parser ? 1 : 0;
+    return n;
+}
+
+void HydroDBCache::set_use_of_binary_files(const bool use_binary_files)
+{
+    Cache& c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    c.use_binary_files = use_binary_files;
+}
+
+bool HydroDBCache::get_use_of_binary_files()
+{
+    Cache& c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    return c.use_binary_files;
+}
+
+std::string HydroDBCache::binary_filename(const std::string& hdb_filename)
+{
+    return hdb_filename + ".xdynbin";
+}
+
+uint64_t HydroDBCache::hash(const std::string& contents)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (const char c:contents)
+    {
+        h ^= (uint64_t)(unsigned char)c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
@@ -0,0 +1,54 @@
+/*
+ * HydroDBCache.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HYDRODBCACHE_HPP_
+#define HYDRODBCACHE_HPP_
+
+#include "HydroDBParser.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/** \brief Process-wide cache of the parsed hydrodynamic databases (HDB & PRECAL_R files)
+ *  \details All the models using the same file (added mass, radiation damping, diffraction, Froude-Krylov,
+ *           gRPC models...) share the same parser, keyed by the path of the file & a hash of its contents
+ *           (so a file modified between two simulations in the same process is parsed again).
+ *           The file is still read at each call (to compute the hash) but only parsed once.
+ *           Optionally (cf. set_use_of_binary_files), the AST of each HDB file is also written next to it
+ *           (cf. binary_filename & hdb::to_binary) & later runs read it instead of parsing the text.
+ *           The parsers are shared, so they must not be modified once they are in the cache.
+ *           All the functions are thread-safe.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/HydroDBCacheTest.cpp HydroDBCacheTest example
+ */
+class HydroDBCache
+{
+    public:
+        HydroDBCache() = delete;
+
+        /**  \brief Same as parser_factory: HDB file if hdb_filename is not empty, PRECAL_R file otherwise, nullptr if both are empty
+          */
+        static std::shared_ptr<HydroDBParser> get(const std::string& hdb_filename, const std::string& precal_filename);
+
+        static void clear();                                      //!< Removes all the parsers from the cache (they are deleted once no model uses them)
+        static size_t size();                                     //!< Number of parsers in the cache
+
+        /**  \brief Should the HDB files be read from (and written to) binary files?
+          *  \details Off by default, unless environment variable XDYN_HDB_BINARY_CACHE is set (to anything but 0).
+          *           Binary files which cannot be written (eg. read-only directory) are skipped with a warning
+          *           & binary files written for another version of the file or of the format are overwritten.
+          */
+        static void set_use_of_binary_files(const bool use_binary_files);
+        static bool get_use_of_binary_files();
+
+        static std::string binary_filename(const std::string& hdb_filename); //!< Where the binary version of hdb_filename is written
+        static uint64_t hash(const std::string& contents);                    //!< 64-bit FNV-1a hash (not cryptographic)
+};
+
+#endif /* HYDRODBCACHE_HPP_ */
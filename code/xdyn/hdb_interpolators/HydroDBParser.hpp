@@ -9,6 +9,7 @@
 #define __HYDRODBPARSERHPP__
 
 #include <array>
+#include <memory>
 #include <vector>
 #include <Eigen/Dense>
 #include "TimestampedMatrix.hpp"
@@ -0,0 +1,207 @@
+/*
+ * PronyApproximation.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "PronyApproximation.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <limits>
+
+#define MAX_POLE_MODULUS (1-1E-9) // So that all exponentials decay (& their integrals are finite)
+
+double relative_rms_error(const std::function<double(double)>& K, const PronyApproximation& approximation, const std::vector<double>& taus);
+double relative_rms_error(const std::function<double(double)>& K, const PronyApproximation& approximation, const std::vector<double>& taus)
+{
+    double squared_error = 0;
+    double squared_K = 0;
+    for (const auto tau:taus)
+    {
+        const double k = K(tau);
+        const double e = approximation(tau) - k;
+        squared_error += e*e;
+        squared_K += k*k;
+    }
+    if (squared_K == 0) return squared_error == 0 ? 0 : std::numeric_limits<double>::infinity();
+    return std::sqrt(squared_error/squared_K);
+}
+
+PronyApproximation::PronyApproximation(const std::function<double(double)>& K, const std::vector<double>& taus, const size_t max_nb_of_exponentials) :
+        tau0(taus.empty() ? 0 : taus.front()), poles(), residues(), relative_error(0)
+{
+    if (taus.size() < 2)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Need at least two instants to approximate a retardation function, but got " << taus.size());
+    }
+    const double dt = taus[1] - taus[0];
+    if (dt <= 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Instants should be strictly increasing, but got tau[0] = " << taus[0] << " & tau[1] = " << taus[1]);
+    }
+    std::vector<double> samples;
+    samples.reserve(taus.size());
+    bool K_is_zero = true;
+    for (const auto tau:taus)
+    {
+        samples.push_back(K(tau));
+        K_is_zero &= samples.back() == 0;
+    }
+    if (K_is_zero) return;
+
+    std::vector<double> fine_taus;
+    const size_t n = 4*(taus.size()-1);
+    for (size_t i = 0 ; i <= n ; ++i)
+    {
+        fine_taus.push_back(taus.front() + (taus.back()-taus.front())*(double)i/(double)n);
+    }
+
+    // Try all orders & keep the most accurate (Prony's method does not necessarily improve with the order),
+    // each additional exponential having to reduce the error by 10 % to be worth its cost during the simulation
+    // (& stop once the relative error is below 1E-6)
+    std::vector<std::complex<double> > best_poles;
+    std::vector<std::complex<double> > best_residues;
+    double best_error = std::numeric_limits<double>::infinity();
+    for (size_t nb_of_exponentials = 1 ; (nb_of_exponentials <= std::min(max_nb_of_exponentials, samples.size()/2)) && (best_error > 1E-6) ; ++nb_of_exponentials)
+    {
+        if (fit(samples, dt, nb_of_exponentials))
+        {
+            const double error = relative_rms_error(K, *this, fine_taus);
+            if (error < 0.9*best_error)
+            {
+                best_error = error;
+                best_poles = poles;
+                best_residues = residues;
+            }
+        }
+    }
+    if (best_poles.empty())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unable to approximate the retardation function by a sum of exponentials");
+    }
+    poles = best_poles;
+    residues = best_residues;
+    relative_error = best_error;
+}
+
+bool PronyApproximation::fit(const std::vector<double>& K, const double dt, const size_t p)
+{
+    const Eigen::Index N = (Eigen::Index)K.size();
+    const Eigen::Index P = (Eigen::Index)p;
+    // Linear prediction: K[n] + c_1.K[n-1] + ... + c_p.K[n-p] = 0 in the least-squares sense
+    Eigen::MatrixXd A(N-P, P);
+    Eigen::VectorXd b(N-P);
+    for (Eigen::Index r = 0 ; r < N-P ; ++r)
+    {
+        for (Eigen::Index m = 0 ; m < P ; ++m)
+        {
+            A(r,m) = K[(size_t)(r+P-1-m)];
+        }
+        b(r) = -K[(size_t)(r+P)];
+    }
+    const Eigen::VectorXd c = A.colPivHouseholderQr().solve(b);
+
+    // The roots of z^p + c_1.z^(p-1) + ... + c_p are the eigenvalues of its companion matrix
+    Eigen::MatrixXd companion = Eigen::MatrixXd::Zero(P, P);
+    companion.row(0) = -c.transpose();
+    for (Eigen::Index m = 1 ; m < P ; ++m)
+    {
+        companion(m,m-1) = 1;
+    }
+    const Eigen::VectorXcd z = Eigen::EigenSolver<Eigen::MatrixXd>(companion, false).eigenvalues();
+
+    poles.clear();
+    for (Eigen::Index k = 0 ; k < P ; ++k)
+    {
+        std::complex<double> zk = z(k);
+        const double modulus = std::abs(zk);
+        if (not(std::isfinite(modulus)) || (modulus < 1E-12)) continue; // Mode vanishing after one sample: negligible
+        if (modulus > 1)               zk = 1./std::conj(zk);            // Unstable pole: reflected inside the unit circle
+        if (std::abs(zk) > MAX_POLE_MODULUS) zk *= MAX_POLE_MODULUS/std::abs(zk);
+        poles.push_back(std::log(zk)/dt);
+    }
+    if (poles.empty()) return false;
+
+    // Residues: sum_k a_k.exp(s_k.n.dt) = K[n] in the least-squares sense
+    const Eigen::Index Q = (Eigen::Index)poles.size();
+    Eigen::MatrixXcd V(N, Q);
+    Eigen::VectorXcd y(N);
+    for (Eigen::Index n = 0 ; n < N ; ++n)
+    {
+        for (Eigen::Index k = 0 ; k < Q ; ++k)
+        {
+            V(n,k) = std::exp(poles[(size_t)k]*((double)n*dt));
+        }
+        y(n) = K[(size_t)n];
+    }
+    const Eigen::VectorXcd a = V.colPivHouseholderQr().solve(y);
+    residues.clear();
+    for (Eigen::Index k = 0 ; k < Q ; ++k)
+    {
+        if (not(std::isfinite(a(k).real())) || not(std::isfinite(a(k).imag()))) return false;
+        residues.push_back(a(k));
+    }
+    return true;
+}
+
+double PronyApproximation::operator()(const double tau) const
+{
+    std::complex<double> ret = 0;
+    for (size_t k = 0 ; k < poles.size() ; ++k)
+    {
+        ret += residues[k]*std::exp(poles[k]*(tau-tau0));
+    }
+    return ret.real();
+}
+
+double PronyApproximation::integral(const double tau) const
+{
+    std::complex<double> ret = 0;
+    for (size_t k = 0 ; k < poles.size() ; ++k)
+    {
+        ret += residues[k]*(std::exp(poles[k]*(tau-tau0)) - 1.)/poles[k];
+    }
+    return ret.real();
+}
+
+std::complex<double> PronyApproximation::fourier_transform(const double omega, const double tau) const
+{
+    // K is the real part of g = sum_k a_k.exp(s_k.(tau-tau0)), so its transform is the half-sum of those of g & conj(g)
+    const std::complex<double> i_omega(0, omega);
+    std::complex<double> ret = 0;
+    for (size_t k = 0 ; k < poles.size() ; ++k)
+    {
+        const std::complex<double> s1 = poles[k] - i_omega;
+        const std::complex<double> s2 = std::conj(poles[k]) - i_omega;
+        ret += residues[k]*(std::exp(s1*(tau-tau0)) - 1.)/s1 + std::conj(residues[k])*(std::exp(s2*(tau-tau0)) - 1.)/s2;
+    }
+    return ret*std::exp(-i_omega*tau0)/2.;
+}
+
+size_t PronyApproximation::size() const
+{
+    return poles.size();
+}
+
+double PronyApproximation::get_tau0() const
+{
+    return tau0;
+}
+
+std::vector<std::complex<double> > PronyApproximation::get_poles() const
+{
+    return poles;
+}
+
+std::vector<std::complex<double> > PronyApproximation::get_residues() const
+{
+    return residues;
+}
+
+double PronyApproximation::get_relative_error() const
+{
+    return relative_error;
+}
@@ -0,0 +1,70 @@
+/*
+ * PronyApproximation.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef PRONYAPPROXIMATION_HPP_
+#define PRONYAPPROXIMATION_HPP_
+
+#include <complex>
+#include <functional>
+#include <vector>
+
+/** \brief Approximates a retardation function by a sum of (complex) exponentials
+ *  \details \f$K(\tau)\simeq\Re\left(\sum_k a_k e^{s_k(\tau-\tau_0)}\right)\f$ for \f$\tau\geq\tau_0\f$.
+ *           The poles \f$s_k\f$ are found using Prony's method (least-squares linear prediction
+ *           on regularly spaced samples of K, then roots of the characteristic polynomial)
+ *           & the residues \f$a_k\f$ by linear least squares. Unstable poles are reflected
+ *           inside the unit circle so the approximation always decays. All orders up to the
+ *           maximum number of exponentials are tried & the most accurate one is kept.
+ *           The convolution of such a function with a signal can be integrated recursively
+ *           (cf. StateSpaceConvolution), at a cost which does not depend on the length of the history.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/PronyApproximationTest.cpp PronyApproximationTest example
+ */
+class PronyApproximation
+{
+    public:
+        PronyApproximation(const std::function<double(double)>& K,  //!< Function to approximate
+                           const std::vector<double>& taus,         //!< Regularly spaced instants (increasing) at which K is sampled to compute the fit
+                           const size_t max_nb_of_exponentials      //!< Each pair of complex conjugate poles counts as two exponentials
+                           );
+
+        /**  \brief Value of the approximation at tau (tau >= tau0)
+          */
+        double operator()(const double tau) const;
+
+        /**  \brief Integral of the approximation between tau0 & tau
+          */
+        double integral(const double tau) const;
+
+        /**  \brief Fourier transform of the approximation, between tau0 & tau
+          *  \returns \f$\int_{\tau_0}^{\tau}K(u)e^{-i\omega u}du\f$
+          */
+        std::complex<double> fourier_transform(const double omega, const double tau) const;
+
+        size_t size() const; //!< Number of exponentials (0 if K is zero)
+        double get_tau0() const;
+        std::vector<std::complex<double> > get_poles() const;
+        std::vector<std::complex<double> > get_residues() const;
+
+        /**  \brief RMS of the difference between K & its approximation, relative to the RMS of K
+          *  \details Evaluated on a grid four times as fine as 'taus', so aliased poles are penalized.
+          */
+        double get_relative_error() const;
+
+    private:
+        PronyApproximation();
+
+        bool fit(const std::vector<double>& K, const double dt, const size_t nb_of_exponentials);
+
+        double tau0;
+        std::vector<std::complex<double> > poles;    //!< s_k (their real parts are negative)
+        std::vector<std::complex<double> > residues; //!< a_k
+        double relative_error;
+};
+
+#endif /* PRONYAPPROXIMATION_HPP_ */
@@ -0,0 +1,77 @@
+/*
+ * StateSpaceConvolution.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "StateSpaceConvolution.hpp"
+
+#include <cmath>
+
+StateSpaceConvolution::StateSpaceConvolution(const PronyApproximation& K_, const double tau_start) : K(K_), poles(K_.get_poles()), weights(K_.get_residues()), y(K_.size(), 0)
+{
+    for (size_t k = 0 ; k < weights.size() ; ++k)
+    {
+        weights[k] *= std::exp(poles[k]*(tau_start-K.get_tau0()));
+    }
+}
+
+void StateSpaceConvolution::reset()
+{
+    for (auto& yk:y) yk = 0;
+}
+
+std::complex<double> StateSpaceConvolution::advance(const size_t k, const std::complex<double>& yk, const double v0, const double v1, const double dt) const
+{
+    if (dt <= 0) return yk;
+    // y(dt) = exp(s.dt).y(0) + int_0^dt exp(s.(dt-u)).v(u) du, with v(u) = v0 + (v1-v0).u/dt
+    const std::complex<double> x = poles[k]*dt;
+    std::complex<double> I0; // int_0^dt exp(s.(dt-u)) du
+    std::complex<double> I1; // int_0^dt exp(s.(dt-u)).u du
+    const std::complex<double> E = std::exp(x);
+    if (std::abs(x) < 1E-3)
+    {
+        // Taylor series, to avoid catastrophic cancellations
+        I0 = dt*(1. + x*(1./2 + x*(1./6 + x/24.)));
+        I1 = dt*dt*(1./2 + x*(1./6 + x*(1./24 + x/120.)));
+    }
+    else
+    {
+        I0 = (E - 1.)/poles[k];
+        I1 = (E - 1. - x)/(poles[k]*poles[k]);
+    }
+    return E*yk + v0*I0 + ((v1-v0)/dt)*I1;
+}
+
+void StateSpaceConvolution::advance(const double v0, const double v1, const double dt)
+{
+    for (size_t k = 0 ; k < y.size() ; ++k)
+    {
+        y[k] = advance(k, y[k], v0, v1, dt);
+    }
+}
+
+double StateSpaceConvolution::get_value(const double v0, const double v1, const double dt) const
+{
+    std::complex<double> ret = 0;
+    for (size_t k = 0 ; k < y.size() ; ++k)
+    {
+        ret += weights[k]*advance(k, y[k], v0, v1, dt);
+    }
+    return ret.real();
+}
+
+double StateSpaceConvolution::get_value() const
+{
+    std::complex<double> ret = 0;
+    for (size_t k = 0 ; k < y.size() ; ++k)
+    {
+        ret += weights[k]*y[k];
+    }
+    return ret.real();
+}
+
+double StateSpaceConvolution::integral_of_kernel(const double tau) const
+{
+    return K.integral(tau);
+}
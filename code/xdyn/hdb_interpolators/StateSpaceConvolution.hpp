@@ -0,0 +1,68 @@
+/*
+ * StateSpaceConvolution.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef STATESPACECONVOLUTION_HPP_
+#define STATESPACECONVOLUTION_HPP_
+
+#include "PronyApproximation.hpp"
+
+#include <complex>
+#include <vector>
+
+/** \brief Recursive convolution of a signal with a sum of exponentials
+ *  \details Computes \f$\int_{\tau_s}^{+\infty}K(\tau)v(T+\tau_s-\tau)d\tau\f$, K being a PronyApproximation,
+ *           ie. \f$\Re\left(\sum_k a_k e^{s_k(\tau_s-\tau_0)} y_k(T)\right)\f$ where each state \f$y_k\f$ obeys
+ *           \f$\dot{y_k}=s_k y_k + v\f$ (v being zero before the first call to 'advance').
+ *           The states are integrated exactly over each interval during which v varies linearly,
+ *           so the cost & memory do not depend on how far back the convolution goes.
+ *           The caller feeds the signal with a delay of \f$\tau_s\f$ (ie. T is \f$t-\tau_s\f$): the
+ *           convolution truncated to \f$[\tau_0,\tau_{max}]\f$ is the difference of the values
+ *           obtained with \f$\tau_s=\tau_0\f$ & \f$\tau_s=\tau_{max}\f$.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/PronyApproximationTest.cpp StateSpaceConvolutionTest example
+ */
+class StateSpaceConvolution
+{
+    public:
+        StateSpaceConvolution(const PronyApproximation& K, //!< Kernel of the convolution
+                              const double tau_start        //!< Lower bound of the convolution integral (tau_s, greater than or equal to tau0)
+                              );
+
+        /**  \brief Sets all states to zero
+          */
+        void reset();
+
+        /**  \brief Integrates the states over an interval during which the signal varies linearly from v0 to v1
+          */
+        void advance(const double v0, //!< Value of the signal at the beginning of the interval
+                     const double v1, //!< Value of the signal at the end of the interval
+                     const double dt  //!< Length of the interval (positive)
+                     );
+
+        /**  \brief Value of the convolution at the end of an interval, without changing the states
+          *  \details Same as calling 'advance' then 'get_value', but the interval is not committed (eg. because
+          *           the signal at the end of the interval is not final yet).
+          */
+        double get_value(const double v0, const double v1, const double dt) const;
+        double get_value() const;
+
+        /**  \brief Approximation of the integral of K between tau0 & tau
+          */
+        double integral_of_kernel(const double tau) const;
+
+    private:
+        StateSpaceConvolution();
+        std::complex<double> advance(const size_t k, const std::complex<double>& y, const double v0, const double v1, const double dt) const;
+
+        PronyApproximation K;
+        std::vector<std::complex<double> > poles;
+        std::vector<std::complex<double> > weights; //!< a_k.exp(s_k.(tau_s-tau0))
+        std::vector<std::complex<double> > y;
+};
+
+#endif /* STATESPACECONVOLUTION_HPP_ */
@@ -397,3 +397,136 @@ TEST_F(HistoryTest, values_before_oldest_should_be_equal_to_oldest)
     h.record(Tmax + 5, a.random<double>());
     ASSERT_DOUBLE_EQ(h(h.get_duration()+1), h(Tmax));
 }
+
+TEST_F(HistoryTest, long_histories_should_only_keep_the_last_Tmax_seconds)
+{
+    const double Tmax = 1;
+    const double dt = 1./64; // Exact in binary, so no point is interpolated when the oldest ones are forgotten
+    History h(Tmax);
+    for (size_t i = 0 ; i < 10000 ; ++i)
+    {
+        const double t = (double)i*dt;
+        h.record(t, 3*t+1);
+        if (t >= Tmax)
+        {
+            ASSERT_EQ(65, h.size()) << "i = " << i;
+            ASSERT_DOUBLE_EQ(t-Tmax, h[0].first) << "i = " << i;
+            ASSERT_DOUBLE_EQ(t, h[-1].first) << "i = " << i;
+            ASSERT_DOUBLE_EQ(3*t+1, h(0)) << "i = " << i;
+            ASSERT_DOUBLE_EQ(3*(t-0.3)+1, h(0.3)) << "i = " << i;
+            ASSERT_DOUBLE_EQ(3*(t-Tmax)+1, h(2*Tmax)) << "i = " << i;
+            ASSERT_DOUBLE_EQ(3*(t-0.5)+1, h.average(1)) << "i = " << i;
+        }
+    }
+    h.reset();
+    ASSERT_TRUE(h.is_empty());
+    h.record(2, 4);
+    h.record(3, 5);
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(4.5, h(0.5));
+}
+
+TEST_F(HistoryTest, tentative_values_are_seen_until_they_are_discarded)
+{
+    //! [HistoryTest record_tentatively_example]
+    History h(10);
+    h.record(0, 1);
+    h.record(1, 3);
+    h.record_tentatively(1.5, 7); // Intermediate stage of a Runge-Kutta step
+    ASSERT_DOUBLE_EQ(7, h(0));
+    ASSERT_DOUBLE_EQ(5, h(0.25));
+    h.record_tentatively(2, 9);   // Replaces the previous tentative value
+    ASSERT_EQ(3, h.size());
+    ASSERT_DOUBLE_EQ(9, h(0));
+    ASSERT_DOUBLE_EQ(6, h(0.5));
+    h.discard_tentative_value();  // Eg. the step was rejected
+    //! [HistoryTest record_tentatively_example]
+    ASSERT_FALSE(h.has_tentative_value());
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(1, h.get_current_time());
+    ASSERT_DOUBLE_EQ(3, h(0));
+}
+
+TEST_F(HistoryTest, discarding_a_tentative_value_restores_the_value_it_replaced)
+{
+    History h(10);
+    h.record(0, 1);
+    h.record(1, 3);
+    h.record_tentatively(1, 4);
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(4, h(0));
+    h.discard_tentative_value();
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(3, h(0));
+    ASSERT_DOUBLE_EQ(2, h(0.5));
+}
+
+TEST_F(HistoryTest, recording_a_value_discards_the_tentative_value)
+{
+    History h(10);
+    h.record(0, 1);
+    h.record_tentatively(0.5, 100);
+    h.record(1, 3);
+    ASSERT_FALSE(h.has_tentative_value());
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(2, h(0.5));
+}
+
+TEST_F(HistoryTest, committed_tentative_values_are_kept)
+{
+    History h(10);
+    h.record(0, 1);
+    h.record_tentatively(1, 3);
+    h.commit();
+    ASSERT_FALSE(h.has_tentative_value());
+    h.record_tentatively(2, 5);
+    h.discard_tentative_value();
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(3, h(0));
+}
+
+TEST_F(HistoryTest, oldest_values_are_only_forgotten_when_a_tentative_value_is_committed)
+{
+    History h(1);
+    h.record(0, 1);
+    h.record(1, 2);
+    h.record_tentatively(1.5, 3);
+    ASSERT_EQ(3, h.size());
+    ASSERT_DOUBLE_EQ(0, h[0].first);
+    h.discard_tentative_value();
+    ASSERT_DOUBLE_EQ(0, h[0].first);
+    h.record_tentatively(1.5, 3);
+    h.commit();
+    ASSERT_DOUBLE_EQ(0.5, h[0].first);
+    ASSERT_DOUBLE_EQ(1.5, h(1));
+}
+
+TEST_F(HistoryTest, cannot_record_tentative_values_in_the_past)
+{
+    History h(10);
+    h.record(1, 1);
+    ASSERT_THROW(h.record_tentatively(0.5, 2), InternalErrorException);
+}
+
+TEST_F(HistoryTest, first_tentative_value_can_be_discarded)
+{
+    History h(10);
+    h.record_tentatively(3, 2);
+    ASSERT_DOUBLE_EQ(2, h(0));
+    h.discard_tentative_value();
+    ASSERT_TRUE(h.is_empty());
+    h.record(1, 4);
+    ASSERT_DOUBLE_EQ(1, h.get_current_time());
+}
+
+TEST_F(HistoryTest, can_record_is_false_for_instants_before_the_newest_recorded_instant)
+{
+    History h(10);
+    ASSERT_TRUE(h.can_record(-3));
+    h.record(1, 2);
+    h.record(2, 3);
+    ASSERT_FALSE(h.can_record(1.5));
+    ASSERT_TRUE(h.can_record(2));
+    ASSERT_TRUE(h.can_record(2 - 1E-16));
+    ASSERT_TRUE(h.can_record(2.5));
+}
@@ -0,0 +1,160 @@
+/*
+ * HydroDBCacheTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "HydroDBCacheTest.hpp"
+#include "xdyn/hdb_interpolators/HydroDBCache.hpp"
+#include "xdyn/hdb_interpolators/HDBParser.hpp"
+#include "xdyn/external_file_formats/hdb_binary.hpp"
+#include "xdyn/external_file_formats/hdb_to_ast.hpp"
+#include "xdyn/test_data_generator/hdb_data.hpp"
+#include "xdyn/test_data_generator/precal_test_data.hpp"
+
+#include <boost/algorithm/string/replace.hpp>
+#include <boost/filesystem.hpp> // For boost::filesystem::unique_path
+#include <fstream>
+#include <iterator>
+
+HydroDBCacheTest::HydroDBCacheTest() :
+    hdb_filename(boost::filesystem::unique_path().string() + ".hdb"),
+    precal_filename(boost::filesystem::unique_path().string() + ".ini")
+{
+}
+
+HydroDBCacheTest::~HydroDBCacheTest()
+{
+}
+
+void HydroDBCacheTest::SetUp()
+{
+    HydroDBCache::clear();
+    HydroDBCache::set_use_of_binary_files(false);
+    write(hdb_filename, test_data::test_ship_hdb());
+    write(precal_filename, test_data::precal());
+}
+
+void HydroDBCacheTest::TearDown()
+{
+    HydroDBCache::clear();
+    HydroDBCache::set_use_of_binary_files(false);
+    for (const auto& filename:{hdb_filename, precal_filename, HydroDBCache::binary_filename(hdb_filename)})
+    {
+        if (boost::filesystem::exists(filename)) boost::filesystem::remove(filename);
+    }
+}
+
+void HydroDBCacheTest::write(const std::string& filename, const std::string& contents) const
+{
+    std::ofstream of(filename.c_str(), std::ios::binary | std::ios::trunc);
+    of << contents;
+}
+
+TEST_F(HydroDBCacheTest, example)
+{
+//! [HydroDBCacheTest example]
+    const std::shared_ptr<HydroDBParser> radiation_damping = HydroDBCache::get(hdb_filename, "");
+    const std::shared_ptr<HydroDBParser> diffraction = HydroDBCache::get(hdb_filename, "");
+//! [HydroDBCacheTest example]
+//! [HydroDBCacheTest expected output]
+    ASSERT_EQ(radiation_damping.get(), diffraction.get());
+    ASSERT_EQ(1, HydroDBCache::size());
+//! [HydroDBCacheTest expected output]
+}
+
+TEST_F(HydroDBCacheTest, parser_factory_uses_the_cache)
+{
+    const std::shared_ptr<HydroDBParser> parser = HydroDBCache::get(hdb_filename, "");
+    ASSERT_EQ(parser.get(), parser_factory(hdb_filename, "").get());
+    ASSERT_EQ(parser.get(), parser_factory(hdb_filename, precal_filename).get());
+}
+
+TEST_F(HydroDBCacheTest, returns_nullptr_if_there_is_no_file)
+{
+    ASSERT_FALSE(HydroDBCache::get("", ""));
+    ASSERT_EQ(0, HydroDBCache::size());
+}
+
+TEST_F(HydroDBCacheTest, precal_r_files_are_cached_too)
+{
+    const std::shared_ptr<HydroDBParser> precal = HydroDBCache::get("", precal_filename);
+    ASSERT_EQ(precal.get(), HydroDBCache::get("", precal_filename).get());
+    ASSERT_NE(precal.get(), HydroDBCache::get(hdb_filename, "").get());
+    ASSERT_EQ(2, HydroDBCache::size());
+}
+
+TEST_F(HydroDBCacheTest, modified_files_are_parsed_again)
+{
+    const std::shared_ptr<HydroDBParser> before = HydroDBCache::get(hdb_filename, "");
+    write(hdb_filename, boost::algorithm::replace_first_copy(test_data::test_ship_hdb(), "[FORWARD_SPEED]   0.00", "[FORWARD_SPEED]   2.00"));
+    const std::shared_ptr<HydroDBParser> after = HydroDBCache::get(hdb_filename, "");
+    ASSERT_NE(before.get(), after.get());
+    ASSERT_DOUBLE_EQ(0, before->get_forward_speed());
+    ASSERT_DOUBLE_EQ(2, after->get_forward_speed());
+    ASSERT_EQ(1, HydroDBCache::size());
+}
+
+TEST_F(HydroDBCacheTest, clear_does_not_invalidate_the_parsers_in_use)
+{
+    const std::shared_ptr<HydroDBParser> parser = HydroDBCache::get(hdb_filename, "");
+    HydroDBCache::clear();
+    ASSERT_EQ(0, HydroDBCache::size());
+    ASSERT_DOUBLE_EQ(0, parser->get_forward_speed());
+    ASSERT_NE(parser.get(), HydroDBCache::get(hdb_filename, "").get());
+}
+
+TEST_F(HydroDBCacheTest, binary_files_are_not_written_by_default)
+{
+    HydroDBCache::get(hdb_filename, "");
+    ASSERT_FALSE(boost::filesystem::exists(HydroDBCache::binary_filename(hdb_filename)));
+}
+
+TEST_F(HydroDBCacheTest, can_write_binary_files)
+{
+    HydroDBCache::set_use_of_binary_files(true);
+    const std::shared_ptr<HydroDBParser> parser = HydroDBCache::get(hdb_filename, "");
+    ASSERT_TRUE(boost::filesystem::exists(HydroDBCache::binary_filename(hdb_filename)));
+    std::ifstream file(HydroDBCache::binary_filename(hdb_filename).c_str(), std::ios::binary);
+    const std::string binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const std::string contents = test_data::test_ship_hdb();
+    ASSERT_EQ(hdb::to_binary(hdb::parse(contents), HydroDBCache::hash(contents)), binary);
+    ASSERT_TRUE(parser->get_added_mass() == HDBParser::from_string(contents).get_added_mass());
+}
+
+TEST_F(HydroDBCacheTest, binary_files_are_used_instead_of_the_text_if_they_are_up_to_date)
+{
+    // Binary file for the current HDB file, but with another forward speed, to see which one is used
+    const std::string contents = test_data::test_ship_hdb();
+    const std::string other = boost::algorithm::replace_first_copy(contents, "[FORWARD_SPEED]   0.00", "[FORWARD_SPEED]   3.00");
+    write(HydroDBCache::binary_filename(hdb_filename), hdb::to_binary(hdb::parse(other), HydroDBCache::hash(contents)));
+    HydroDBCache::set_use_of_binary_files(true);
+    ASSERT_DOUBLE_EQ(3, HydroDBCache::get(hdb_filename, "")->get_forward_speed());
+}
+
+TEST_F(HydroDBCacheTest, binary_files_are_ignored_and_overwritten_if_they_are_out_of_date)
+{
+    const std::string contents = test_data::test_ship_hdb();
+    const std::string other = boost::algorithm::replace_first_copy(contents, "[FORWARD_SPEED]   0.00", "[FORWARD_SPEED]   3.00");
+    write(HydroDBCache::binary_filename(hdb_filename), hdb::to_binary(hdb::parse(other), HydroDBCache::hash(other)));
+    HydroDBCache::set_use_of_binary_files(true);
+    ASSERT_DOUBLE_EQ(0, HydroDBCache::get(hdb_filename, "")->get_forward_speed());
+    std::ifstream file(HydroDBCache::binary_filename(hdb_filename).c_str(), std::ios::binary);
+    const std::string binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(hdb::to_binary(hdb::parse(contents), HydroDBCache::hash(contents)), binary);
+}
+
+TEST_F(HydroDBCacheTest, corrupted_binary_files_are_ignored)
+{
+    HydroDBCache::set_use_of_binary_files(true);
+    write(HydroDBCache::binary_filename(hdb_filename), "XDYNHDB");
+    ASSERT_DOUBLE_EQ(0, HydroDBCache::get(hdb_filename, "")->get_forward_speed());
+}
+
+TEST_F(HydroDBCacheTest, hash_depends_on_all_characters)
+{
+    ASSERT_EQ(HydroDBCache::hash("abc"), HydroDBCache::hash("abc"));
+    ASSERT_NE(HydroDBCache::hash("abc"), HydroDBCache::hash("abd"));
+    ASSERT_NE(HydroDBCache::hash("abc"), HydroDBCache::hash("abc "));
+    ASSERT_NE(HydroDBCache::hash(""), HydroDBCache::hash(std::string(1, '\0')));
+}
@@ -0,0 +1,25 @@
+/*
+ * HydroDBCacheTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HYDRODBCACHETEST_HPP_
+#define HYDRODBCACHETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <string>
+
+class HydroDBCacheTest : public ::testing::Test
+{
+    protected:
+        HydroDBCacheTest();
+        virtual ~HydroDBCacheTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        void write(const std::string& filename, const std::string& contents) const;
+        const std::string hdb_filename;
+        const std::string precal_filename;
+};
+
+#endif  /* HYDRODBCACHETEST_HPP_ */
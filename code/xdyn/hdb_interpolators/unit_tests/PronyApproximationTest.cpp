@@ -0,0 +1,227 @@
+/*
+ * PronyApproximationTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "PronyApproximationTest.hpp"
+#include "PronyApproximation.hpp"
+#include "StateSpaceConvolution.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <cmath>
+
+PronyApproximationTest::PronyApproximationTest() : a(ssc::random_data_generator::DataGenerator(87412))
+{
+}
+
+PronyApproximationTest::~PronyApproximationTest()
+{
+}
+
+void PronyApproximationTest::SetUp()
+{
+}
+
+void PronyApproximationTest::TearDown()
+{
+}
+
+std::vector<double> regular_intervals(const double xmin, const double xmax, const size_t n);
+std::vector<double> regular_intervals(const double xmin, const double xmax, const size_t n)
+{
+    std::vector<double> ret;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        ret.push_back(xmin + (xmax-xmin)*(double)i/(double)(n-1));
+    }
+    return ret;
+}
+
+double K3(const double tau);
+double K3(const double tau)
+{
+    return 2*std::exp(-0.2*tau) + std::exp(-0.5*tau)*std::cos(2*tau) - 0.5*std::exp(-0.5*tau)*std::sin(2*tau);
+}
+
+TEST_F(PronyApproximationTest, example)
+{
+    //! [PronyApproximationTest example]
+    const PronyApproximation K(K3, regular_intervals(0, 20, 200), 10);
+    //! [PronyApproximationTest example]
+    ASSERT_EQ(3, K.size());
+    ASSERT_LT(K.get_relative_error(), 1E-6);
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double tau = a.random<double>().between(0,20);
+        ASSERT_NEAR(K3(tau), K(tau), 1E-6);
+    }
+}
+
+TEST_F(PronyApproximationTest, poles_of_a_sum_of_exponentials_are_retrieved_exactly)
+{
+    const PronyApproximation K(K3, regular_intervals(0, 20, 200), 10);
+    const auto poles = K.get_poles();
+    ASSERT_EQ(3, poles.size());
+    size_t nb_of_real_poles = 0;
+    for (const auto s:poles)
+    {
+        if (std::abs(s.imag()) < 1E-6)
+        {
+            ASSERT_NEAR(-0.2, s.real(), 1E-6);
+            nb_of_real_poles++;
+        }
+        else
+        {
+            ASSERT_NEAR(-0.5, s.real(), 1E-6);
+            ASSERT_NEAR(2, std::abs(s.imag()), 1E-6);
+        }
+    }
+    ASSERT_EQ(1, nb_of_real_poles);
+}
+
+TEST_F(PronyApproximationTest, does_not_need_to_start_at_zero)
+{
+    const double tau0 = a.random<double>().between(0.1,1);
+    const PronyApproximation K(K3, regular_intervals(tau0, 20, 200), 10);
+    ASSERT_DOUBLE_EQ(tau0, K.get_tau0());
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double tau = a.random<double>().between(tau0,20);
+        ASSERT_NEAR(K3(tau), K(tau), 1E-6);
+    }
+}
+
+TEST_F(PronyApproximationTest, zero_retardation_function_has_no_exponential)
+{
+    const PronyApproximation K([](const double){return 0.;}, regular_intervals(0.2, 10, 100), 10);
+    ASSERT_EQ(0, K.size());
+    ASSERT_EQ(0, K(a.random<double>().between(0.2,10)));
+    ASSERT_EQ(0, K.integral(a.random<double>().between(0.2,10)));
+}
+
+TEST_F(PronyApproximationTest, number_of_exponentials_is_bounded)
+{
+    const size_t max_nb_of_exponentials = a.random<size_t>().between(1,5);
+    const auto K = [](const double tau){return std::exp(-0.1*tau)*std::cos(0.5*tau)/(1+tau*tau);};
+    const PronyApproximation approximation(K, regular_intervals(0.2, 10, 100), max_nb_of_exponentials);
+    ASSERT_LE(approximation.size(), max_nb_of_exponentials);
+    ASSERT_GE(approximation.size(), 1);
+}
+
+TEST_F(PronyApproximationTest, all_poles_are_stable)
+{
+    // Exponentially growing function: the poles are reflected inside the unit circle
+    const PronyApproximation K([](const double tau){return std::exp(0.3*tau) + std::cos(tau);}, regular_intervals(0, 10, 100), 10);
+    for (const auto s:K.get_poles())
+    {
+        ASSERT_LT(s.real(), 0);
+    }
+}
+
+TEST_F(PronyApproximationTest, integral_is_correct)
+{
+    const PronyApproximation K(K3, regular_intervals(0.2, 20, 200), 10);
+    const double tau = a.random<double>().between(0.2,20);
+    const size_t n = 10000;
+    double integral = 0;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        const double u = 0.2 + (tau-0.2)*((double)i+0.5)/(double)n;
+        integral += K3(u)*(tau-0.2)/(double)n;
+    }
+    ASSERT_NEAR(integral, K.integral(tau), 1E-6);
+}
+
+TEST_F(PronyApproximationTest, fourier_transform_is_correct)
+{
+    const PronyApproximation K(K3, regular_intervals(0.2, 20, 200), 10);
+    const double omega = a.random<double>().between(0,5);
+    const size_t n = 100000;
+    std::complex<double> F = 0;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        const double u = 0.2 + 9.8*((double)i+0.5)/(double)n;
+        F += K3(u)*std::exp(std::complex<double>(0,-omega*u))*9.8/(double)n;
+    }
+    ASSERT_NEAR(F.real(), K.fourier_transform(omega, 10).real(), 1E-6);
+    ASSERT_NEAR(F.imag(), K.fourier_transform(omega, 10).imag(), 1E-6);
+}
+
+TEST_F(PronyApproximationTest, should_throw_if_instants_are_invalid)
+{
+    ASSERT_THROW(PronyApproximation(K3, {1}, 10), InternalErrorException);
+    ASSERT_THROW(PronyApproximation(K3, {1, 1, 1}, 10), InternalErrorException);
+}
+
+double direct_convolution(const std::function<double(double)>& K, const std::function<double(double)>& v, const double t, const double tau_min, const double tau_max);
+double direct_convolution(const std::function<double(double)>& K, const std::function<double(double)>& v, const double t, const double tau_min, const double tau_max)
+{
+    const size_t n = 20000;
+    const double dtau = (tau_max-tau_min)/(double)n;
+    double ret = 0;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        const double tau = tau_min + ((double)i+0.5)*dtau;
+        if (t-tau >= 0) ret += K(tau)*v(t-tau)*dtau;
+    }
+    return ret;
+}
+
+TEST_F(PronyApproximationTest, state_space_convolution_is_correct)
+{
+    const double Tmin = 0.2;
+    const double Tmax = 10;
+    const double dt = 0.01;
+    const auto v = [](const double t){return std::sin(0.7*t) + 0.3*std::cos(2.1*t);};
+    //! [StateSpaceConvolutionTest example]
+    const PronyApproximation K(K3, regular_intervals(Tmin, Tmax, 100), 10);
+    StateSpaceConvolution from_tmin(K, Tmin);
+    StateSpaceConvolution from_tmax(K, Tmax);
+    for (size_t i = 0 ; i < 2000 ; ++i)
+    {
+        // The signal is zero before t = 0 & the convolution is truncated to [Tmin, Tmax]
+        const double t = (double)i*dt;
+        if (i >= 20)   from_tmin.advance(v(t-Tmin), v(t+dt-Tmin), dt);
+        if (i >= 1000) from_tmax.advance(v(t-Tmax), v(t+dt-Tmax), dt);
+    }
+    const double convolution = from_tmin.get_value() - from_tmax.get_value(); // At t = 20
+    //! [StateSpaceConvolutionTest example]
+    ASSERT_NEAR(direct_convolution(K3, v, 20, Tmin, Tmax), convolution, 1E-4);
+}
+
+TEST_F(PronyApproximationTest, state_space_convolution_can_be_evaluated_without_committing_the_last_interval)
+{
+    const PronyApproximation K(K3, regular_intervals(0, 10, 100), 10);
+    StateSpaceConvolution C(K, 0);
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        C.advance(a.random<double>().between(-1,1), a.random<double>().between(-1,1), a.random<double>().between(0,0.1));
+    }
+    const double v0 = a.random<double>().between(-1,1);
+    const double v1 = a.random<double>().between(-1,1);
+    const double dt = a.random<double>().between(0,0.1);
+    const double uncommitted = C.get_value(v0, v1, dt);
+    C.advance(v0, v1, dt);
+    ASSERT_DOUBLE_EQ(C.get_value(), uncommitted);
+}
+
+TEST_F(PronyApproximationTest, state_space_convolution_of_a_constant_is_the_integral_of_the_kernel)
+{
+    const PronyApproximation K(K3, regular_intervals(0, 10, 100), 10);
+    StateSpaceConvolution C(K, 0);
+    const double v = a.random<double>().between(-10,10);
+    C.advance(v, v, 3);
+    ASSERT_NEAR(v*C.integral_of_kernel(3), C.get_value(), 1E-10);
+    C.advance(v, v, 1E-6); // Taylor series
+    ASSERT_NEAR(v*C.integral_of_kernel(3+1E-6), C.get_value(), 1E-10);
+}
+
+TEST_F(PronyApproximationTest, state_space_convolution_can_be_reset)
+{
+    const PronyApproximation K(K3, regular_intervals(0, 10, 100), 10);
+    StateSpaceConvolution C(K, 0);
+    C.advance(1, 2, 3);
+    C.reset();
+    ASSERT_EQ(0, C.get_value());
+}
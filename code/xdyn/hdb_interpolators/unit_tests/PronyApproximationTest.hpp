@@ -0,0 +1,24 @@
+/*
+ * PronyApproximationTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#ifndef PRONYAPPROXIMATIONTEST_HPP_
+#define PRONYAPPROXIMATIONTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class PronyApproximationTest : public ::testing::Test
+{
+    protected:
+        PronyApproximationTest();
+        virtual ~PronyApproximationTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* PRONYAPPROXIMATIONTEST_HPP_ */
@@ -136,12 +136,39 @@ H5::DataSet H5_Tools::createDataSet(
         const H5::DataType& datasetType,
         const H5::DataSpace& space)
 {
+    return H5_Tools::createDataSet(file, datasetName, datasetType, space, 1, 0);
+}
+
+H5::DataSet H5_Tools::createDataSet(
+        const H5::H5File& file,
+        const std::string& datasetName,
+        const H5::DataType& datasetType,
+        const H5::DataSpace& space,
+        const hsize_t chunk_size,
+        const unsigned int compression_level)
+{
+    if (chunk_size == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "When creating dataset '" << datasetName << "', chunk size should be at least 1");
+    }
+    if (compression_level > 9)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "When creating dataset '" << datasetName << "', compression level should be between 0 and 9 (got " << compression_level << ")");
+    }
     const int nDims = space.getSimpleExtentNdims();
-    hsize_t * chunk_dims = new hsize_t[nDims];
-    for (int i=0;i<nDims;++i) chunk_dims[i]=1;
+    std::vector<hsize_t> chunk_dims((size_t)nDims, chunk_size);
     H5::DSetCreatPropList cparms;
-    cparms.setChunk(nDims, chunk_dims);
-    delete [] chunk_dims;
+    cparms.setChunk(nDims, chunk_dims.data());
+    if (compression_level > 0)
+    {
+        if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0)
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Compression of HDF5 outputs was requested but this HDF5 library does not provide the deflate filter");
+        }
+        // Shuffling the bytes of the doubles before deflating them groups the (slowly varying) exponents together
+        cparms.setShuffle();
+        cparms.setDeflate(compression_level);
+    }
     createMissingGroups(file, datasetName);
     if (H5_Tools::doesDataSetExist(file, datasetName))
     {
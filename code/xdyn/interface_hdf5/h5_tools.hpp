@@ -56,6 +56,24 @@ namespace H5_Tools
             const H5::H5File& file, const std::string& datasetName,
             const H5::DataType& datasetType, const H5::DataSpace& space);
 
+    /**
+     * \brief creates a chunked (and optionally compressed) dataset, if not
+     *        existing. Else, this function throws an exception
+     * \param[in] file HDF5 file descriptor
+     * \param[in] datasetName Location of the dataset. May contain /,
+     *                        indicating groups
+     * \param[in] datasetType dataset type
+     * \param[in] space dataset space
+     * \param[in] chunk_size Number of elements per chunk along each dimension
+     * \param[in] compression_level Deflate level (0: no compression, 1 to 9:
+     *                              shuffle + deflate filters)
+     * \return the dataset descriptor
+     */
+    H5::DataSet createDataSet(
+            const H5::H5File& file, const std::string& datasetName,
+            const H5::DataType& datasetType, const H5::DataSpace& space,
+            const hsize_t chunk_size, const unsigned int compression_level);
+
     /**
      * \brief open an existing data set
      * \param[in] file HDF5 file descriptor
@@ -48,16 +48,24 @@ boost::optional<WaveModelPtr> WaveModelBuilder<Airy>::try_to_parse(const std::st
         {
             ret.reset(WaveModelPtr(new Airy(spectrum,0.0)));
         }
+        if (parse_phasor_cache(yaml))
+        {
+            (*ret)->enable_phasor_cache();
+        }
     }
     return ret;
 }
 
-boost::optional<WaveModelPtr> WaveModelBuilder<Airy>::try_to_parse(const std::string& model, const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::string&) const
+boost::optional<WaveModelPtr> WaveModelBuilder<Airy>::try_to_parse(const std::string& model, const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::string& yaml) const
 {
     boost::optional<WaveModelPtr> ret;
     if (model == "airy")
     {
         ret.reset(WaveModelPtr(new Airy(spectrum)));
+        if (parse_phasor_cache(yaml))
+        {
+            (*ret)->enable_phasor_cache();
+        }
     }
     return ret;
 }
@@ -167,6 +175,7 @@ FlatDiscreteDirectionalWaveSpectrum SurfaceElevationBuilder<SurfaceElevationFrom
         // Infinite depth
         f.pdyn_factor = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
         f.pdyn_factor_sh = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
+        f.depth_factor = DepthFactorParameters(0, stretching.get_delta(), stretching.get_h());
     }
     else
     {
@@ -174,6 +183,7 @@ FlatDiscreteDirectionalWaveSpectrum SurfaceElevationBuilder<SurfaceElevationFrom
         const double h = spectrum.depth;
         f.pdyn_factor = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,h,eta,stretching);};
         f.pdyn_factor_sh = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor_sh(k,z,h,eta,stretching);};
+        f.depth_factor = DepthFactorParameters(h, stretching.get_delta(), stretching.get_h());
     }
     return f;
 }
@@ -0,0 +1,108 @@
+/*
+ * FacetBoundingBoxTree.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "FacetBoundingBoxTree.hpp"
+
+#include <algorithm> // std::nth_element
+
+FacetBoundingBoxTree::Box::Box() : centre(EPoint::Zero()), half_size(EPoint::Zero()), begin(0), end(0), left(0)
+{
+}
+
+FacetBoundingBoxTree::FacetBoundingBoxTree() : boxes(), facet_order(), nb_of_facets(0)
+{
+}
+
+FacetBoundingBoxTree::FacetBoundingBoxTree(const Matrix3x& nodes, const std::vector<Facet>& facets) : boxes(), facet_order(), nb_of_facets(facets.size())
+{
+    std::vector<EPoint> min_of_facet(facets.size(), EPoint::Zero());
+    std::vector<EPoint> max_of_facet(facets.size(), EPoint::Zero());
+    for (size_t i = 0 ; i < facets.size() ; ++i)
+    {
+        if (facets[i].vertex_index.empty()) continue;
+        min_of_facet[i] = nodes.col((long)facets[i].vertex_index.front());
+        max_of_facet[i] = min_of_facet[i];
+        for (const auto vertex:facets[i].vertex_index)
+        {
+            min_of_facet[i] = min_of_facet[i].cwiseMin(nodes.col((long)vertex));
+            max_of_facet[i] = max_of_facet[i].cwiseMax(nodes.col((long)vertex));
+        }
+        facet_order.push_back(i);
+    }
+    if (facet_order.empty()) return;
+    boxes.reserve(2*facet_order.size());
+    boxes.push_back(Box());
+    boxes.back().end = facet_order.size();
+    build(0, min_of_facet, max_of_facet);
+}
+
+void FacetBoundingBoxTree::build(const size_t box_index, const std::vector<EPoint>& min_of_facet, const std::vector<EPoint>& max_of_facet)
+{
+    const size_t begin = boxes[box_index].begin;
+    const size_t end = boxes[box_index].end;
+    EPoint m = min_of_facet[facet_order[begin]];
+    EPoint M = max_of_facet[facet_order[begin]];
+    for (size_t i = begin + 1 ; i < end ; ++i)
+    {
+        m = m.cwiseMin(min_of_facet[facet_order[i]]);
+        M = M.cwiseMax(max_of_facet[facet_order[i]]);
+    }
+    boxes[box_index].centre = (m + M)/2;
+    boxes[box_index].half_size = (M - m)/2;
+    if (end - begin < 2) return;
+
+    // Split at the median of the centres of the facets' boxes, along the largest dimension
+    Eigen::Index axis = 0;
+    boxes[box_index].half_size.maxCoeff(&axis);
+    const size_t middle = begin + (end - begin)/2;
+    std::nth_element(facet_order.begin() + (long)begin, facet_order.begin() + (long)middle, facet_order.begin() + (long)end,
+                     [&min_of_facet, &max_of_facet, axis](const size_t i, const size_t j)
+                     {return min_of_facet[i](axis) + max_of_facet[i](axis) < min_of_facet[j](axis) + max_of_facet[j](axis);});
+
+    const size_t left = boxes.size();
+    boxes[box_index].left = left;
+    boxes.push_back(Box());
+    boxes.push_back(Box());
+    boxes[left].begin = begin;
+    boxes[left].end = middle;
+    boxes[left+1].begin = middle;
+    boxes[left+1].end = end;
+    build(left, min_of_facet, max_of_facet);
+    build(left+1, min_of_facet, max_of_facet);
+}
+
+void FacetBoundingBoxTree::find_facets_above(const double tz, const EPoint& r3, const double z_max, std::vector<bool>& facet_is_above) const
+{
+    facet_is_above.resize(nb_of_facets);
+    for (size_t i = 0 ; i < nb_of_facets ; ++i) facet_is_above[i] = false;
+    if (boxes.empty()) return;
+    find_facets_above(0, tz, r3, r3.cwiseAbs(), z_max, facet_is_above);
+}
+
+void FacetBoundingBoxTree::find_facets_above(const size_t box_index, const double tz, const EPoint& r3, const EPoint& abs_r3, const double z_max, std::vector<bool>& facet_is_above) const
+{
+    const Box& box = boxes[box_index];
+    const double z = tz + r3.dot(box.centre);
+    const double dz = abs_r3.dot(box.half_size);
+    if (z + dz < z_max)
+    {
+        for (size_t i = box.begin ; i < box.end ; ++i) facet_is_above[facet_order[i]] = true;
+        return;
+    }
+    if ((z - dz >= z_max) or (box.left == 0)) return;
+    find_facets_above(box.left, tz, r3, abs_r3, z_max, facet_is_above);
+    find_facets_above(box.left + 1, tz, r3, abs_r3, z_max, facet_is_above);
+}
+
+bool FacetBoundingBoxTree::empty() const
+{
+    return boxes.empty();
+}
+
+size_t FacetBoundingBoxTree::get_nb_of_boxes() const
+{
+    return boxes.size();
+}
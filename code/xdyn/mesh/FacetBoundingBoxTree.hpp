@@ -0,0 +1,65 @@
+/*
+ * FacetBoundingBoxTree.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef FACETBOUNDINGBOXTREE_HPP_
+#define FACETBOUNDINGBOXTREE_HPP_
+
+#include "xdyn/external_data_structures/GeometricTypes3d.hpp"
+
+/** \brief Hierarchy of axis-aligned bounding boxes (in the mesh frame) over the facets of a mesh
+ *  \details Used to find the facets which are entirely above a given altitude (eg. above the highest
+ *           possible wave crest) without looking at each vertex: the altitude of the points of a box
+ *           lies within the altitude of its centre plus or minus the projection of its half-size,
+ *           whatever the attitude of the mesh. The facets are split along the largest dimension
+ *           of the boxes, at the median of their centroids, until each box contains a single facet.
+ *  \addtogroup mesh
+ *  \ingroup mesh
+ *  \section ex1 Example
+ *  \snippet mesh/unit_tests/FacetBoundingBoxTreeTest.cpp FacetBoundingBoxTreeTest example
+ */
+class FacetBoundingBoxTree
+{
+    public:
+        FacetBoundingBoxTree();
+        FacetBoundingBoxTree(const Matrix3x& nodes,               //!< Coordinates of the vertices (in the mesh frame)
+                             const std::vector<Facet>& facets     //!< Facets to put in the tree
+                             );
+
+        /**  \brief Marks the facets whose bounding boxes are entirely above z_max (hence all their vertices have a z-coordinate strictly smaller than z_max, in the NED frame)
+          *  \details z (in the NED frame) of point P (in the mesh frame) is tz + r3.dot(P): r3 is the last row of the
+          *           rotation matrix from the mesh frame to the NED frame & tz the z-coordinate of the origin of the mesh
+          *           frame in the NED frame.
+          */
+        void find_facets_above(
+                const double tz,                    //!< z-coordinate of the origin of the mesh frame in the NED frame
+                const EPoint& r3,                   //!< Last row of the rotation matrix from the mesh frame to the NED frame
+                const double z_max,                 //!< In the NED frame (z pointing downwards)
+                std::vector<bool>& facet_is_above   //!< Output: one element per facet (resized to the number of facets the tree was built with)
+                ) const;
+
+        bool empty() const;                         //!< True if the tree contains no facets
+        size_t get_nb_of_boxes() const;
+
+    private:
+        struct Box
+        {
+            Box();
+            EPoint centre;
+            EPoint half_size;
+            size_t begin;  //!< Index of the first facet of the box in 'facet_order'
+            size_t end;    //!< One past the index of the last facet of the box in 'facet_order'
+            size_t left;   //!< Index of the first child in 'boxes' (the second child follows it), 0 for leaves
+        };
+
+        void build(const size_t box_index, const std::vector<EPoint>& min_of_facet, const std::vector<EPoint>& max_of_facet);
+        void find_facets_above(const size_t box_index, const double tz, const EPoint& r3, const EPoint& abs_r3, const double z_max, std::vector<bool>& facet_is_above) const;
+
+        std::vector<Box> boxes;                     //!< The root is boxes[0]
+        std::vector<size_t> facet_order;            //!< Indices of the facets, sorted so that the facets of each box are contiguous
+        size_t nb_of_facets;                        //!< Including the facets without vertices (which are never marked)
+};
+
+#endif /* FACETBOUNDINGBOXTREE_HPP_ */
@@ -1,7 +1,7 @@
 
 #include "Mesh.hpp"
 #include "mesh_manipulations.hpp"
-#include <map>
+#include <utility> // std::move
 
 Mesh::Mesh():
     nodes(),
@@ -13,7 +13,10 @@ Mesh::Mesh():
     nb_of_static_edges(),
     nb_of_static_facets(),
     all_nodes(),
-    total_number_of_nodes()
+    total_number_of_nodes(),
+    spare_vertex_lists(),
+    vertex_stamps(),
+    stamp(0)
 {
 }
 
@@ -34,6 +37,9 @@ Mesh::Mesh(
 ,nb_of_static_facets(facets_.size())
 ,all_nodes(3,nb_of_static_nodes+nb_of_static_edges)
 ,total_number_of_nodes(nb_of_static_nodes)
+,spare_vertex_lists()
+,vertex_stamps((size_t)all_nodes.cols(), 0)
+,stamp(0)
 {
     Matrix3x room_for_dynamic_vertices(3,all_nodes.cols()-nodes.cols());
     room_for_dynamic_vertices.fill(0);
@@ -45,28 +51,42 @@ void Mesh::reset_dynamic_data()
     total_number_of_nodes = nb_of_static_nodes;
     edges[0].erase( edges[0].begin() + (int)nb_of_static_edges , edges[0].end());
     edges[1].erase( edges[1].begin() + (int)nb_of_static_edges , edges[1].end());
+    for (size_t i = nb_of_static_facets ; i < facets.size() ; ++i)
+    {
+        const size_t k = i - nb_of_static_facets;
+        if (k < spare_vertex_lists.size()) spare_vertex_lists[k] = std::move(facets[i].vertex_index);
+        else                               spare_vertex_lists.push_back(std::move(facets[i].vertex_index));
+    }
     facets.erase( facets.begin() + (int)nb_of_static_facets , facets.end());
 }
 
 size_t Mesh::create_facet_from_edges(const std::vector<size_t>& oriented_edge_list,const EPoint &unit_normal)
 {
     size_t n=oriented_edge_list.size();
-    std::vector<size_t> vertex_list(n,0);
-    std::map<size_t, bool> vertex_inserted;
+    if (vertex_stamps.size() < (size_t)all_nodes.cols()) vertex_stamps.resize((size_t)all_nodes.cols(), 0);
+    ++stamp;
+    Facet facet;
+    const size_t k = facets.size() - nb_of_static_facets;
+    if (k < spare_vertex_lists.size()) facet.vertex_index = std::move(spare_vertex_lists[k]);
+    std::vector<size_t>& vertex_list = facet.vertex_index;
+    vertex_list.assign(n,0);
     size_t nb_of_vertices = 0;
     for( size_t ei=0;ei<oriented_edge_list.size();ei++)
     {
         size_t vertex_index = second_vertex_of_oriented_edge(oriented_edge_list[ei]); // Note: use second vertex rather than first for compatibility with existing tests
-        if (not(vertex_inserted[vertex_index]))
+        if (vertex_stamps[vertex_index] != stamp)
         {
             vertex_list[ei]=vertex_index;
-            vertex_inserted[vertex_index] = true;
+            vertex_stamps[vertex_index] = stamp;
             nb_of_vertices++;
         }
     }
     vertex_list.resize(nb_of_vertices);
+    facet.unit_normal = unit_normal;
+    facet.centre_of_gravity = ::centre_of_gravity(all_nodes,vertex_list);
+    facet.area = ::area(all_nodes,vertex_list);
     size_t facet_index = facets.size();
-    facets.push_back(Facet(vertex_list,unit_normal,::centre_of_gravity(all_nodes,vertex_list),::area(all_nodes,vertex_list)));
+    facets.push_back(std::move(facet));
     return facet_index;
 }
 
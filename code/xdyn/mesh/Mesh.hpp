@@ -24,7 +24,10 @@ public:
          );
 
 
-    /** \brief Reset the dynamic data related to the mesh intersection with free surface */
+    /** \brief Reset the dynamic data related to the mesh intersection with free surface
+     *  \details The vertex lists of the dynamic facets are kept (rather than freed) so they can be
+     *           reused by create_facet_from_edges without allocating
+     */
     void reset_dynamic_data();
 
     /** \brief add an edge
@@ -75,6 +78,11 @@ public:
     size_t nb_of_static_facets;                                 //!< Number of static facets (ie. read from an STL file & not generated dynamically)
     Matrix3x all_nodes;                                         //!< Coordinates of all vertices in mesh, including dynamic ones added for free surface intersection
     size_t total_number_of_nodes;                               //!< Total number of nodes used, including dynamic ones
+
+private:
+    std::vector<std::vector<size_t> > spare_vertex_lists;       //!< Vertex lists of the dynamic facets released by reset_dynamic_data (the n-th dynamic facet reuses the n-th list)
+    std::vector<size_t> vertex_stamps;                          //!< For each vertex, value of 'stamp' when it was last inserted in a facet by create_facet_from_edges
+    size_t stamp;                                               //!< Incremented by each call to create_facet_from_edges
 };
 
 typedef TR1(shared_ptr)<Mesh> MeshPtr;
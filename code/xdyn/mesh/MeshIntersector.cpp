@@ -5,9 +5,19 @@
 #include "2DMeshDisplay.hpp"
 #include "xdyn/exceptions/InternalErrorException.hpp"
 #include <ssc/macros/SerializeMapsSetsAndVectors.hpp>
-#include <algorithm> //std::all_of
+#include <algorithm> //std::all_of, std::sort, std::lower_bound
 #include <numeric> //std::accumulate
 
+#define WATERLINE_BAND_RELATIVE_HALF_WIDTH 0.1 // Relative to the largest dimension of the mesh
+#define CREST_MARGIN 1E-6 // In m: facets closer than this to the highest wave crest are not skipped (so the skipped vertices are strictly emerged)
+
+double default_waterline_band_half_width(const Matrix3x& nodes);
+double default_waterline_band_half_width(const Matrix3x& nodes)
+{
+    if (nodes.cols() == 0) return 0;
+    return WATERLINE_BAND_RELATIVE_HALF_WIDTH*(nodes.rowwise().maxCoeff() - nodes.rowwise().minCoeff()).maxCoeff();
+}
+
 Facet flip(Facet facet);
 Facet flip(Facet facet)
 {
@@ -26,6 +36,30 @@ MeshIntersector::MeshIntersector(const VectorOfVectorOfPoints& mesh_, const bool
 ,index_of_facets_exactly_on_the_surface()
 ,index_of_edges_exactly_on_surface()
 ,need_to_update_closing_facet(true)
+,facet_crosses_free_surface()
+,edges_immersion_status()
+,split_edges()
+,edge_is_exactly_on_surface()
+,emerged_edges()
+,immersed_edges()
+,waterline_band_half_width(default_waterline_band_half_width(mesh->nodes))
+,side_of_vertex()
+,band_edges()
+,band_facets()
+,immersed_facets_outside_band()
+,emerged_facets_outside_band()
+,nb_of_full_intersections(0)
+,static_facets_tree()
+,facet_is_above_crest()
+,vertex_is_needed()
+,vertices_to_evaluate()
+,z_of_mesh_origin(0)
+,z_axis_of_NED_frame_in_mesh(0,0,1)
+,lowest_crest(0)
+,relative_immersions_of_all_static_vertices()
+,absolute_wave_elevations_of_all_static_vertices()
+,nb_of_evaluated_vertices(0)
+,nb_of_skipped_vertices(0)
 {}
 
 MeshIntersector::MeshIntersector(const MeshPtr mesh_)
@@ -38,6 +72,30 @@ MeshIntersector::MeshIntersector(const MeshPtr mesh_)
         ,index_of_facets_exactly_on_the_surface()
         ,index_of_edges_exactly_on_surface()
         ,need_to_update_closing_facet(true)
+        ,facet_crosses_free_surface()
+        ,edges_immersion_status()
+        ,split_edges()
+        ,edge_is_exactly_on_surface()
+        ,emerged_edges()
+        ,immersed_edges()
+        ,waterline_band_half_width(default_waterline_band_half_width(mesh->nodes))
+        ,side_of_vertex()
+        ,band_edges()
+        ,band_facets()
+        ,immersed_facets_outside_band()
+        ,emerged_facets_outside_band()
+        ,nb_of_full_intersections(0)
+        ,static_facets_tree()
+        ,facet_is_above_crest()
+        ,vertex_is_needed()
+        ,vertices_to_evaluate()
+        ,z_of_mesh_origin(0)
+        ,z_axis_of_NED_frame_in_mesh(0,0,1)
+        ,lowest_crest(0)
+        ,relative_immersions_of_all_static_vertices()
+        ,absolute_wave_elevations_of_all_static_vertices()
+        ,nb_of_evaluated_vertices(0)
+        ,nb_of_skipped_vertices(0)
 {}
 
 void MeshIntersector::find_intersection_with_free_surface(
@@ -47,22 +105,31 @@ void MeshIntersector::find_intersection_with_free_surface(
 {
     for (size_t edge_index = 0; edge_index < mesh->nb_of_static_edges; ++edge_index)
     {
-        double z0 = all_relative_immersions[mesh->edges[0][edge_index]];
-        double z1 = all_relative_immersions[mesh->edges[1][edge_index]];
-        int status = get_edge_immersion_status(z0, z1);
-        edges_immersion_status[edge_index] = status;
-        if (crosses_free_surface(status))
-        {
-            split_edges[edge_index] = split_partially_immersed_edge(edge_index, edges_immersion_status);
-        }
-        if (   crosses_free_surface(status)
-            or both_ends_just_touch_free_surface(status)
-            or one_of_the_ends_just_touches_free_surface(status))
+        find_intersection_with_free_surface(edge_index, split_edges, edges_immersion_status, facet_crosses_free_surface);
+    }
+}
+
+void MeshIntersector::find_intersection_with_free_surface(
+        const size_t edge_index,
+        std::vector<size_t>& split_edges,
+        std::vector<int>& edges_immersion_status,
+        std::vector<bool>& facet_crosses_free_surface)
+{
+    double z0 = all_relative_immersions[mesh->edges[0][edge_index]];
+    double z1 = all_relative_immersions[mesh->edges[1][edge_index]];
+    int status = get_edge_immersion_status(z0, z1);
+    edges_immersion_status[edge_index] = status;
+    if (crosses_free_surface(status))
+    {
+        split_edges[edge_index] = split_partially_immersed_edge(edge_index, edges_immersion_status);
+    }
+    if (   crosses_free_surface(status)
+        or both_ends_just_touch_free_surface(status)
+        or one_of_the_ends_just_touches_free_surface(status))
+    {
+        for (auto facet_index:mesh->facets_per_edge[edge_index])
         {
-            for (auto facet_index:mesh->facets_per_edge[edge_index])
-            {
-                facet_crosses_free_surface[facet_index] = true;
-            }
+            facet_crosses_free_surface[facet_index] = true;
         }
     }
 }
@@ -75,16 +142,25 @@ void MeshIntersector::classify_or_split(
     // Iterate on each facet to classify and/or split
     for (size_t facet_index = 0 ; facet_index < mesh->nb_of_static_facets ; ++facet_index)
     {
-        if (facet_crosses_free_surface[facet_index])
-        {
-            split_partially_immersed_facet_and_classify(facet_index,
-                                                        edges_immersion_status,
-                                                        split_edges);
-        }
-        else
-        {
-            classify_facet(facet_index, edges_immersion_status);
-        }
+        classify_or_split(facet_index, split_edges, facet_crosses_free_surface, edges_immersion_status);
+    }
+}
+
+void MeshIntersector::classify_or_split(
+        const size_t facet_index,
+        const std::vector<size_t>& split_edges,
+        const std::vector<bool>& facet_crosses_free_surface,
+        std::vector<int>& edges_immersion_status)
+{
+    if (facet_crosses_free_surface[facet_index])
+    {
+        split_partially_immersed_facet_and_classify(facet_index,
+                                                    edges_immersion_status,
+                                                    split_edges);
+    }
+    else
+    {
+        classify_facet(facet_index, edges_immersion_status);
     }
 }
 
@@ -110,13 +186,25 @@ void MeshIntersector::reset_dynamic_members()
     index_of_emerged_facets.reserve(mesh->facets.size());
     index_of_immersed_facets.reserve(mesh->facets.size());
     index_of_facets_exactly_on_the_surface.reserve(mesh->facets.size());
+    for (const auto edge_index:index_of_edges_exactly_on_surface) edge_is_exactly_on_surface[edge_index] = false;
     index_of_edges_exactly_on_surface.clear();
 }
 
+void MeshIntersector::add_edge_exactly_on_surface(const size_t edge_index)
+{
+    if (edge_index >= edge_is_exactly_on_surface.size()) edge_is_exactly_on_surface.resize(mesh->edges[0].size(), false);
+    if (not(edge_is_exactly_on_surface[edge_index]))
+    {
+        edge_is_exactly_on_surface[edge_index] = true;
+        index_of_edges_exactly_on_surface.push_back(edge_index);
+    }
+}
+
 void MeshIntersector::update_intersection_with_free_surface(const std::vector<double>& relative_immersions,
         const std::vector<double>& absolute_wave_elevations  //!< z coordinate in NED frame of the free surface for each point in mesh
         )
 {
+    // Copy assignments & 'assign' reuse the capacity of the vectors, so they only allocate while they grow
     all_relative_immersions = relative_immersions;
     if (std::any_of(relative_immersions.begin(),relative_immersions.end(), [](const double x){return std::isnan(x);}))
     {
@@ -124,11 +212,20 @@ void MeshIntersector::update_intersection_with_free_surface(const std::vector<do
     }
     all_absolute_wave_elevations = absolute_wave_elevations;
     reset_dynamic_members();
-    std::vector<bool> facet_crosses_free_surface(mesh->nb_of_static_facets,false);
-    std::vector<int> edges_immersion_status(mesh->nb_of_static_edges,0); // the immersion status of each edge
-    std::vector<size_t > split_edges(mesh->nb_of_static_edges,0);  //!< a table indicating the index of replacing edge for each edge that is split (there are two consecutive edges per split edge, the table only gives the first one)
-    find_intersection_with_free_surface(split_edges, edges_immersion_status, facet_crosses_free_surface);
-    classify_or_split(split_edges, facet_crosses_free_surface, edges_immersion_status);
+    if (waterline_band_is_valid(relative_immersions))
+    {
+        intersect_waterline_band();
+    }
+    else
+    {
+        facet_crosses_free_surface.assign(mesh->nb_of_static_facets,false);
+        edges_immersion_status.assign(mesh->nb_of_static_edges,0);
+        split_edges.assign(mesh->nb_of_static_edges,0);
+        find_intersection_with_free_surface(split_edges, edges_immersion_status, facet_crosses_free_surface);
+        classify_or_split(split_edges, facet_crosses_free_surface, edges_immersion_status);
+        build_waterline_band(relative_immersions);
+        ++nb_of_full_intersections;
+    }
     all_absolute_immersions.resize(all_absolute_wave_elevations.size());
     for (size_t i = 0 ; i < all_absolute_wave_elevations.size() ; ++i)
     {
@@ -137,6 +234,149 @@ void MeshIntersector::update_intersection_with_free_surface(const std::vector<do
     need_to_update_closing_facet = true;
 }
 
+bool MeshIntersector::waterline_band_is_valid(const std::vector<double>& relative_immersions) const
+{
+    if (side_of_vertex.empty() or (side_of_vertex.size() != relative_immersions.size())) return false;
+    for (size_t i = 0 ; i < relative_immersions.size() ; ++i)
+    {
+        if ((side_of_vertex[i] > 0) and not(relative_immersions[i] > 0)) return false;
+        if ((side_of_vertex[i] < 0) and not(relative_immersions[i] < 0)) return false;
+    }
+    return true;
+}
+
+void MeshIntersector::build_waterline_band(const std::vector<double>& relative_immersions)
+{
+    side_of_vertex.clear();
+    band_edges.clear();
+    band_facets.clear();
+    immersed_facets_outside_band.clear();
+    emerged_facets_outside_band.clear();
+    if (waterline_band_half_width <= 0) return;
+    for (const auto dz:relative_immersions)
+    {
+        side_of_vertex.push_back(dz > waterline_band_half_width ? 1 : (dz < -waterline_band_half_width ? -1 : 0));
+    }
+    // Outside the band, the immersion status of the edges & the classification of the facets cannot change
+    // as long as their vertices stay on the same side of the free surface
+    for (size_t edge_index = 0 ; edge_index < mesh->nb_of_static_edges ; ++edge_index)
+    {
+        const int side0 = side_of_vertex[mesh->edges[0][edge_index]];
+        const int side1 = side_of_vertex[mesh->edges[1][edge_index]];
+        if ((side0 == 0) or (side0 != side1)) band_edges.push_back(edge_index);
+    }
+    for (size_t facet_index = 0 ; facet_index < mesh->nb_of_static_facets ; ++facet_index)
+    {
+        const std::vector<size_t>& vertices = mesh->facets[facet_index].vertex_index;
+        const int side = vertices.empty() ? 0 : side_of_vertex[vertices.front()];
+        const bool in_band = (side == 0) or std::any_of(vertices.begin(), vertices.end(), [this, side](const size_t i){return side_of_vertex[i] != side;});
+        if (in_band)     band_facets.push_back(facet_index);
+        else if (side>0) immersed_facets_outside_band.push_back(facet_index);
+        else             emerged_facets_outside_band.push_back(facet_index);
+    }
+}
+
+void MeshIntersector::intersect_waterline_band()
+{
+    // The static part of edges_immersion_status, split_edges & facet_crosses_free_surface is still valid outside the band
+    edges_immersion_status.resize(mesh->nb_of_static_edges);
+    for (const auto facet_index:band_facets) facet_crosses_free_surface[facet_index] = false;
+    // Same order as the full intersection, hence same indices for the dynamic vertices & edges
+    for (const auto edge_index:band_edges)
+    {
+        find_intersection_with_free_surface(edge_index, split_edges, edges_immersion_status, facet_crosses_free_surface);
+    }
+    // Facets are classified in increasing order (as in the full intersection): the ones outside the band are inserted in between
+    auto immersed = immersed_facets_outside_band.cbegin();
+    auto emerged = emerged_facets_outside_band.cbegin();
+    for (const auto facet_index:band_facets)
+    {
+        const auto next_immersed = std::lower_bound(immersed, immersed_facets_outside_band.cend(), facet_index);
+        const auto next_emerged = std::lower_bound(emerged, emerged_facets_outside_band.cend(), facet_index);
+        index_of_immersed_facets.insert(index_of_immersed_facets.end(), immersed, next_immersed);
+        index_of_emerged_facets.insert(index_of_emerged_facets.end(), emerged, next_emerged);
+        immersed = next_immersed;
+        emerged = next_emerged;
+        classify_or_split(facet_index, split_edges, facet_crosses_free_surface, edges_immersion_status);
+    }
+    index_of_immersed_facets.insert(index_of_immersed_facets.end(), immersed, immersed_facets_outside_band.cend());
+    index_of_emerged_facets.insert(index_of_emerged_facets.end(), emerged, emerged_facets_outside_band.cend());
+}
+
+void MeshIntersector::set_waterline_band_half_width(const double half_width)
+{
+    waterline_band_half_width = half_width;
+    side_of_vertex.clear();
+}
+
+size_t MeshIntersector::get_nb_of_full_intersections() const
+{
+    return nb_of_full_intersections;
+}
+
+const std::vector<size_t>& MeshIntersector::select_vertices_to_evaluate(const double z_of_origin, const EPoint& z_axis_of_NED_frame, const double smallest_wave_elevation)
+{
+    if (static_facets_tree.empty() and (mesh->nb_of_static_facets > 0))
+    {
+        const std::vector<Facet> static_facets(mesh->facets.begin(), mesh->facets.begin() + (long)mesh->nb_of_static_facets);
+        static_facets_tree = FacetBoundingBoxTree(mesh->nodes, static_facets);
+    }
+    z_of_mesh_origin = z_of_origin;
+    z_axis_of_NED_frame_in_mesh = z_axis_of_NED_frame;
+    lowest_crest = smallest_wave_elevation;
+    static_facets_tree.find_facets_above(z_of_origin, z_axis_of_NED_frame, smallest_wave_elevation - CREST_MARGIN, facet_is_above_crest);
+    vertex_is_needed.assign(mesh->nb_of_static_nodes, false);
+    for (size_t facet_index = 0 ; facet_index < mesh->nb_of_static_facets ; ++facet_index)
+    {
+        if (facet_is_above_crest[facet_index]) continue;
+        for (const auto vertex:mesh->facets[facet_index].vertex_index) vertex_is_needed[vertex] = true;
+    }
+    vertices_to_evaluate.clear();
+    for (size_t i = 0 ; i < mesh->nb_of_static_nodes ; ++i)
+    {
+        if (vertex_is_needed[i]) vertices_to_evaluate.push_back(i);
+    }
+    nb_of_evaluated_vertices += vertices_to_evaluate.size();
+    nb_of_skipped_vertices += mesh->nb_of_static_nodes - vertices_to_evaluate.size();
+    return vertices_to_evaluate;
+}
+
+void MeshIntersector::update_intersection_with_selected_vertices(const std::vector<double>& relative_immersions, const std::vector<double>& absolute_wave_elevations)
+{
+    if (vertex_is_needed.size() != mesh->nb_of_static_nodes)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "select_vertices_to_evaluate should be called before update_intersection_with_selected_vertices.");
+    }
+    if ((relative_immersions.size() != vertices_to_evaluate.size()) or (absolute_wave_elevations.size() != vertices_to_evaluate.size()))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Expected " << vertices_to_evaluate.size() << " relative immersions & wave elevations (one per selected vertex), but got "
+                << relative_immersions.size() << " relative immersions and " << absolute_wave_elevations.size() << " wave elevations.");
+    }
+    relative_immersions_of_all_static_vertices.resize(mesh->nb_of_static_nodes);
+    absolute_wave_elevations_of_all_static_vertices.resize(mesh->nb_of_static_nodes);
+    for (size_t i = 0 ; i < mesh->nb_of_static_nodes ; ++i)
+    {
+        relative_immersions_of_all_static_vertices[i] = z_of_mesh_origin + z_axis_of_NED_frame_in_mesh.dot(mesh->nodes.col((long)i)) - lowest_crest;
+        absolute_wave_elevations_of_all_static_vertices[i] = lowest_crest;
+    }
+    for (size_t k = 0 ; k < vertices_to_evaluate.size() ; ++k)
+    {
+        relative_immersions_of_all_static_vertices[vertices_to_evaluate[k]] = relative_immersions[k];
+        absolute_wave_elevations_of_all_static_vertices[vertices_to_evaluate[k]] = absolute_wave_elevations[k];
+    }
+    update_intersection_with_free_surface(relative_immersions_of_all_static_vertices, absolute_wave_elevations_of_all_static_vertices);
+}
+
+size_t MeshIntersector::get_nb_of_evaluated_vertices() const
+{
+    return nb_of_evaluated_vertices;
+}
+
+size_t MeshIntersector::get_nb_of_skipped_vertices() const
+{
+    return nb_of_skipped_vertices;
+}
+
 void MeshIntersector::build_closing_edge()
 {
     ClosingFacetComputer::ListOfEdges all_edges_as_pairs;
@@ -145,7 +385,8 @@ void MeshIntersector::build_closing_edge()
         all_edges_as_pairs.push_back(std::make_pair(mesh->edges.at(0).at(idx), mesh->edges.at(1).at(idx)));
     }
     if (index_of_edges_exactly_on_surface.empty()) return;
-    const auto ll = ClosingFacetComputer::group_connected_edges(all_edges_as_pairs, std::vector<size_t>(index_of_edges_exactly_on_surface.begin(),index_of_edges_exactly_on_surface.end()));
+    std::sort(index_of_edges_exactly_on_surface.begin(), index_of_edges_exactly_on_surface.end());
+    const auto ll = ClosingFacetComputer::group_connected_edges(all_edges_as_pairs, index_of_edges_exactly_on_surface);
     for (const auto& l:ll)
     {
         const ClosingFacetComputer c(mesh->all_nodes, all_edges_as_pairs, l);
@@ -172,9 +413,9 @@ void MeshIntersector::split_partially_immersed_facet_and_classify(
         const std::vector<size_t>& split_edges          //!< replacement map for split edges
         )
 {
-    const std::vector<size_t> oriented_edges_of_this_facet = mesh->oriented_edges_per_facet[facet_index];
-    std::vector<size_t> emerged_edges;
-    std::vector<size_t> immersed_edges;
+    const std::vector<size_t>& oriented_edges_of_this_facet = mesh->oriented_edges_per_facet[facet_index];
+    emerged_edges.clear();
+    immersed_edges.clear();
     int status=-1;
     size_t first_emerged  = 0;
     size_t first_immersed = 0;
@@ -187,7 +428,7 @@ void MeshIntersector::split_partially_immersed_facet_and_classify(
         {
             emerged_edges.push_back(oriented_edge);
             immersed_edges.push_back(oriented_edge);
-            index_of_edges_exactly_on_surface.insert(edge_index);
+            add_edge_exactly_on_surface(edge_index);
             if(status==3) first_emerged = emerged_edges.size();
             if(status==0) first_immersed = immersed_edges.size();
         }
@@ -242,7 +483,7 @@ void MeshIntersector::split_partially_immersed_facet_and_classify(
             mesh->first_vertex_of_oriented_edge( emerged_edges[ first_emerged]));
     const bool closing_edge_is_a_point = mesh->edges[0][closing_edge_index] == mesh->edges[1][closing_edge_index];
     if (not(closing_edge_is_a_point))
-        index_of_edges_exactly_on_surface.insert(closing_edge_index);
+        add_edge_exactly_on_surface(closing_edge_index);
     immersed_edges.insert(immersed_edges.begin() + (long)first_immersed, Mesh::convert_index_to_oriented_edge_id(closing_edge_index,true));
     emerged_edges.insert( emerged_edges.begin()  + (long)first_emerged,  Mesh::convert_index_to_oriented_edge_id(closing_edge_index,false));
 
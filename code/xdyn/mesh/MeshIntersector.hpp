@@ -3,8 +3,8 @@
 
 #include "Mesh.hpp"
 #include "CenterOfMass.hpp"
+#include "FacetBoundingBoxTree.hpp"
 #include <ssc/kinematics.hpp>
-#include <set>
 
 class FacetIterator
 {
@@ -54,13 +54,59 @@ class MeshIntersector
 
         /**
          * \brief Update the intersection of the mesh with free surface
-         * \details the intersection requires new Vertices/Edges/Facets stored as dynamic data in the end of container members
+         * \details the intersection requires new Vertices/Edges/Facets stored as dynamic data in the end of container members.
+         * All the work buffers are members which keep their capacity (and the dynamic facets are recycled, cf. Mesh::reset_dynamic_data)
+         * so, once the largest intersection has been computed, this method does not allocate any memory.
+         * Each full intersection also computes a band around the waterline (the static facets which have a vertex whose
+         * relative immersion is smaller than the band's half-width, or vertices on both sides of the free surface).
+         * As long as all the vertices outside this band stay on the same side of the free surface, only the edges
+         * & facets of the band are intersected again (the others keep their classification) and the results are
+         * identical to those of a full intersection (including the order of the facets & the indices of the dynamic data).
          */
         void update_intersection_with_free_surface(
                 const std::vector<double>& relative_immersions, //!< the relative immersion of each static vertex of the mesh
                 const std::vector<double>& absolute_wave_elevations  //!< z coordinate in NED frame of each point in mesh
                 );
 
+        /**
+         * \brief Sets the half-width of the band around the waterline (in m), 0 to always intersect the whole mesh
+         * \details By default, 10 % of the largest dimension of the mesh. The next intersection is a full one.
+         */
+        void set_waterline_band_half_width(const double half_width);
+
+        /**
+         * \brief Number of calls to update_intersection_with_free_surface which intersected the whole mesh (rather than the waterline band)
+         */
+        size_t get_nb_of_full_intersections() const;
+
+        /**
+         * \brief Selects the static vertices whose wave elevation is needed by the next intersection, knowing the highest possible wave crest
+         * \details The facets which are entirely above the highest crest are found using a hierarchy of bounding boxes
+         * (cf. FacetBoundingBoxTree), without looking at their vertices. A vertex is skipped if all the static facets
+         * containing it are above the crest: it is then certainly emerged, as are all the edges & facets containing it,
+         * so the immersed facets & the waterline computed by update_intersection_with_selected_vertices are exactly
+         * the same as if the wave elevation had been computed at all vertices.
+         * \returns Indices of the static vertices at which the wave elevation must be computed (in increasing order)
+         */
+        const std::vector<size_t>& select_vertices_to_evaluate(
+                const double z_of_origin,                 //!< z-coordinate of the origin of the mesh frame, in the NED frame
+                const EPoint& z_axis_of_NED_frame,        //!< Last row of the rotation matrix from the mesh frame to the NED frame (ie. NED z-axis projected in the mesh frame)
+                const double smallest_wave_elevation      //!< Lower bound of the wave elevation (z in the NED frame, so it is the elevation of the highest crest)
+                );
+
+        /**
+         * \brief Same as update_intersection_with_free_surface, but only for the vertices returned by the last call to select_vertices_to_evaluate
+         * \details The skipped vertices get the lower bound of the wave elevation as wave elevation (so their relative
+         * immersion is negative, as it would have been with the actual wave elevation). Only the emerged facets see these values.
+         */
+        void update_intersection_with_selected_vertices(
+                const std::vector<double>& relative_immersions,       //!< the relative immersion of each selected vertex
+                const std::vector<double>& absolute_wave_elevations   //!< z coordinate in NED frame of the free surface at each selected vertex
+                );
+
+        size_t get_nb_of_evaluated_vertices() const; //!< Total number of vertices selected by select_vertices_to_evaluate
+        size_t get_nb_of_skipped_vertices() const;   //!< Total number of vertices skipped by select_vertices_to_evaluate
+
         FacetIterator begin_immersed() const
         {
             const std::vector<Facet>::const_iterator target=mesh->facets.begin();
@@ -192,7 +238,7 @@ class MeshIntersector
         std::vector<size_t> index_of_emerged_facets;                //!< All emerged facets, including the ones dynamically created by split
         std::vector<size_t> index_of_immersed_facets;               //!< All immersed facets, including the ones dynamically created by split
         std::vector<size_t> index_of_facets_exactly_on_the_surface; //!< All facets exactly on the surface (z==0 for all points), including the ones dynamically created by split
-        std::set<size_t>    index_of_edges_exactly_on_surface;      //!< Edges exactly on free surface (either generated or static)
+        std::vector<size_t> index_of_edges_exactly_on_surface;      //!< Edges exactly on free surface (either generated or static), without duplicates
 
         friend class ImmersedFacetIterator;
         friend class EmergedFacetIterator;
@@ -246,12 +292,42 @@ class MeshIntersector
                 std::vector<size_t>& split_edges,
                 std::vector<int>& edges_immersion_status,
                 std::vector<bool>& facet_crosses_free_surface);
+        /**
+         * \brief Find the intersection of one static edge with free surface
+         */
+        void find_intersection_with_free_surface(
+                const size_t edge_index,
+                std::vector<size_t>& split_edges,
+                std::vector<int>& edges_immersion_status,
+                std::vector<bool>& facet_crosses_free_surface);
         /**
          * \brief Iterate on each facet to classify and/or split
          */
         void classify_or_split(const std::vector<size_t>& split_edges,
                                const std::vector<bool>& facet_crosses_free_surface,
                                std::vector<int>& edges_immersion_status);
+        /**
+         * \brief Classify and/or split one static facet
+         */
+        void classify_or_split(const size_t facet_index,
+                               const std::vector<size_t>& split_edges,
+                               const std::vector<bool>& facet_crosses_free_surface,
+                               std::vector<int>& edges_immersion_status);
+
+        /**
+         * \brief Are all the vertices outside the waterline band still on the same side of the free surface?
+         */
+        bool waterline_band_is_valid(const std::vector<double>& relative_immersions) const;
+
+        /**
+         * \brief Computes the waterline band after a full intersection
+         */
+        void build_waterline_band(const std::vector<double>& relative_immersions);
+
+        /**
+         * \brief Intersects the edges & facets of the waterline band (the other static data keeps the status it had after the last full intersection)
+         */
+        void intersect_waterline_band();
 
         /**
          * \brief Classify facet based on immersion status
@@ -260,11 +336,46 @@ class MeshIntersector
 
         void reset_dynamic_members();
 
+        /**
+         * \brief Adds an edge to index_of_edges_exactly_on_surface, unless it is already there
+         */
+        void add_edge_exactly_on_surface(const size_t edge_index);
+
         double volume(const FacetIterator& begin, const FacetIterator& end) const;
         Facet make(const Facet& f, const size_t i1, const size_t i2, const size_t i3) const;
 
         void build_closing_edge();
         bool need_to_update_closing_facet;
+
+        // Work buffers of update_intersection_with_free_surface (members so their memory is reused from one call to the next)
+        std::vector<bool> facet_crosses_free_surface;      //!< For each static facet
+        std::vector<int> edges_immersion_status;           //!< The immersion status of each edge (static & dynamic)
+        std::vector<size_t> split_edges;                   //!< Index of replacing edge for each edge that is split (there are two consecutive edges per split edge, the table only gives the first one)
+        std::vector<bool> edge_is_exactly_on_surface;      //!< For each edge: is it in index_of_edges_exactly_on_surface?
+        std::vector<size_t> emerged_edges;                 //!< Used by split_partially_immersed_facet_and_classify
+        std::vector<size_t> immersed_edges;                //!< Used by split_partially_immersed_facet_and_classify
+
+        // Waterline band (computed by the last full intersection)
+        double waterline_band_half_width;                  //!< In m (0 to disable the waterline band)
+        std::vector<int> side_of_vertex;                   //!< For each static vertex: 1 if immersed & outside the band, -1 if emerged & outside the band, 0 if inside the band
+        std::vector<size_t> band_edges;                    //!< Static edges with a vertex in the band or vertices on both sides of the band (in increasing order)
+        std::vector<size_t> band_facets;                   //!< Static facets with a vertex in the band or vertices on both sides of the band (in increasing order)
+        std::vector<size_t> immersed_facets_outside_band;  //!< In increasing order
+        std::vector<size_t> emerged_facets_outside_band;   //!< In increasing order
+        size_t nb_of_full_intersections;
+
+        // Culling of the vertices above the highest wave crest (cf. select_vertices_to_evaluate)
+        FacetBoundingBoxTree static_facets_tree;           //!< Built on the first call to select_vertices_to_evaluate
+        std::vector<bool> facet_is_above_crest;            //!< For each static facet
+        std::vector<bool> vertex_is_needed;                //!< For each static vertex
+        std::vector<size_t> vertices_to_evaluate;          //!< Static vertices selected by the last call to select_vertices_to_evaluate
+        double z_of_mesh_origin;                           //!< Attitude used by the last call to select_vertices_to_evaluate
+        EPoint z_axis_of_NED_frame_in_mesh;                //!< Attitude used by the last call to select_vertices_to_evaluate
+        double lowest_crest;                               //!< Smallest wave elevation used by the last call to select_vertices_to_evaluate
+        std::vector<double> relative_immersions_of_all_static_vertices;      //!< Work buffer of update_intersection_with_selected_vertices
+        std::vector<double> absolute_wave_elevations_of_all_static_vertices; //!< Work buffer of update_intersection_with_selected_vertices
+        size_t nb_of_evaluated_vertices;
+        size_t nb_of_skipped_vertices;
 };
 
 typedef TR1(shared_ptr)<MeshIntersector> MeshIntersectorPtr;
@@ -0,0 +1,361 @@
+/*
+ * MeshSimplifier.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "MeshSimplifier.hpp"
+#include "MeshBuilder.hpp" // Vector3dMap
+#include "xdyn/exceptions/MeshException.hpp"
+#include <ssc/exception_handling.hpp>
+
+#include <algorithm> // std::push_heap, std::pop_heap, std::sort, std::unique, std::set_intersection
+#include <iterator>  // std::back_inserter
+#include <cmath>
+
+#define MIN_COS_OF_NORMAL_ROTATION 0.2 // Collapses which rotate the normal of a facet by more than ~78 degrees are rejected
+#define MAX_DISPLACEMENT 2             // Relative to the length of the collapsed edge (the optimal position is discarded if it is further away)
+
+bool contains(const std::array<size_t,3>& triangle, const size_t vertex);
+bool contains(const std::array<size_t,3>& triangle, const size_t vertex)
+{
+    return (triangle[0] == vertex) or (triangle[1] == vertex) or (triangle[2] == vertex);
+}
+
+double projected_area_below(const EPoint& A, const EPoint& B, const EPoint& C, const double z);
+double projected_area_below(const EPoint& A, const EPoint& B, const EPoint& C, const double z)
+{
+    // Part of triangle ABC with a z-coordinate greater than z (Sutherland-Hodgman), projected on the (x,y) plane
+    const EPoint P[3] = {A, B, C};
+    std::vector<EPoint> clipped;
+    for (size_t i = 0 ; i < 3 ; ++i)
+    {
+        const EPoint& P0 = P[i];
+        const EPoint& P1 = P[(i+1)%3];
+        if (P0(2) >= z) clipped.push_back(P0);
+        if ((P0(2) - z)*(P1(2) - z) < 0) clipped.push_back(P0 + (P1 - P0)*(z - P0(2))/(P1(2) - P0(2)));
+    }
+    double area = 0;
+    for (size_t i = 0 ; i < clipped.size() ; ++i)
+    {
+        const EPoint& P0 = clipped[i];
+        const EPoint& P1 = clipped[(i+1)%clipped.size()];
+        area += P0(0)*P1(1) - P1(0)*P0(1);
+    }
+    return area/2;
+}
+
+MeshSimplifier::Properties::Properties() : nb_of_facets(0), volume(0), centroid(EPoint::Zero()), waterplane_area(0)
+{
+}
+
+MeshSimplifier::Collapse::Collapse() : cost(0), u(0), w(0), position(EPoint::Zero())
+{
+}
+
+bool MeshSimplifier::Collapse::operator<(const Collapse& rhs) const
+{
+    return cost > rhs.cost;
+}
+
+MeshSimplifier::MeshSimplifier(const VectorOfVectorOfPoints& mesh, const double z_of_waterplane_) :
+    vertices(),
+    triangles(),
+    triangle_is_alive(),
+    triangles_of_vertex(),
+    quadrics(),
+    heap(),
+    z_of_waterplane(z_of_waterplane_),
+    nb_of_alive_triangles(0)
+{
+    Vector3dMap index_of_point;
+    for (const auto& polygon:mesh)
+    {
+        std::vector<size_t> idx;
+        for (const auto& P:polygon)
+        {
+            const auto it = index_of_point.insert(std::make_pair(P, vertices.size()));
+            if (it.second) vertices.push_back(P);
+            idx.push_back(it.first->second);
+        }
+        for (size_t i = 1 ; i + 1 < idx.size() ; ++i)
+        {
+            const Triangle t = {{idx[0], idx[i], idx[i+1]}};
+            if ((t[0] != t[1]) and (t[1] != t[2]) and (t[0] != t[2])) triangles.push_back(t);
+        }
+    }
+    triangle_is_alive.assign(triangles.size(), true);
+    nb_of_alive_triangles = triangles.size();
+    triangles_of_vertex.resize(vertices.size());
+    quadrics.assign(vertices.size(), Eigen::Matrix4d::Zero());
+    for (size_t i = 0 ; i < triangles.size() ; ++i)
+    {
+        for (const auto vertex:triangles[i]) triangles_of_vertex[vertex].push_back(i);
+        add_quadric(i);
+    }
+}
+
+void MeshSimplifier::add_quadric(const size_t triangle_index)
+{
+    const Triangle& t = triangles[triangle_index];
+    const EPoint n = (vertices[t[1]] - vertices[t[0]]).cross(vertices[t[2]] - vertices[t[0]]);
+    const double norm = n.norm();
+    if (norm == 0) return;
+    Eigen::Vector4d plane;
+    plane << n/norm, -n.dot(vertices[t[0]])/norm;
+    // Weighted by the area of the facet, so the error does not depend on the resolution of the original mesh
+    const Eigen::Matrix4d K = (norm/2)*plane*plane.transpose();
+    for (const auto vertex:t) quadrics[vertex] += K;
+}
+
+std::vector<size_t> MeshSimplifier::neighbours(const size_t vertex) const
+{
+    std::vector<size_t> ret;
+    for (const auto t:triangles_of_vertex[vertex])
+    {
+        for (const auto other:triangles[t]) if (other != vertex) ret.push_back(other);
+    }
+    std::sort(ret.begin(), ret.end());
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+    return ret;
+}
+
+bool MeshSimplifier::is_on_boundary(const size_t vertex) const
+{
+    // In a closed manifold mesh, each edge belongs to exactly two facets
+    for (const auto other:neighbours(vertex))
+    {
+        size_t n = 0;
+        for (const auto t:triangles_of_vertex[vertex]) if (contains(triangles[t], other)) ++n;
+        if (n != 2) return true;
+    }
+    return false;
+}
+
+bool MeshSimplifier::touches_waterplane(const size_t vertex) const
+{
+    for (const auto t:triangles_of_vertex[vertex])
+    {
+        const double z0 = vertices[triangles[t][0]](2);
+        const double z1 = vertices[triangles[t][1]](2);
+        const double z2 = vertices[triangles[t][2]](2);
+        const bool above = (z0 < z_of_waterplane) and (z1 < z_of_waterplane) and (z2 < z_of_waterplane);
+        const bool below = (z0 > z_of_waterplane) and (z1 > z_of_waterplane) and (z2 > z_of_waterplane);
+        if (not(above) and not(below)) return true;
+    }
+    return false;
+}
+
+bool MeshSimplifier::evaluate(const size_t u, const size_t w, Collapse& c) const
+{
+    if (triangles_of_vertex[u].empty() or triangles_of_vertex[w].empty()) return false;
+    size_t nb_of_shared_triangles = 0;
+    for (const auto t:triangles_of_vertex[u]) if (contains(triangles[t], w)) ++nb_of_shared_triangles;
+    if (nb_of_shared_triangles != 2) return false;
+    // Link condition: u & w must only have the two opposite vertices of their shared facets in common
+    const std::vector<size_t> Nu = neighbours(u);
+    const std::vector<size_t> Nw = neighbours(w);
+    std::vector<size_t> common;
+    std::set_intersection(Nu.begin(), Nu.end(), Nw.begin(), Nw.end(), std::back_inserter(common));
+    if (common.size() != 2) return false;
+    if (is_on_boundary(u) or is_on_boundary(w)) return false;
+    if (touches_waterplane(u) or touches_waterplane(w)) return false;
+
+    // Volume constraint (g.v = d): the volume enclosed by the facets around u & w must not change
+    EPoint g = EPoint::Zero();
+    double d = 0;
+    for (const auto x:{u, w})
+    {
+        for (const auto t:triangles_of_vertex[x])
+        {
+            const Triangle& T = triangles[t];
+            const bool shared = contains(T, u) and contains(T, w);
+            if (shared and (x == w)) continue; // Already counted with u
+            d += vertices[T[0]].dot(vertices[T[1]].cross(vertices[T[2]]))/6;
+            if (shared) continue;              // Disappears
+            const size_t i = (T[0] == x) ? 0 : ((T[1] == x) ? 1 : 2);
+            g += vertices[T[(i+1)%3]].cross(vertices[T[(i+2)%3]])/6;
+        }
+    }
+    if (g.squaredNorm() == 0) return false;
+
+    const Eigen::Matrix4d Q = quadrics[u] + quadrics[w];
+    const auto cost = [&Q](const EPoint& v){Eigen::Vector4d v1;v1 << v, 1;return std::max(0., (double)(v1.transpose()*Q*v1));};
+    const auto project = [&g, d](const EPoint& v){return EPoint(v + (d - g.dot(v))/g.squaredNorm()*g);};
+    const EPoint middle = (vertices[u] + vertices[w])/2;
+    const double max_displacement = MAX_DISPLACEMENT*(vertices[u] - vertices[w]).norm();
+
+    // Minimum of the quadric error on the plane of the volume constraint (Lagrange multipliers)
+    Eigen::Matrix4d K = Eigen::Matrix4d::Zero();
+    K.topLeftCorner<3,3>() = 2*Q.topLeftCorner<3,3>();
+    K.block<3,1>(0,3) = g;
+    K.block<1,3>(3,0) = g.transpose();
+    Eigen::Vector4d rhs;
+    rhs << -2*Q.block<3,1>(0,3), d;
+    const Eigen::FullPivLU<Eigen::Matrix4d> lu(K);
+    bool found = false;
+    if (lu.isInvertible())
+    {
+        const EPoint v = lu.solve(rhs).head<3>();
+        if ((v - middle).norm() <= max_displacement)
+        {
+            c.position = v;
+            found = true;
+        }
+    }
+    if (not(found))
+    {
+        // Best of the (projected) ends & middle of the edge
+        c.position = project(vertices[u]);
+        for (const auto& P:{vertices[w], middle})
+        {
+            const EPoint v = project(P);
+            if (cost(v) < cost(c.position)) c.position = v;
+        }
+        if ((c.position - middle).norm() > max_displacement) return false;
+    }
+
+    // The new position must stay on the same side of the waterplane (no facet around u & w touches it)
+    const bool below = vertices[u](2) > z_of_waterplane;
+    if (below != (c.position(2) > z_of_waterplane)) return false;
+    if (c.position(2) == z_of_waterplane) return false;
+
+    // No facet may flip or become degenerate
+    for (const auto x:{u, w})
+    {
+        for (const auto t:triangles_of_vertex[x])
+        {
+            const Triangle& T = triangles[t];
+            if (contains(T, u) and contains(T, w)) continue;
+            EPoint P[3] = {vertices[T[0]], vertices[T[1]], vertices[T[2]]};
+            const EPoint n_before = (P[1] - P[0]).cross(P[2] - P[0]);
+            for (size_t i = 0 ; i < 3 ; ++i) if (T[i] == x) P[i] = c.position;
+            const EPoint n_after = (P[1] - P[0]).cross(P[2] - P[0]);
+            if (n_before.dot(n_after) <= MIN_COS_OF_NORMAL_ROTATION*n_before.norm()*n_after.norm()) return false;
+        }
+    }
+    c.u = u;
+    c.w = w;
+    c.cost = cost(c.position);
+    return true;
+}
+
+void MeshSimplifier::push_edges_of(const size_t vertex)
+{
+    for (const auto other:neighbours(vertex))
+    {
+        Collapse c;
+        if (evaluate(vertex, other, c))
+        {
+            heap.push_back(c);
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+}
+
+void MeshSimplifier::collapse(const Collapse& c)
+{
+    vertices[c.u] = c.position;
+    quadrics[c.u] += quadrics[c.w];
+    const std::vector<size_t> triangles_of_w = triangles_of_vertex[c.w];
+    for (const auto t:triangles_of_w)
+    {
+        if (contains(triangles[t], c.u))
+        {
+            triangle_is_alive[t] = false;
+            --nb_of_alive_triangles;
+            for (const auto vertex:triangles[t])
+            {
+                std::vector<size_t>& L = triangles_of_vertex[vertex];
+                L.erase(std::remove(L.begin(), L.end(), t), L.end());
+            }
+        }
+        else
+        {
+            for (auto& vertex:triangles[t]) if (vertex == c.w) vertex = c.u;
+            triangles_of_vertex[c.u].push_back(t);
+        }
+    }
+    triangles_of_vertex[c.w].clear();
+    push_edges_of(c.u);
+}
+
+VectorOfVectorOfPoints MeshSimplifier::simplify(const size_t max_nb_of_facets)
+{
+    heap.clear();
+    for (size_t vertex = 0 ; vertex < vertices.size() ; ++vertex)
+    {
+        for (const auto other:neighbours(vertex))
+        {
+            Collapse c;
+            if ((vertex < other) and evaluate(vertex, other, c)) heap.push_back(c);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end());
+    while ((nb_of_alive_triangles > max_nb_of_facets) and not(heap.empty()))
+    {
+        std::pop_heap(heap.begin(), heap.end());
+        const Collapse candidate = heap.back();
+        heap.pop_back();
+        // The candidate may be outdated by previous collapses: evaluate it again
+        Collapse c;
+        if (not(evaluate(candidate.u, candidate.w, c))) continue;
+        if (c.cost > candidate.cost*(1 + 1E-9))
+        {
+            heap.push_back(c);
+            std::push_heap(heap.begin(), heap.end());
+            continue;
+        }
+        collapse(c);
+    }
+    VectorOfVectorOfPoints ret;
+    ret.reserve(nb_of_alive_triangles);
+    for (size_t i = 0 ; i < triangles.size() ; ++i)
+    {
+        if (triangle_is_alive[i]) ret.push_back({vertices[triangles[i][0]], vertices[triangles[i][1]], vertices[triangles[i][2]]});
+    }
+    return ret;
+}
+
+size_t MeshSimplifier::get_facet_budget(const VectorOfVectorOfPoints& mesh, const double shortest_wavelength, const double edges_per_wavelength)
+{
+    if ((shortest_wavelength <= 0) or (edges_per_wavelength <= 0))
+    {
+        THROW(__PRETTY_FUNCTION__, MeshException, "Expected a strictly positive wavelength & number of edges per wavelength, but got "
+                << shortest_wavelength << " m & " << edges_per_wavelength << " edges per wavelength");
+    }
+    double area = 0;
+    for (const auto& polygon:mesh)
+    {
+        for (size_t i = 1 ; i + 1 < polygon.size() ; ++i)
+        {
+            area += (polygon[i] - polygon[0]).cross(polygon[i+1] - polygon[0]).norm()/2;
+        }
+    }
+    const double edge_length = shortest_wavelength/edges_per_wavelength;
+    const double area_of_one_facet = std::sqrt(3.)/4*edge_length*edge_length;
+    return std::max((size_t)1, (size_t)std::ceil(area/area_of_one_facet));
+}
+
+MeshSimplifier::Properties MeshSimplifier::get_properties(const VectorOfVectorOfPoints& mesh, const double z_of_waterplane)
+{
+    Properties ret;
+    EPoint moment = EPoint::Zero();
+    double waterplane_area = 0;
+    for (const auto& polygon:mesh)
+    {
+        ++ret.nb_of_facets;
+        for (size_t i = 1 ; i + 1 < polygon.size() ; ++i)
+        {
+            // Signed volume of the tetrahedron made by the origin & the triangle
+            const double v = polygon[0].dot(polygon[i].cross(polygon[i+1]))/6;
+            ret.volume += v;
+            moment += v*(polygon[0] + polygon[i] + polygon[i+1])/4;
+            // The part of the hull below the waterplane & the waterplane enclose a volume, so their projected areas cancel out
+            waterplane_area += projected_area_below(polygon[0], polygon[i], polygon[i+1], z_of_waterplane);
+        }
+    }
+    if (ret.volume != 0) ret.centroid = moment/ret.volume;
+    ret.waterplane_area = std::abs(waterplane_area);
+    return ret;
+}
@@ -0,0 +1,93 @@
+/*
+ * MeshSimplifier.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef MESHSIMPLIFIER_HPP_
+#define MESHSIMPLIFIER_HPP_
+
+#include "xdyn/external_data_structures/GeometricTypes3d.hpp"
+
+#include <Eigen/Dense>
+#include <Eigen/StdVector>
+#include <array>
+#include <vector>
+
+/** \brief Reduces the number of facets of a closed hull mesh by quadric error decimation
+ *  \details Edges are collapsed in order of increasing quadric error (Garland & Heckbert), each
+ *           collapse putting the remaining vertex where it minimizes the quadric error while
+ *           leaving the enclosed volume unchanged (Lindstrom & Turk). The facets which touch
+ *           or cross the waterplane are never modified (and no facet is moved across it), so
+ *           the waterplane area is exactly preserved. A collapse is rejected if
+ *           it would make the mesh non-manifold, flip a facet, or touch the boundary of an open mesh.
+ *  \addtogroup mesh
+ *  \ingroup mesh
+ *  \section ex1 Example
+ *  \snippet mesh/unit_tests/MeshSimplifierTest.cpp MeshSimplifierTest example
+ *  \see "Surface Simplification Using Quadric Error Metrics", M. Garland & P. S. Heckbert, SIGGRAPH 1997
+ *  \see "Fast and Memory Efficient Polygonal Simplification", P. Lindstrom & G. Turk, IEEE Visualization 1998
+ */
+class MeshSimplifier
+{
+    public:
+        struct Properties
+        {
+            Properties();
+            size_t nb_of_facets;
+            double volume;              //!< Enclosed volume (in m^3 if the mesh is in m)
+            EPoint centroid;            //!< Centre of the enclosed volume
+            double waterplane_area;     //!< Area of the section of the mesh by the waterplane
+        };
+
+        MeshSimplifier(const VectorOfVectorOfPoints& mesh, //!< Closed mesh (polygons are split into triangles)
+                       const double z_of_waterplane        //!< z-coordinate (in the mesh frame) of the plane whose section is preserved
+                       );
+
+        /**  \brief Collapses edges until there are at most max_nb_of_facets facets (or no edge can be collapsed)
+          *  \returns The simplified mesh (triangles, with the same orientation as the original mesh)
+          */
+        VectorOfVectorOfPoints simplify(const size_t max_nb_of_facets);
+
+        /**  \brief Number of facets of a mesh whose edges are about shortest_wavelength/edges_per_wavelength long
+          *  \details Assumes equilateral triangles covering the whole area of the mesh.
+          */
+        static size_t get_facet_budget(const VectorOfVectorOfPoints& mesh,
+                                       const double shortest_wavelength, //!< In m
+                                       const double edges_per_wavelength
+                                       );
+
+        static Properties get_properties(const VectorOfVectorOfPoints& mesh, const double z_of_waterplane);
+
+    private:
+        MeshSimplifier();
+        typedef std::array<size_t,3> Triangle;
+        struct Collapse
+        {
+            Collapse();
+            double cost;
+            size_t u;           //!< Vertex which is kept
+            size_t w;           //!< Vertex which is removed
+            EPoint position;    //!< New position of u
+            bool operator<(const Collapse& rhs) const; //!< Reversed, so the top of the heap is the cheapest collapse
+        };
+
+        void add_quadric(const size_t triangle_index);
+        void push_edges_of(const size_t vertex);
+        bool evaluate(const size_t u, const size_t w, Collapse& collapse) const;
+        bool is_on_boundary(const size_t vertex) const;
+        bool touches_waterplane(const size_t vertex) const;
+        void collapse(const Collapse& c);
+        std::vector<size_t> neighbours(const size_t vertex) const;
+
+        std::vector<EPoint> vertices;
+        std::vector<Triangle> triangles;
+        std::vector<bool> triangle_is_alive;
+        std::vector<std::vector<size_t> > triangles_of_vertex; //!< Alive triangles containing each vertex
+        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > quadrics; //!< For each vertex
+        std::vector<Collapse> heap;                            //!< Candidate collapses (std::push_heap & std::pop_heap)
+        double z_of_waterplane;
+        size_t nb_of_alive_triangles;
+};
+
+#endif /* MESHSIMPLIFIER_HPP_ */
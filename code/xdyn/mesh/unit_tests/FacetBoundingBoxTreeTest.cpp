@@ -0,0 +1,101 @@
+/*
+ * FacetBoundingBoxTreeTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "FacetBoundingBoxTreeTest.hpp"
+#include "FacetBoundingBoxTree.hpp"
+#include "xdyn/external_file_formats/stl_reader.hpp"
+#include "xdyn/mesh/MeshBuilder.hpp"
+#include "xdyn/test_data_generator/stl_data.hpp"
+#include "xdyn/test_data_generator/TriMeshTestData.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+FacetBoundingBoxTreeTest::FacetBoundingBoxTreeTest() : a(ssc::random_data_generator::DataGenerator(87452))
+{
+}
+
+FacetBoundingBoxTreeTest::~FacetBoundingBoxTreeTest()
+{
+}
+
+void FacetBoundingBoxTreeTest::SetUp()
+{
+}
+
+void FacetBoundingBoxTreeTest::TearDown()
+{
+}
+
+TEST_F(FacetBoundingBoxTreeTest, example)
+{
+//! [FacetBoundingBoxTreeTest example]
+    const Mesh mesh = MeshBuilder(unit_cube()).build();
+    const FacetBoundingBoxTree tree(mesh.nodes, mesh.facets);
+    std::vector<bool> facet_is_above;
+    // Mesh frame aligned with the NED frame, its origin being 0.2 m below the origin of the NED frame
+    tree.find_facets_above(0.2, EPoint(0,0,1), 0, facet_is_above);
+//! [FacetBoundingBoxTreeTest example]
+//! [FacetBoundingBoxTreeTest expected output]
+    ASSERT_EQ(mesh.facets.size(), facet_is_above.size());
+    for (size_t i = 0 ; i < mesh.facets.size() ; ++i)
+    {
+        // Only the top of the cube (z = -0.5 in the mesh frame, so -0.3 in the NED frame) is entirely above z = 0
+        ASSERT_EQ(mesh.facets[i].unit_normal(2) < -0.9, facet_is_above[i]);
+    }
+//! [FacetBoundingBoxTreeTest expected output]
+}
+
+TEST_F(FacetBoundingBoxTreeTest, each_box_which_is_not_a_leaf_has_two_children)
+{
+    const Mesh mesh = MeshBuilder(unit_cube()).build();
+    const FacetBoundingBoxTree tree(mesh.nodes, mesh.facets);
+    ASSERT_FALSE(tree.empty());
+    ASSERT_EQ(2*mesh.facets.size()-1, tree.get_nb_of_boxes());
+}
+
+TEST_F(FacetBoundingBoxTreeTest, empty_tree_marks_no_facets)
+{
+    const FacetBoundingBoxTree tree;
+    std::vector<bool> facet_is_above(3, true);
+    tree.find_facets_above(0, EPoint(0,0,1), 0, facet_is_above);
+    ASSERT_TRUE(tree.empty());
+    ASSERT_TRUE(facet_is_above.empty());
+}
+
+TEST_F(FacetBoundingBoxTreeTest, marks_exactly_the_facets_whose_bounding_boxes_are_above_a_given_altitude)
+{
+    const Mesh mesh = MeshBuilder(read_stl(test_data::big_cube())).build();
+    const FacetBoundingBoxTree tree(mesh.nodes, mesh.facets);
+    std::vector<bool> facet_is_above;
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double phi = a.random<double>().between(-PI,PI);
+        const double theta = a.random<double>().between(-PI/2,PI/2);
+        const double tz = a.random<double>().between(-1,1);
+        const double z_max = a.random<double>().between(-1,1);
+        // Last row of the rotation matrix from the mesh frame to the NED frame
+        const EPoint r3(-std::sin(theta), std::sin(phi)*std::cos(theta), std::cos(phi)*std::cos(theta));
+        tree.find_facets_above(tz, r3, z_max, facet_is_above);
+        ASSERT_EQ(mesh.facets.size(), facet_is_above.size());
+        for (size_t j = 0 ; j < mesh.facets.size() ; ++j)
+        {
+            const std::vector<size_t>& vertices = mesh.facets[j].vertex_index;
+            EPoint m = mesh.nodes.col((long)vertices.front());
+            EPoint M = m;
+            for (const auto vertex:vertices)
+            {
+                m = m.cwiseMin(mesh.nodes.col((long)vertex));
+                M = M.cwiseMax(mesh.nodes.col((long)vertex));
+            }
+            // Highest z (in the NED frame) of the facet's bounding box
+            const double z = tz + r3.dot((m+M)/2) + r3.cwiseAbs().dot((M-m)/2);
+            if (std::abs(z - z_max) < 1E-10) continue;
+            ASSERT_EQ(z < z_max, facet_is_above[j]) << "i = " << i << ", j = " << j;
+        }
+    }
+}
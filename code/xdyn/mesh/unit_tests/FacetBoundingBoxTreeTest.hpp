@@ -0,0 +1,23 @@
+/*
+ * FacetBoundingBoxTreeTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef FACETBOUNDINGBOXTREETEST_HPP_
+#define FACETBOUNDINGBOXTREETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class FacetBoundingBoxTreeTest : public ::testing::Test
+{
+    protected:
+        FacetBoundingBoxTreeTest();
+        virtual ~FacetBoundingBoxTreeTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* FACETBOUNDINGBOXTREETEST_HPP_ */
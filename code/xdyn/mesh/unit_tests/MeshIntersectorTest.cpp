@@ -13,6 +13,9 @@
 #include <ssc/macros.hpp>
 #include <ssc/kinematics.hpp>
 
+#include <cstdlib> // std::malloc, std::free
+#include <new>
+
 #define EPS 1E-6
 
 #define _USE_MATH_DEFINE
@@ -39,6 +42,28 @@ void check_vector(const Eigen::Vector3d& v_to_check, const double x_expected, co
     ASSERT_DOUBLE_EQ(z_expected, (double)v_to_check(2)) << "Expected: " << Eigen::Vector3d(x_expected, y_expected, z_expected).transpose() << ", actual: " << v_to_check.transpose();;
 }
 
+namespace
+{
+    // Only the allocations of the thread which armed the counter are counted: the other threads
+    // of the test executable (eg. gRPC's) can allocate at any time
+    thread_local bool counting_allocations = false;
+    thread_local size_t nb_of_allocations = 0;
+}
+
+// Counts the dynamic allocations (this replaces the global operator new for the whole test executable)
+void* operator new(std::size_t size)
+{
+    if (counting_allocations) ++nb_of_allocations;
+    void* p = std::malloc(size ? size : 1);
+    if (not(p)) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
 MeshIntersectorTest::MeshIntersectorTest() : a(ssc::random_data_generator::DataGenerator(2))
 {
 }
@@ -1095,3 +1120,117 @@ TEST_F(MeshIntersectorTest, unit_normal_of_facets_on_surface_is_properly_compute
     ASSERT_EQ(1, facets_on_surface.size());
     check_vector(facets_on_surface.at(0).unit_normal, 0, 0, -1);
 }
+
+TEST_F(MeshIntersectorTest, does_not_allocate_memory_once_the_largest_intersection_has_been_computed)
+{
+    MeshIntersector intersector(read_stl(test_data::big_cube()));
+    const Matrix3x& nodes = intersector.mesh->nodes;
+    const double zmin = nodes.row(2).minCoeff();
+    const double zmax = nodes.row(2).maxCoeff();
+    // Inclined free surfaces at different heights, so the number of split facets changes at each step
+    std::vector<std::vector<double> > immersions;
+    for (size_t i = 0 ; i < 20 ; ++i)
+    {
+        const double z0 = zmin + (zmax-zmin)*(0.5+(double)i)/20;
+        const double slope = 0.3*std::sin((double)i);
+        std::vector<double> dz;
+        for (int j = 0 ; j < nodes.cols() ; ++j)
+        {
+            dz.push_back(nodes(2,j) - z0 - slope*nodes(0,j));
+        }
+        immersions.push_back(dz);
+    }
+    for (const auto& dz:immersions) intersector.update_intersection_with_free_surface(dz,dz);
+    nb_of_allocations = 0;
+    counting_allocations = true;
+    for (const auto& dz:immersions) intersector.update_intersection_with_free_surface(dz,dz);
+    counting_allocations = false;
+    ASSERT_EQ(0, nb_of_allocations);
+    ASSERT_LT(intersector.mesh->nb_of_static_facets, intersector.mesh->facets.size());
+    ASSERT_FALSE(intersector.index_of_immersed_facets.empty());
+    ASSERT_FALSE(intersector.index_of_emerged_facets.empty());
+}
+
+TEST_F(MeshIntersectorTest, intersecting_the_waterline_band_gives_the_same_results_as_a_full_intersection)
+{
+    MeshIntersector full(read_stl(test_data::big_cube()));
+    MeshIntersector band(read_stl(test_data::big_cube()));
+    full.set_waterline_band_half_width(0);
+    band.set_waterline_band_half_width(0.2);
+    const Matrix3x& nodes = full.mesh->nodes;
+    const size_t n = 100;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        // Slowly moving inclined free surface
+        const double z0 = 0.3*std::sin(0.1*(double)i);
+        const double slope = 0.2*std::cos(0.07*(double)i);
+        std::vector<double> dz;
+        for (int j = 0 ; j < nodes.cols() ; ++j)
+        {
+            dz.push_back(nodes(2,j) - z0 - slope*nodes(0,j));
+        }
+        full.update_intersection_with_free_surface(dz,dz);
+        band.update_intersection_with_free_surface(dz,dz);
+        ASSERT_EQ(full.index_of_immersed_facets, band.index_of_immersed_facets);
+        ASSERT_EQ(full.index_of_emerged_facets, band.index_of_emerged_facets);
+        ASSERT_EQ(full.all_relative_immersions, band.all_relative_immersions);
+        ASSERT_EQ(full.all_absolute_wave_elevations, band.all_absolute_wave_elevations);
+        ASSERT_EQ(full.mesh->facets.size(), band.mesh->facets.size());
+        for (size_t k = 0 ; k < full.mesh->facets.size() ; ++k)
+        {
+            ASSERT_EQ(full.mesh->facets[k].vertex_index, band.mesh->facets[k].vertex_index);
+            ASSERT_EQ(full.mesh->facets[k].area, band.mesh->facets[k].area);
+        }
+        ASSERT_EQ(full.immersed_volume(), band.immersed_volume());
+        ASSERT_EQ(full.emerged_volume(), band.emerged_volume());
+    }
+    ASSERT_EQ(n, full.get_nb_of_full_intersections());
+    ASSERT_GT(n/2, band.get_nb_of_full_intersections());
+    ASSERT_LT(1, band.get_nb_of_full_intersections());
+}
+
+TEST_F(MeshIntersectorTest, skipping_the_vertices_above_the_highest_wave_crest_does_not_change_the_immersed_facets)
+{
+    MeshIntersector all(read_stl(test_data::big_cube()));
+    MeshIntersector culled(read_stl(test_data::big_cube()));
+    const Matrix3x& nodes = all.mesh->nodes;
+    const double amplitude = 0.1;
+    const size_t n = 20;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        // Heave, roll & pitch of the mesh, in waves whose elevation lies between -amplitude & +amplitude
+        const double tz = 0.8*std::sin(0.3*(double)i);
+        const double phi = 0.3*std::sin(0.5*(double)i);
+        const double theta = 0.2*std::cos(0.4*(double)i);
+        const EPoint r3(-std::sin(theta), std::sin(phi)*std::cos(theta), std::cos(phi)*std::cos(theta));
+        std::vector<double> dz, eta;
+        for (int j = 0 ; j < nodes.cols() ; ++j)
+        {
+            eta.push_back(amplitude*std::sin(2*nodes(0,j)+0.5*(double)i));
+            dz.push_back(tz + r3.dot(nodes.col(j)) - eta.back());
+        }
+        all.update_intersection_with_free_surface(dz, eta);
+        const std::vector<size_t> selected = culled.select_vertices_to_evaluate(tz, r3, -amplitude);
+        std::vector<double> dz_selected, eta_selected;
+        for (const auto j:selected)
+        {
+            dz_selected.push_back(dz[j]);
+            eta_selected.push_back(eta[j]);
+        }
+        culled.update_intersection_with_selected_vertices(dz_selected, eta_selected);
+        ASSERT_EQ(all.index_of_immersed_facets, culled.index_of_immersed_facets);
+        ASSERT_EQ(all.index_of_emerged_facets, culled.index_of_emerged_facets);
+        for (auto facet = all.begin_immersed() ; facet != all.end_immersed() ; ++facet)
+        {
+            for (const auto vertex:facet->vertex_index)
+            {
+                ASSERT_EQ(all.all_relative_immersions[vertex], culled.all_relative_immersions[vertex]);
+                ASSERT_EQ(all.all_absolute_wave_elevations[vertex], culled.all_absolute_wave_elevations[vertex]);
+            }
+        }
+        ASSERT_EQ(all.immersed_volume(), culled.immersed_volume());
+    }
+    ASSERT_EQ(n*(size_t)nodes.cols(), culled.get_nb_of_evaluated_vertices() + culled.get_nb_of_skipped_vertices());
+    ASSERT_LT(0, culled.get_nb_of_skipped_vertices());
+    ASSERT_LT(0, culled.get_nb_of_evaluated_vertices());
+}
@@ -0,0 +1,128 @@
+/*
+ * MeshSimplifierTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "MeshSimplifierTest.hpp"
+#include "MeshSimplifier.hpp"
+#include "xdyn/exceptions/MeshException.hpp"
+#include "xdyn/mesh/MeshBuilder.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+MeshSimplifierTest::MeshSimplifierTest() : a(ssc::random_data_generator::DataGenerator(5412))
+{
+}
+
+MeshSimplifierTest::~MeshSimplifierTest()
+{
+}
+
+void MeshSimplifierTest::SetUp()
+{
+}
+
+void MeshSimplifierTest::TearDown()
+{
+}
+
+VectorOfVectorOfPoints ellipsoid(const double a, const double b, const double c, const size_t nb_of_meridians, const size_t nb_of_parallels);
+VectorOfVectorOfPoints ellipsoid(const double a, const double b, const double c, const size_t nb_of_meridians, const size_t nb_of_parallels)
+{
+    // Outward normals (right-hand rule). The points shared by several facets must be exactly equal.
+    const auto P = [&](const size_t i, const size_t j)
+    {
+        if (j == 0)               return EPoint(0, 0, c);
+        if (j == nb_of_parallels) return EPoint(0, 0, -c);
+        const double theta = PI*(double)j/(double)nb_of_parallels;
+        const double phi = 2*PI*(double)(i % nb_of_meridians)/(double)nb_of_meridians;
+        return EPoint(a*std::sin(theta)*std::cos(phi), b*std::sin(theta)*std::sin(phi), c*std::cos(theta));
+    };
+    VectorOfVectorOfPoints ret;
+    for (size_t i = 0 ; i < nb_of_meridians ; ++i)
+    {
+        for (size_t j = 0 ; j < nb_of_parallels ; ++j)
+        {
+            const EPoint A = P(i, j), B = P(i, j+1), C = P(i+1, j+1), D = P(i+1, j);
+            if (j > 0)                   ret.push_back({A, B, D});
+            if (j + 1 < nb_of_parallels) ret.push_back({B, C, D});
+        }
+    }
+    return ret;
+}
+
+TEST_F(MeshSimplifierTest, example)
+{
+//! [MeshSimplifierTest example]
+    const VectorOfVectorOfPoints hull = ellipsoid(10, 2, 1, 120, 60);
+    // Waterplane at z = 0.3 m in the mesh frame, shortest wavelength of 5 m, 10 edges per wavelength
+    const size_t budget = MeshSimplifier::get_facet_budget(hull, 5, 10);
+    const VectorOfVectorOfPoints simplified = MeshSimplifier(hull, 0.3).simplify(budget);
+    const MeshSimplifier::Properties before = MeshSimplifier::get_properties(hull, 0.3);
+    const MeshSimplifier::Properties after = MeshSimplifier::get_properties(simplified, 0.3);
+//! [MeshSimplifierTest example]
+//! [MeshSimplifierTest expected output]
+    ASSERT_EQ(hull.size(), before.nb_of_facets);
+    ASSERT_EQ(simplified.size(), after.nb_of_facets);
+    ASSERT_GE(budget, simplified.size());
+    ASSERT_GT(hull.size()/5, simplified.size());
+    ASSERT_NEAR(before.volume, after.volume, 1E-9*before.volume);
+    ASSERT_NEAR(before.waterplane_area, after.waterplane_area, 1E-9*before.waterplane_area);
+    ASSERT_NEAR(before.centroid(0), after.centroid(0), 1E-3);
+    ASSERT_NEAR(before.centroid(1), after.centroid(1), 1E-3);
+    ASSERT_NEAR(before.centroid(2), after.centroid(2), 1E-3);
+//! [MeshSimplifierTest expected output]
+}
+
+TEST_F(MeshSimplifierTest, can_compute_the_properties_of_a_mesh)
+{
+    const MeshSimplifier::Properties p = MeshSimplifier::get_properties(ellipsoid(3, 2, 1, 400, 200), 0.5);
+    ASSERT_NEAR(4./3*PI*3*2*1, p.volume, 1E-3*p.volume);
+    ASSERT_NEAR(0, p.centroid.norm(), 1E-6);
+    // Section of the ellipsoid at z = 0.5: ellipse of semi-axes 3*sqrt(1-0.25) & 2*sqrt(1-0.25)
+    ASSERT_NEAR(PI*3*2*0.75, p.waterplane_area, 1E-3*p.waterplane_area);
+    ASSERT_EQ(400*2*199, p.nb_of_facets);
+}
+
+TEST_F(MeshSimplifierTest, simplified_mesh_is_closed_and_has_the_same_orientation)
+{
+    const VectorOfVectorOfPoints simplified = MeshSimplifier(ellipsoid(5, 1, 1, 80, 40), 0).simplify(1000);
+    ASSERT_GE(1000, simplified.size());
+    const Mesh mesh = MeshBuilder(simplified).build();
+    for (const auto& facets:mesh.facets_per_edge)
+    {
+        ASSERT_EQ(2, facets.size());
+    }
+    ASSERT_LT(0, MeshSimplifier::get_properties(simplified, 0).volume);
+}
+
+TEST_F(MeshSimplifierTest, facets_crossing_the_waterplane_are_not_modified)
+{
+    const VectorOfVectorOfPoints hull = ellipsoid(5, 1, 1, 80, 40);
+    const double z = 0.27;
+    const VectorOfVectorOfPoints simplified = MeshSimplifier(hull, z).simplify(100);
+    size_t nb_of_crossing_facets = 0;
+    for (const auto& facet:hull)
+    {
+        const double zmin = std::min(facet[0](2), std::min(facet[1](2), facet[2](2)));
+        const double zmax = std::max(facet[0](2), std::max(facet[1](2), facet[2](2)));
+        if ((zmin < z) and (zmax > z))
+        {
+            ++nb_of_crossing_facets;
+            ASSERT_NE(simplified.end(), std::find(simplified.begin(), simplified.end(), facet));
+        }
+    }
+    ASSERT_EQ(160, nb_of_crossing_facets);
+}
+
+TEST_F(MeshSimplifierTest, facet_budget_is_based_on_the_shortest_wavelength)
+{
+    const VectorOfVectorOfPoints square = {{EPoint(0,0,0), EPoint(10,0,0), EPoint(10,10,0)}, {EPoint(0,0,0), EPoint(10,10,0), EPoint(0,10,0)}};
+    // Edges 1 m long: equilateral triangles of sqrt(3)/4 m^2
+    ASSERT_EQ((size_t)std::ceil(100/(std::sqrt(3.)/4)), MeshSimplifier::get_facet_budget(square, 10, 10));
+    ASSERT_EQ((size_t)std::ceil(100/(std::sqrt(3.)/4)/4), MeshSimplifier::get_facet_budget(square, 20, 10));
+    ASSERT_THROW(MeshSimplifier::get_facet_budget(square, 0, 10), MeshException);
+}
@@ -0,0 +1,23 @@
+/*
+ * MeshSimplifierTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef MESHSIMPLIFIERTEST_HPP_
+#define MESHSIMPLIFIERTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class MeshSimplifierTest : public ::testing::Test
+{
+    protected:
+        MeshSimplifierTest();
+        virtual ~MeshSimplifierTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* MESHSIMPLIFIERTEST_HPP_ */
@@ -0,0 +1,83 @@
+/*
+ * AcceptedStatesRecorder.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ACCEPTEDSTATESRECORDER_HPP_
+#define ACCEPTEDSTATESRECORDER_HPP_
+
+#include "xdyn/core/Sim.hpp"
+
+#include <ssc/solver/DiscreteSystem.hpp>
+#include <ssc/solver/Scheduler.hpp>
+#include <ssc/solver/solve.hpp>
+
+#include <memory>
+#include <vector>
+
+/** \brief Records the states accepted by the solver in the history of the bodies, then forwards to an observer
+ *  \details Sim::dx_dt only sets the states of each stage tentatively (cf. Body::set_stage_states): the solver
+ *           calls 'observe_after_solver_step' at the first instant & after each step it accepted, with the
+ *           accepted states in Sim::state, so this is where they are committed (cf. Sim::accept_states).
+ *           The wrapped observer therefore sees the history including the accepted states.
+ *  \ingroup simulator
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/SimTest.cpp SimTest accepted states example
+ */
+template <typename ObserverType> class AcceptedStatesRecorder
+{
+    public:
+        AcceptedStatesRecorder(Sim& sys_, ObserverType& observer_) : sys(sys_), observer(observer_)
+        {
+        }
+
+        void check_variables_to_serialize_are_available() const
+        {
+            observer.check_variables_to_serialize_are_available();
+        }
+
+        void observe_before_solver_step(const Sim& s, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+        {
+            observer.observe_before_solver_step(s, t, discrete_systems);
+        }
+
+        void observe_after_solver_step(const Sim& s, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+        {
+            sys.accept_states(t);
+            observer.observe_after_solver_step(s, t, discrete_systems);
+        }
+
+        void collect_available_serializations(const Sim& s, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+        {
+            observer.collect_available_serializations(s, t, discrete_systems);
+        }
+
+        void flush()
+        {
+            observer.flush();
+        }
+
+    private:
+        AcceptedStatesRecorder(); // Disabled
+        Sim& sys;
+        ObserverType& observer;
+};
+
+/**  \brief Runs the solver on 'sys', recording the accepted states in the history of the bodies
+  *  \details Use this instead of calling ssc::solver::quicksolve directly: otherwise the history only contains
+  *           the initial states.
+  */
+template <typename StepperType, typename ObserverType> void run_solver(Sim& sys, ssc::solver::Scheduler& scheduler, ObserverType& observer)
+{
+    AcceptedStatesRecorder<ObserverType> recorder(sys, observer);
+    ssc::solver::quicksolve<StepperType>(sys, scheduler, recorder);
+}
+
+template <typename StepperType, typename ObserverType> void run_solver(Sim& sys, ssc::solver::Scheduler& scheduler, ObserverType& observer, const std::vector<ssc::solver::DiscreteSystemPtr>& discrete_systems)
+{
+    AcceptedStatesRecorder<ObserverType> recorder(sys, observer);
+    ssc::solver::quicksolve<StepperType>(sys, scheduler, recorder, discrete_systems);
+}
+
+#endif /* ACCEPTEDSTATESRECORDER_HPP_ */
@@ -0,0 +1,358 @@
+/*
+ * AsyncObserver.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "AsyncObserver.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
+
+#include <iostream>
+
+AsyncObserver::Observation::Observation() : after_solver_step(false), variables(), values(), grids()
+{
+}
+
+void AsyncObserver::Observation::clear()
+{
+    variables.clear();
+    values.clear();
+    grids.clear();
+}
+
+AsyncObserver::TimeStep::TimeStep() : observations(), nb_of_observations(0), flush(false)
+{
+}
+
+void AsyncObserver::TimeStep::clear()
+{
+    nb_of_observations = 0;
+    flush = false;
+}
+
+AsyncObserver::Observation& AsyncObserver::TimeStep::new_observation(const bool after_solver_step)
+{
+    if (nb_of_observations == observations.size())
+    {
+        observations.push_back(Observation());
+    }
+    Observation& observation = observations[nb_of_observations++];
+    observation.clear();
+    observation.after_solver_step = after_solver_step;
+    return observation;
+}
+
+AsyncObserver::Backpressure AsyncObserver::parse_backpressure(const std::string& backpressure)
+{
+    if (backpressure == "block")       return Backpressure::BLOCK;
+    if (backpressure == "drop oldest") return Backpressure::DROP_OLDEST;
+    if (backpressure == "decimate")    return Backpressure::DECIMATE;
+    THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unknown backpressure policy '" << backpressure << "' for asynchronous outputs: expected 'block', 'drop oldest' or 'decimate'");
+    return Backpressure::BLOCK;
+}
+
+const Observer& check_not_null(const ObserverPtr& observer);
+const Observer& check_not_null(const ObserverPtr& observer)
+{
+    if (not(observer))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The observer running in the background should not be null");
+    }
+    return *observer;
+}
+
+AsyncObserver::AsyncObserver(
+        const ObserverPtr& observer_,
+        const size_t queue_size,
+        const Backpressure backpressure_,
+        const size_t decimation_) :
+            // Only the variables requested by the wrapped observer are copied to the queue
+            Observer(check_not_null(observer_).get_requested_serializations(), check_not_null(observer_).outputs_everything()),
+            observer(observer_),
+            decimation(decimation_),
+            backpressure(backpressure_),
+            variables(),
+            variables_mutex(),
+            nb_of_variables(0),
+            grid_variables(),
+            current_step(),
+            nb_of_time_steps(0),
+            nb_of_dropped_time_steps(0),
+            stopping(false),
+            failed(false),
+            error(),
+            error_reported(false),
+            queue(queue_size),
+            background_thread()
+{
+    if (decimation == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The decimation factor should be at least 1");
+    }
+    background_thread = std::thread(&AsyncObserver::serialize_in_background, this);
+}
+
+AsyncObserver::~AsyncObserver()
+{
+    if (current_step.nb_of_observations)
+    {
+        // Observations not followed by a call to flush
+        push(current_step);
+    }
+    stopping = true;
+    background_thread.join();
+    if (failed && not(error_reported))
+    {
+        try
+        {
+            std::rethrow_exception(error);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Error while writing asynchronous outputs: " << e.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cerr << "Unknown error while writing asynchronous outputs" << std::endl;
+        }
+    }
+}
+
+size_t AsyncObserver::get_nb_of_dropped_time_steps() const
+{
+    return nb_of_dropped_time_steps;
+}
+
+void AsyncObserver::check_variables_to_serialize_are_available() const
+{
+    observer->check_variables_to_serialize_are_available();
+}
+
+void AsyncObserver::collect_available_serializations(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+{
+    // Called before the first time step, so the background thread is not using the observer yet
+    observer->collect_available_serializations(sys, t, discrete_systems);
+    Observer::collect_available_serializations(sys, t, discrete_systems);
+}
+
+void AsyncObserver::observe_before_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+{
+    rethrow_serialization_error();
+    current_step.new_observation(false);
+    Observer::observe_before_solver_step(sys, t, discrete_systems);
+}
+
+void AsyncObserver::observe_after_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems)
+{
+    rethrow_serialization_error();
+    current_step.new_observation(true);
+    Observer::observe_after_solver_step(sys, t, discrete_systems);
+}
+
+// Everything written before the simulation goes straight to the wrapped observer:
+// the background thread does not use it until the first time step is queued.
+// The variables only written before the simulation are also removed from the ones this observer queues.
+void AsyncObserver::write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address)
+{
+    observer->write_before_simulation(val, address);
+    remove_variable("spectra");
+}
+
+void AsyncObserver::write_before_simulation(const MeshPtr mesh, const DataAddressing& address)
+{
+    observer->write_before_simulation(mesh, address);
+    remove_variable("mesh");
+}
+
+void AsyncObserver::write_before_simulation(const std::string& data, const DataAddressing& address)
+{
+    observer->write_before_simulation(data, address);
+}
+
+void AsyncObserver::write_command_line_before_simulation(const std::string& command_line)
+{
+    observer->write_command_line_before_simulation(command_line);
+    remove_variable("command line");
+}
+
+void AsyncObserver::write_yaml_before_simulation(const std::string& yaml)
+{
+    observer->write_yaml_before_simulation(yaml);
+    remove_variable("yaml");
+}
+
+void AsyncObserver::write_matlab_script_before_simulation()
+{
+    observer->write_matlab_script_before_simulation();
+    remove_variable("matlab scripts");
+}
+
+void AsyncObserver::write_python_script_before_simulation()
+{
+    observer->write_python_script_before_simulation();
+    remove_variable("python scripts");
+}
+
+size_t AsyncObserver::add_variable(const DataAddressing& address)
+{
+    std::lock_guard<std::mutex> lock(variables_mutex);
+    variables.push_back(address);
+    nb_of_variables = variables.size();
+    return variables.size() - 1;
+}
+
+std::function<void()> AsyncObserver::get_serializer(const double& val, const DataAddressing& address)
+{
+    // Called once per variable, so the variable's index is only looked up when it is first written
+    const size_t idx = add_variable(address);
+    return [this,&val,idx]()
+           {
+               Observation& observation = current_step.observations[current_step.nb_of_observations-1];
+               observation.variables.push_back(idx);
+               observation.values.push_back(val);
+           };
+}
+
+std::function<void()> AsyncObserver::get_initializer(const double, const DataAddressing&)
+{
+    return [](){};
+}
+
+std::function<void()> AsyncObserver::get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address)
+{
+    // Called at each time step (the grid is copied)
+    auto it = grid_variables.find(address.name);
+    if (it == grid_variables.end())
+    {
+        it = grid_variables.insert(std::make_pair(address.name, add_variable(address))).first;
+    }
+    const size_t idx = it->second;
+    return [this,val,idx]()
+           {
+               current_step.observations[current_step.nb_of_observations-1].grids.push_back(std::make_pair(idx, val));
+           };
+}
+
+std::function<void()> AsyncObserver::get_initializer(const SurfaceElevationGrid&, const DataAddressing&)
+{
+    return [](){};
+}
+
+void AsyncObserver::flush_after_initialization()
+{
+}
+
+void AsyncObserver::flush_value_during_write()
+{
+}
+
+void AsyncObserver::flush_after_write()
+{
+    rethrow_serialization_error();
+    current_step.flush = true;
+    push(current_step);
+}
+
+void AsyncObserver::push(TimeStep& step)
+{
+    const size_t time_step = nb_of_time_steps++;
+    bool dropped = false;
+    switch (backpressure)
+    {
+        case Backpressure::BLOCK:
+            dropped = not(queue.push(step, [this](){return failed.load();}));
+            break;
+        case Backpressure::DROP_OLDEST:
+            dropped = queue.push_overwriting_oldest(step);
+            break;
+        case Backpressure::DECIMATE:
+            if ((2*queue.size() >= queue.get_capacity()) && (time_step % decimation))
+            {
+                dropped = true;
+            }
+            else
+            {
+                dropped = not(queue.try_push(step));
+            }
+            break;
+    }
+    if (dropped) nb_of_dropped_time_steps++;
+    // Either what we recorded, or a time step already serialized whose memory we recycle
+    step.clear();
+}
+
+void AsyncObserver::rethrow_serialization_error()
+{
+    if (failed && not(error_reported))
+    {
+        error_reported = true;
+        std::rethrow_exception(error);
+    }
+}
+
+void AsyncObserver::replay(const TimeStep& step, std::vector<DataAddressing>& known_variables)
+{
+    for (size_t i = 0 ; i < step.nb_of_observations ; ++i)
+    {
+        const Observation& observation = step.observations[i];
+        const auto write_values = [this,&observation,&known_variables]()
+            {
+                for (size_t j = 0 ; j < observation.values.size() ; ++j)
+                {
+                    const DataAddressing& address = known_variables[observation.variables[j]];
+                    if (observation.after_solver_step) observer->write_after_solver_step(observation.values[j], address);
+                    else                               observer->write_before_solver_step(observation.values[j], address);
+                }
+                for (const auto& grid:observation.grids)
+                {
+                    const DataAddressing& address = known_variables[grid.first];
+                    if (observation.after_solver_step) observer->write_after_solver_step(grid.second, address);
+                    else                               observer->write_before_solver_step(grid.second, address);
+                }
+            };
+        if (observation.after_solver_step) observer->observe_values_after_solver_step(write_values);
+        else                               observer->observe_values_before_solver_step(write_values);
+    }
+    if (step.flush)
+    {
+        observer->flush();
+    }
+}
+
+void AsyncObserver::serialize_in_background()
+{
+    std::vector<DataAddressing> known_variables; // Copy of 'variables', so we only lock when new variables appear
+    TimeStep step;
+    size_t nb_of_attempts = 0;
+    try
+    {
+        for (;;)
+        {
+            const bool last_attempt = stopping; // Read before trying to pop, so we do not miss the last time step
+            if (queue.try_pop(step))
+            {
+                nb_of_attempts = 0;
+                if (nb_of_variables > known_variables.size())
+                {
+                    std::lock_guard<std::mutex> lock(variables_mutex);
+                    known_variables.insert(known_variables.end(), variables.begin() + (long)known_variables.size(), variables.end());
+                }
+                replay(step, known_variables);
+            }
+            else if (last_attempt)
+            {
+                return;
+            }
+            else
+            {
+                SpscRingBuffer<TimeStep>::back_off(nb_of_attempts++);
+            }
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+        failed = true;
+    }
+}
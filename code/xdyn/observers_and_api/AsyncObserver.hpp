@@ -0,0 +1,132 @@
+/*
+ * AsyncObserver.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ASYNCOBSERVER_HPP_
+#define ASYNCOBSERVER_HPP_
+
+#include "SpscRingBuffer.hpp"
+#include "xdyn/core/Observer.hpp"
+#include "xdyn/core/SurfaceElevationGrid.hpp"
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/** \brief Serializes the outputs of another observer in a background thread
+ *  \details The values written by Sim::output at each time step are copied (on the
+ *           solver's thread) into a SpscRingBuffer, which is drained by a background thread
+ *           replaying them into the wrapped observer: text formatting, file & network I/O
+ *           no longer slow down the solver. What happens when the background thread does
+ *           not keep up (ie. when the queue is full) depends on the backpressure policy.
+ *           The outputs are the same as the ones of the wrapped observer (except for the
+ *           time steps which were dropped, if any). The wrapped observer should not be used
+ *           by anything else once the simulation has started.
+ *           The destructor waits until all queued time steps have been serialized.
+ *  \ingroup observers
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/AsyncObserverTest.cpp AsyncObserverTest example
+ */
+class AsyncObserver : public Observer
+{
+    public:
+        enum class Backpressure
+        {
+            BLOCK,       //!< The solver waits until there is room in the queue: no time step is lost
+            DROP_OLDEST, //!< The oldest queued time step is discarded: the solver never waits
+            DECIMATE     //!< Once the queue is half full, only one time step out of 'decimation' is queued (& the others are discarded): the solver never waits
+        };
+        static Backpressure parse_backpressure(const std::string& backpressure); // "block", "drop oldest" or "decimate"
+
+        AsyncObserver(const ObserverPtr& observer,            //!< Observer actually serializing the outputs (in the background thread)
+                      const size_t queue_size = 1024,         //!< Maximum number of time steps waiting to be serialized
+                      const Backpressure backpressure = Backpressure::BLOCK,
+                      const size_t decimation = 10            //!< Only used by Backpressure::DECIMATE
+                      );
+        ~AsyncObserver();
+
+        void check_variables_to_serialize_are_available() const override;
+        void collect_available_serializations(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems) override;
+        void observe_before_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems) override;
+        void observe_after_solver_step(const Sim& sys, const double t, const std::vector<std::shared_ptr<ssc::solver::DiscreteSystem> >& discrete_systems) override;
+
+        void write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address) override;
+        void write_before_simulation(const MeshPtr mesh, const DataAddressing& address) override;
+        void write_before_simulation(const std::string& data, const DataAddressing& address) override;
+        void write_command_line_before_simulation(const std::string& command_line) override;
+        void write_yaml_before_simulation(const std::string& yaml) override;
+        void write_matlab_script_before_simulation() override;
+        void write_python_script_before_simulation() override;
+
+        size_t get_nb_of_dropped_time_steps() const;
+
+    private:
+        AsyncObserver(); // Disabled
+        AsyncObserver(const AsyncObserver&); // Disabled
+        AsyncObserver& operator=(const AsyncObserver&); // Disabled
+
+        /** \brief Values written during one call to observe_before_solver_step or observe_after_solver_step
+         */
+        struct Observation
+        {
+            Observation();
+            void clear();
+            bool after_solver_step;
+            std::vector<size_t> variables; //!< Indexes in 'variables' (cf. AsyncObserver::variables)
+            std::vector<double> values;
+            std::vector<std::pair<size_t,SurfaceElevationGrid> > grids;
+        };
+
+        /** \brief Everything written between two calls to Observer::flush (ie. one time step)
+         */
+        struct TimeStep
+        {
+            TimeStep();
+            void clear();
+            Observation& new_observation(const bool after_solver_step);
+            std::vector<Observation> observations; //!< Only the first nb_of_observations are used (the others are kept to recycle their memory)
+            size_t nb_of_observations;
+            bool flush;
+        };
+
+        using Observer::get_serializer;
+        using Observer::get_initializer;
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address) override;
+        std::function<void()> get_initializer(const double val, const DataAddressing& address) override;
+        std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address) override;
+        std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address) override;
+
+        void flush_after_initialization() override;
+        void flush_after_write() override;
+        void flush_value_during_write() override;
+
+        size_t add_variable(const DataAddressing& address);
+        void push(TimeStep& step);
+        void rethrow_serialization_error();
+        void serialize_in_background();
+        void replay(const TimeStep& step, std::vector<DataAddressing>& known_variables);
+
+        ObserverPtr observer;
+        size_t decimation;
+        Backpressure backpressure;
+        std::deque<DataAddressing> variables; //!< Appended by the solver's thread & read by the background thread (protected by variables_mutex)
+        std::mutex variables_mutex;
+        std::atomic<size_t> nb_of_variables; //!< Lets the background thread know when new variables were added (without locking)
+        std::map<std::string,size_t> grid_variables;
+        TimeStep current_step; //!< Being recorded by the solver's thread
+        size_t nb_of_time_steps;
+        std::atomic<size_t> nb_of_dropped_time_steps;
+        std::atomic<bool> stopping;
+        std::atomic<bool> failed;
+        std::exception_ptr error; //!< Thrown by the wrapped observer in the background thread (only read once 'failed' is true)
+        bool error_reported;      //!< True once 'error' has been rethrown in the solver's thread
+        SpscRingBuffer<TimeStep> queue;
+        std::thread background_thread;
+};
+
+#endif /* ASYNCOBSERVER_HPP_ */
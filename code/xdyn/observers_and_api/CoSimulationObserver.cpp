@@ -31,18 +31,18 @@ CoSimulationObserver::CoSimulationObserver(const std::vector<std::string>& extra
 {
 }
 
-std::function<void()> CoSimulationObserver::get_serializer(const double val, const DataAddressing& address)
+std::function<void()> CoSimulationObserver::get_serializer(const double& val, const DataAddressing& address)
 {
     if(address.name=="t")
     {
-        return [this, val, address]()
+        return [this, &val, address]()
         {
             current_state.t = val;
         };
     }
     else if(address.address.at(0)=="states" && address.address.at(1)==body_name)
     {
-        return [this, val, address]()
+        return [this, &val, address]()
         {
             if(address.address.at(2)=="X")
             {
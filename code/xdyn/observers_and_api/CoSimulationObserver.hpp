@@ -11,7 +11,7 @@ public:
 
 private:
     using Observer::get_serializer;
-    std::function<void()> get_serializer(const double val, const DataAddressing& address) override;
+    std::function<void()> get_serializer(const double& val, const DataAddressing& address) override;
 
     const std::string body_name;
 };
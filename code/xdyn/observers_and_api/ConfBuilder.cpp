@@ -7,6 +7,12 @@ ConfBuilder::ConfBuilder(const std::string& yaml)
 {
 }
 
+ConfBuilder::ConfBuilder(const YamlSimulatorInput& input, const MeshMap& meshes)
+    : sim(get_system(input, meshes, 0))
+    , Tmax(sim.get_bodies().front()->get_states().x.get_Tmax())
+{
+}
+
 ConfBuilder::ConfBuilder(const std::string& yaml, const VectorOfVectorOfPoints& mesh)
     : sim(get_system(yaml, mesh, 0))
     , Tmax(sim.get_bodies().front()->get_states().x.get_Tmax())
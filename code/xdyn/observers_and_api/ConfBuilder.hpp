@@ -9,13 +9,17 @@
 #define OBSERVERS_AND_API_INC_CONFBUILDER_HPP_
 
 #include "xdyn/core/Sim.hpp"
+#include <map>
 #include <string>
 
+struct YamlSimulatorInput;
+
 class ConfBuilder
 {
     public :
         ConfBuilder(const std::string& yaml_model);
         ConfBuilder(const std::string& yaml_model, const VectorOfVectorOfPoints& mesh);
+        ConfBuilder(const YamlSimulatorInput& parsed_yaml_model, const std::map<std::string, VectorOfVectorOfPoints>& meshes); //!< Neither parses the YAML nor reads the meshes again (eg. to build one Sim per session, cf. read_meshes)
 
         Sim sim;
         const double Tmax;
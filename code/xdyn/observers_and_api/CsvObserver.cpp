@@ -37,9 +37,9 @@ CsvObserver::~CsvObserver()
     if (output_to_file) delete(&os);
 }
 
-std::function<void()> CsvObserver::get_serializer(const double val, const DataAddressing& d)
+std::function<void()> CsvObserver::get_serializer(const double& val, const DataAddressing& d)
 {
-    return [this,val,d](){cache[d.name] = val;};
+    return [this,&val,d](){cache[d.name] = val;};
 }
 
 std::function<void()> CsvObserver::get_initializer(const double, const DataAddressing& address)
@@ -33,7 +33,7 @@ class CsvObserver : public Observer
         using Observer::get_serializer;
         using Observer::get_initializer;
 
-        std::function<void()> get_serializer(const double val, const DataAddressing& address) override;
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address) override;
         std::function<void()> get_initializer(const double val, const DataAddressing& address) override;
 };
 
@@ -36,9 +36,9 @@ DictObserver::~DictObserver()
 {
 }
 
-std::function<void()> DictObserver::get_serializer(const double val, const DataAddressing& d)
+std::function<void()> DictObserver::get_serializer(const double& val, const DataAddressing& d)
 {
-    return [this,d,val]()
+    return [this,d,&val]()
                       {
                         DictMapKeyVar j = extractKeyVarFromString(d.name);
                         if (not j.first.empty())
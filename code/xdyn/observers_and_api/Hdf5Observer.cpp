@@ -9,6 +9,8 @@
 #include "demoMatLab.hpp"
 #include "demoPython.hpp"
 
+#include <iostream>
+
 
 Hdf5Addressing::Hdf5Addressing(
         const DataAddressing& addressing,
@@ -18,14 +20,31 @@ Hdf5Addressing::Hdf5Addressing(
 {
 }
 
-Hdf5Observer::Hdf5Observer(const std::string& filename_) :
+Hdf5Buffering::Hdf5Buffering(
+        const size_t nb_of_rows_in_buffer_,
+        const size_t chunk_size_,
+        const unsigned int compression_level_) :
+            nb_of_rows_in_buffer(nb_of_rows_in_buffer_),
+            chunk_size((hsize_t)(chunk_size_ ? chunk_size_ : nb_of_rows_in_buffer_)),
+            compression_level(compression_level_)
+{
+    if (nb_of_rows_in_buffer == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The HDF5 buffer should contain at least one time step");
+    }
+}
+
+Hdf5Observer::Column::Column() : dataset(), buffer(), nb_of_rows_written(0)
+{
+}
+
+Hdf5Observer::Hdf5Observer(const std::string& filename_, const Hdf5Buffering& buffering_) :
             Observer(),
             h5File(H5_Tools::openEmptyHdf5File(filename_)),
+            buffering(buffering_),
             basename("outputs"),
             name2address(),
-            name2dataset(),
-            name2datatype(),
-            name2dataspace(),
+            name2column(),
             wave_serializer(),
             filename(filename_)
 {
@@ -34,41 +53,72 @@ Hdf5Observer::Hdf5Observer(const std::string& filename_) :
 
 Hdf5Observer::Hdf5Observer(
         const std::string& filename_,
-        const std::vector<std::string>& d) :
+        const std::vector<std::string>& d,
+        const Hdf5Buffering& buffering_) :
             Observer(d),
             h5File(H5_Tools::openEmptyHdf5File(filename_)),
+            buffering(buffering_),
             basename("outputs"),
             name2address(),
-            name2dataset(),
-            name2datatype(),
-            name2dataspace(),
+            name2column(),
             wave_serializer(),
             filename(filename_)
 {
     h5_writeFileDescription(h5File);
 }
 
-std::function<void()> Hdf5Observer::get_serializer(const double val, const DataAddressing& addressing)
+Hdf5Observer::~Hdf5Observer()
 {
-    return [this,val,addressing]()
+    try
+    {
+        write_buffered_rows();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Unable to write the last time steps to HDF5 file '" << filename << "': " << e.what() << std::endl;
+    }
+    catch (const H5::Exception& e)
+    {
+        std::cerr << "Unable to write the last time steps to HDF5 file '" << filename << "': " << e.getDetailMsg() << std::endl;
+    }
+}
+
+void Hdf5Observer::write_buffered_rows()
+{
+    for (auto& name_column:name2column)
+    {
+        write_buffer(name_column.second);
+    }
+}
+
+void Hdf5Observer::write_buffer(Column& column)
+{
+    if (column.buffer.empty())
+    {
+        return;
+    }
+    const hsize_t offset[1] = {column.nb_of_rows_written};
+    const hsize_t count[1] = {(hsize_t)column.buffer.size()};
+    const hsize_t size[1] = {column.nb_of_rows_written + count[0]};
+    column.dataset.extend(size);
+    H5::DataSpace fspace = column.dataset.getSpace();
+    fspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    const H5::DataSpace mspace(1, count);
+    column.dataset.write(column.buffer.data(), H5::PredType::NATIVE_DOUBLE, mspace, fspace);
+    column.nb_of_rows_written = size[0];
+    column.buffer.clear();
+}
+
+std::function<void()> Hdf5Observer::get_serializer(const double& val, const DataAddressing& addressing)
+{
+    Column* column = &name2column[addressing.name]; // std::map does not invalidate references on insertion
+    return [this,&val,column]()
            {
-                H5::DataSet dataset = name2dataset[addressing.name];
-                H5::DataSpace dataspace = dataset.getSpace();
-                hsize_t offset[1] = {(hsize_t)0};
-                hsize_t size[1] = {(hsize_t)0};
-                if (dataspace.getSimpleExtentDims(size)!=1)
+                column->buffer.push_back(val);
+                if (column->buffer.size() >= buffering.nb_of_rows_in_buffer)
                 {
-                    std::stringstream ss;
-                    ss << "Rank mismatch -> Should be one, not " << dataspace.getSimpleExtentNdims();
-                    THROW(__PRETTY_FUNCTION__, InternalErrorException, ss.str());
+                    write_buffer(*column);
                 }
-                const hsize_t dims[1] = {(hsize_t)1};
-                offset[0] = size[0];
-                size[0] += 1;
-                dataset.extend(size);
-                H5::DataSpace fspace = dataset.getSpace();
-                fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-                dataset.write(&val, name2datatype[addressing.name], H5_Tools::createDataSpace1DUnlimited(), fspace);
            };
 }
 
@@ -77,13 +127,15 @@ std::function<void()> Hdf5Observer::get_initializer(const double , const DataAdd
     return [this,addressing]()
            {
                 name2address[addressing.name] = Hdf5Addressing(addressing,this->basename).address;
-                name2datatype[addressing.name] = H5::DataType(H5::PredType::NATIVE_DOUBLE);
-                name2dataspace[addressing.name] = H5_Tools::createDataSpace1DEmptyUnlimited();
-                name2dataset[addressing.name] =
+                Column& column = name2column[addressing.name];
+                column.buffer.reserve(buffering.nb_of_rows_in_buffer);
+                column.dataset =
                         H5_Tools::createDataSet(h5File,
                                                 name2address[addressing.name],
-                                                name2datatype[addressing.name],
-                                                name2dataspace[addressing.name]);
+                                                H5::PredType::NATIVE_DOUBLE,
+                                                H5_Tools::createDataSpace1DEmptyUnlimited(),
+                                                buffering.chunk_size,
+                                                buffering.compression_level);
            };
 }
 
@@ -108,6 +160,7 @@ void Hdf5Observer::flush_after_initialization()
 
 void Hdf5Observer::flush_after_write()
 {
+    // Called after each time step: the rows are only written once the buffers are full (cf. get_serializer)
 }
 
 void Hdf5Observer::flush_value_during_write()
@@ -16,11 +16,34 @@ struct Hdf5Addressing
             );
 };
 
+/** \brief How the time series are laid out in the HDF5 file
+ *  \details Each time series is a 1D dataset: instead of extending it by one element at
+ *           each time step, the values are kept in memory & written nb_of_rows_in_buffer
+ *           at a time (as one hyperslab per dataset). The datasets are chunked & can be compressed.
+ */
+struct Hdf5Buffering
+{
+    Hdf5Buffering(const size_t nb_of_rows_in_buffer = 1, //!< Number of time steps kept in memory before being written
+                  const size_t chunk_size = 0,           //!< Number of time steps per chunk (0: same as nb_of_rows_in_buffer)
+                  const unsigned int compression_level = 0 //!< 0: no compression, 1 to 9: shuffle + deflate
+                  );
+    size_t nb_of_rows_in_buffer;
+    hsize_t chunk_size;
+    unsigned int compression_level;
+};
+
 class Hdf5Observer : public Observer
 {
     public:
-        Hdf5Observer(const std::string& filename);
-        Hdf5Observer(const std::string& filename, const std::vector<std::string>& data);
+        Hdf5Observer(const std::string& filename, const Hdf5Buffering& buffering = Hdf5Buffering());
+        Hdf5Observer(const std::string& filename, const std::vector<std::string>& data, const Hdf5Buffering& buffering = Hdf5Buffering());
+        ~Hdf5Observer();
+
+        /** \brief Writes the values still in memory to the file, at the end of the simulation
+         *  \details Called by the destructor. Observer::flush is called after each time step, so it does
+         *           not write anything: the rows are written nb_of_rows_in_buffer at a time.
+         */
+        void write_buffered_rows();
         void write_before_simulation(const MeshPtr mesh, const DataAddressing& address) override;
         void write_before_simulation(const std::string& data, const DataAddressing& address) override;
         void write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address) override;
@@ -36,18 +59,26 @@ class Hdf5Observer : public Observer
         using Observer::get_serializer;
         using Observer::get_initializer;
 
-        std::function<void()> get_serializer(const double val, const DataAddressing& address) override;
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address) override;
         std::function<void()> get_initializer(const double val, const DataAddressing& address) override;
 
         std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address) override;
         std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address) override;
 
+        struct Column
+        {
+            Column();
+            H5::DataSet dataset;
+            std::vector<double> buffer; //!< Values not written yet
+            hsize_t nb_of_rows_written;
+        };
+        void write_buffer(Column& column);
+
         H5::H5File h5File;
+        Hdf5Buffering buffering;
         std::string basename;
         std::map<std::string, std::string > name2address;
-        std::map<std::string, H5::DataSet> name2dataset;
-        std::map<std::string, H5::DataType> name2datatype;
-        std::map<std::string, H5::DataSpace> name2dataspace;
+        std::map<std::string, Column> name2column;
         Hdf5WaveObserverPtr wave_serializer;
         std::string filename;
 };
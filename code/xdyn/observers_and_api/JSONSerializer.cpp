@@ -25,6 +25,22 @@ YamlSimServerInputs deserialize(const std::string& input)
         THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "Expecting a JSON array but got '" << ssc::json::dump(document["states"]));
     }
     infos.Dt = ssc::json::find_optional_double("Dt", document, 0);
+    if (document.HasMember("reset"))
+    {
+        if (not(document["reset"].IsBool()))
+        {
+            THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "'reset' should be a boolean (true or false): got " << ssc::json::print_type(document["reset"]));
+        }
+        infos.reset = document["reset"].GetBool();
+    }
+    if (document.HasMember("session"))
+    {
+        if (not(document["session"].IsString()))
+        {
+            THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "'session' should be a string: got " << ssc::json::print_type(document["session"]));
+        }
+        infos.session = document["session"].GetString();
+    }
     for (rapidjson::Value& v:document["states"].GetArray())
     {
         YamlState s;
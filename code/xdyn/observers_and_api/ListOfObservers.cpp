@@ -6,6 +6,7 @@
  */
 
 #include "ListOfObservers.hpp"
+#include "AsyncObserver.hpp"
 #include "CsvObserver.hpp"
 #include "TsvObserver.hpp"
 #include "JsonObserver.hpp"
@@ -17,11 +18,12 @@
 ObserverPtr ListOfObservers::parse_observer(const YamlOutput& output)
 {
     ObserverPtr obs;
+    const Hdf5Buffering hdf5_buffering(output.buffer_size, output.chunk_size, output.compression_level);
     if (output.full_output)
     {
         if (output.format == "csv")  obs.reset(new CsvObserver(output.filename));
-        if (output.format == "h5")   obs.reset(new Hdf5Observer(output.filename));
-        if (output.format == "hdf5") obs.reset(new Hdf5Observer(output.filename));
+        if (output.format == "h5")   obs.reset(new Hdf5Observer(output.filename,hdf5_buffering));
+        if (output.format == "hdf5") obs.reset(new Hdf5Observer(output.filename,hdf5_buffering));
         if (output.format == "tsv")  obs.reset(new TsvObserver(output.filename));
         if (output.format == "map")  obs.reset(new MapObserver());
         if (output.format == "json") obs.reset(new JsonObserver(output.filename));
@@ -30,13 +32,17 @@ ObserverPtr ListOfObservers::parse_observer(const YamlOutput& output)
     else
     {
         if (output.format == "csv")  obs.reset(new CsvObserver(output.filename,output.data));
-        if (output.format == "h5")   obs.reset(new Hdf5Observer(output.filename,output.data));
-        if (output.format == "hdf5") obs.reset(new Hdf5Observer(output.filename,output.data));
+        if (output.format == "h5")   obs.reset(new Hdf5Observer(output.filename,output.data,hdf5_buffering));
+        if (output.format == "hdf5") obs.reset(new Hdf5Observer(output.filename,output.data,hdf5_buffering));
         if (output.format == "tsv")  obs.reset(new TsvObserver(output.filename,output.data));
         if (output.format == "map")  obs.reset(new MapObserver(output.data));
         if (output.format == "json") obs.reset(new JsonObserver(output.filename,output.data));
         if (output.format == "ws")   obs.reset(new WebSocketObserver(output.address,output.port,output.data));
     }
+    if (obs && output.asynchronous)
+    {
+        obs.reset(new AsyncObserver(obs, output.queue_size, AsyncObserver::parse_backpressure(output.backpressure), output.decimation));
+    }
     return obs;
 }
 
@@ -15,9 +15,9 @@ MapObserver::MapObserver(const std::vector<std::string>& d) : Observer(d), m()
 {
 }
 
-std::function<void()> MapObserver::get_serializer(const double val, const DataAddressing& address)
+std::function<void()> MapObserver::get_serializer(const double& val, const DataAddressing& address)
 {
-    return [this,address,val](){m[address.name].push_back(val);};
+    return [this,address,&val](){m[address.name].push_back(val);};
 }
 
 std::function<void()> MapObserver::get_initializer(const double, const DataAddressing& address)
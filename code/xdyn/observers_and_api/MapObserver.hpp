@@ -23,7 +23,7 @@ class MapObserver : public Observer
     private:
         using Observer::get_serializer;
         using Observer::get_initializer;
-        std::function<void()> get_serializer(const double val, const DataAddressing& address) override;
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address) override;
         std::function<void()> get_initializer(const double val, const DataAddressing& address) override;
         void flush_after_initialization() override;
         void flush_after_write() override;
@@ -0,0 +1,263 @@
+/*
+ * Sessions.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SESSIONS_HPP_
+#define SESSIONS_HPP_
+
+#include "xdyn/exceptions/InternalErrorException.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility> // std::pair
+#include <vector>
+
+/** \brief Independent simulation services (eg. XdynForCS), one per session, whose requests are handled by a fixed set of threads
+ *  \details Used by the co-simulation & model exchange servers to serve several clients at once. Each session
+ *           gets its own service, built (by a worker thread) when its first job is run, using the factory
+ *           given to the constructor. The factory should build the services from an already parsed model
+ *           so the YAML, meshes & hydrodynamic databases are only parsed once per process.
+ *           The jobs of a session are run one at a time, in the order in which they were posted, but the
+ *           jobs of different sessions are run concurrently (up to the number of threads).
+ *           Sessions which are neither running nor waiting for a job are destroyed (the least recently used
+ *           ones first) when there are more than 'max_nb_of_sessions' sessions: the next request of such a
+ *           session gets a new service. If the services keep a state between requests (eg. XdynForCS in
+ *           session mode), the first job posted for a destroyed session fails instead, so the client knows
+ *           it has to send its whole state again.
+ *  \ingroup observers
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/SessionsTest.cpp SessionsTest example
+ */
+template <typename ServiceT> class Sessions
+{
+    public:
+        typedef std::function<std::shared_ptr<ServiceT>()> Factory;
+        typedef std::function<void(ServiceT&)> Job;
+        typedef std::function<void(const std::exception_ptr&)> ErrorHandler;
+
+        Sessions(const Factory& make_service_,            //!< Builds the service of a new session
+                 const size_t nb_of_threads,              //!< Number of worker threads (at least 1)
+                 const size_t max_nb_of_sessions_,        //!< Number of sessions kept when they have no pending jobs (at least 1)
+                 const bool services_keep_state_ = false  //!< If true, the first job of a destroyed session fails (its state was lost)
+                 ) :
+            make_service(make_service_),
+            max_nb_of_sessions(max_nb_of_sessions_),
+            services_keep_state(services_keep_state_),
+            mutex(),
+            work_available(),
+            sessions(),
+            removed_sessions(),
+            ready(),
+            nb_of_posted_jobs(0),
+            stopping(false),
+            workers()
+        {
+            if (nb_of_threads == 0)
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "The number of threads should be at least 1");
+            }
+            if (max_nb_of_sessions == 0)
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "The maximum number of sessions should be at least 1");
+            }
+            for (size_t i = 0 ; i < nb_of_threads ; ++i)
+            {
+                workers.push_back(std::thread(&Sessions::work, this));
+            }
+        }
+
+        ~Sessions()
+        {
+            stop();
+        }
+
+        /**  \brief Runs the jobs which were already posted, then stops the threads
+          *  \details No job can be posted afterwards. Lets the servers wait for the replies of the pending jobs
+          *           before their connections are closed.
+          */
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            work_available.notify_all();
+            for (auto& worker:workers)
+            {
+                if (worker.joinable()) worker.join();
+            }
+        }
+
+        /**  \brief Queues 'job' for the service of the session (created if needed) & returns immediately
+          *  \details If the service cannot be built, or if 'job' throws, 'on_error' is called (by the worker thread)
+          *           with the exception. If the services keep a state & the session was destroyed, 'job' is not
+          *           run: 'on_error' is called with an InvalidInputException & the next job gets a new service.
+          */
+        void post(const std::string& session_id, const Job& job, const ErrorHandler& on_error)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (stopping)
+                {
+                    THROW(__PRETTY_FUNCTION__, InternalErrorException, "Cannot post a job for session '" << session_id << "': the sessions are being destroyed");
+                }
+                std::shared_ptr<Session>& session = sessions[session_id];
+                if (not(session))
+                {
+                    session.reset(new Session(session_id));
+                    session->was_removed = removed_sessions.erase(session_id) > 0;
+                }
+                session->pending.push_back(std::make_pair(job, on_error));
+                session->last_use = ++nb_of_posted_jobs;
+                if (not(session->is_scheduled))
+                {
+                    session->is_scheduled = true;
+                    ready.push_back(session);
+                }
+                remove_idle_sessions();
+            }
+            work_available.notify_one();
+        }
+
+        /**  \brief Runs 'job' for the service of the session (created if needed) & waits for it to finish
+          *  \details Rethrows the exceptions thrown by 'job' or by the factory. Should not be called by a job.
+          */
+        void run(const std::string& session_id, const Job& job)
+        {
+            const std::shared_ptr<std::promise<void> > done(new std::promise<void>());
+            post(session_id,
+                 [&job, done](ServiceT& service){job(service); done->set_value();},
+                 [done](const std::exception_ptr& e){done->set_exception(e);});
+            done->get_future().get();
+        }
+
+        size_t get_nb_of_sessions() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return sessions.size();
+        }
+
+        size_t get_nb_of_threads() const
+        {
+            return workers.size();
+        }
+
+    private:
+        Sessions(); // Disabled
+        Sessions(const Sessions&); // Disabled
+        Sessions& operator=(const Sessions&); // Disabled
+
+        struct Session
+        {
+            Session(const std::string& id_) : id(id_), service(), pending(), is_scheduled(false), last_use(0), was_removed(false)
+            {
+            }
+            std::string id;
+            std::shared_ptr<ServiceT> service;                     //!< Only used by the worker running the session's current job
+            std::deque<std::pair<Job, ErrorHandler> > pending;
+            bool is_scheduled;                                     //!< In 'ready' or being run by a worker
+            size_t last_use;                                       //!< Value of nb_of_posted_jobs when the latest job was posted
+            bool was_removed;                                      //!< The session's state was lost & its first job should fail
+        };
+
+        // Called with 'mutex' locked
+        void remove_idle_sessions()
+        {
+            while (sessions.size() > max_nb_of_sessions)
+            {
+                auto least_recently_used = sessions.end();
+                for (auto it = sessions.begin() ; it != sessions.end() ; ++it)
+                {
+                    // A session still running a job is never removed: its next job could otherwise run concurrently on a new service
+                    const bool is_idle = not(it->second->is_scheduled);
+                    if (is_idle and ((least_recently_used == sessions.end()) or (it->second->last_use < least_recently_used->second->last_use)))
+                    {
+                        least_recently_used = it;
+                    }
+                }
+                if (least_recently_used == sessions.end()) return; // All sessions are busy
+                if (services_keep_state) removed_sessions.insert(least_recently_used->first);
+                sessions.erase(least_recently_used);
+            }
+        }
+
+        void run_next_job(Session& session, const std::pair<Job, ErrorHandler>& job)
+        {
+            try
+            {
+                if (session.was_removed)
+                {
+                    session.was_removed = false;
+                    THROW(__PRETTY_FUNCTION__, InvalidInputException, "Session '" << session.id << "' was closed because the server had more than " << max_nb_of_sessions
+                          << " sessions, so the state history it kept was lost: this request was not simulated. "
+                          << "Please send it again with the whole state history (or with 'reset' set to true).");
+                }
+                if (not(session.service)) session.service = make_service();
+                job.first(*session.service);
+            }
+            catch (...)
+            {
+                try
+                {
+                    job.second(std::current_exception());
+                }
+                catch (...)
+                {
+                    // Nothing else can be done with this error: the worker thread must go on
+                }
+            }
+        }
+
+        void work()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true)
+            {
+                work_available.wait(lock, [this]{return stopping or not(ready.empty());});
+                if (ready.empty()) return; // Stopping & all jobs done
+                const std::shared_ptr<Session> session = ready.front();
+                ready.pop_front();
+                const std::pair<Job, ErrorHandler> job = session->pending.front();
+                session->pending.pop_front();
+                lock.unlock();
+                run_next_job(*session, job);
+                lock.lock();
+                if (session->pending.empty())
+                {
+                    session->is_scheduled = false;
+                    remove_idle_sessions();
+                }
+                else
+                {
+                    ready.push_back(session); // Behind the other sessions' jobs, so no session can starve the others
+                }
+            }
+        }
+
+        const Factory make_service;
+        const size_t max_nb_of_sessions;
+        const bool services_keep_state;
+        mutable std::mutex mutex;
+        std::condition_variable work_available;
+        std::map<std::string, std::shared_ptr<Session> > sessions;
+        std::set<std::string> removed_sessions;                     //!< Only if services_keep_state: sessions destroyed since their last job
+        std::deque<std::shared_ptr<Session> > ready;               //!< Sessions with pending jobs, not being run by a worker
+        size_t nb_of_posted_jobs;
+        bool stopping;
+        std::vector<std::thread> workers;
+};
+
+#endif /* SESSIONS_HPP_ */
@@ -37,6 +37,7 @@ SimServerInputs::SimServerInputs(const YamlSimServerInputs& server_inputs, const
     , commands(server_inputs.commands)
     , requested_output(server_inputs.requested_output)
     , controllers(server_inputs.controllers)
+    , reset(server_inputs.reset)
 {
     if (not(server_inputs.states.empty()))
     {
@@ -73,5 +74,6 @@ SimServerInputs::SimServerInputs(const double Dt_)
     , commands({})
     , requested_output({})
     , controllers()
+    , reset(false)
 {
 }
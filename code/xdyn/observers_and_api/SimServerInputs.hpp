@@ -27,6 +27,7 @@ struct SimServerInputs
     std::map<std::string, double> commands;
     std::vector<std::string> requested_output;
     std::vector<YamlController> controllers;
+    bool reset;
     private: SimServerInputs(); // Disabled
 };
 
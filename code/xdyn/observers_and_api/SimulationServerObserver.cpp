@@ -12,9 +12,9 @@ std::vector<YamlState> SimulationServerObserver::get() const
     return states;
 }
 
-std::function<void()> SimulationServerObserver::get_serializer(const double val, const DataAddressing& address)
+std::function<void()> SimulationServerObserver::get_serializer(const double& val, const DataAddressing& address)
 {
-    return [this, val, address]()
+    return [this, &val, address]()
     {
         current_state.extra_observations[address.name] = val;
     };
@@ -15,7 +15,7 @@ class SimulationServerObserver : public Observer
     protected:
         using Observer::get_serializer;
         using Observer::get_initializer;
-        std::function<void()> get_serializer(const double val, const DataAddressing& address) override;
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address) override;
 
         YamlState current_state;
         std::vector<YamlState> states;
@@ -0,0 +1,204 @@
+/*
+ * SpscRingBuffer.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SPSCRINGBUFFER_HPP_
+#define SPSCRINGBUFFER_HPP_
+
+#include "xdyn/exceptions/InternalErrorException.hpp"
+
+#include <algorithm> // std::min
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <utility> // std::swap
+#include <vector>
+
+/** \brief Fixed-size, lock-free queue between one producer thread & one consumer thread
+ *  \details The items are swapped in & out of preallocated slots (not copied), so if T
+ *           holds std::vectors, their memory is recycled & pushing or popping does not
+ *           allocate once the queue has been filled once.
+ *           Each slot has a state (empty, being written, full, being read) & the sequence
+ *           number of the item it holds, which lets the producer overwrite the oldest item
+ *           when the queue is full: the consumer then skips the items which were overwritten
+ *           & still gets the other ones in the order in which they were pushed.
+ *           The only waits are the ones of 'push' when the queue is full & the (very short)
+ *           ones of the producer while the consumer swaps an item out of the slot it needs.
+ *  \ingroup observers
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/AsyncObserverTest.cpp SpscRingBufferTest example
+ */
+template <typename T> class SpscRingBuffer
+{
+    public:
+        SpscRingBuffer(const size_t capacity_) : slots(capacity_), capacity(capacity_), next_write(0), next_read(0)
+        {
+            if (capacity == 0)
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "The capacity of the ring buffer should be at least 1");
+            }
+        }
+
+        /**  \brief Producer only: swaps 'item' into the queue, if there is room for it
+          *  \returns false if the queue is full (in which case 'item' is unchanged)
+          */
+        bool try_push(T& item)
+        {
+            Slot& slot = slots[next_write % capacity];
+            for (;;)
+            {
+                const int state = slot.state.load(std::memory_order_acquire);
+                if (state == EMPTY)
+                {
+                    // The consumer never changes the state of an empty slot
+                    write(slot, item);
+                    return true;
+                }
+                if (state == FULL)
+                {
+                    return false;
+                }
+                std::this_thread::yield(); // The consumer is swapping the previous item out of this slot
+            }
+        }
+
+        /**  \brief Producer only: swaps 'item' into the queue, waiting until there is room for it
+          *  \details 'stop_waiting' is called while the queue is full: push returns false (without
+          *           pushing the item) if it returns true (eg. if the consumer has stopped).
+          */
+        template <typename F> bool push(T& item, const F& stop_waiting)
+        {
+            size_t nb_of_attempts = 0;
+            while (not(try_push(item)))
+            {
+                if (stop_waiting())
+                {
+                    return false;
+                }
+                back_off(nb_of_attempts++);
+            }
+            return true;
+        }
+
+        /**  \brief Producer only: swaps 'item' into the queue, overwriting the oldest item if the queue is full
+          *  \returns true if an item was overwritten (& will therefore never be popped)
+          */
+        bool push_overwriting_oldest(T& item)
+        {
+            Slot& slot = slots[next_write % capacity];
+            for (;;)
+            {
+                int state = slot.state.load(std::memory_order_acquire);
+                if (state == EMPTY)
+                {
+                    write(slot, item);
+                    return false;
+                }
+                if ((state == FULL) && slot.state.compare_exchange_strong(state, WRITING, std::memory_order_acq_rel))
+                {
+                    // The queue was full & this slot holds the oldest item
+                    write(slot, item);
+                    return true;
+                }
+                std::this_thread::yield(); // The consumer is swapping the oldest item out of this slot
+            }
+        }
+
+        /**  \brief Consumer only: swaps the oldest item out of the queue
+          *  \returns false if the queue is empty (in which case 'item' is unchanged)
+          */
+        bool try_pop(T& item)
+        {
+            for (;;)
+            {
+                const size_t seq = next_read.load(std::memory_order_relaxed);
+                Slot& slot = slots[seq % capacity];
+                int state = slot.state.load(std::memory_order_acquire);
+                if (state != FULL)
+                {
+                    return false; // Empty, or the producer is writing the next item
+                }
+                if (not(slot.state.compare_exchange_strong(state, READING, std::memory_order_acq_rel)))
+                {
+                    continue; // The producer has just started overwriting this item
+                }
+                if (slot.seq < seq)
+                {
+                    // Item pushed before the ones we already popped: cannot happen, but we do not want to pop it twice
+                    slot.state.store(FULL, std::memory_order_release);
+                    return false;
+                }
+                if (slot.seq > seq)
+                {
+                    // Item 'seq' was overwritten by a more recent one, which will be popped in turn
+                    slot.state.store(FULL, std::memory_order_release);
+                    next_read.store(seq + 1, std::memory_order_release);
+                    continue;
+                }
+                std::swap(slot.item, item);
+                slot.state.store(EMPTY, std::memory_order_release);
+                next_read.store(seq + 1, std::memory_order_release);
+                return true;
+            }
+        }
+
+        /**  \brief Number of items in the queue (only approximate if called while the other thread pushes or pops)
+          */
+        size_t size() const
+        {
+            const size_t written = next_write.load(std::memory_order_acquire);
+            const size_t read = next_read.load(std::memory_order_acquire);
+            return written > read ? std::min(written - read, capacity) : 0;
+        }
+
+        size_t get_capacity() const
+        {
+            return capacity;
+        }
+
+        /**  \brief Yields a few times then sleeps, to wait without using a whole core
+          */
+        static void back_off(const size_t nb_of_attempts)
+        {
+            if (nb_of_attempts < 64)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+
+    private:
+        SpscRingBuffer(); // Disabled
+        SpscRingBuffer(const SpscRingBuffer&); // Disabled
+        SpscRingBuffer& operator=(const SpscRingBuffer&); // Disabled
+
+        enum SlotState {EMPTY, WRITING, FULL, READING};
+        struct Slot
+        {
+            Slot() : state(EMPTY), seq(0), item() {}
+            std::atomic<int> state;
+            size_t seq;     //!< Sequence number of 'item' (only read & written by the thread which changed 'state' to WRITING or READING)
+            T item;
+        };
+
+        void write(Slot& slot, T& item)
+        {
+            std::swap(slot.item, item);
+            slot.seq = next_write.load(std::memory_order_relaxed);
+            slot.state.store(FULL, std::memory_order_release);
+            next_write.store(slot.seq + 1, std::memory_order_release);
+        }
+
+        std::vector<Slot> slots;
+        size_t capacity;
+        std::atomic<size_t> next_write; //!< Sequence number of the next item to push (only written by the producer)
+        std::atomic<size_t> next_read;  //!< Sequence number of the next item to pop (only written by the consumer)
+};
+
+#endif /* SPSCRINGBUFFER_HPP_ */
@@ -32,9 +32,9 @@ TsvObserver::~TsvObserver()
     if (output_to_file) delete(&os);
 }
 
-std::function<void()> TsvObserver::get_serializer(const double val, const DataAddressing&)
+std::function<void()> TsvObserver::get_serializer(const double& val, const DataAddressing&)
 {
-    return [this,val](){os << val;};
+    return [this,&val](){os << val;};
 }
 
 std::function<void()> TsvObserver::get_initializer(const double, const DataAddressing& address)
@@ -12,7 +12,9 @@ XdynForCS::XdynForCS(const std::string& yaml_model, const std::string& solver, c
         builder(yaml_model),
         dt(dt),
         sim(builder.sim),
-        solver(solver)
+        solver(solver),
+        keep_history_between_requests(false),
+        history_comes_from_requests(false)
 {
 }
 
@@ -23,10 +25,30 @@ XdynForCS::XdynForCS(const std::string& yaml_model,
         builder(yaml_model, mesh),
         dt(dt),
         sim(builder.sim),
-        solver(solver)
+        solver(solver),
+        keep_history_between_requests(false),
+        history_comes_from_requests(false)
 {
 }
 
+XdynForCS::XdynForCS(const YamlSimulatorInput& parsed_yaml_model,
+                  const MeshMap& meshes,
+                  const std::string& solver,
+                  const double dt):
+        builder(parsed_yaml_model, meshes),
+        dt(dt),
+        sim(builder.sim),
+        solver(solver),
+        keep_history_between_requests(false),
+        history_comes_from_requests(false)
+{
+}
+
+void XdynForCS::set_session_mode(const bool keep_history_between_requests_)
+{
+    keep_history_between_requests = keep_history_between_requests_;
+}
+
 std::vector<YamlState> XdynForCS::handle(const YamlSimServerInputs& request)
 {
     return handle(SimServerInputs(request, builder.Tmax));
@@ -56,8 +78,16 @@ std::vector<YamlState> XdynForCS::handle(const SimServerInputs& request)
     }
     const double tstart = request.t;
     const double Dt = request.Dt;
-    sim.reset_history();
-    sim.set_bodystates(request.full_state_history);
+    if (keep_history_between_requests and history_comes_from_requests and not(request.reset))
+    {
+        sim.append_bodystates(request.full_state_history);
+    }
+    else
+    {
+        sim.reset_history();
+        sim.set_bodystates(request.full_state_history);
+    }
+    history_comes_from_requests = true;
     sim.set_command_listener(request.commands);
     CoSimulationObserver observer(request.requested_output, sim.get_bodies().at(0)->get_name());
     ssc::solver::Scheduler scheduler(tstart, tstart+Dt, dt);
@@ -18,10 +18,24 @@ class XdynForCS
                   const std::string& solver,
                   const double dt);
 
+        XdynForCS(const YamlSimulatorInput& parsed_yaml_model,
+                  const std::map<std::string, VectorOfVectorOfPoints>& meshes,
+                  const std::string& solver,
+                  const double dt);
+
         std::vector<YamlState> handle(const YamlSimServerInputs& request);
         std::vector<YamlState> handle(const SimServerInputs& request);
         double get_Tmax() const;
 
+        /**  \brief Should the server keep the state history between requests?
+          *  \details Off by default: each request must then contain the whole state history (Tmax seconds).
+          *           In session mode, the states of each request are appended to the history kept by the server
+          *           (which already contains the states it computed), so the requests only need to contain the
+          *           latest state. The history is replaced if the request has 'reset' set or if its states start
+          *           before the newest point in history (eg. a client sending the whole history).
+          */
+        void set_session_mode(const bool keep_history_between_requests);
+
     private :
         XdynForCS(); // Deactivated
 
@@ -29,6 +43,8 @@ class XdynForCS
         const double dt;
         Sim sim;
         const std::string solver;
+        bool keep_history_between_requests;
+        bool history_comes_from_requests; //!< False until the first request: the history then only contains the initial state of the YAML file
 };
 
 #endif /* OBSERVERS_AND_API_INC_SIMSERVER_HPP_ */
@@ -10,10 +10,19 @@
 #include "xdyn/exceptions/InternalErrorException.hpp"
 #include <tuple>
 
-XdynForME::XdynForME(const std::string& yaml_model) :builder(yaml_model)
+XdynForME::XdynForME(const std::string& yaml_model) :builder(yaml_model), keep_history_between_requests(false), history_comes_from_requests(false)
 {
 }
 
+XdynForME::XdynForME(const YamlSimulatorInput& parsed_yaml_model, const std::map<std::string, VectorOfVectorOfPoints>& meshes) :builder(parsed_yaml_model, meshes), keep_history_between_requests(false), history_comes_from_requests(false)
+{
+}
+
+void XdynForME::set_session_mode(const bool keep_history_between_requests_)
+{
+    keep_history_between_requests = keep_history_between_requests_;
+}
+
 double XdynForME::get_Tmax() const
 {
     return builder.Tmax;
@@ -48,7 +57,15 @@ std::tuple<double, double, double> get_euler_derivative(const StateType& state)
 YamlState XdynForME::handle(const SimServerInputs& request)
 {
     const double t = request.t;
-    builder.sim.set_bodystates(request.state_history_except_last_point);
+    if (keep_history_between_requests and history_comes_from_requests and not(request.reset))
+    {
+        builder.sim.append_bodystates(request.state_history_except_last_point);
+    }
+    else
+    {
+        builder.sim.set_bodystates(request.state_history_except_last_point);
+    }
+    history_comes_from_requests = true;
     builder.sim.set_command_listener(request.commands);
 
     StateType dx_dt(13, 0);
@@ -18,13 +18,22 @@ class XdynForME
 {
     public :
         XdynForME(const std::string& yaml_model);
+        XdynForME(const YamlSimulatorInput& parsed_yaml_model, const std::map<std::string, VectorOfVectorOfPoints>& meshes);
         YamlState handle(const YamlSimServerInputs& request);
         YamlState handle(const SimServerInputs& request);
         double get_Tmax() const;
 
+        /**  \brief Should the server keep the state history between requests? (cf. XdynForCS::set_session_mode)
+          *  \details In session mode, the requests only need to contain the states which were not added to the history
+          *           yet, followed by the state at which the derivatives are computed (which is not added to the history).
+          */
+        void set_session_mode(const bool keep_history_between_requests);
+
     private :
         XdynForME();
         ConfBuilder builder;
+        bool keep_history_between_requests;
+        bool history_comes_from_requests; //!< False until the first request: the history then only contains the initial state of the YAML file
 };
 
 
@@ -208,3 +208,10 @@ MeshMap make_mesh_map(const YamlSimulatorInput& input, const std::string& mesh)
     meshes[name] = read_stl(mesh);
     return meshes;
 }
+
+MeshMap read_meshes(YamlSimulatorInput& input)
+{
+    const MeshMap meshes = get_builder(check_input_yaml(input), 0).make_simplified_mesh_map();
+    for (auto& body:input.bodies) body.mesh_simplification.simplify = false;
+    return meshes;
+}
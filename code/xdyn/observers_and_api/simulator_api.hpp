@@ -1,6 +1,7 @@
 #ifndef SIMULATORAPI_HPP_
 #define SIMULATORAPI_HPP_
 
+#include "AcceptedStatesRecorder.hpp"
 #include "EverythingObserver.hpp"
 #include "SimObserver.hpp"
 #include "xdyn/core/Sim.hpp"
@@ -37,14 +38,14 @@ template <typename StepperType> std::vector<Res> simulate(Sim& sys, const YamlSi
     EverythingObserver observer;
     const double tstart = scheduler.get_time();
     const auto controllers = get_initialized_controllers(tstart, input.controllers, input.commands, scheduler, sys);
-    ssc::solver::quicksolve<StepperType>(sys, scheduler, observer, controllers);
+    run_solver<StepperType>(sys, scheduler, observer, controllers);
     auto ret = observer.get();
     return ret;
 }
 
 template <typename StepperType, typename ObserverType> void simulate(Sim& sys, ssc::solver::Scheduler& scheduler, ObserverType& observer)
 {
-    ssc::solver::quicksolve<StepperType>(sys, scheduler, observer);
+    run_solver<StepperType>(sys, scheduler, observer);
 }
 
 template <typename StepperType> std::vector<Res> simulate(const std::string& yaml, ssc::solver::Scheduler& scheduler)
@@ -57,6 +58,12 @@ template <typename StepperType> std::vector<Res> simulate(const std::string& yam
 
 MeshMap make_mesh_map(const YamlSimulatorInput& yaml, const std::string& mesh);
 
+/**  \brief Reads the meshes of all bodies once, eg. to build one Sim per session with get_system(input, meshes, t0)
+  *  \details The meshes are simplified if requested, & the 'mesh simplification' sections of 'input' are then
+  *           removed so they are not simplified again each time a Sim is built.
+  */
+MeshMap read_meshes(YamlSimulatorInput& input);
+
 template <typename StepperType> std::vector<Res> simulate(const std::string& yaml, const std::string& mesh, ssc::solver::Scheduler& scheduler)
 {
     const YamlSimulatorInput input = check_input_yaml(SimulatorYamlParser(yaml).parse());
@@ -108,7 +115,7 @@ template <typename StepperType> std::vector<Res> simulate(const YamlSimulatorInp
     Sim sys = get_system(input, mesh, tstart, commands);
     SimObserver observer;
     const auto controllers = get_initialized_controllers(tstart, input.controllers, input.commands, scheduler, sys);
-    ssc::solver::quicksolve<StepperType>(sys, scheduler, observer, controllers);
+    run_solver<StepperType>(sys, scheduler, observer, controllers);
     return observer.get();
 }
 
@@ -0,0 +1,263 @@
+/*
+ * AsyncObserverTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "AsyncObserverTest.hpp"
+#include "AsyncObserver.hpp"
+#include "CsvObserver.hpp"
+#include "ListOfObservers.hpp"
+#include "MapObserver.hpp"
+#include "SpscRingBuffer.hpp"
+#include "xdyn/environment_models/DiscreteDirectionalWaveSpectrum.hpp"
+#include "xdyn/external_data_structures/YamlOutput.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
+#include "xdyn/observers_and_api/simulator_api.hpp"
+#include "xdyn/test_data_generator/yaml_data.hpp"
+#include <ssc/solver/steppers.hpp>
+
+#include <cstdio> // remove
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+AsyncObserverTest::AsyncObserverTest() : a(ssc::random_data_generator::DataGenerator(87512))
+{
+}
+
+AsyncObserverTest::~AsyncObserverTest()
+{
+}
+
+void AsyncObserverTest::SetUp()
+{
+}
+
+void AsyncObserverTest::TearDown()
+{
+}
+
+std::string read_file(const std::string& filename);
+std::string read_file(const std::string& filename)
+{
+    std::ifstream f(filename);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+TEST_F(AsyncObserverTest, SpscRingBuffer_should_overwrite_the_oldest_items_when_full)
+{
+//! [SpscRingBufferTest example]
+    SpscRingBuffer<int> queue(4);
+    size_t nb_of_overwritten_items = 0;
+    for (int i = 1 ; i <= 10 ; ++i)
+    {
+        int item = i;
+        if (queue.push_overwriting_oldest(item)) nb_of_overwritten_items++;
+    }
+//! [SpscRingBufferTest example]
+    ASSERT_EQ(6, nb_of_overwritten_items);
+    ASSERT_EQ(4, queue.size());
+    int item = 0;
+    for (int i = 7 ; i <= 10 ; ++i)
+    {
+        ASSERT_TRUE(queue.try_pop(item));
+        ASSERT_EQ(i, item);
+    }
+    ASSERT_FALSE(queue.try_pop(item));
+}
+
+TEST_F(AsyncObserverTest, SpscRingBuffer_try_push_should_fail_when_full)
+{
+    SpscRingBuffer<int> queue(2);
+    int item = 1;
+    ASSERT_TRUE(queue.try_push(item));
+    item = 2;
+    ASSERT_TRUE(queue.try_push(item));
+    item = 3;
+    ASSERT_FALSE(queue.try_push(item));
+    ASSERT_EQ(3, item);
+    ASSERT_TRUE(queue.try_pop(item));
+    ASSERT_EQ(1, item);
+    item = 3;
+    ASSERT_TRUE(queue.try_push(item));
+    ASSERT_TRUE(queue.try_pop(item));
+    ASSERT_EQ(2, item);
+    ASSERT_TRUE(queue.try_pop(item));
+    ASSERT_EQ(3, item);
+}
+
+TEST_F(AsyncObserverTest, SpscRingBuffer_should_transfer_all_items_in_order_between_two_threads)
+{
+    const int n = 10000;
+    SpscRingBuffer<std::vector<int> > queue(16);
+    std::vector<int> received;
+    std::thread consumer([&queue, &received, n]()
+        {
+            std::vector<int> item;
+            while ((int)received.size() < n)
+            {
+                if (queue.try_pop(item)) received.push_back(item.at(0));
+            }
+        });
+    for (int i = 0 ; i < n ; ++i)
+    {
+        std::vector<int> item(1, i);
+        queue.push(item, [](){return false;});
+    }
+    consumer.join();
+    ASSERT_EQ(n, received.size());
+    for (int i = 0 ; i < n ; ++i)
+    {
+        ASSERT_EQ(i, received[(size_t)i]);
+    }
+}
+
+TEST_F(AsyncObserverTest, SpscRingBuffer_should_keep_the_order_when_overwriting_items_between_two_threads)
+{
+    const int n = 10000;
+    SpscRingBuffer<int> queue(8);
+    std::atomic<bool> done(false);
+    std::vector<int> received;
+    std::thread consumer([&queue, &received, &done]()
+        {
+            int item = 0;
+            for (;;)
+            {
+                const bool last_attempt = done;
+                if (queue.try_pop(item)) received.push_back(item);
+                else if (last_attempt)   return;
+            }
+        });
+    size_t nb_of_overwritten_items = 0;
+    for (int i = 0 ; i < n ; ++i)
+    {
+        int item = i;
+        if (queue.push_overwriting_oldest(item)) nb_of_overwritten_items++;
+    }
+    done = true;
+    consumer.join();
+    ASSERT_EQ((size_t)n, received.size() + nb_of_overwritten_items);
+    ASSERT_EQ(n-1, received.back());
+    for (size_t i = 1 ; i < received.size() ; ++i)
+    {
+        ASSERT_LT(received[i-1], received[i]);
+    }
+}
+
+TEST_F(AsyncObserverTest, should_write_the_same_file_as_the_observer_it_wraps)
+{
+//! [AsyncObserverTest example]
+    const double dt = 0.1;
+    const double tend = 10;
+    const std::vector<std::string> data = {"t", "x(ball)", "z(ball)", "Fz(gravity,ball,ball)", "Fz(gravity,ball,NED)"};
+    {
+        auto sys = get_system(test_data::falling_ball_example(), 0);
+        ssc::solver::Scheduler scheduler(0, tend, dt);
+        ListOfObservers observers(std::vector<ObserverPtr>({ObserverPtr(new CsvObserver("falling_ball_sync.csv", data))}));
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    }
+    {
+        auto sys = get_system(test_data::falling_ball_example(), 0);
+        ssc::solver::Scheduler scheduler(0, tend, dt);
+        // The CSV file is written by a background thread & is complete once the AsyncObserver is destroyed
+        const ObserverPtr csv(new CsvObserver("falling_ball_async.csv", data));
+        ListOfObservers observers(std::vector<ObserverPtr>({ObserverPtr(new AsyncObserver(csv, 4, AsyncObserver::Backpressure::BLOCK))}));
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    }
+//! [AsyncObserverTest example]
+    const std::string expected = read_file("falling_ball_sync.csv");
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected, read_file("falling_ball_async.csv"));
+    EXPECT_EQ(0, remove("falling_ball_sync.csv"));
+    EXPECT_EQ(0, remove("falling_ball_async.csv"));
+}
+
+TEST_F(AsyncObserverTest, should_give_the_same_results_as_the_observer_it_wraps_when_outputting_everything)
+{
+    const double dt = 0.5;
+    const double tend = 10;
+    const auto sync = std::make_shared<MapObserver>();
+    const auto async = std::make_shared<MapObserver>();
+    {
+        auto sys = get_system(test_data::falling_ball_example(), 0);
+        ssc::solver::Scheduler scheduler(0, tend, dt);
+        ListOfObservers observers(std::vector<ObserverPtr>({sync}));
+        run_solver<ssc::solver::RK4Stepper>(sys, scheduler, observers);
+    }
+    {
+        auto sys = get_system(test_data::falling_ball_example(), 0);
+        ssc::solver::Scheduler scheduler(0, tend, dt);
+        ListOfObservers observers(std::vector<ObserverPtr>({ObserverPtr(new AsyncObserver(async))}));
+        run_solver<ssc::solver::RK4Stepper>(sys, scheduler, observers);
+    }
+    const auto expected = sync->get();
+    const auto actual = async->get();
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected.size(), actual.size());
+    for (const auto& variable:expected)
+    {
+        ASSERT_TRUE(actual.count(variable.first)) << variable.first;
+        ASSERT_EQ(variable.second, actual.at(variable.first)) << variable.first;
+    }
+}
+
+TEST_F(AsyncObserverTest, should_only_queue_the_variables_requested_by_the_observer_it_wraps)
+{
+    const std::vector<std::string> data = {"t", "z(ball)"};
+    const auto map = std::make_shared<MapObserver>(data);
+    ASSERT_TRUE(AsyncObserver(std::make_shared<MapObserver>()).outputs_everything());
+    {
+        // The map is complete once the AsyncObserver is destroyed
+        const auto async = std::make_shared<AsyncObserver>(map);
+        ASSERT_FALSE(async->outputs_everything());
+        ASSERT_EQ(data, async->get_requested_serializations());
+        auto sys = get_system(test_data::falling_ball_example(), 0);
+        ssc::solver::Scheduler scheduler(0, 1, 0.5);
+        ListOfObservers observers(std::vector<ObserverPtr>({async}));
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    }
+    const auto results = map->get();
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(3, results.at("z(ball)").size());
+}
+
+TEST_F(AsyncObserverTest, should_not_queue_the_variables_only_written_before_the_simulation)
+{
+    const std::vector<std::string> data = {"t", "z(ball)", "mesh", "command line", "yaml", "python scripts", "matlab scripts", "spectra"};
+    const auto map = std::make_shared<MapObserver>(data);
+    {
+        const auto async = std::make_shared<AsyncObserver>(map);
+        auto sys = get_system(test_data::falling_ball_example(), 0);
+        // Same calls as xdyn before the simulation
+        async->write_before_simulation(std::vector<FlatDiscreteDirectionalWaveSpectrum>(), DataAddressing());
+        async->write_command_line_before_simulation("xdyn falling_ball.yml");
+        async->write_matlab_script_before_simulation();
+        async->write_python_script_before_simulation();
+        async->write_before_simulation(sys.get_bodies().front()->get_states().mesh, DataAddressing({"meshes","ball"}, "mesh(ball)"));
+        async->write_yaml_before_simulation(test_data::falling_ball_example());
+        ASSERT_EQ(std::vector<std::string>({"t", "z(ball)"}), async->get_requested_serializations());
+        ssc::solver::Scheduler scheduler(0, 1, 0.5);
+        ListOfObservers observers(std::vector<ObserverPtr>({async}));
+        ASSERT_NO_THROW(run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers));
+    }
+    const auto results = map->get();
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(3, results.at("z(ball)").size());
+}
+
+TEST_F(AsyncObserverTest, can_be_built_from_the_yaml_output_section)
+{
+    YamlOutput output;
+    output.format = "map";
+    output.data = {"t"};
+    output.asynchronous = true;
+    output.queue_size = 16;
+    output.backpressure = "drop oldest";
+    const auto observer = ListOfObservers::parse_observer(output);
+    ASSERT_TRUE(dynamic_cast<AsyncObserver*>(observer.get()) != NULL);
+    output.backpressure = "whatever";
+    ASSERT_THROW(ListOfObservers::parse_observer(output), InvalidInputException);
+}
@@ -0,0 +1,23 @@
+/*
+ * AsyncObserverTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ASYNCOBSERVERTEST_HPP_
+#define ASYNCOBSERVERTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class AsyncObserverTest : public ::testing::Test
+{
+    protected:
+        AsyncObserverTest();
+        virtual ~AsyncObserverTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* ASYNCOBSERVERTEST_HPP_ */
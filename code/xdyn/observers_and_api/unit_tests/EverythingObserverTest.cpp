@@ -59,7 +59,7 @@ TEST_F(EverythingObserverTest, example)
     auto list_of_observers = observers();
 
     ssc::solver::Scheduler scheduler(0, tend, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, list_of_observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, list_of_observers);
     const auto obs = list_of_observers.get();
 //! [MapObserverTest example]
 //! [MapObserverTest expected output]
@@ -78,7 +78,7 @@ TEST_F(EverythingObserverTest, GM)
     auto sys = get_system(test_data::GM_cube(), test_data::cube_for_gm_test(), 0);
     ssc::solver::Scheduler scheduler(0, tend, dt);
     auto list_of_observers = observers();
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, list_of_observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, list_of_observers);
     const auto obs = list_of_observers.get();
 //! [MapObserverTest example]
 //! [MapObserverTest expected output]
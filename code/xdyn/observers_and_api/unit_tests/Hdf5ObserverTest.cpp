@@ -1,6 +1,8 @@
 #include "Hdf5ObserverTest.hpp"
 #include "Hdf5Observer.hpp"
 #include "ListOfObservers.hpp"
+#include "xdyn/external_data_structures/YamlOutput.hpp"
+#include "xdyn/interface_hdf5/h5_tools.hpp"
 #include "xdyn/observers_and_api/simulator_api.hpp"
 #include "xdyn/test_data_generator/yaml_data.hpp"
 #include "xdyn/yaml_parser/parse_output.hpp"
@@ -19,7 +21,7 @@ TEST_F(Hdf5ObserverTest, should_be_able_to_create_an_observer)
     {
         ssc::solver::Scheduler scheduler(0, tend, dt);
         ListOfObservers observers(yaml);
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     }
     for (auto output:yaml)
     {
@@ -39,7 +41,7 @@ TEST_F(Hdf5ObserverTest, LONG_should_be_able_to_create_an_observer_with_wave_out
     {
         ssc::solver::Scheduler scheduler(0, tend, dt);
         ListOfObservers observers(yaml);
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     }
     for (auto output:yaml)
     {
@@ -50,3 +52,67 @@ TEST_F(Hdf5ObserverTest, LONG_should_be_able_to_create_an_observer_with_wave_out
         }
     }
 }
+
+TEST_F(Hdf5ObserverTest, buffered_and_compressed_output_should_contain_the_same_values_as_unbuffered_output)
+{
+    const double dt = 1E-1;
+    const double tend = 10;
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    YamlOutput unbuffered;
+    unbuffered.format = "hdf5";
+    unbuffered.filename = "falling_ball_unbuffered.h5";
+    unbuffered.data = {"t", "z(ball)", "Fz(gravity,ball,ball)"};
+    YamlOutput buffered = unbuffered;
+    buffered.filename = "falling_ball_buffered.h5";
+    buffered.buffer_size = 7; // 101 time steps: the last ones are written when the observer is destroyed
+    buffered.chunk_size = 16;
+    buffered.compression_level = 4;
+    {
+        ssc::solver::Scheduler scheduler(0, tend, dt);
+        ListOfObservers observers({unbuffered, buffered});
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    }
+    for (const std::string dataset:{"/outputs/t", "/outputs/states/ball/Z", "/outputs/efforts/ball/gravity/ball/Fz"})
+    {
+        std::vector<double> expected, actual;
+        H5_Tools::read(unbuffered.filename, dataset, expected);
+        H5_Tools::read(buffered.filename, dataset, actual);
+        ASSERT_EQ(101, expected.size()) << dataset;
+        ASSERT_EQ(expected.size(), actual.size()) << dataset;
+        for (size_t i = 0 ; i < expected.size() ; ++i)
+        {
+            ASSERT_DOUBLE_EQ(expected[i], actual[i]) << dataset << ", i = " << i;
+        }
+    }
+    EXPECT_EQ(0,remove(unbuffered.filename.c_str()));
+    EXPECT_EQ(0,remove(buffered.filename.c_str()));
+}
+
+TEST_F(Hdf5ObserverTest, flushing_after_each_time_step_should_only_write_full_buffers)
+{
+    const double dt = 1E-1;
+    const double tend = 1;
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    YamlOutput buffered;
+    buffered.format = "hdf5";
+    buffered.filename = "falling_ball_flushed.h5";
+    buffered.data = {"t", "z(ball)"};
+    buffered.buffer_size = 4; // 11 time steps: two full buffers are written during the simulation
+    {
+        ssc::solver::Scheduler scheduler(0, tend, dt);
+        ListOfObservers observers({buffered});
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
+        for (size_t i = 0 ; i < 3 ; ++i) observers.flush(); // Like the solver after each step
+        for (const std::string dataset:{"/outputs/t", "/outputs/states/ball/Z"})
+        {
+            std::vector<double> values;
+            H5_Tools::read(buffered.filename, dataset, values);
+            ASSERT_EQ(8, values.size()) << dataset;
+        }
+    }
+    std::vector<double> t;
+    H5_Tools::read(buffered.filename, "/outputs/t", t);
+    ASSERT_EQ(11, t.size());
+    ASSERT_DOUBLE_EQ(tend, t.back());
+    EXPECT_EQ(0,remove(buffered.filename.c_str()));
+}
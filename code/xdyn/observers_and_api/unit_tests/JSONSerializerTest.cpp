@@ -2,6 +2,7 @@
 #include "JSONSerializer.hpp"
 #include "SimServerInputs.hpp"
 #include "xdyn/test_data_generator/yaml_data.hpp"
+#include <ssc/json.hpp>
 #include <algorithm>
 #include <vector>
 #include <iostream>
@@ -118,3 +119,24 @@ TEST_F(JSONSerializerTest, t_should_correspond_to_last_value_in_yaml_into_SimSer
     const SimServerInputs s(deserialize(yaml), 100);
     ASSERT_DOUBLE_EQ(51.123, s.t);
 }
+
+TEST_F(JSONSerializerTest, reset_is_optional_and_false_by_default)
+{
+    ASSERT_FALSE(deserialize(yaml).reset);
+    ASSERT_FALSE(SimServerInputs(deserialize(yaml), 100).reset);
+}
+
+TEST_F(JSONSerializerTest, can_parse_reset)
+{
+    const std::string json = "{\"Dt\": 12, \"reset\": true, \"states\": []}";
+    ASSERT_TRUE(deserialize(json).reset);
+    ASSERT_TRUE(SimServerInputs(deserialize(json), 100).reset);
+    ASSERT_THROW(deserialize("{\"Dt\": 12, \"reset\": 1, \"states\": []}"), ssc::json::Exception);
+}
+
+TEST_F(JSONSerializerTest, can_parse_session)
+{
+    ASSERT_EQ("", deserialize(yaml).session);
+    ASSERT_EQ("vessel 2", deserialize("{\"Dt\": 12, \"session\": \"vessel 2\", \"states\": []}").session);
+    ASSERT_THROW(deserialize("{\"Dt\": 12, \"session\": 2, \"states\": []}"), ssc::json::Exception);
+}
@@ -19,7 +19,7 @@ TEST_F(JsonObserverTest, should_be_able_to_create_an_observer)
     {
         ssc::solver::Scheduler scheduler(0, tend, dt);
         ListOfObservers observers(yaml);
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     }
     for (auto output:yaml)
     {
@@ -42,7 +42,7 @@ TEST_F(JsonObserverTest, should_be_able_to_create_an_observer_with_waves)
     {
         ssc::solver::Scheduler scheduler(0, tend, dt);
         ListOfObservers observers(yaml);
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     }
     for (auto output:yaml)
     {
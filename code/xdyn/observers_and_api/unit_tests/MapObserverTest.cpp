@@ -60,7 +60,7 @@ TEST_F(MapObserverTest, example)
 
     ssc::solver::Scheduler scheduler(0, tend, dt);
     auto observers = observe({"x(ball)"});
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     const auto obs = observers.get();
 //! [MapObserverTest example]
 //! [MapObserverTest expected output]
@@ -78,7 +78,7 @@ TEST_F(MapObserverTest, GM)
     auto sys = get_system(test_data::GM_cube(), test_data::cube_for_gm_test(), 0);
     ssc::solver::Scheduler scheduler(0, tend, dt);
     auto observers = observe({"Fz(GM,cube,NED)","GM(cube)"});
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     const auto m = get_map(observers);
     ASSERT_TRUE(m.find("Fz(GM,cube,NED)") != m.end());
     ASSERT_TRUE(m.find("GM(cube)") != m.end());
@@ -113,7 +113,7 @@ TEST_F(MapObserverTest, blocked_state_force_residuals_should_appear)
     auto sys = get_system(test_data::full_example_with_diagonal_inertia(), test_data::cube(), 0);
     ssc::solver::Scheduler scheduler(0, tend, dt);
     auto observers = observe({"Fx(blocked states,body 1,body 1)","Fy(blocked states,body 1,body 1)","Fz(blocked states,body 1,body 1)","Mx(blocked states,body 1,body 1)","My(blocked states,body 1,body 1)","Mz(blocked states,body 1,body 1)"});
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     auto m = get_map(observers);
     ASSERT_EQ(6, m.size());
     ASSERT_TRUE(m.find("Fx(blocked states,body 1,body 1)") != m.end());
@@ -6,6 +6,7 @@
  */
 
 #include "ObserverTests.hpp"
+#include "EverythingObserver.hpp"
 #include "ListOfObservers.hpp"
 #include "MapObserver.hpp"
 #include "xdyn/core/Sim.hpp"
@@ -37,6 +38,38 @@ struct ListOfStringMessages : public ssc::websocket::MessageHandler
     std::vector<std::string> messages;
 };
 
+// Counts the serializers built, which should be once per variable (not once per variable & per time step)
+class MapObserverCountingSerializers : public MapObserver
+{
+    public:
+        MapObserverCountingSerializers(const std::vector<std::string>& d) : MapObserver(d), nb_of_serializers_built(0)
+        {
+        }
+        size_t nb_of_serializers_built;
+
+    protected:
+        using MapObserver::get_serializer;
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address) override
+        {
+            nb_of_serializers_built++;
+            return MapObserver::get_serializer(val, address);
+        }
+};
+
+// Invalidates the observation plans before each observation, so the values are always serialized by name
+class MapObserverSerializingByName : public MapObserver
+{
+    public:
+        MapObserverSerializingByName(const std::vector<std::string>& d) : MapObserver(d)
+        {
+        }
+        void observe(const std::function<void()>& write_values)
+        {
+            remove_variable("variable that was not requested");
+            observe_values_before_solver_step(write_values);
+        }
+};
+
 ObserverTests::ObserverTests() : a(ssc::random_data_generator::DataGenerator(542021))
 {
 }
@@ -70,7 +103,7 @@ TEST_F(ObserverTests, can_observe_using_a_websocket)
         std::vector<YamlOutput> v(1,out);
         ssc::solver::Scheduler scheduler(0, 1, 0.1);
         ListOfObservers observer(v);
-        ssc::solver::quicksolve<ssc::solver::RK4Stepper>(sys, scheduler, observer);
+        run_solver<ssc::solver::RK4Stepper>(sys, scheduler, observer);
         usleep(1000); // So the server thread has enough time to process the data
     }
 //! [ObserverTests example]
@@ -88,7 +121,7 @@ TEST_F(ObserverTests, can_output_all_results)
     Sim sys = get_system(yaml, mesh, 0);
     MapObserver observer = MapObserver(); // Should output all results when using default constructor
     ssc::solver::Scheduler scheduler(0, 1, 0.1);
-    ssc::solver::quicksolve<ssc::solver::RK4Stepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::RK4Stepper>(sys, scheduler, observer);
     auto results = observer.get();
     ASSERT_TRUE(results.find("u(cube)")!= results.end());
     ASSERT_TRUE(results.find("v(cube)")!= results.end());
@@ -131,3 +164,67 @@ TEST_F(ObserverTests, can_output_all_results)
     ASSERT_TRUE(results.find("My(non-linear hydrostatic (fast),cube,NED)")!= results.end());
     ASSERT_TRUE(results.find("Mz(non-linear hydrostatic (fast),cube,NED)")!= results.end());
 }
+
+TEST_F(ObserverTests, observation_plan_should_give_the_same_results_as_serializing_by_name)
+{
+    const std::vector<std::string> variables = {"t", "z(ball)", "w(ball)", "Fz(gravity,ball,NED)", "Fz(sum of forces,ball,ball)"};
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    MapObserverCountingSerializers observer(variables);
+    ssc::solver::Scheduler scheduler(0, 10, 0.5);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    // EverythingObserver does not use an observation plan
+    auto sys2 = get_system(test_data::falling_ball_example(), 0);
+    EverythingObserver reference;
+    ssc::solver::Scheduler scheduler2(0, 10, 0.5);
+    run_solver<ssc::solver::EulerStepper>(sys2, scheduler2, reference);
+    const auto results = observer.get();
+    const auto expected = reference.MapObserver::get();
+    ASSERT_EQ(variables.size(), results.size());
+    for (const auto& variable:variables)
+    {
+        ASSERT_LT(1, results.at(variable).size()) << variable;
+        ASSERT_EQ(expected.at(variable), results.at(variable)) << variable;
+    }
+    // One serializer per variable written by Sim::output, whatever the number of time steps
+    ASSERT_EQ(expected.size(), observer.nb_of_serializers_built);
+}
+
+TEST_F(ObserverTests, observation_plan_should_be_recompiled_when_the_writes_change)
+{
+    const std::vector<std::string> variables = {"t", "a", "b", "c"};
+    // Each step writes the variables in this order: same order, reordered, one missing, one extra, original order
+    const std::vector<std::vector<std::string> > steps = {{"t", "a", "b", "c"},
+                                                          {"t", "a", "b", "c"},
+                                                          {"t", "c", "a", "b"},
+                                                          {"t", "a", "c"},
+                                                          {"t", "a", "d", "b", "c"},
+                                                          {"t", "a", "b", "c"},
+                                                          {"t", "a", "b", "c"}};
+    MapObserver observer(variables);
+    MapObserverSerializingByName reference(variables);
+    for (size_t i = 0 ; i < steps.size() ; ++i)
+    {
+        const auto write = [&steps, i](Observer& o)
+        {
+            double value = 10*(double)i;
+            for (const auto& name:steps[i])
+            {
+                o.write_before_solver_step(value++, DataAddressing({"outputs", name}, name));
+            }
+        };
+        observer.observe_values_before_solver_step([&observer, &write](){write(observer);});
+        reference.observe([&reference, &write](){write(reference);});
+    }
+    const auto results = observer.get();
+    const auto expected = reference.get();
+    ASSERT_EQ(variables.size(), results.size());
+    for (const auto& variable:variables)
+    {
+        ASSERT_EQ(steps.size(), results.at(variable).size()) << variable;
+        ASSERT_EQ(expected.at(variable), results.at(variable)) << variable;
+    }
+    ASSERT_EQ(std::vector<double>({1, 11, 22, 31, 41, 51, 61}), results.at("a"));
+    // "b" was not written at the fourth step: its previous value is serialized again
+    ASSERT_EQ(std::vector<double>({2, 12, 23, 23, 43, 52, 62}), results.at("b"));
+    ASSERT_EQ(std::vector<double>({3, 13, 21, 32, 44, 53, 63}), results.at("c"));
+}
@@ -0,0 +1,220 @@
+/*
+ * SessionsTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "SessionsTest.hpp"
+#include "Sessions.hpp"
+#include "xdyn/exceptions/InternalErrorException.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+SessionsTest::SessionsTest()
+{
+}
+
+SessionsTest::~SessionsTest()
+{
+}
+
+void SessionsTest::SetUp()
+{
+}
+
+void SessionsTest::TearDown()
+{
+}
+
+struct Service
+{
+    Service() : calls()
+    {
+    }
+    std::vector<size_t> calls;
+};
+
+Sessions<Service>::Factory make_service(std::atomic<size_t>& nb_of_services);
+Sessions<Service>::Factory make_service(std::atomic<size_t>& nb_of_services)
+{
+    return [&nb_of_services](){++nb_of_services; return std::shared_ptr<Service>(new Service());};
+}
+
+bool wait_for(const std::atomic<bool>& flag);
+bool wait_for(const std::atomic<bool>& flag)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (not(flag) and (std::chrono::steady_clock::now() - start < std::chrono::seconds(10)))
+    {
+        std::this_thread::yield();
+    }
+    return flag;
+}
+
+TEST_F(SessionsTest, example)
+{
+//! [SessionsTest example]
+    const auto make_counter = [](){return std::shared_ptr<size_t>(new size_t(0));};
+    Sessions<size_t> sessions(make_counter, 4, 100);
+    size_t counter = 0;
+    sessions.run("client A", [](size_t& n){n++;});
+    sessions.run("client A", [&counter](size_t& n){counter = ++n;});
+//! [SessionsTest example]
+    ASSERT_EQ((size_t)2, counter);
+    sessions.run("client B", [&counter](size_t& n){counter = ++n;});
+    ASSERT_EQ((size_t)1, counter);
+    ASSERT_EQ((size_t)2, sessions.get_nb_of_sessions());
+    ASSERT_EQ((size_t)4, sessions.get_nb_of_threads());
+}
+
+TEST_F(SessionsTest, jobs_of_a_session_are_run_in_the_order_in_which_they_were_posted)
+{
+    std::atomic<size_t> nb_of_services(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 4, 100);
+    const auto ignore_errors = [](const std::exception_ptr&){};
+    for (size_t i = 0 ; i < 1000 ; ++i)
+    {
+        sessions.post(std::to_string(i % 3), [i](Service& s){s.calls.push_back(i);}, ignore_errors);
+    }
+    for (size_t session = 0 ; session < 3 ; ++session)
+    {
+        std::vector<size_t> calls;
+        sessions.run(std::to_string(session), [&calls](Service& s){calls = s.calls;});
+        ASSERT_EQ((size_t)(session == 0 ? 334 : 333), calls.size());
+        for (size_t i = 0 ; i < calls.size() ; ++i)
+        {
+            ASSERT_EQ(session + 3*i, calls[i]);
+        }
+    }
+    ASSERT_EQ((size_t)3, nb_of_services.load());
+}
+
+TEST_F(SessionsTest, sessions_are_run_concurrently)
+{
+    std::atomic<size_t> nb_of_services(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 2, 100);
+    std::atomic<bool> a_started(false);
+    std::atomic<bool> b_started(false);
+    bool a_saw_b = false;
+    bool b_saw_a = false;
+    std::thread client_a([&](){sessions.run("a", [&](Service&){a_started = true; a_saw_b = wait_for(b_started);});});
+    sessions.run("b", [&](Service&){b_started = true; b_saw_a = wait_for(a_started);});
+    client_a.join();
+    ASSERT_TRUE(a_saw_b);
+    ASSERT_TRUE(b_saw_a);
+}
+
+TEST_F(SessionsTest, run_rethrows_the_exceptions_of_the_job_and_of_the_factory)
+{
+    std::atomic<size_t> nb_of_services(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 2, 100);
+    ASSERT_THROW(sessions.run("a", [](Service&){throw std::runtime_error("job");}), std::runtime_error);
+    size_t n = 0;
+    sessions.run("a", [&n](Service& s){s.calls.push_back(1); n = s.calls.size();});
+    ASSERT_EQ((size_t)1, n);
+    Sessions<Service> failing_sessions([]()->std::shared_ptr<Service>{throw std::invalid_argument("factory");}, 2, 100);
+    ASSERT_THROW(failing_sessions.run("a", [](Service&){}), std::invalid_argument);
+}
+
+TEST_F(SessionsTest, post_calls_the_error_handler)
+{
+    std::atomic<size_t> nb_of_services(0);
+    std::atomic<bool> error_was_reported(false);
+    {
+        Sessions<Service> sessions(make_service(nb_of_services), 2, 100);
+        sessions.post("a", [](Service&){throw std::runtime_error("job");}, [&error_was_reported](const std::exception_ptr& e){error_was_reported = (e != nullptr);});
+    }
+    ASSERT_TRUE(error_was_reported);
+}
+
+TEST_F(SessionsTest, least_recently_used_idle_sessions_are_removed)
+{
+    std::atomic<size_t> nb_of_services(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 3, 2);
+    size_t n = 0;
+    const auto count_calls = [&n](Service& s){s.calls.push_back(0); n = s.calls.size();};
+    sessions.run("a", count_calls);
+    sessions.run("b", count_calls);
+    sessions.run("a", count_calls);
+    ASSERT_EQ((size_t)2, n);
+    sessions.run("c", count_calls);
+    ASSERT_EQ((size_t)2, sessions.get_nb_of_sessions());
+    sessions.run("a", count_calls);
+    ASSERT_EQ((size_t)3, n);
+    sessions.run("b", count_calls);
+    ASSERT_EQ((size_t)1, n);
+    ASSERT_EQ((size_t)4, nb_of_services.load());
+}
+
+TEST_F(SessionsTest, sessions_running_a_job_are_not_removed)
+{
+    std::atomic<size_t> nb_of_services(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 2, 1);
+    std::atomic<bool> a_started(false);
+    std::atomic<bool> a_can_finish(false);
+    sessions.post("a", [&a_started,&a_can_finish](Service&){a_started = true; wait_for(a_can_finish);}, [](const std::exception_ptr&){});
+    ASSERT_TRUE(wait_for(a_started));
+    sessions.run("b", [](Service&){});
+    const auto start = std::chrono::steady_clock::now();
+    while ((sessions.get_nb_of_sessions() > 1) and (std::chrono::steady_clock::now() - start < std::chrono::seconds(10)))
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ((size_t)1, sessions.get_nb_of_sessions()); // "b" was removed instead of "a"
+    a_can_finish = true;
+    sessions.run("a", [](Service&){});
+    ASSERT_EQ((size_t)2, nb_of_services.load());
+}
+
+TEST_F(SessionsTest, first_job_of_a_removed_session_fails_if_the_services_keep_a_state)
+{
+    std::atomic<size_t> nb_of_services(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 1, 1, true);
+    size_t n = 0;
+    const auto count_calls = [&n](Service& s){s.calls.push_back(0); n = s.calls.size();};
+    sessions.run("a", count_calls);
+    sessions.run("a", count_calls);
+    sessions.run("b", count_calls); // With a single thread, "a" is removed before this job is done
+    ASSERT_THROW(sessions.run("a", count_calls), InvalidInputException);
+    sessions.run("a", count_calls); // The client sent its whole state again
+    ASSERT_EQ((size_t)1, n);
+    ASSERT_EQ((size_t)3, nb_of_services.load());
+}
+
+TEST_F(SessionsTest, destructor_runs_the_pending_jobs)
+{
+    std::atomic<size_t> nb_of_services(0);
+    std::atomic<size_t> nb_of_jobs(0);
+    {
+        Sessions<Service> sessions(make_service(nb_of_services), 3, 100);
+        for (size_t i = 0 ; i < 100 ; ++i)
+        {
+            sessions.post(std::to_string(i % 7), [&nb_of_jobs](Service&){++nb_of_jobs;}, [](const std::exception_ptr&){});
+        }
+    }
+    ASSERT_EQ((size_t)100, nb_of_jobs.load());
+}
+
+TEST_F(SessionsTest, stop_runs_the_pending_jobs_and_forbids_new_ones)
+{
+    std::atomic<size_t> nb_of_services(0);
+    std::atomic<size_t> nb_of_jobs(0);
+    Sessions<Service> sessions(make_service(nb_of_services), 2, 100);
+    for (size_t i = 0 ; i < 20 ; ++i)
+    {
+        sessions.post(std::to_string(i % 3), [&nb_of_jobs](Service&){++nb_of_jobs;}, [](const std::exception_ptr&){});
+    }
+    sessions.stop();
+    ASSERT_EQ((size_t)20, nb_of_jobs.load());
+    ASSERT_THROW(sessions.post("a", [](Service&){}, [](const std::exception_ptr&){}), InternalErrorException);
+}
+
+TEST_F(SessionsTest, should_throw_if_there_are_no_threads_or_no_sessions)
+{
+    std::atomic<size_t> nb_of_services(0);
+    ASSERT_THROW(Sessions<Service>(make_service(nb_of_services), 0, 10), InternalErrorException);
+    ASSERT_THROW(Sessions<Service>(make_service(nb_of_services), 2, 0), InternalErrorException);
+}
@@ -0,0 +1,21 @@
+/*
+ * SessionsTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SESSIONSTEST_HPP_
+#define SESSIONSTEST_HPP_
+
+#include "gtest/gtest.h"
+
+class SessionsTest : public ::testing::Test
+{
+    protected:
+        SessionsTest();
+        virtual ~SessionsTest();
+        virtual void SetUp();
+        virtual void TearDown();
+};
+
+#endif  /* SESSIONSTEST_HPP_ */
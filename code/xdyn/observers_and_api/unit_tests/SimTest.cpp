@@ -10,6 +10,7 @@
 #include "xdyn/binary_stl_data/generate_test_ship.hpp"
 #include "xdyn/core/Sim.hpp"
 #include "xdyn/exceptions/InternalErrorException.hpp"
+#include "xdyn/external_file_formats/stl_reader.hpp"
 #include "xdyn/observers_and_api/simulator_api.hpp"
 #include "xdyn/test_data_generator/hdb_data.hpp"
 #include "xdyn/test_data_generator/precal_test_data.hpp"
@@ -438,8 +439,8 @@ TEST_F(SimTest, DISABLED_LONG_bug_2732)
     command_listener.set<double>("Prop. & rudder(beta)", 0);
     auto sys = get_system(yaml,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(0, 0.1, 0.4);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
-    ASSERT_NO_THROW(ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer));
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    ASSERT_NO_THROW(run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer));
 }
 
 TEST_F(SimTest, LONG_bug_2838)
@@ -452,7 +453,7 @@ TEST_F(SimTest, LONG_bug_2838)
     command_listener.set<double>("PropRudd(beta)", 0);
     auto sys = get_system(yaml,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(0, 0.4, 0.1);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     const auto m = get_map(observer);
     ASSERT_EQ(2, m.size());
     const auto it = m.find("Mz(PropRudd,TestShip,TestShip)");
@@ -471,7 +472,7 @@ TEST_F(SimTest, LONG_bug_2845)
     command_listener.set<double>("PropRudd(beta)", 0.8);
     auto sys = get_system(yaml,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(0, 0.1, 0.1);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     const auto m = get_map(observer);
     ASSERT_EQ(10, m.size());
     const auto it_x = m.find("Mx(PropRudd,TestShip,TestShip)"); ASSERT_NE(m.end(), it_x); ASSERT_EQ(2, it_x->second.size());
@@ -504,7 +505,7 @@ TEST_F(SimTest, LONG_can_retrieve_maneuvering_force)
     command_listener.set<double>("PropRudd(beta)", 0.8);
     auto sys = get_system(yaml,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(0, 0.4, 0.1);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     const auto m = get_map(observer);
     ASSERT_EQ(10, m.size());
     const auto it = m.find("Fx(Fman,TestShip,TestShip)");
@@ -523,7 +524,7 @@ TEST_F(SimTest, LONG_can_use_commands_in_maneuvering_model)
     command_listener.set<double>("PropRudd(beta)", 0.8);
     auto sys = get_system(yaml,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(0, 0.4, 0.1);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     command_listener.check_out();
     const auto m = get_map(observer);
     ASSERT_EQ(4, m.size());
@@ -710,7 +711,7 @@ TEST_F(SimTest, bug_2984)
 
     auto sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(0, 0.1, 0.1);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     const auto m = get_map(observer);
     ASSERT_EQ(6, m.size());
     const auto Fx = m.find("Fx(propeller,ship,ship)");
@@ -748,7 +749,7 @@ TEST_F(SimTest, bug_3217_hdb_interpolation_in_direction_incorrect_LONG)
     // Results for 0.001 deg
     auto sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     auto m = get_map(observers);
     ASSERT_EQ(6, m.size());
     ASSERT_EQ(2, m["Fx(diffraction,TestShip,TestShip)"].size());
@@ -763,7 +764,7 @@ TEST_F(SimTest, bug_3217_hdb_interpolation_in_direction_incorrect_LONG)
     boost::replace_all(input.environment.at(0).yaml, "value: 0.001", "value: 0");
     sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler2(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler2, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler2, observers);
     m = get_map(observers);
 
     ASSERT_EQ(6, m.size());
@@ -780,7 +781,7 @@ TEST_F(SimTest, bug_3217_hdb_interpolation_in_direction_incorrect_LONG)
     boost::replace_all(input.environment.at(0).yaml, "value: 0.001", "value: 30");
     sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler3(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler3, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler3, observers);
     m = get_map(observers);
     ASSERT_EQ(6, m.size());
     ASSERT_EQ(6, m["Fx(diffraction,TestShip,TestShip)"].size());
@@ -822,7 +823,7 @@ TEST_F(SimTest, bug_3227_wave_angle_mirroing_problem_for_diffraction_LONG)
     // Results for 30 deg
     auto sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     auto m = get_map(observers);
     ASSERT_EQ(6, m.size());
     ASSERT_EQ(2, m["Fx(diffraction,TestShip,TestShip)"].size());
@@ -837,7 +838,7 @@ TEST_F(SimTest, bug_3227_wave_angle_mirroing_problem_for_diffraction_LONG)
     boost::replace_all(input.environment.at(0).yaml, "value: 30", "value: -30");
     sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler2(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler2, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler2, observers);
     m = get_map(observers);
 
     ASSERT_EQ(6, m.size());
@@ -878,7 +879,7 @@ TEST_F(SimTest, bug_3230_advance_speed_not_taken_into_account_properly_for_diffr
 
     auto sys = get_system(input,test_ship_stl,0,command_listener);
     ssc::solver::Scheduler scheduler(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     auto m = get_map(observers);
     ASSERT_EQ(6, m.size());
     ASSERT_EQ(2, m["Fx(diffraction,ship,ship)"].size());
@@ -909,7 +910,7 @@ TEST_F(SimTest, bug_3241_blocked_dof_interpolation_problem_LONG)
 
     auto sys = get_system(input,test_ship_stl,0);
     ssc::solver::Scheduler scheduler(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
     auto m = get_map(observers);
     ASSERT_EQ(1, m.size());
     ASSERT_EQ(151, m["u(dtmb)"].size());
@@ -931,7 +932,7 @@ TEST_F(SimTest, issue_20_constant_force)
 
     auto sys = get_system(input,test_ship_stl,0);
     ssc::solver::Scheduler scheduler(t0, T, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observers);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observers);
 }
 
 TEST_F(SimTest, bug_3187)
@@ -973,7 +974,7 @@ TEST_F(SimTest, bug_3185_all_data_should_be_there)
     const auto input = SimulatorYamlParser(yaml).parse();
     auto sys = get_system(input,0);
     ssc::solver::Scheduler scheduler(0, 0.1, 0.1);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     const auto m = get_map(observer);
     ASSERT_EQ(13, m.size());
     ASSERT_NE(m.end(), m.find("t"));
@@ -999,7 +1000,7 @@ TEST_F(SimTest, bug_3185_check_values)
     const auto input = SimulatorYamlParser(yaml).parse();
     auto sys = get_system(input,0);
     ssc::solver::Scheduler scheduler(0, 0.1, 0.2);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     auto m = get_map(observer);
 
     const auto Fx_prop = m["Fx(portside propeller,dtmb,portside propeller)"];
@@ -1166,4 +1167,89 @@ TEST_F(SimTest, should_throw_if_a_controller_has_an_unknown_type)
                                                    + test_data::controllers()
                                                    + test_data::unknown_controller(), scheduler)
                                                    , InvalidInputException);
-}
\ No newline at end of file
+}
+TEST_F(SimTest, bodies_evaluated_concurrently_should_give_exactly_the_same_results_as_serial_evaluation)
+{
+    const auto input = SimulatorYamlParser(test_data::three_cubes_in_waves()).parse();
+    std::map<std::string, VectorOfVectorOfPoints> meshes;
+    for (const auto& body:input.bodies)
+    {
+        meshes[body.name] = read_stl(test_data::cube());
+    }
+    Sim serial = get_system(input, meshes, 0);
+    Sim parallel = get_system(input, meshes, 0);
+    ASSERT_EQ(1, serial.get_number_of_threads());
+    parallel.set_number_of_threads(3);
+    ASSERT_EQ(3, parallel.get_number_of_threads());
+    ssc::solver::Scheduler scheduler_serial(0, 2, 0.1);
+    ssc::solver::Scheduler scheduler_parallel(0, 2, 0.1);
+    const auto res_serial = simulate<ssc::solver::RK4Stepper>(serial, input, scheduler_serial);
+    const auto res_parallel = simulate<ssc::solver::RK4Stepper>(parallel, input, scheduler_parallel);
+    ASSERT_EQ(21, res_serial.size());
+    ASSERT_EQ(res_serial.size(), res_parallel.size());
+    for (size_t i = 0 ; i < res_serial.size() ; ++i)
+    {
+        ASSERT_EQ(3*13, res_serial[i].x.size());
+        ASSERT_EQ(res_serial[i].t, res_parallel[i].t);
+        for (size_t j = 0 ; j < res_serial[i].x.size() ; ++j)
+        {
+            // Exact comparison: the order in which the bodies are evaluated should not change anything
+            ASSERT_EQ(res_serial[i].x[j], res_parallel[i].x[j]) << "i = " << i << ", j = " << j;
+        }
+    }
+    // The cubes are not in the same position, so they should not have the same states
+    ASSERT_NE(res_serial.back().x[ZIDX(0)], res_serial.back().x[ZIDX(1)]);
+}
+
+template <typename StepperType> void check_history_only_contains_the_accepted_states(const double dt);
+template <typename StepperType> void check_history_only_contains_the_accepted_states(const double dt)
+{
+    //! [SimTest accepted states example]
+    Sim sys = get_system(test_data::falling_ball_example(), 0);
+    ssc::solver::Scheduler scheduler(0, 3*dt, dt);
+    SimObserver observer;
+    run_solver<StepperType>(sys, scheduler, observer);
+    //! [SimTest accepted states example]
+    const auto res = observer.get();
+    ASSERT_EQ(4, res.size());
+    const auto& states = sys.get_bodies().front()->get_states();
+    // The last stage of the last step (eg. at t = 2.875 for RKCK) should not be left in history
+    for (const History* h:{&states.x, &states.z, &states.w})
+    {
+        ASSERT_FALSE(h->has_tentative_value());
+        ASSERT_DOUBLE_EQ(3*dt, h->get_current_time());
+    }
+    // The newest point in history should be the state accepted by the solver (ie. the one seen by the observers)
+    ASSERT_DOUBLE_EQ(res.back().x[XIDX(0)], states.x());
+    ASSERT_DOUBLE_EQ(res.back().x[ZIDX(0)], states.z());
+    ASSERT_DOUBLE_EQ(res.back().x[WIDX(0)], states.w());
+    // Falling ball: w = g*t
+    ASSERT_NEAR(9.81*3*dt, states.w(), EPS);
+}
+
+TEST_F(SimTest, history_should_only_contain_the_states_accepted_by_a_RK4_stepper)
+{
+    check_history_only_contains_the_accepted_states<ssc::solver::RK4Stepper>(1);
+}
+
+TEST_F(SimTest, history_should_only_contain_the_states_accepted_by_a_RKCK_stepper)
+{
+    check_history_only_contains_the_accepted_states<ssc::solver::RKCK>(1);
+}
+
+TEST_F(SimTest, the_states_of_the_stages_should_not_be_recorded_in_history)
+{
+    Sim sys = get_system(test_data::falling_ball_example(), 0);
+    StateType dx_dt(13, 0);
+    StateType stage = sys.state;
+    stage[ZIDX(0)] += 1;
+    sys.dx_dt(stage, dx_dt, 0.5);
+    const auto& states = sys.get_bodies().front()->get_states();
+    ASSERT_TRUE(states.z.has_tentative_value());
+    ASSERT_DOUBLE_EQ(0.5, states.z.get_current_time());
+    sys.state = stage;
+    sys.state[ZIDX(0)] += 1;
+    sys.accept_states(0.5);
+    ASSERT_FALSE(states.z.has_tentative_value());
+    ASSERT_DOUBLE_EQ(sys.state[ZIDX(0)], states.z());
+}
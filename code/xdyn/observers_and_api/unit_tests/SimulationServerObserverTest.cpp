@@ -22,7 +22,7 @@ TEST_F(SimulationServerObserverTest, requested_additional_variables_are_availabl
 
     SimulationServerObserver observer({"Fz(gravity,ball,ball)"});
     ssc::solver::Scheduler scheduler(0, tend, dt);
-    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer);
+    run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer);
     auto results = observer.get();
 
     for(const auto& res:results)
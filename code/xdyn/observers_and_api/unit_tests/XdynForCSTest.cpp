@@ -220,3 +220,88 @@ TEST_F(XdynForCSTest, sim_update)
     sim.set_bodystates(State(AbstractStates<double>(5.0, 200.0 ,300.0 ,1.0 ,0.0 ,0.0 ,0 ,0 ,0 ,1 ,0 ,0 ,0) ,0.0));
     ASSERT_EQ(sim.get_bodies().front()->get_states().x(), 5.0);
 }
+
+YamlSimServerInputs request_with_commands_and_delay(const std::vector<YamlState>& states);
+YamlSimServerInputs request_with_commands_and_delay(const std::vector<YamlState>& states)
+{
+    YamlSimServerInputs ret;
+    ret.Dt = 1;
+    ret.states = states;
+    ret.commands = {{"F1(command1)", 0.2}, {"F1(a)", 4.5}, {"F1(b)", 5.7}};
+    return ret;
+}
+
+void assert_same_states(const YamlState& expected, const YamlState& actual);
+void assert_same_states(const YamlState& expected, const YamlState& actual)
+{
+    ASSERT_NEAR(expected.t, actual.t, EPS);
+    ASSERT_NEAR(expected.x, actual.x, EPS);
+    ASSERT_NEAR(expected.y, actual.y, EPS);
+    ASSERT_NEAR(expected.z, actual.z, EPS);
+    ASSERT_NEAR(expected.u, actual.u, EPS);
+    ASSERT_NEAR(expected.v, actual.v, EPS);
+    ASSERT_NEAR(expected.w, actual.w, EPS);
+    ASSERT_NEAR(expected.p, actual.p, EPS);
+    ASSERT_NEAR(expected.q, actual.q, EPS);
+    ASSERT_NEAR(expected.r, actual.r, EPS);
+}
+
+TEST_F(XdynForCSTest, session_mode_gives_the_same_results_as_sending_the_whole_history)
+{
+//! [XdynForCSTest session_mode]
+    const std::string yaml = test_data::simserver_test_with_commands_and_delay(); // Forces depend on the states up to 10 s before
+    XdynForCS whole_history(yaml, "rk4", 0.25);
+    XdynForCS session(yaml, "rk4", 0.25);
+    session.set_session_mode(true);
+    std::vector<YamlState> history(1, YamlState(0, 4, 8, 12, 1, 0.1, 0.2, 0.01, 0.02, 0.03, 1, 0, 0, 0));
+    for (size_t i = 0 ; i < 5 ; ++i)
+    {
+        const std::vector<YamlState> expected = whole_history.handle(request_with_commands_and_delay(history));
+        // Only the latest state is sent: the server already knows the others
+        const std::vector<YamlState> actual = session.handle(request_with_commands_and_delay({history.back()}));
+//! [XdynForCSTest session_mode]
+        ASSERT_EQ(expected.size(), actual.size());
+        assert_same_states(expected.back(), actual.back());
+        history.insert(history.end(), expected.begin() + 1, expected.end());
+    }
+}
+
+TEST_F(XdynForCSTest, in_session_mode_the_state_sent_by_the_client_replaces_the_one_computed_by_the_server)
+{
+    const std::string yaml = test_data::simserver_test_with_commands_and_delay();
+    XdynForCS whole_history(yaml, "rk4", 0.25);
+    XdynForCS session(yaml, "rk4", 0.25);
+    session.set_session_mode(true);
+    std::vector<YamlState> history(1, YamlState(0, 4, 8, 12, 1, 0.1, 0.2, 0.01, 0.02, 0.03, 1, 0, 0, 0));
+    const std::vector<YamlState> first_step = whole_history.handle(request_with_commands_and_delay(history));
+    session.handle(request_with_commands_and_delay(history));
+    history.insert(history.end(), first_step.begin() + 1, first_step.end());
+    history.back().u += 0.5; // Eg. corrected by another solver in the co-simulation
+    assert_same_states(whole_history.handle(request_with_commands_and_delay(history)).back(),
+                       session.handle(request_with_commands_and_delay({history.back()})).back());
+}
+
+TEST_F(XdynForCSTest, in_session_mode_the_history_is_replaced_if_the_request_starts_before_the_latest_state)
+{
+    const std::string yaml = test_data::simserver_test_with_commands_and_delay();
+    XdynForCS session(yaml, "rk4", 0.25);
+    session.set_session_mode(true);
+    const YamlState s0(0, 4, 8, 12, 1, 0.1, 0.2, 0.01, 0.02, 0.03, 1, 0, 0, 0);
+    const std::vector<YamlState> first_step = session.handle(request_with_commands_and_delay({s0}));
+    session.handle(request_with_commands_and_delay({first_step.back()}));
+    // The client goes back to t = 0 (eg. it restarted): same results as the first time
+    assert_same_states(first_step.back(), session.handle(request_with_commands_and_delay({s0})).back());
+}
+
+TEST_F(XdynForCSTest, in_session_mode_the_history_is_replaced_if_the_request_asks_for_it)
+{
+    const std::string yaml = test_data::simserver_test_with_commands_and_delay();
+    XdynForCS whole_history(yaml, "rk4", 0.25);
+    XdynForCS session(yaml, "rk4", 0.25);
+    session.set_session_mode(true);
+    const std::vector<YamlState> first_step = session.handle(request_with_commands_and_delay({YamlState(0, 4, 8, 12, 1, 0.1, 0.2, 0.01, 0.02, 0.03, 1, 0, 0, 0)}));
+    YamlSimServerInputs reset = request_with_commands_and_delay({first_step.back()});
+    reset.reset = true;
+    // Same as a server without sessions, which only knows the states in the request
+    assert_same_states(whole_history.handle(request_with_commands_and_delay({first_step.back()})).back(), session.handle(reset).back());
+}
@@ -205,3 +205,33 @@ TEST_F(XdynForMETest, extra_observations_response_is_in_sync_with_request)
     ASSERT_NE(d_dt_0.extra_observations.at("Fx(F1,ball,ball)"), d_dt_2.extra_observations.at("Fx(F1,ball,ball)"));
     ASSERT_NE(d_dt_0.extra_observations.at("My(F1,ball,ball)"), d_dt_2.extra_observations.at("My(F1,ball,ball)"));
 }
+
+TEST_F(XdynForMETest, session_mode_gives_the_same_results_as_sending_the_whole_history)
+{
+    const std::string yaml = test_data::simserver_test_with_commands_and_delay(); // Forces depend on the states up to 10 s before
+    XdynForME whole_history(yaml);
+    XdynForME session(yaml);
+    session.set_session_mode(true);
+    std::vector<YamlState> history;
+    YamlSimServerInputs request;
+    request.commands = {{"F1(command1)", 20}, {"F1(a)", 4.5}, {"F1(b)", 5.7}};
+    for (size_t i = 0 ; i < 12 ; ++i)
+    {
+        const double t = (double)i;
+        const YamlState accepted(t, 4+t, 8-t, 12+0.1*t, 1+0.1*t, 0.01*t, 0.02*t, 0.03*t, 0.1*t, 0, 1, 0, 0, 0);
+        const YamlState stage(t+0.5, 4.5+t, 7.5-t, 12+0.1*t, 1.05+0.1*t, 0.01*t, 0.02*t, 0.03*t, 0.1*t, 0, 1, 0, 0, 0);
+        history.push_back(accepted);
+        // Derivatives at an intermediate stage of the client's solver step
+        request.states = history;
+        request.states.push_back(stage);
+        const YamlState expected = whole_history.handle(request);
+        // Only the new accepted state & the stage are sent
+        request.states = {accepted, stage};
+        const YamlState actual = session.handle(request);
+        ASSERT_NEAR(expected.u, actual.u, EPS) << "t = " << t;
+        ASSERT_NEAR(expected.v, actual.v, EPS) << "t = " << t;
+        ASSERT_NEAR(expected.w, actual.w, EPS) << "t = " << t;
+        ASSERT_NEAR(expected.p, actual.p, EPS) << "t = " << t;
+        ASSERT_NEAR(expected.q, actual.q, EPS) << "t = " << t;
+    }
+}
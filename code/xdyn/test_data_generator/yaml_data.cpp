@@ -1466,6 +1466,63 @@ std::string test_data::cube_in_waves()
         return ss.str();
 }
 
+std::string test_data::three_cubes_in_waves()
+{
+    std::stringstream ss;
+    ss << rotation_convention()
+       << "\n"
+       << "environmental constants:\n"
+       << "    g: {value: 9.81, unit: m/s^2}\n"
+       << "    rho: {value: 1026, unit: kg/m^3}\n"
+       << "    nu: {value: 1.18e-6, unit: m^2/s}\n"
+       << "environment models:\n"
+       << "  - model: waves\n"
+       << "    discretization:\n"
+       << "       n: 64\n"
+       << "       omega min: {value: 0.1, unit: rad/s}\n"
+       << "       omega max: {value: 6, unit: rad/s}\n"
+       << "       energy fraction: 0.999\n"
+       << "    spectra:\n"
+       << "      - model: airy\n"
+       << "        depth: {value: 100, unit: m}\n"
+       << "        seed of the random data generator: 0\n"
+       << "        stretching:\n"
+       << "          delta: 1\n"
+       << "          h: {unit: m, value: 0}\n"
+       << "        directional spreading:\n"
+       << "           type: cos2s\n"
+       << "           s: 2\n"
+       << "           waves propagating to: {value: 30, unit: deg}\n"
+       << "        spectral density:\n"
+       << "           type: jonswap\n"
+       << "           Hs: {value: 2, unit: m}\n"
+       << "           Tp: {value: 5, unit: s}\n"
+       << "           gamma: 1.2\n"
+       << "\n"
+       << "bodies: # All bodies have NED as parent frame\n";
+    for (size_t i = 0 ; i < 3 ; ++i)
+    {
+        const std::string name = "cube" + std::to_string(i);
+        ss << "  - name: " << name << "\n"
+           << "    mesh: cube.stl\n"
+           << position_relative_to_mesh(0, 0, 0.5, 0, 0, 0)
+           << initial_position_of_body_frame(5*(double)i, 2*(double)i, 0.4, 0, 0.1*(double)i, 0)
+           << initial_velocity(name, 0, 0, 0, 0, 0, 0)
+           << "    dynamics:\n"
+           << "        hydrodynamic forces calculation point in body frame:\n"
+           << "            x: {value: 0, unit: m}\n"
+           << "            y: {value: 0, unit: m}\n"
+           << "            z: {value: 0.5, unit: m}\n"
+           << centre_of_inertia(name, 0, 0, 0.5)
+           << one_ton_rigid_inertia_matrix()
+           << no_added_mass()
+           << "    external forces:\n"
+           << "      - model: gravity\n"
+           << "      - model: non-linear hydrostatic (fast)\n";
+    }
+    return ss.str();
+}
+
 std::string test_data::test_ship_froude_krylov()
 {
     std::stringstream ss;
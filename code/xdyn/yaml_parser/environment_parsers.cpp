@@ -495,6 +495,26 @@ boost::optional<int> parse_seed_of_random_number_generator(const std::string& ya
     return ret;
 }
 
+bool parse_phasor_cache(const std::string& yaml)
+{
+    bool ret = false;
+    try
+    {
+        std::stringstream stream(yaml);
+        YAML::Parser parser(stream);
+        YAML::Node node;
+        parser.GetNextDocument(node);
+        try_to_parse(node, "phasor cache", ret);
+    }
+    catch(std::exception& e)
+    {
+        std::stringstream ss;
+        ss << "Error parsing Airy wave model parameters ('wave' section in the YAML file): " << e.what();
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, ss.str());
+    }
+    return ret;
+}
+
 enum Comparison {LT,LE,GT,GE,EQ,NE};
 
 template <typename T> bool comparator(const Comparison c, const T& left, const T& right)
@@ -25,6 +25,7 @@ YamlPiersonMoskowitz  parse_pierson_moskowitz(const std::string& yaml);
 YamlBretschneider     parse_bretschneider(const std::string& yaml);
 YamlCos2s             parse_cos2s(const std::string& yaml);
 boost::optional<int>  parse_seed_of_random_number_generator(const std::string& yaml);
+bool                  parse_phasor_cache(const std::string& yaml);
 YamlGRPC              parse_grpc(const std::string& yaml);
 
 #endif  /* ENVIRONMENT_PARSERS_HPP_ */
@@ -117,6 +117,10 @@ void operator >> (const YAML::Node& node, YamlBody& b)
         {
             node["filtered states"] >> b.filtered_states;
         }
+        if (node.FindValue("mesh simplification"))
+        {
+            node["mesh simplification"] >> b.mesh_simplification;
+        }
     }
     catch (const InvalidInputException& e)
     {
@@ -125,6 +129,17 @@ void operator >> (const YAML::Node& node, YamlBody& b)
     try_to_parse(node, "blocked dof", b.blocked_dof);
 }
 
+void operator >> (const YAML::Node& node, YamlMeshSimplification& m)
+{
+    m.simplify = true;
+    node["edges per wavelength"] >> m.edges_per_wavelength;
+    ssc::yaml_parser::parse_uv(node["waterplane z in mesh frame"], m.z_of_waterplane);
+    if (m.edges_per_wavelength <= 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In section 'mesh simplification', 'edges per wavelength' should be strictly positive, but got " << m.edges_per_wavelength);
+    }
+}
+
 void operator >> (const YAML::Node& node, YamlModel& m)
 {
     node["model"] >> m.model;
@@ -11,6 +11,18 @@
 #include "yaml.h"
 #include <boost/algorithm/string/predicate.hpp>
 
+size_t parse_number_of_time_steps(const YAML::Node& node, const std::string& key, const std::string& filename);
+size_t parse_number_of_time_steps(const YAML::Node& node, const std::string& key, const std::string& filename)
+{
+    long n = 0;
+    node >> n;
+    if (n < 1)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section, '" << key << "' should be a number of time steps greater than or equal to 1 (got " << n << " for '" << filename << "')");
+    }
+    return (size_t)n;
+}
+
 void operator >> (const YAML::Node& node, YamlOutput& f);
 void operator >> (const YAML::Node& node, YamlOutput& f)
 {
@@ -32,6 +44,44 @@ void operator >> (const YAML::Node& node, YamlOutput& f)
     {
         node["full output"] >> f.full_output;
     }
+    if (const YAML::Node *pBufferSize = node.FindValue("buffer size"))
+    {
+        f.buffer_size = parse_number_of_time_steps(*pBufferSize, "buffer size", f.filename);
+    }
+    if (const YAML::Node *pChunkSize = node.FindValue("chunk size"))
+    {
+        f.chunk_size = parse_number_of_time_steps(*pChunkSize, "chunk size", f.filename);
+    }
+    if (const YAML::Node *pCompression = node.FindValue("compression level"))
+    {
+        int compression_level = 0;
+        *pCompression >> compression_level;
+        if ((compression_level < 0) or (compression_level > 9))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section, 'compression level' should be between 0 (no compression) and 9 (got " << compression_level << " for '" << f.filename << "')");
+        }
+        f.compression_level = (unsigned int)compression_level;
+    }
+    if (const YAML::Node *pAsynchronous = node.FindValue("asynchronous"))
+    {
+        *pAsynchronous >> f.asynchronous;
+    }
+    if (const YAML::Node *pQueueSize = node.FindValue("queue size"))
+    {
+        f.queue_size = parse_number_of_time_steps(*pQueueSize, "queue size", f.filename);
+    }
+    if (const YAML::Node *pBackpressure = node.FindValue("backpressure"))
+    {
+        *pBackpressure >> f.backpressure;
+        if ((f.backpressure != "block") and (f.backpressure != "drop oldest") and (f.backpressure != "decimate"))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section, 'backpressure' should be 'block', 'drop oldest' or 'decimate' (got '" << f.backpressure << "' for '" << f.filename << "')");
+        }
+    }
+    if (const YAML::Node *pDecimation = node.FindValue("decimation"))
+    {
+        f.decimation = parse_number_of_time_steps(*pDecimation, "decimation", f.filename);
+    }
 }
 
 std::vector<YamlOutput> parse_output(const std::string& yaml)
@@ -45,6 +95,10 @@ std::vector<YamlOutput> parse_output(const std::string& yaml)
     {
         node["output"] >> ret;
     }
+    catch(const InvalidInputException& ) // The 'output' section exists but is invalid
+    {
+        throw;
+    }
     catch(std::exception& ) // Nothing to do: 'output' section is not mandatory
     {
     }
@@ -255,6 +255,36 @@ TEST_F(SimulatorYamlParserTest, should_get_an_error_message_when_using_the_old_k
     }
 }
 
+TEST_F(SimulatorYamlParserTest, mesh_simplification_is_disabled_by_default)
+{
+    ASSERT_FALSE(yaml.bodies.front().mesh_simplification.simplify);
+}
+
+TEST_F(SimulatorYamlParserTest, can_parse_mesh_simplification)
+{
+    std::string yaml_data = test_data::full_example_with_propulsion();
+    boost::replace_all(yaml_data, "    mesh: test_ship.stl\n",
+                                  "    mesh: test_ship.stl\n"
+                                  "    mesh simplification:\n"
+                                  "        edges per wavelength: 8\n"
+                                  "        waterplane z in mesh frame: {value: 0.5, unit: m}\n");
+    const YamlSimulatorInput input = SimulatorYamlParser(yaml_data).parse();
+    ASSERT_TRUE(input.bodies.front().mesh_simplification.simplify);
+    ASSERT_DOUBLE_EQ(8, input.bodies.front().mesh_simplification.edges_per_wavelength);
+    ASSERT_DOUBLE_EQ(0.5, input.bodies.front().mesh_simplification.z_of_waterplane);
+}
+
+TEST_F(SimulatorYamlParserTest, number_of_edges_per_wavelength_should_be_positive)
+{
+    std::string yaml_data = test_data::full_example_with_propulsion();
+    boost::replace_all(yaml_data, "    mesh: test_ship.stl\n",
+                                  "    mesh: test_ship.stl\n"
+                                  "    mesh simplification:\n"
+                                  "        edges per wavelength: 0\n"
+                                  "        waterplane z in mesh frame: {value: 0.5, unit: m}\n");
+    ASSERT_THROW(SimulatorYamlParser(yaml_data).parse(), InvalidInputException);
+}
+
 TEST_F(SimulatorYamlParserTest, can_parse_added_mass_matrix_from_precal_file)
 {
     const std::string filename = "ONRT_SIMMAN.raodb.ini";
@@ -176,6 +176,13 @@ TEST_F(environment_parsersTest, can_force_seed_to_zero)
     ASSERT_FALSE(seed);
 }
 
+TEST_F(environment_parsersTest, phasor_cache_is_optional_and_disabled_by_default)
+{
+    ASSERT_FALSE(parse_phasor_cache("seed of the random data generator: 1234\n"));
+    ASSERT_FALSE(parse_phasor_cache("phasor cache: false\n"));
+    ASSERT_TRUE(parse_phasor_cache("seed of the random data generator: 1234\nphasor cache: true\n"));
+}
+
 TEST_F(environment_parsersTest, can_parse_depth_for_wave_models)
 {
     ASSERT_EQ(0,yaml.spectra_from_rays.size());
@@ -9,6 +9,7 @@
 #include "parse_outputTest.hpp"
 #include "xdyn/yaml_parser/parse_output.hpp"
 #include "xdyn/test_data_generator/yaml_data.hpp"
+#include "xdyn/exceptions/InvalidInputException.hpp"
 
 parse_outputTest::parse_outputTest() : a(ssc::random_data_generator::DataGenerator(215451))
 {
@@ -88,3 +89,61 @@ TEST_F(parse_outputTest, format_is_CSV_if_extension_is_csv)
     ASSERT_EQ("blabla.csv", res.filename);
     ASSERT_EQ("csv", res.format);
 }
+
+TEST_F(parse_outputTest, can_parse_hdf5_buffering_and_compression)
+{
+    const std::string yaml = "output:\n"
+                             "   - format: hdf5\n"
+                             "     filename: out.h5\n"
+                             "     data: [t]\n"
+                             "     buffer size: 1000\n"
+                             "     chunk size: 500\n"
+                             "     compression level: 4\n"
+                             "   - format: hdf5\n"
+                             "     filename: out2.h5\n"
+                             "     data: [t]\n";
+    const auto res = parse_output(yaml);
+    ASSERT_EQ(2, res.size());
+    ASSERT_EQ(1000, res.at(0).buffer_size);
+    ASSERT_EQ(500, res.at(0).chunk_size);
+    ASSERT_EQ(4, res.at(0).compression_level);
+    ASSERT_EQ(1, res.at(1).buffer_size);
+    ASSERT_EQ(0, res.at(1).chunk_size);
+    ASSERT_EQ(0, res.at(1).compression_level);
+}
+
+TEST_F(parse_outputTest, should_throw_if_hdf5_buffering_is_invalid)
+{
+    const std::string yaml = "output:\n"
+                             "   - format: hdf5\n"
+                             "     filename: out.h5\n"
+                             "     data: [t]\n";
+    ASSERT_THROW(parse_output(yaml + "     buffer size: 0\n"), InvalidInputException);
+    ASSERT_THROW(parse_output(yaml + "     chunk size: -3\n"), InvalidInputException);
+    ASSERT_THROW(parse_output(yaml + "     compression level: 10\n"), InvalidInputException);
+    ASSERT_NO_THROW(parse_output(yaml + "     compression level: 9\n"));
+}
+
+TEST_F(parse_outputTest, can_parse_asynchronous_outputs)
+{
+    const std::string yaml = "output:\n"
+                             "   - format: csv\n"
+                             "     filename: out.csv\n"
+                             "     data: [t]\n"
+                             "     asynchronous: true\n"
+                             "     queue size: 64\n"
+                             "     backpressure: decimate\n"
+                             "     decimation: 5\n"
+                             "   - format: csv\n"
+                             "     filename: out2.csv\n"
+                             "     data: [t]\n";
+    const auto res = parse_output(yaml);
+    ASSERT_EQ(2, res.size());
+    ASSERT_TRUE(res.at(0).asynchronous);
+    ASSERT_EQ(64, res.at(0).queue_size);
+    ASSERT_EQ("decimate", res.at(0).backpressure);
+    ASSERT_EQ(5, res.at(0).decimation);
+    ASSERT_FALSE(res.at(1).asynchronous);
+    ASSERT_EQ("block", res.at(1).backpressure);
+    ASSERT_THROW(parse_output(yaml + "     backpressure: drop newest\n"), InvalidInputException);
+}
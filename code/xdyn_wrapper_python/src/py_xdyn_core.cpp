@@ -220,6 +220,9 @@ void py_add_module_xdyn_core_io(py::module& m)
         .def_readwrite("calculation_point_in_body_frame", &YamlRadiationDamping::calculation_point_in_body_frame)
         .def_readwrite("remove_constant_speed", &YamlRadiationDamping::remove_constant_speed)
         .def_readwrite("forward_speed_correction", &YamlRadiationDamping::forward_speed_correction)
+        .def_readwrite("use_state_space_approximation", &YamlRadiationDamping::use_state_space_approximation)
+        .def_readwrite("max_nb_of_exponentials", &YamlRadiationDamping::max_nb_of_exponentials)
+        .def_readwrite("output_state_space_fidelity", &YamlRadiationDamping::output_state_space_fidelity)
         ;
 }
 
@@ -24,19 +24,19 @@ void solve(const std::string& solver_name, Sim& sys, ssc::solver::Scheduler& sch
 {
     if (solver_name=="euler")
     {
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
     }
     else if (solver_name=="rk4")
     {
-        ssc::solver::quicksolve<ssc::solver::RK4Stepper>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::RK4Stepper>(sys, scheduler, observer, controllers);
     }
     else if (solver_name=="rkck")
     {
-        ssc::solver::quicksolve<ssc::solver::RKCK>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::RKCK>(sys, scheduler, observer, controllers);
     }
     else
     {
-        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
+        run_solver<ssc::solver::EulerStepper>(sys, scheduler, observer, controllers);
     }
 }
 